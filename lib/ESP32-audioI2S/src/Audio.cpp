@@ -206,7 +206,7 @@ Audio::Audio(bool internalDAC /* = false */, uint8_t channelEnabled /* = I2S_DAC
                 m_i2s_config.communication_format = (i2s_comm_format_t)(I2S_COMM_FORMAT_I2S_MSB);
             #endif
 
-            i2s_driver_install((i2s_port_t)m_i2s_num, &m_i2s_config, 0, NULL);
+            i2s_driver_install((i2s_port_t)m_i2s_num, &m_i2s_config, 16, &m_i2sEventQueue);
             i2s_set_dac_mode((i2s_dac_mode_t)m_f_channelEnabled);
             if(m_f_channelEnabled != I2S_DAC_CHANNEL_BOTH_EN) {
                 m_f_forceMono = true;
@@ -224,7 +224,7 @@ Audio::Audio(bool internalDAC /* = false */, uint8_t channelEnabled /* = I2S_DAC
             m_i2s_config.communication_format = (i2s_comm_format_t)(I2S_COMM_FORMAT_I2S | I2S_COMM_FORMAT_I2S_MSB);
         #endif
 
-        i2s_driver_install((i2s_port_t)m_i2s_num, &m_i2s_config, 0, NULL);
+        i2s_driver_install((i2s_port_t)m_i2s_num, &m_i2s_config, 16, &m_i2sEventQueue);
         m_f_forceMono = false;
     }
 
@@ -2899,9 +2899,9 @@ void Audio::processLocalFile() {
         return;
     }
 
-    availableBytes = 16 * 1024; // set some large value
+    availableBytes = m_fileReadChunk;
 
-    //availableBytes = min(availableBytes, InBuff.writeSpace());
+    availableBytes = min(availableBytes, (uint32_t)InBuff.writeSpace());
     availableBytes = min(availableBytes, audiofile.size() - byteCounter);
     if(m_contentlength){
         if(m_contentlength > getFilePos()) availableBytes = min(availableBytes, m_contentlength - getFilePos());
@@ -2963,7 +2963,8 @@ void Audio::processLocalFile() {
         if(InBuff.bufferFilled()){
             if(!readID3V1Tag()){
                 int bytesDecoded = sendBytes(InBuff.getReadPtr(), InBuff.bufferFilled());
-                if(bytesDecoded > 2){InBuff.bytesWasRead(bytesDecoded); return;}
+                // 0: FLAC hands a decoded block out over several calls
+                if(bytesDecoded > 2 || bytesDecoded == 0){InBuff.bytesWasRead(bytesDecoded); return;}
             }
         }
         playI2Sremains();
@@ -3168,7 +3169,8 @@ void Audio::processWebFile() {
         if(InBuff.bufferFilled()){
             if(!readID3V1Tag()){
                 int bytesDecoded = sendBytes(InBuff.getReadPtr(), InBuff.bufferFilled());
-                if(bytesDecoded > 2){InBuff.bytesWasRead(bytesDecoded); return;}
+                // 0: FLAC hands a decoded block out over several calls
+                if(bytesDecoded > 2 || bytesDecoded == 0){InBuff.bytesWasRead(bytesDecoded); return;}
             }
         }
         playI2Sremains();
@@ -4487,7 +4489,21 @@ void Audio::setI2SCommFMT_LSB(bool commFMT) {
     }
     AUDIO_INFO("commFMT = %i", m_i2s_config.communication_format);
     i2s_driver_uninstall((i2s_port_t)m_i2s_num);
-    i2s_driver_install  ((i2s_port_t)m_i2s_num, &m_i2s_config, 0, NULL);
+    i2s_driver_install  ((i2s_port_t)m_i2s_num, &m_i2s_config, 16, &m_i2sEventQueue);
+}
+//---------------------------------------------------------------------------------------------------------------------
+size_t Audio::writePCM(const int16_t* samples, size_t frames, uint8_t channels, uint32_t sampleRate) {
+    if(getSampleRate() != sampleRate) setSampleRate(sampleRate);
+    setBitsPerSample(16);
+    int16_t sample[2];
+    size_t written = 0;
+    while(written < frames) {
+        sample[LEFTCHANNEL]  = samples[written * channels];
+        sample[RIGHTCHANNEL] = samples[written * channels + (channels > 1 ? 1 : 0)];
+        if(!playSample(sample)) break;
+        written++;
+    }
+    return written;
 }
 //---------------------------------------------------------------------------------------------------------------------
 bool Audio::playSample(int16_t sample[2]) {
@@ -4497,6 +4513,8 @@ bool Audio::playSample(int16_t sample[2]) {
         sample[RIGHTCHANNEL] = ((sample[RIGHTCHANNEL] & 0xff) -128) << 8;
     }
 
+    if(audio_mix_sample) audio_mix_sample(sample);
+
     sample[LEFTCHANNEL]  = sample[LEFTCHANNEL]  >> 1; // half Vin so we can boost up to 6dB in filters
     sample[RIGHTCHANNEL] = sample[RIGHTCHANNEL] >> 1;
 
@@ -4524,12 +4542,15 @@ bool Audio::playSample(int16_t sample[2]) {
     esp_err_t err = i2s_write((i2s_port_t) m_i2s_num, (const char*) &s32, sizeof(uint32_t), &m_i2s_bytesWritten, 100);
     if(err != ESP_OK) {
         log_e("ESP32 Errorcode %i", err);
+        m_i2sWriteFails++;
         return false;
     }
     if(m_i2s_bytesWritten < 4) {
         log_e("Can't stuff any more in I2S..."); // increase waitingtime or outputbuffer
+        m_i2sWriteFails++;
         return false;
     }
+    m_i2sFramesWritten++;
     return true;
 }
 //---------------------------------------------------------------------------------------------------------------------
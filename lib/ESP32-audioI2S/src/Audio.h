@@ -86,6 +86,7 @@ extern __attribute__((weak)) void audio_eof_speech(const char*);
 extern __attribute__((weak)) void audio_eof_stream(const char*); // The webstream comes to an end
 extern __attribute__((weak)) void audio_process_extern(int16_t* buff, uint16_t len, bool *continueI2S); // record audiodata or send via BT
 extern __attribute__((weak)) void audio_process_i2s(uint32_t* sample, bool *continueI2S); // record audiodata or send via BT
+extern __attribute__((weak)) void audio_mix_sample(int16_t* sample); // mix further sources into each L/R frame ahead of filters and volume
 
 #define AUDIO_INFO(...) {char buff[512 + 64]; snprintf(buff,sizeof(buff),__VA_ARGS__); if(audio_info) audio_info(buff);}
 
@@ -214,6 +215,18 @@ public:
     int getCodec() {return m_codec;}
     const char *getCodecname() {return codecname[m_codec];}
 
+    // Pump support: DMA geometry, TX event queue (I2S_EVENT_TX_DONE / TX_Q_OVF)
+    // and write accounting for callers that drive loop() from their own task.
+    QueueHandle_t getI2sEventQueue() {return m_i2sEventQueue;}
+    uint16_t getDmaFrameNum() {return m_i2s_config.dma_frame_num;}
+    uint16_t getDmaDescNum() {return m_i2s_config.dma_desc_num;}
+    uint32_t getI2sFramesWritten() {return m_i2sFramesWritten;}
+    uint32_t getI2sWriteFails() {return m_i2sWriteFails;}
+    void setFileReadChunk(uint32_t bytes) {m_fileReadChunk = bytes;}
+    // Play 16-bit PCM from memory through the volume/filter chain.  Returns the
+    // frames accepted; blocks in i2s_write() while the DMA ring is full.
+    size_t writePCM(const int16_t* samples, size_t frames, uint8_t channels, uint32_t sampleRate);
+
 private:
 
     #ifndef ESP_ARDUINO_VERSION_VAL
@@ -570,6 +583,10 @@ private:
     size_t          m_audioDataSize = 0;            //
     float           m_filterBuff[3][2][2][2];       // IIR filters memory for Audio DSP
     size_t          m_i2s_bytesWritten = 0;         // set in i2s_write() but not used
+    QueueHandle_t   m_i2sEventQueue = NULL;         // legacy driver TX events
+    uint32_t        m_i2sFramesWritten = 0;         // stereo frames accepted by i2s_write()
+    uint32_t        m_i2sWriteFails = 0;            // i2s_write() errors / timeouts
+    uint32_t        m_fileReadChunk = 16 * 1024;    // max bytes read from file per loop()
     size_t          m_file_size = 0;                // size of the file
     uint16_t        m_filterFrequency[2];
     int8_t          m_gain0 = 0;                    // cut or boost filters (EQ)
@@ -0,0 +1,259 @@
+"""
+Host tool — pack the EEZ-exported images and large fonts into an asset pack
+and regenerate the firmware-side stubs in src/asset_stubs/.
+
+The pack is flashed to the `assets` data partition (or copied to the SD card
+root as /assets.bin) and read at boot by AssetPack (src/asset_pack.cpp).
+Build the `waveshare_s3_146_assetpack` environment to link the stubs instead
+of the full image/font sources.
+
+Layout (little-endian, see src/asset_pack_format.h):
+    asset_pack_header_t
+    asset_pack_entry_t[count]      sorted by name
+    blobs                          4-byte aligned
+
+Image pixels are taken from the LV_COLOR_DEPTH 16 / LV_COLOR_16_SWAP 0 block
+of each generated C array and stored RLE-compressed when that saves at least
+1/8 of the size.  Font glyph bitmaps are stored raw so they can be used
+straight out of the memory-mapped partition.
+
+Usage:
+    python pack_assets.py [--out assets.bin] [--no-compress]
+    esptool.py write_flash 0x8f0000 assets.bin
+"""
+import argparse
+import os
+import re
+import struct
+
+PROJECT_DIR = os.path.dirname(os.path.abspath(__file__))
+IMAGES_DIR = os.path.join(PROJECT_DIR, "src", "src", "images")
+FONTS_DIR = os.path.join(PROJECT_DIR, "src", "src", "fonts")
+STUBS_DIR = os.path.join(PROJECT_DIR, "src", "asset_stubs")
+
+# Fonts large enough to be worth moving out of the app partition.
+PACKED_FONTS = [
+    "ui_font_monserrat_normal_60",
+    "ui_font_montserrat_light_80",
+    "ui_font_montserrat_regular_90",
+    "ui_font_montserrat_normal_100",
+]
+FONT_FALLBACK = "lv_font_montserrat_48"
+
+ASSET_PACK_MAGIC = 0x4B504157          # "WAPK"
+ASSET_PACK_VERSION = 1
+ASSET_NAME_LEN = 40
+
+ASSET_TYPE_IMAGE = 1
+ASSET_TYPE_FONT = 2
+ASSET_CODEC_RAW = 0
+ASSET_CODEC_RLE = 1
+
+# lv_img_cf_t values (LVGL 8)
+LV_IMG_CF = {
+    "LV_IMG_CF_TRUE_COLOR": 4,
+    "LV_IMG_CF_TRUE_COLOR_ALPHA": 5,
+    "LV_IMG_CF_TRUE_COLOR_CHROMA_KEYED": 6,
+}
+PX_SIZE = {4: 2, 5: 3, 6: 2}           # bytes per pixel at LV_COLOR_DEPTH 16
+
+HEADER_FMT = "<IHHI"                   # magic, version, count, totalSize
+ENTRY_FMT = "<%dsBBBBHHIII" % ASSET_NAME_LEN
+HEX_RE = re.compile(r"0x([0-9a-fA-F]{1,2})")
+
+GENERATED_BANNER = "/* Generated by pack_assets.py — do not edit. */\n"
+
+
+def parse_hex_block(lines):
+    data = bytearray()
+    for line in lines:
+        line = line.split("/*")[0]
+        data.extend(int(h, 16) for h in HEX_RE.findall(line))
+    return bytes(data)
+
+
+def parse_image(path):
+    with open(path, "r") as f:
+        text = f.read()
+
+    name = re.search(r"const lv_img_dsc_t (\w+) = \{", text).group(1)
+    cf_name = re.search(r"\.header\.cf = (\w+)", text).group(1)
+    w = int(re.search(r"\.header\.w = (\d+)", text).group(1))
+    h = int(re.search(r"\.header\.h = (\d+)", text).group(1))
+    if cf_name not in LV_IMG_CF:
+        raise SystemExit("%s: unsupported colour format %s" % (path, cf_name))
+    cf = LV_IMG_CF[cf_name]
+
+    block = []
+    inside = False
+    for line in text.splitlines():
+        if line.startswith("#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 0"):
+            inside = True
+            continue
+        if inside and line.startswith("#endif"):
+            break
+        if inside:
+            block.append(line)
+
+    pixels = parse_hex_block(block)
+    expected = w * h * PX_SIZE[cf]
+    if len(pixels) != expected:
+        raise SystemExit("%s: expected %d bytes, parsed %d" % (path, expected, len(pixels)))
+    return name, cf, w, h, pixels
+
+
+def rle_encode(data, unit):
+    """Control byte c: c & 0x80 -> repeat next unit (c & 0x7f) + 1 times,
+    otherwise (c + 1) literal units follow."""
+    units = [data[i:i + unit] for i in range(0, len(data), unit)]
+    out = bytearray()
+    literals = []
+
+    def flush_literals():
+        while literals:
+            chunk = literals[:128]
+            del literals[:128]
+            out.append(len(chunk) - 1)
+            for u in chunk:
+                out.extend(u)
+
+    i = 0
+    while i < len(units):
+        run = 1
+        while i + run < len(units) and run < 128 and units[i + run] == units[i]:
+            run += 1
+        if run >= 2:
+            flush_literals()
+            out.append(0x80 | (run - 1))
+            out.extend(units[i])
+            i += run
+        else:
+            literals.append(units[i])
+            i += 1
+    flush_literals()
+    return bytes(out)
+
+
+def parse_font(name):
+    path = os.path.join(FONTS_DIR, name + ".c")
+    with open(path, "r") as f:
+        text = f.read()
+
+    start = text.index("/*Store the image of the glyphs*/")
+    end = text.index("};", start) + 2
+    array_lines = text[start:end].splitlines()[2:]    # skip comment + declaration
+    bitmap = parse_hex_block(array_lines)
+
+    if "FORMAT0_TINY" not in text or "unicode_list = NULL" not in text:
+        raise SystemExit("%s: only FORMAT0_TINY cmaps are supported" % path)
+
+    stub = text[:start] + text[end:]
+    stub = stub.replace(".glyph_bitmap = glyph_bitmap,",
+                        ".glyph_bitmap = NULL,        /*Bound by AssetPack::begin()*/")
+    stub = re.sub(r"#if LVGL_VERSION_MAJOR >= 8\nstatic const lv_font_fmt_txt_dsc_t font_dsc = \{\n"
+                  r"#else\nstatic lv_font_fmt_txt_dsc_t font_dsc = \{\n#endif\n",
+                  "lv_font_fmt_txt_dsc_t %s_dsc = {\n" % name, stub)
+    stub = stub.replace(".dsc = &font_dsc,", ".dsc = &%s_dsc," % name)
+    stub = stub.replace(".get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,",
+                        ".get_glyph_dsc = AssetPack_FontGetGlyphDsc,")
+    stub = stub.replace(".fallback = NULL,", ".fallback = &%s," % FONT_FALLBACK)
+    stub = stub.replace('#include "lvgl.h"\n#else\n    #include "lvgl.h"\n#endif\n',
+                        '#include "lvgl.h"\n#else\n    #include "lvgl.h"\n#endif\n'
+                        '#include "../asset_pack_format.h"\n', 1)
+    if "%s_dsc = {" % name not in stub or "AssetPack_FontGetGlyphDsc" not in stub:
+        raise SystemExit("%s: unexpected font layout" % path)
+
+    return bitmap, GENERATED_BANNER + "#ifdef USE_ASSET_PACK\n\n" + stub + "\n#endif /*USE_ASSET_PACK*/\n"
+
+
+def write_if_changed(path, text):
+    if os.path.isfile(path):
+        with open(path, "r") as f:
+            if f.read() == text:
+                return
+    with open(path, "w") as f:
+        f.write(text)
+
+
+def write_image_stubs(images):
+    lines = [GENERATED_BANNER, "#ifdef USE_ASSET_PACK\n\n",
+             '#include "../src/images.h"\n#include "../asset_pack_format.h"\n\n',
+             "/* Pixel data lives in the asset pack; .data carries the entry name. */\n"]
+    for name, cf, w, h, _ in images:
+        lines.append("const lv_img_dsc_t %s = { .header.cf = ASSET_PACK_IMG_CF, .header.w = %d, "
+                     ".header.h = %d, .data_size = 0, .data = (const uint8_t *)\"%s\" };\n" % (name, w, h, name))
+    lines.append("\n#endif /*USE_ASSET_PACK*/\n")
+    write_if_changed(os.path.join(STUBS_DIR, "images.c"), "".join(lines))
+
+
+def write_font_index(fonts):
+    lines = [GENERATED_BANNER, "#ifdef USE_ASSET_PACK\n\n", '#include "../asset_pack_format.h"\n\n']
+    for name in fonts:
+        lines.append("extern lv_font_fmt_txt_dsc_t %s_dsc;\n" % name)
+    lines.append("\nconst asset_font_binding_t asset_pack_fonts[] = {\n")
+    for name in fonts:
+        lines.append("    { \"%s\", &%s_dsc },\n" % (name, name))
+    lines.append("};\nconst size_t asset_pack_font_count = %d;\n" % len(fonts))
+    lines.append("\n#endif /*USE_ASSET_PACK*/\n")
+    write_if_changed(os.path.join(STUBS_DIR, "asset_index.c"), "".join(lines))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--out", default=os.path.join(PROJECT_DIR, "assets.bin"))
+    parser.add_argument("--no-compress", action="store_true", help="store every image raw")
+    args = parser.parse_args()
+
+    os.makedirs(STUBS_DIR, exist_ok=True)
+
+    images = [parse_image(os.path.join(IMAGES_DIR, f))
+              for f in sorted(os.listdir(IMAGES_DIR)) if f.endswith(".c")]
+    write_image_stubs(images)
+
+    entries = []       # (name, type, codec, cf, unit, w, h, blob, rawSize)
+    raw_total = 0
+    for name, cf, w, h, pixels in images:
+        unit = PX_SIZE[cf]
+        codec, blob = ASSET_CODEC_RAW, pixels
+        if not args.no_compress:
+            packed = rle_encode(pixels, unit)
+            if len(packed) <= len(pixels) - len(pixels) // 8:
+                codec, blob = ASSET_CODEC_RLE, packed
+        entries.append((name, ASSET_TYPE_IMAGE, codec, cf, unit, w, h, blob, len(pixels)))
+        raw_total += len(pixels)
+
+    for name in PACKED_FONTS:
+        bitmap, stub = parse_font(name)
+        write_if_changed(os.path.join(STUBS_DIR, name + ".c"), stub)
+        entries.append((name, ASSET_TYPE_FONT, ASSET_CODEC_RAW, 0, 1, 0, 0, bitmap, len(bitmap)))
+        raw_total += len(bitmap)
+    write_font_index(PACKED_FONTS)
+
+    for e in entries:
+        if len(e[0]) >= ASSET_NAME_LEN:
+            raise SystemExit("asset name too long: %s" % e[0])
+    entries.sort(key=lambda e: e[0].encode())
+
+    offset = struct.calcsize(HEADER_FMT) + struct.calcsize(ENTRY_FMT) * len(entries)
+    index = bytearray()
+    blobs = bytearray()
+    for name, kind, codec, cf, unit, w, h, blob, raw_size in entries:
+        pad = (-(offset + len(blobs))) % 4
+        blobs.extend(b"\0" * pad)
+        index.extend(struct.pack(ENTRY_FMT, name.encode(), kind, codec, cf, unit, w, h,
+                                 offset + len(blobs), len(blob), raw_size))
+        blobs.extend(blob)
+
+    total = offset + len(blobs)
+    with open(args.out, "wb") as f:
+        f.write(struct.pack(HEADER_FMT, ASSET_PACK_MAGIC, ASSET_PACK_VERSION, len(entries), total))
+        f.write(index)
+        f.write(blobs)
+
+    rle = sum(1 for e in entries if e[2] == ASSET_CODEC_RLE)
+    print("[pack_assets] %d images (%d RLE) + %d fonts -> %s" % (len(images), rle, len(PACKED_FONTS), args.out))
+    print("[pack_assets] raw %.1f KB, packed %.1f KB" % (raw_total / 1024.0, total / 1024.0))
+
+
+if __name__ == "__main__":
+    main()
@@ -1,18 +1,165 @@
 #include "Audio_PCM5101.h"
+#include "esp_pm.h"
+#include "esp_timer.h"
 
-#define AUDIO_TICK_PERIOD_MS 1
+// audio.loop() runs in its own task instead of a 1 ms esp_timer.  The task
+// sleeps on the I2S TX event queue whenever the decoder has nothing to add and
+// i2s_write() blocks it while the DMA ring is full, so nothing wakes the CPU
+// periodically while audio is idle.
+#define AUDIO_PUMP_STACK_SIZE   8192
+#define AUDIO_PUMP_PRIORITY     5
+#define AUDIO_PUMP_CORE         0
+#define AUDIO_EVENT_WAIT_MS     50
+#define AUDIO_INBUFF_DESCS      32      // InBuff size in DMA descriptors
+#define AUDIO_READ_DESCS        4       // file read per loop() in DMA descriptors
+#define AUDIO_STATS_PERIOD_MS   60000
+#define AUDIO_SILENCE_FRAMES    512     // one DMA descriptor
 
 Audio audio;
-static esp_timer_handle_t s_audio_tick_timer = NULL;
+AudioMixer audioMixer;
+static TaskHandle_t s_audioPumpTask = NULL;
+static esp_pm_lock_handle_t s_audioCpuLock = NULL;
+static bool s_audioBoosted = false;
 
 uint8_t Volume = Volume_MAX;
 
-void increase_audio_tick(void *arg)
-{
-  if (audio.isRunning())
-    audio.loop();
-  else
-    esp_timer_stop(s_audio_tick_timer);
+static struct {
+  uint32_t windowStartMs;
+  uint32_t startFrames;         // frame counter when the current song started
+  uint32_t underruns;           // DMA ran dry (I2S_EVENT_TX_Q_OVF)
+  uint32_t overruns;            // i2s_write() timed out / failed
+  uint32_t lastWriteFails;
+  uint32_t descriptors;         // I2S_EVENT_TX_DONE
+  uint32_t decodeUs;            // time spent inside audio.loop() and mixing
+} s_audioStats;
+
+// Carrier for mixer voices when no stream is playing.
+static const int16_t s_silence[AUDIO_SILENCE_FRAMES] = {};
+
+// File the current stream was opened from by Play_File().
+static char s_streamPath[100] = "";
+
+// Trigger-to-first-sample measurement, totalled per source ("bank", "sd")
+// since boot: alarms are too rare for a per-window figure.
+#define AUDIO_LATENCY_SOURCES   2
+static int64_t s_latencyStartUs = 0;
+static const char *s_latencySource = NULL;
+static struct {
+  const char *source;           // NULL: free
+  uint32_t count;
+  uint64_t totalUs;
+  uint32_t maxUs;
+} s_latency[AUDIO_LATENCY_SOURCES];
+
+// Hold the CPU at max frequency only while a stream is being decoded.
+static void Audio_SetBoost(bool on) {
+  if (!s_audioCpuLock || on == s_audioBoosted) return;
+  esp_err_t err = on ? esp_pm_lock_acquire(s_audioCpuLock) : esp_pm_lock_release(s_audioCpuLock);
+  if (err == ESP_OK) s_audioBoosted = on;
+}
+
+static void Audio_DrainEvents(TickType_t wait) {
+  QueueHandle_t queue = audio.getI2sEventQueue();
+  if (!queue) {
+    if (wait) vTaskDelay(wait);
+    return;
+  }
+  bool playing = audio.getI2sFramesWritten() != s_audioStats.startFrames;
+  i2s_event_t event;
+  while (xQueueReceive(queue, &event, wait) == pdTRUE) {
+    wait = 0;
+    if (event.type == I2S_EVENT_TX_DONE) {
+      s_audioStats.descriptors++;
+    } else if (event.type == I2S_EVENT_TX_Q_OVF && playing) {
+      s_audioStats.underruns++;
+    }
+  }
+}
+
+static void Audio_PumpStats(void) {
+  uint32_t fails = audio.getI2sWriteFails();
+  s_audioStats.overruns += fails - s_audioStats.lastWriteFails;
+  s_audioStats.lastWriteFails = fails;
+
+  uint32_t now = millis();
+  uint32_t elapsed = now - s_audioStats.windowStartMs;
+  if (elapsed < AUDIO_STATS_PERIOD_MS) return;
+
+#ifdef STATS_LOG
+  {
+    printf("[Audio] %s decode=%lums/s cpu=%lu.%lu%% desc=%lu underruns=%lu overruns=%lu\r\n",
+           audio.getCodecname(),
+           (unsigned long)(s_audioStats.decodeUs / elapsed),
+           (unsigned long)(s_audioStats.decodeUs / (elapsed * 10)),
+           (unsigned long)((s_audioStats.decodeUs / elapsed) % 10),
+           (unsigned long)s_audioStats.descriptors,
+           (unsigned long)s_audioStats.underruns,
+           (unsigned long)s_audioStats.overruns);
+    for (int i = 0; i < AUDIO_LATENCY_SOURCES; i++) {
+      if (!s_latency[i].source) continue;
+      printf("[Audio] first sample (%s) n=%lu avg=%luus max=%luus\r\n",
+             s_latency[i].source,
+             (unsigned long)s_latency[i].count,
+             (unsigned long)(s_latency[i].totalUs / s_latency[i].count),
+             (unsigned long)s_latency[i].maxUs);
+    }
+  }
+  audioMixer.logStats();
+#endif
+  s_audioStats.windowStartMs = now;
+  s_audioStats.descriptors = 0;
+  s_audioStats.underruns = 0;
+  s_audioStats.overruns = 0;
+  s_audioStats.decodeUs = 0;
+}
+
+// Called by the Audio library for every frame it writes to I2S.
+void audio_mix_sample(int16_t *sample) {
+  audioMixer.mixFrame(sample, audio.getSampleRate());
+}
+
+static void Audio_NoteFirstSample(uint32_t framesBefore) {
+  if (!s_latencySource || audio.getI2sFramesWritten() == framesBefore) return;
+  uint32_t us = (uint32_t)(esp_timer_get_time() - s_latencyStartUs);
+  printf("[Audio] first sample %lu us after trigger (%s)\r\n", (unsigned long)us, s_latencySource);
+  for (int i = 0; i < AUDIO_LATENCY_SOURCES; i++) {
+    if (s_latency[i].source && strcmp(s_latency[i].source, s_latencySource) != 0) continue;
+    s_latency[i].source = s_latencySource;
+    s_latency[i].count++;
+    s_latency[i].totalUs += us;
+    s_latency[i].maxUs = max(s_latency[i].maxUs, us);
+    break;
+  }
+  s_latencySource = NULL;
+}
+
+static void Audio_PumpTask(void *parameter) {
+  for (;;) {
+    bool streaming = audio.isRunning();
+    if (!streaming && !audioMixer.isActive()) {
+      Audio_SetBoost(false);
+      ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+      // Events queued while idle are the DMA replaying silence, not underruns.
+      if (audio.getI2sEventQueue()) xQueueReset(audio.getI2sEventQueue());
+      s_audioStats.startFrames = audio.getI2sFramesWritten();
+      s_audioStats.lastWriteFails = audio.getI2sWriteFails();
+      continue;
+    }
+    Audio_SetBoost(true);
+
+    uint32_t framesBefore = audio.getI2sFramesWritten();
+    int64_t start = esp_timer_get_time();
+    // With no stream running, one descriptor of silence carries the voices.
+    audioMixer.pump(audio, s_silence, min((uint32_t)AUDIO_SILENCE_FRAMES, (uint32_t)audio.getDmaFrameNum()));
+    s_audioStats.decodeUs += (uint32_t)(esp_timer_get_time() - start);
+    Audio_NoteFirstSample(framesBefore);
+
+    // Nothing reached I2S this pass (header parsing, buffering, end of file):
+    // wait for the DMA to retire a descriptor instead of spinning.
+    bool idle = audio.getI2sFramesWritten() == framesBefore;
+    Audio_DrainEvents(idle ? pdMS_TO_TICKS(AUDIO_EVENT_WAIT_MS) : 0);
+    Audio_PumpStats();
+  }
 }
 
 void Audio_Init() {
@@ -20,21 +167,51 @@ void Audio_Init() {
   audio.setPinout(I2S_BCLK, I2S_LRC, I2S_DOUT);
   audio.setVolume(Volume); // 0...21    
 
-  const esp_timer_create_args_t audio_tick_timer_args = {
-    .callback = &increase_audio_tick,
-    .dispatch_method = ESP_TIMER_TASK,
-    .name = "audio_tick",
-    .skip_unhandled_events = true
-  };
-  esp_timer_create(&audio_tick_timer_args, &s_audio_tick_timer);
+  // Size the input buffer and per-loop file reads in whole DMA descriptors
+  // (16-bit stereo) so one SD read refills a predictable slice of the ring.
+  const uint32_t descBytes = audio.getDmaFrameNum() * 2 * sizeof(int16_t);
+  audio.setBufsize(-1, AUDIO_INBUFF_DESCS * descBytes);
+  audio.setFileReadChunk(AUDIO_READ_DESCS * descBytes);
+
+  if (esp_pm_lock_create(ESP_PM_CPU_FREQ_MAX, 0, "audio_decode", &s_audioCpuLock) != ESP_OK) {
+    printf("Audio : Failed to create CPU PM lock\r\n");
+    s_audioCpuLock = NULL;
+  }
+
+  s_audioStats.windowStartMs = millis();
+  xTaskCreatePinnedToCoreWithCaps(
+    Audio_PumpTask,
+    "Audio Pump",
+    AUDIO_PUMP_STACK_SIZE,
+    NULL,
+    AUDIO_PUMP_PRIORITY,
+    &s_audioPumpTask,
+    AUDIO_PUMP_CORE,
+    MALLOC_CAP_SPIRAM);
+}
+
+// Wake the pump after a stream was connected or resumed.
+void Audio_StartPump(void) {
+  if (s_audioPumpTask) xTaskNotifyGive(s_audioPumpTask);
+}
+
+bool Audio_PlayClip(const int16_t *pcm, uint32_t frames, uint8_t channels, uint32_t sampleRate, AudioPriority priority) {
+  if (!audioMixer.play(pcm, frames, channels, sampleRate, priority)) return false;
+  Audio_StartPump();
+  return true;
+}
+
+void Audio_StopClip(const int16_t *pcm) {
+  audioMixer.stop(pcm);
 }
 
-void Audio_StopTickTimer(void) {
-  if (s_audio_tick_timer) esp_timer_stop(s_audio_tick_timer);
+bool Audio_IsClipPlaying(const int16_t *pcm) {
+  return audioMixer.isPlaying(pcm);
 }
 
-void Audio_StartTickTimer(void) {
-  if (s_audio_tick_timer) esp_timer_start_periodic(s_audio_tick_timer, AUDIO_TICK_PERIOD_MS * 1000);
+void Audio_MarkLatencyStart(const char *source) {
+  s_latencyStartUs = esp_timer_get_time();
+  s_latencySource = source;
 }
 
 void Volume_adjustment(uint8_t Volume) {
@@ -54,7 +231,7 @@ void Play_Music_test() {
   bool ret = audio.connecttoFS(SD_MMC,"/A.mp3");
   if(ret) {
     printf("Music Read OK\r\n");
-    Audio_StartTickTimer();
+    Audio_StartPump();
   } else
     printf("Music Read Failed\r\n");
 }
@@ -72,16 +249,29 @@ void Play_Music(const char* directory, const char* fileName) {
     snprintf(filePath, maxPathLength, "%s/%s", directory, fileName);
   }
   // printf("%s AAAAAAAA.\r\n",filePath);    
-  if(!audio.isRunning()) {
-    bool ret = audio.connecttoFS(SD_MMC,(char*)filePath);
-    if(ret) {
-      printf("Music Read OK\r\n");
-      Audio_StartTickTimer();
-    } else
-      printf("Music Read Failed\r\n");
-  }
+  Play_File(filePath);
   vTaskDelay(pdMS_TO_TICKS(100));    
 }
+// Stream a file whose existence the caller already knows (no directory scan).
+bool Play_File(const char* filePath) {
+  if(audio.isRunning()) return false;
+  bool ret = audio.connecttoFS(SD_MMC,(char*)filePath);
+  if(ret) {
+    printf("Music Read OK\r\n");
+    strlcpy(s_streamPath, filePath, sizeof(s_streamPath));
+    Audio_StartPump();
+  } else
+    printf("Music Read Failed\r\n");
+  return ret;
+}
+// Mixer clips are not touched: an alarm or timer tone keeps playing.
+bool Audio_StopStream(const char* filePath) {
+  if (!filePath || !audio.isRunning() || strcmp(s_streamPath, filePath) != 0) return false;
+  audio.stopSong();
+  s_streamPath[0] = '\0';
+  printf("The music stop\r\n");
+  return true;
+}
 void Music_pause() {
   if (audio.isRunning()) {            
     audio.pauseResume();             
@@ -91,7 +281,7 @@ void Music_pause() {
 void Music_resume() {
   if (!audio.isRunning()) {
     audio.pauseResume();
-    Audio_StartTickTimer();
+    Audio_StartPump();
     printf("The music begins\r\n");
   }
 }
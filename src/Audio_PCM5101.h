@@ -2,6 +2,7 @@
 #include "Arduino.h"
 #include "Audio.h"
 #include "SD_Card.h"
+#include "audio_mixer.h"
 
 // Digital I/O used
 #define I2S_DOUT      47
@@ -11,16 +12,23 @@
 #define Volume_MAX  21
 
 extern Audio audio;
+extern AudioMixer audioMixer;
 extern uint8_t Volume;
 
 void Play_Music_test();
 void Audio_Loop();
 
 void Audio_Init();
-void Audio_StopTickTimer(void);
-void Audio_StartTickTimer(void);
+void Audio_StartPump(void);
+// Resident PCM (SoundBank, UI sounds): mixed over whatever else is playing.
+bool Audio_PlayClip(const int16_t *pcm, uint32_t frames, uint8_t channels, uint32_t sampleRate, AudioPriority priority);
+void Audio_StopClip(const int16_t *pcm);        // NULL: all clips
+bool Audio_IsClipPlaying(const int16_t *pcm);   // NULL: any clip
+void Audio_MarkLatencyStart(const char *source);
 void Volume_adjustment(uint8_t Volume);
 void Play_Music(const char* directory, const char* fileName);
+bool Play_File(const char* filePath);           // false if a stream is already playing
+bool Audio_StopStream(const char* filePath);    // stops the stream only if it plays filePath
 void Music_pause(); 
 void Music_resume();    
 uint32_t Music_Duration();  
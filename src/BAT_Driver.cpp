@@ -208,3 +208,7 @@ const char *BAT_Get_Charge_Percentage(void) {
 const char *BAT_Get_Charge_Percentage_Str(void) {
   return chargePercentageStr;
 }
+
+int BAT_Get_Charge_Percent(void) {
+  return chargePercentage;
+}
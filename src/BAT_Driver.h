@@ -8,4 +8,5 @@ void BAT_Init(void);
 void BAT_Get_Volts(void);
 bool BAT_Is_Charging(void);
 const char *BAT_Get_Charge_Percentage(void);
-const char *BAT_Get_Charge_Percentage_Str(void);
\ No newline at end of file
+const char *BAT_Get_Charge_Percentage_Str(void);
+int BAT_Get_Charge_Percent(void);
\ No newline at end of file
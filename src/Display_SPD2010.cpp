@@ -10,10 +10,14 @@
 #include "esp_lcd_panel_io.h"
 #include "esp_lcd_spd2010.h"
 #include "lvgl.h"
+#include "esp_timer.h"
+#include "frame_profiler.h"
 
 #include "esp_lcd_panel_io_interface.h"
 #include "esp_lcd_panel_ops.h"
 
+extern FrameProfiler frameProfiler;
+
 uint8_t LCD_Backlight = 60;
 static lv_disp_drv_t *s_lvgl_disp_drv = NULL;
 static uint16_t *s_flush_dma_buf = NULL;
@@ -49,6 +53,7 @@ static bool LCD_OnColorTransferDone(esp_lcd_panel_io_handle_t panel_io,
     s_wait_for_chunk = false;
   }
   if (flush_done && s_lvgl_disp_drv) {
+    frameProfiler.flushDoneFromISR();
     lv_disp_flush_ready(s_lvgl_disp_drv);
   }
   return false;
@@ -200,6 +205,7 @@ void LCD_addWindow(uint16_t Xstart, uint16_t Ystart, uint16_t Xend, uint16_t Yen
   portEXIT_CRITICAL(&s_flush_mux);
 
   uint16_t rows_sent = 0;
+  uint32_t swap_us = 0;
   for (uint16_t chunk_index = 0; chunk_index < chunk_count; chunk_index++) {
     uint16_t chunk_rows = height - rows_sent;
     if (chunk_rows > max_chunk_rows) {
@@ -207,6 +213,7 @@ void LCD_addWindow(uint16_t Xstart, uint16_t Ystart, uint16_t Xend, uint16_t Yen
     }
     const uint32_t chunk_pixels = (uint32_t)width * chunk_rows;
     uint16_t *tx_buf = color + ((uint32_t)rows_sent * width);
+    const int64_t swap_start = esp_timer_get_time();
 
     if (s_flush_dma_buf != NULL && chunk_pixels <= LCD_DMA_STAGE_PIXELS) {
       tx_buf = s_flush_dma_buf;
@@ -223,6 +230,7 @@ void LCD_addWindow(uint16_t Xstart, uint16_t Ystart, uint16_t Xend, uint16_t Yen
         tx_buf[i] = (uint16_t)(((pixel >> 8) & 0xFF) | ((pixel << 8) & 0xFF00));
       }
     }
+    swap_us += (uint32_t)(esp_timer_get_time() - swap_start);
 
     const uint16_t chunk_y_start = Ystart + rows_sent;
     uint16_t chunk_x_end = Xstart + width;
@@ -249,6 +257,7 @@ void LCD_addWindow(uint16_t Xstart, uint16_t Ystart, uint16_t Xend, uint16_t Yen
 
     rows_sent += chunk_rows;
   }
+  frameProfiler.addStage(FRAME_STAGE_SWAP, swap_us);
 }
 
 
@@ -454,7 +454,7 @@ void getAccelerometer(void)
 {
 
   uint8_t buf[6];
-	esp_err_t ret = I2C_Read(Device_addr, QMI8658_AX_L, buf, 6);
+	esp_err_t ret = I2C_ReadMergeable(Device_addr, QMI8658_AX_L, buf, 6);
 	if(ret != ESP_OK) {
 		printf("QMI8658: Accelerometer read failure (addr=0x%02X)\r\n", Device_addr);
     return;
@@ -506,7 +506,7 @@ void getAccelerometer(void)
 void getGyroscope(void)
 {
   uint8_t buf[6];
-	esp_err_t ret = I2C_Read(Device_addr, QMI8658_GX_L, buf, 6);
+	esp_err_t ret = I2C_ReadMergeable(Device_addr, QMI8658_GX_L, buf, 6);
 	if(ret != ESP_OK)
 		printf("QMI8658 : Gyroscope read failure\r\n");
 	else{
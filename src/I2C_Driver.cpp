@@ -1,14 +1,67 @@
 #include "I2C_Driver.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/semphr.h"
+#include "freertos/task.h"
+#include "esp_timer.h"
 
 static SemaphoreHandle_t g_i2c_mutex = nullptr;
 
+// Pending transactions.  Small fixed table instead of a FreeRTOS queue so the
+// worker can pick by priority and scan for mergeable reads.
+typedef struct {
+  i2c_transaction_t t;
+  int64_t queuedUs;
+  uint32_t seq;
+  bool used;
+} i2c_slot_t;
+
+static i2c_slot_t s_slots[I2C_QUEUE_DEPTH];
+static uint32_t s_seq = 0;
+static portMUX_TYPE s_queueMux = portMUX_INITIALIZER_UNLOCKED;
+static SemaphoreHandle_t s_workSem = nullptr;
+static TaskHandle_t s_workerTask = nullptr;
+
+typedef struct {
+  uint8_t addr;
+  uint32_t transactions;
+  uint32_t errors;
+  uint64_t latencyUsSum;              // queue wait + transfer
+  uint32_t latencyUsMax;
+  uint64_t busyUs;                    // time on the wire
+} i2c_dev_stats_t;
+
+static i2c_dev_stats_t s_devStats[I2C_STATS_MAX_DEVICES];
+static int64_t s_statsWindowStartUs = 0;
+static uint64_t s_busBusyUs = 0;
+static uint32_t s_mergedReads = 0;
+static uint32_t s_queueFull = 0;
+
+static void I2C_Worker(void *parameter);
+
 void I2C_Init(void) {
   if (!g_i2c_mutex) {
     g_i2c_mutex = xSemaphoreCreateMutex();
   }
+  // Re-init is used for bus recovery; never pull the bus out from under an
+  // in-flight transfer on the worker task.
+  bool locked = I2C_Lock(1000);
   Wire.begin(I2C_SDA_PIN, I2C_SCL_PIN);
+  if (locked) {
+    I2C_Unlock();
+  }
+
+  if (!s_workSem) {
+    s_workSem = xSemaphoreCreateCounting(I2C_QUEUE_DEPTH, 0);
+    s_statsWindowStartUs = esp_timer_get_time();
+  }
+  if (!s_workerTask && s_workSem) {
+    // Internal-RAM stack: the worker sits on the touch input path.
+    if (xTaskCreatePinnedToCore(I2C_Worker, "I2C Worker", 4096, NULL, 5,
+                                &s_workerTask, tskNO_AFFINITY) != pdPASS) {
+      printf("I2C worker task creation failed - falling back to direct transfers\r\n");
+      s_workerTask = nullptr;
+    }
+  }
 }
 
 bool I2C_Lock(uint32_t timeoutMs) {
@@ -24,53 +77,356 @@ void I2C_Unlock(void) {
   }
 }
 
-esp_err_t I2C_Read(uint8_t Driver_addr, uint8_t Reg_addr, uint8_t *Reg_data, uint32_t Length) {
-  if (!Reg_data || Length == 0) {
-    return ESP_ERR_INVALID_ARG;
+// Wire backend.  Caller holds the bus mutex.
+static esp_err_t I2C_WireExecute(uint8_t addr, uint16_t reg, uint8_t flags, uint8_t *data, uint32_t length) {
+  Wire.beginTransmission(addr);
+  if (flags & I2C_FLAG_REG16) {
+    Wire.write((uint8_t)(reg >> 8));
   }
-  if (!I2C_Lock()) {
-    printf("I2C lock timeout - I2C Read\r\n");
-    return ESP_ERR_TIMEOUT;
+  Wire.write((uint8_t)reg);
+
+  if (!(flags & I2C_FLAG_READ)) {
+    for (uint32_t i = 0; i < length; i++) {
+      Wire.write(data[i]);
+    }
+    if (Wire.endTransmission(true)) {
+      printf("The I2C transmission fails. - I2C Write 0x%02X\r\n", addr);
+      return ESP_FAIL;
+    }
+    return ESP_OK;
   }
 
-  Wire.beginTransmission(Driver_addr);
-  Wire.write(Reg_addr);
   if (Wire.endTransmission(true)) {
-    printf("The I2C transmission fails. - I2C Read\r\n");
-    I2C_Unlock();
+    printf("The I2C transmission fails. - I2C Read 0x%02X\r\n", addr);
     return ESP_FAIL;
   }
-  int received = Wire.requestFrom(Driver_addr, Length);
-  if (received != (int)Length) {
-    printf("The I2C read length is invalid. expected=%u got=%d\r\n", (unsigned)Length, received);
-    I2C_Unlock();
+  int received = Wire.requestFrom(addr, length);
+  if (received != (int)length) {
+    printf("The I2C read length is invalid. addr=0x%02X expected=%u got=%d\r\n", addr, (unsigned)length, received);
     return ESP_FAIL;
   }
-  for (uint32_t i = 0; i < Length && Wire.available(); i++) {
-    *Reg_data++ = Wire.read();
+  for (uint32_t i = 0; i < length && Wire.available(); i++) {
+    *data++ = Wire.read();
   }
-  I2C_Unlock();
   return ESP_OK;
 }
-esp_err_t I2C_Write(uint8_t Driver_addr, uint8_t Reg_addr, const uint8_t *Reg_data, uint32_t Length) {
-  if ((!Reg_data && Length > 0) || !I2C_Lock()) {
-    if (Length > 0 && !Reg_data) {
-      return ESP_ERR_INVALID_ARG;
-    }
-    printf("I2C lock timeout - I2C Write\r\n");
+
+static esp_err_t I2C_ExecuteLocked(uint8_t addr, uint16_t reg, uint8_t flags, uint8_t *data, uint32_t length) {
+  if (!I2C_Lock()) {
+    printf("I2C lock timeout - addr 0x%02X\r\n", addr);
     return ESP_ERR_TIMEOUT;
   }
+  esp_err_t ret = I2C_WireExecute(addr, reg, flags, data, length);
+  I2C_Unlock();
+  return ret;
+}
 
-  Wire.beginTransmission(Driver_addr);
-  Wire.write(Reg_addr);
-  for (uint32_t i = 0; i < Length; i++) {
-    Wire.write(*Reg_data++);
+static i2c_dev_stats_t *I2C_DevStats(uint8_t addr) {
+  for (int i = 0; i < I2C_STATS_MAX_DEVICES; i++) {
+    if (s_devStats[i].addr == addr && s_devStats[i].transactions > 0) return &s_devStats[i];
   }
-  if (Wire.endTransmission(true)) {
-    printf("The I2C transmission fails. - I2C Write\r\n");
-    I2C_Unlock();
-    return ESP_FAIL;
+  for (int i = 0; i < I2C_STATS_MAX_DEVICES; i++) {
+    if (s_devStats[i].transactions == 0) {
+      s_devStats[i].addr = addr;
+      return &s_devStats[i];
+    }
   }
-  I2C_Unlock();
+  return nullptr;
+}
+
+static void I2C_RecordStats(const i2c_slot_t *slot, esp_err_t result, int64_t doneUs, uint32_t wireUs) {
+  portENTER_CRITICAL(&s_queueMux);
+  i2c_dev_stats_t *stats = I2C_DevStats(slot->t.addr);
+  if (stats) {
+    uint32_t latency = (uint32_t)(doneUs - slot->queuedUs);
+    stats->transactions++;
+    if (result != ESP_OK) stats->errors++;
+    stats->latencyUsSum += latency;
+    if (latency > stats->latencyUsMax) stats->latencyUsMax = latency;
+    stats->busyUs += wireUs;
+  }
+  portEXIT_CRITICAL(&s_queueMux);
+}
+
+static bool I2C_Mergeable(const i2c_transaction_t *t) {
+  return (t->flags & I2C_FLAG_READ) && (t->flags & I2C_FLAG_MERGEABLE) && !(t->flags & I2C_FLAG_REG16);
+}
+
+// Whether a transaction to `addr` queued before `seq` is still waiting.
+// Caller holds s_queueMux.
+static bool I2C_QueuedBefore(uint8_t addr, uint32_t seq, bool writesOnly) {
+  for (int i = 0; i < I2C_QUEUE_DEPTH; i++) {
+    const i2c_slot_t *slot = &s_slots[i];
+    if (!slot->used || slot->t.addr != addr || (int32_t)(slot->seq - seq) >= 0) continue;
+    if (!writesOnly || !(slot->t.flags & I2C_FLAG_READ)) return true;
+  }
+  return false;
+}
+
+// Dequeue the next transaction (touch first, then FIFO) plus any queued reads
+// to the same device that fall inside one burst window.  Returns the count.
+// Priority only reorders devices: a transaction waits for everything queued
+// earlier to its own device, and a read is never merged ahead of a write to
+// that device it was queued behind.
+static int I2C_TakeBatch(i2c_slot_t *batch, uint16_t *spanLo, uint16_t *spanHi) {
+  int count = 0;
+  portENTER_CRITICAL(&s_queueMux);
+
+  int head = -1;
+  for (int i = 0; i < I2C_QUEUE_DEPTH; i++) {
+    if (!s_slots[i].used || I2C_QueuedBefore(s_slots[i].t.addr, s_slots[i].seq, false)) continue;
+    if (head < 0 ||
+        s_slots[i].t.prio > s_slots[head].t.prio ||
+        (s_slots[i].t.prio == s_slots[head].t.prio && (int32_t)(s_slots[i].seq - s_slots[head].seq) < 0)) {
+      head = i;
+    }
+  }
+
+  if (head >= 0) {
+    batch[count++] = s_slots[head];
+    s_slots[head].used = false;
+    uint16_t lo = batch[0].t.reg;
+    uint16_t hi = batch[0].t.reg + batch[0].t.length;
+
+    if (I2C_Mergeable(&batch[0].t)) {
+      // Repeat until the span stops growing so chains of adjacent reads merge
+      // regardless of their order in the table.
+      bool grew = true;
+      while (grew) {
+        grew = false;
+        for (int i = 0; i < I2C_QUEUE_DEPTH; i++) {
+          i2c_slot_t *slot = &s_slots[i];
+          if (!slot->used || slot->t.addr != batch[0].t.addr || !I2C_Mergeable(&slot->t)) continue;
+          if (I2C_QueuedBefore(slot->t.addr, slot->seq, true)) continue;
+          uint16_t sLo = slot->t.reg;
+          uint16_t sHi = slot->t.reg + slot->t.length;
+          if (sLo > hi + I2C_COALESCE_MAX_GAP || sHi + I2C_COALESCE_MAX_GAP < lo) continue;
+          uint16_t newLo = sLo < lo ? sLo : lo;
+          uint16_t newHi = sHi > hi ? sHi : hi;
+          if (newHi - newLo > I2C_COALESCE_MAX_LEN) continue;
+          batch[count++] = *slot;
+          slot->used = false;
+          lo = newLo;
+          hi = newHi;
+          grew = true;
+        }
+      }
+      if (count > 1) s_mergedReads += count - 1;
+    }
+    *spanLo = lo;
+    *spanHi = hi;
+  }
+
+  portEXIT_CRITICAL(&s_queueMux);
+  return count;
+}
+
+static void I2C_Worker(void *parameter) {
+  i2c_slot_t batch[I2C_QUEUE_DEPTH];
+  uint8_t burst[I2C_COALESCE_MAX_LEN];
+
+  while (1) {
+    // Merged slots leave extra counts on the semaphore; those wakeups find an
+    // empty table and go straight back to sleep.
+    xSemaphoreTake(s_workSem, portMAX_DELAY);
+
+    uint16_t lo = 0, hi = 0;
+    int count = I2C_TakeBatch(batch, &lo, &hi);
+    if (count == 0) continue;
+
+    int64_t startUs = esp_timer_get_time();
+    esp_err_t ret;
+    if (count == 1) {
+      const i2c_transaction_t *t = &batch[0].t;
+      ret = I2C_ExecuteLocked(t->addr, t->reg, t->flags, t->data, t->length);
+    } else {
+      ret = I2C_ExecuteLocked(batch[0].t.addr, lo, batch[0].t.flags, burst, hi - lo);
+      if (ret == ESP_OK) {
+        for (int i = 0; i < count; i++) {
+          memcpy(batch[i].t.data, &burst[batch[i].t.reg - lo], batch[i].t.length);
+        }
+      }
+    }
+    int64_t doneUs = esp_timer_get_time();
+    uint32_t wireUs = (uint32_t)(doneUs - startUs);
+
+    portENTER_CRITICAL(&s_queueMux);
+    s_busBusyUs += wireUs;
+    portEXIT_CRITICAL(&s_queueMux);
+
+    for (int i = 0; i < count; i++) {
+      // Split the shared wire time across merged requests for per-device accounting.
+      I2C_RecordStats(&batch[i], ret, doneUs, wireUs / count);
+      if (batch[i].t.done) {
+        batch[i].t.done(ret, batch[i].t.ctx);
+      }
+    }
+  }
+}
+
+// A write may be the register pointer alone (length 0, no data); a read
+// needs somewhere to put at least one byte.
+static bool I2C_ValidTransaction(const i2c_transaction_t *trans) {
+  if (!trans) return false;
+  if (trans->flags & I2C_FLAG_READ) return trans->data && trans->length;
+  return trans->data || trans->length == 0;
+}
+
+esp_err_t I2C_Submit(const i2c_transaction_t *trans) {
+  if (!I2C_ValidTransaction(trans)) {
+    return ESP_ERR_INVALID_ARG;
+  }
+  if (!s_workerTask) {
+    esp_err_t ret = I2C_ExecuteLocked(trans->addr, trans->reg, trans->flags, trans->data, trans->length);
+    if (trans->done) trans->done(ret, trans->ctx);
+    return ESP_OK;
+  }
+
+  bool queued = false;
+  portENTER_CRITICAL(&s_queueMux);
+  for (int i = 0; i < I2C_QUEUE_DEPTH; i++) {
+    if (!s_slots[i].used) {
+      s_slots[i].t = *trans;
+      s_slots[i].queuedUs = esp_timer_get_time();
+      s_slots[i].seq = s_seq++;
+      s_slots[i].used = true;
+      queued = true;
+      break;
+    }
+  }
+  if (!queued) s_queueFull++;
+  portEXIT_CRITICAL(&s_queueMux);
+
+  if (!queued) {
+    return ESP_ERR_NO_MEM;
+  }
+  xSemaphoreGive(s_workSem);
   return ESP_OK;
 }
+
+typedef struct {
+  SemaphoreHandle_t sem;
+  esp_err_t result;
+} i2c_sync_t;
+
+static void I2C_SyncDone(esp_err_t result, void *ctx) {
+  i2c_sync_t *sync = (i2c_sync_t *)ctx;
+  sync->result = result;
+  xSemaphoreGive(sync->sem);
+}
+
+esp_err_t I2C_Transfer(const i2c_transaction_t *trans, uint32_t timeoutMs) {
+  if (!I2C_ValidTransaction(trans)) {
+    return ESP_ERR_INVALID_ARG;
+  }
+  // Completion callbacks run on the worker; a nested blocking transfer from
+  // there would wait on itself.
+  if (!s_workerTask || xTaskGetCurrentTaskHandle() == s_workerTask) {
+    return I2C_ExecuteLocked(trans->addr, trans->reg, trans->flags, trans->data, trans->length);
+  }
+
+  StaticSemaphore_t semBuf;
+  i2c_sync_t sync;
+  sync.sem = xSemaphoreCreateBinaryStatic(&semBuf);
+  sync.result = ESP_FAIL;
+
+  i2c_transaction_t t = *trans;
+  t.done = I2C_SyncDone;
+  t.ctx = &sync;
+  esp_err_t ret = I2C_Submit(&t);
+  if (ret != ESP_OK) {
+    printf("I2C queue full - addr 0x%02X\r\n", trans->addr);
+    return ret;
+  }
+
+  if (xSemaphoreTake(sync.sem, pdMS_TO_TICKS(timeoutMs)) != pdTRUE) {
+    // Still queued: withdraw it so the callback never touches this stack frame.
+    bool withdrawn = false;
+    portENTER_CRITICAL(&s_queueMux);
+    for (int i = 0; i < I2C_QUEUE_DEPTH; i++) {
+      if (s_slots[i].used && s_slots[i].t.ctx == &sync) {
+        s_slots[i].used = false;
+        withdrawn = true;
+        break;
+      }
+    }
+    portEXIT_CRITICAL(&s_queueMux);
+    if (withdrawn) {
+      printf("I2C queue timeout - addr 0x%02X\r\n", trans->addr);
+      return ESP_ERR_TIMEOUT;
+    }
+    // Already on the wire; the Wire timeout bounds how long this can take.
+    xSemaphoreTake(sync.sem, portMAX_DELAY);
+  }
+  return sync.result;
+}
+
+static esp_err_t I2C_ReadFlags(uint8_t Driver_addr, uint8_t Reg_addr, uint8_t *Reg_data, uint32_t Length, uint8_t flags) {
+  if (!Reg_data || Length == 0) {
+    return ESP_ERR_INVALID_ARG;
+  }
+  i2c_transaction_t t = {};
+  t.addr = Driver_addr;
+  t.reg = Reg_addr;
+  t.data = Reg_data;
+  t.length = Length;
+  t.flags = I2C_FLAG_READ | flags;
+  t.prio = I2C_PRIO_NORMAL;
+  return I2C_Transfer(&t);
+}
+
+esp_err_t I2C_Read(uint8_t Driver_addr, uint8_t Reg_addr, uint8_t *Reg_data, uint32_t Length) {
+  return I2C_ReadFlags(Driver_addr, Reg_addr, Reg_data, Length, 0);
+}
+
+esp_err_t I2C_ReadMergeable(uint8_t Driver_addr, uint8_t Reg_addr, uint8_t *Reg_data, uint32_t Length) {
+  return I2C_ReadFlags(Driver_addr, Reg_addr, Reg_data, Length, I2C_FLAG_MERGEABLE);
+}
+esp_err_t I2C_Write(uint8_t Driver_addr, uint8_t Reg_addr, const uint8_t *Reg_data, uint32_t Length) {
+  if (!Reg_data && Length > 0) {
+    return ESP_ERR_INVALID_ARG;
+  }
+  i2c_transaction_t t = {};
+  t.addr = Driver_addr;
+  t.reg = Reg_addr;
+  t.data = (uint8_t *)Reg_data;
+  t.length = Length;
+  t.flags = 0;
+  t.prio = I2C_PRIO_NORMAL;
+  return I2C_Transfer(&t);
+}
+
+void I2C_LogStats(void) {
+  i2c_dev_stats_t devStats[I2C_STATS_MAX_DEVICES];
+  portENTER_CRITICAL(&s_queueMux);
+  int64_t nowUs = esp_timer_get_time();
+  int64_t windowUs = nowUs - s_statsWindowStartUs;
+  uint64_t busyUs = s_busBusyUs;
+  uint32_t merged = s_mergedReads;
+  uint32_t full = s_queueFull;
+  memcpy(devStats, s_devStats, sizeof(devStats));
+  memset(s_devStats, 0, sizeof(s_devStats));
+  s_busBusyUs = 0;
+  s_mergedReads = 0;
+  s_queueFull = 0;
+  s_statsWindowStartUs = nowUs;
+  portEXIT_CRITICAL(&s_queueMux);
+
+  if (windowUs <= 0) return;
+  Serial.printf("[I2C] bus_util=%.2f%% merged_reads=%lu queue_full=%lu window=%lus\n",
+                (double)busyUs * 100.0 / (double)windowUs,
+                (unsigned long)merged,
+                (unsigned long)full,
+                (unsigned long)(windowUs / 1000000));
+  for (int i = 0; i < I2C_STATS_MAX_DEVICES; i++) {
+    const i2c_dev_stats_t *s = &devStats[i];
+    if (s->transactions == 0) continue;
+    Serial.printf("[I2C]   0x%02X n=%lu err=%lu lat_avg=%luus lat_max=%luus busy=%lums\n",
+                  s->addr,
+                  (unsigned long)s->transactions,
+                  (unsigned long)s->errors,
+                  (unsigned long)(s->latencyUsSum / s->transactions),
+                  (unsigned long)s->latencyUsMax,
+                  (unsigned long)(s->busyUs / 1000));
+  }
+}
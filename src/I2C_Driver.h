@@ -1,5 +1,5 @@
 #pragma once
-#include <Wire.h> 
+#include <Wire.h>
 #include <stdint.h>
 #include <esp_err.h>
 
@@ -7,10 +7,56 @@
 #define I2C_SCL_PIN       10
 #define I2C_SDA_PIN       11
 
+// Transaction engine: every bus access is queued and executed by a single
+// I2C worker task, so callers on different cores never contend for the Wire
+// mutex directly.  Touch traffic jumps the queue, but each device's own
+// transactions always run in the order they were queued.  Reads flagged
+// I2C_FLAG_MERGEABLE that touch neighbouring registers of one device are
+// merged into one burst.
+#define I2C_QUEUE_DEPTH        16
+#define I2C_COALESCE_MAX_LEN   32     // largest merged burst read, bytes
+#define I2C_COALESCE_MAX_GAP   2      // unrequested bytes allowed between merged reads
+#define I2C_STATS_MAX_DEVICES  8
+
+typedef enum {
+  I2C_PRIO_NORMAL = 0,
+  I2C_PRIO_TOUCH  = 1,                // input latency sensitive, always served first
+} i2c_prio_t;
+
+#define I2C_FLAG_READ          0x01
+#define I2C_FLAG_REG16         0x02   // 16-bit big-endian register address (SPD2010)
+// Opt-in for merging: the device auto-increments the register pointer and
+// reading the registers around this range (gap bytes included) has no side
+// effects, e.g. data registers, not status or FIFO ones.
+#define I2C_FLAG_MERGEABLE     0x04
+
+typedef void (*i2c_done_cb_t)(esp_err_t result, void *ctx);
+
+typedef struct {
+  uint8_t addr;
+  uint16_t reg;
+  uint8_t *data;                      // read destination or write source; NULL for a
+                                      // register-pointer-only write (length 0)
+  uint32_t length;
+  uint8_t flags;
+  i2c_prio_t prio;
+  i2c_done_cb_t done;                 // runs on the I2C worker task; must not block on I2C
+  void *ctx;
+} i2c_transaction_t;
 
 void I2C_Init(void);
 bool I2C_Lock(uint32_t timeoutMs = 200);
 void I2C_Unlock(void);
 
+// Queue a transaction; completion is reported through trans->done.  The
+// data buffer must stay valid until the callback has run.
+esp_err_t I2C_Submit(const i2c_transaction_t *trans);
+// Queue a transaction and block the caller until it completes.
+esp_err_t I2C_Transfer(const i2c_transaction_t *trans, uint32_t timeoutMs = 200);
+
 esp_err_t I2C_Read(uint8_t Driver_addr, uint8_t Reg_addr, uint8_t *Reg_data, uint32_t Length);
+// I2C_Read with I2C_FLAG_MERGEABLE, for side-effect-free data registers.
+esp_err_t I2C_ReadMergeable(uint8_t Driver_addr, uint8_t Reg_addr, uint8_t *Reg_data, uint32_t Length);
 esp_err_t I2C_Write(uint8_t Driver_addr, uint8_t Reg_addr, const uint8_t *Reg_data, uint32_t Length);
+
+void I2C_LogStats(void);                                       // per-device latency + bus utilisation, resets the window
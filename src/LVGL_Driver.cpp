@@ -7,6 +7,11 @@
 ******************************************************************************/
 #include "LVGL_Driver.h"
 #include "PWR_Key.h"
+#include "frame_profiler.h"
+
+extern FrameProfiler frameProfiler;
+
+uint32_t LVGL_EVENT_TOUCH_GESTURE = 0;
 
 static esp_timer_handle_t s_lvgl_tick_timer = NULL;
 static lv_disp_draw_buf_t draw_buf;
@@ -41,6 +46,10 @@ static void rotate_pixels_clockwise_90(const lv_area_t *area,
 
 
 
+static void Lvgl_RenderStart(lv_disp_drv_t *disp_drv) {
+  frameProfiler.frameStart();
+}
+
 /* Serial debugging */
 void Lvgl_print(const char *buf) {
   // Serial.printf(buf);
@@ -55,12 +64,18 @@ void Lvgl_Display_LCD(lv_disp_drv_t *disp_drv, const lv_area_t *area, lv_color_t
   // already blanked so the data would be invisible, and the SPI DMA transfer
   // wastes power. Only signal flush completion immediately if no transfer was
   // started; otherwise the panel IO callback signals LVGL when DMA finishes.
+  // Every flush closes the pending touch-latency sample, drawn or not, so a
+  // touch is never attributed to a later frame.
+  Touch_PipelineNoteFlush();
   if (PWR_IsDisplayAwake()) {
     const uint32_t pixel_count = lv_area_get_size(area);
     if (rot_buf != NULL && pixel_count <= LVGL_ROT_BUF_LEN) {
+      frameProfiler.flushStart();
+      int64_t rotateStart = esp_timer_get_time();
       lv_area_t rotated_area;
       rotate_area_clockwise_90(area, &rotated_area);
       rotate_pixels_clockwise_90(area, color_p, rot_buf);
+      frameProfiler.addStage(FRAME_STAGE_ROTATE, (uint32_t)(esp_timer_get_time() - rotateStart));
       LCD_addWindow(rotated_area.x1, rotated_area.y1, rotated_area.x2, rotated_area.y2,
                     (uint16_t *)&rot_buf->full);
     } else {
@@ -72,13 +87,21 @@ void Lvgl_Display_LCD(lv_disp_drv_t *disp_drv, const lv_area_t *area, lv_color_t
 }
 /*Read the touchpad*/
 void Lvgl_Touchpad_Read(lv_indev_drv_t *indev_drv, lv_indev_data_t *data) {
-  bool tp_pressed = false;
-  uint16_t tp_x = 0;
-  uint16_t tp_y = 0;
-  uint16_t tp_strength = 0;
-  uint8_t tp_cnt = 0;
-  // Read coordinates AND signal strength in one call.
-  tp_pressed = Touch_Get_xy(&tp_x, &tp_y, &tp_strength, &tp_cnt, CONFIG_ESP_LCD_TOUCH_MAX_POINTS);
+  // Samples are fetched by the touch reader task when TP_INT fires; this
+  // callback only drains the ring, so an idle panel costs no I2C traffic.
+  static touch_sample_t s_lastSample = { 0 };
+  touch_sample_t sample;
+  if (Touch_PipelinePop(&sample)) {
+    s_lastSample = sample;
+    Touch_PipelineNoteConsumed(&sample);
+    // Hand queued samples to LVGL one per read so fast drags keep every point.
+    data->continue_reading = Touch_PipelineAvailable();
+  } else if (s_lastSample.pressed &&
+             esp_timer_get_time() - s_lastSample.timestampUs > (int64_t)TOUCH_ACTIVE_HOLD_MS * 1000) {
+    // The SPD2010 reports continuously while a finger is down; silence this
+    // long means the touch-up packet was lost.  Don't leave LVGL stuck pressed.
+    s_lastSample.pressed = false;
+  }
 
   // SPD2010 protocol: weight > 0 means touch is active; weight == 0 is the
   // hardware's "touch up" notification (not a weak phantom).  We only forward
@@ -86,16 +109,16 @@ void Lvgl_Touchpad_Read(lv_indev_drv_t *indev_drv, lv_indev_data_t *data) {
   // to released.  Log on state transitions only to avoid serial flooding.
   static bool s_wasPressedLast = false;
 
-  bool isActiveTouch = tp_pressed && (tp_cnt > 0) && (tp_strength > 0);
+  bool isActiveTouch = s_lastSample.pressed;
 
   if (isActiveTouch) {
-    data->point.x = tp_y;
-    data->point.y = LCD_HEIGHT - 1 - tp_x;
+    data->point.x = s_lastSample.x;
+    data->point.y = s_lastSample.y;
     data->state = LV_INDEV_STATE_PR;
     if (!s_wasPressedLast) {
-      Serial.printf("[Touch] PRESS  raw=(%u,%u) lvgl=(%d,%d) weight=%u tick=%u\n",
-                    tp_x, tp_y, data->point.x, data->point.y,
-                    (unsigned)tp_strength, (unsigned)lv_tick_get());
+      Serial.printf("[Touch] PRESS  lvgl=(%d,%d) weight=%u tick=%u\n",
+                    data->point.x, data->point.y,
+                    (unsigned)s_lastSample.weight, (unsigned)lv_tick_get());
       s_wasPressedLast = true;
     }
   } else {
@@ -116,6 +139,20 @@ void Lvgl_Touchpad_Read(lv_indev_drv_t *indev_drv, lv_indev_data_t *data) {
       s_wasPressedLast = false;
     }
   }
+
+  touch_gesture_t gesture;
+  if (Touch_ConsumeGesture(&gesture)) {
+    Serial.printf("[Touch] GESTURE %s at=(%d,%d) v=(%.0f,%.0f)px/s dur=%lums\n",
+                  Touch_GestureName(gesture.type), gesture.x, gesture.y,
+                  gesture.velocityX, gesture.velocityY, (unsigned long)gesture.durationMs);
+    // Read callbacks run inside lv_timer_handler() on the UI task, so the
+    // screen's handlers may call LVGL directly.
+    lv_obj_t *screen = lv_scr_act();
+    if (screen && LVGL_EVENT_TOUCH_GESTURE) {
+      lv_event_send(screen, (lv_event_code_t)LVGL_EVENT_TOUCH_GESTURE, &gesture);
+    }
+  }
+  Touch_PipelineTick();
 }
 void example_increase_lvgl_tick(void *arg) {
   /* Tell LVGL how many milliseconds has elapsed */
@@ -123,6 +160,7 @@ void example_increase_lvgl_tick(void *arg) {
 }
 void Lvgl_Init(void) {
   lv_init();
+  LVGL_EVENT_TOUCH_GESTURE = lv_event_register_id();
   lv_disp_draw_buf_init(&draw_buf, buf1, NULL, LVGL_DRAW_BUF_LEN);
 
   /*Initialize the display*/
@@ -132,6 +170,7 @@ void Lvgl_Init(void) {
   disp_drv.hor_res = LCD_WIDTH;
   disp_drv.ver_res = LCD_HEIGHT;
   disp_drv.flush_cb = Lvgl_Display_LCD;
+  disp_drv.render_start_cb = Lvgl_RenderStart;
   // Power optimization: avoid full-frame redraw on every LVGL flush.
   // Let LVGL redraw only invalidated regions.
   disp_drv.full_refresh = 1;
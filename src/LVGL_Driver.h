@@ -8,6 +8,7 @@
 #include <esp_heap_caps.h>
 #include "Display_SPD2010.h"
 #include "Touch_SPD2010.h"
+#include "Touch_Pipeline.h"
 
 #define LCD_WIDTH     EXAMPLE_LCD_WIDTH
 #define LCD_HEIGHT    EXAMPLE_LCD_HEIGHT
@@ -24,6 +25,12 @@ void Lvgl_Display_LCD( lv_disp_drv_t *disp_drv, const lv_area_t *area, lv_color_
 void Lvgl_Touchpad_Read( lv_indev_drv_t * indev_drv, lv_indev_data_t * data );                // Read the touchpad
 void example_increase_lvgl_tick(void *arg);
 
+// Event sent to the active screen for every gesture the touch pipeline
+// recognises (swipes, tap, double tap, long press).  The event parameter is
+// the touch_gesture_t; read it with lv_event_get_param().  Registered by
+// Lvgl_Init().
+extern uint32_t LVGL_EVENT_TOUCH_GESTURE;
+
 void Lvgl_Init(void);
 void Lvgl_Loop(void);
 void Lvgl_PauseTick(void);
@@ -1,4 +1,7 @@
 #include "RTC_PCF85063.h"
+#include "civil_time.h"
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
 
 datetime_t datetime= {0};
 
@@ -123,6 +126,135 @@ void PCF85063_Read_Time(datetime_t *time)
 	}
 }
 
+static time_t datetimeToEpoch(const datetime_t &time)
+{
+	CivilTime civil = {(int16_t)time.year, time.month, time.day, time.hour, time.minute, time.second};
+	return civilToUtc(civil);
+}
+
+/******************************************************************************
+function:	Whether the RTC holds a time
+parameter:
+Info:		False after the oscillator stopped (power loss) and before the time
+			was ever set; the power-on default is 1970.
+******************************************************************************/
+bool PCF85063_Time_Valid()
+{
+	uint8_t buf[7] = {0};
+	if(I2C_Read(PCF85063_ADDRESS, RTC_SECOND_ADDR, buf, sizeof(buf)) != ESP_OK)
+		return false;
+	return !(buf[0] & RTC_SECOND_OS) && bcdToDec(buf[6]) + YEAR_OFFSET >= 2025;
+}
+
+/******************************************************************************
+function:	Read Time And Date as seconds since the epoch
+parameter:
+Info:		Whole seconds only
+******************************************************************************/
+bool PCF85063_Read_Epoch(time_t *utc)
+{
+	uint8_t buf[7] = {0};
+	if(I2C_Read(PCF85063_ADDRESS, RTC_SECOND_ADDR, buf, sizeof(buf)) != ESP_OK)
+		return false;
+	datetime_t time = {(uint16_t)(bcdToDec(buf[6]) + YEAR_OFFSET), (uint8_t)bcdToDec(buf[5] & 0x1F),
+					   (uint8_t)bcdToDec(buf[3] & 0x3F), 0, (uint8_t)bcdToDec(buf[2] & 0x3F),
+					   (uint8_t)bcdToDec(buf[1] & 0x7F), (uint8_t)bcdToDec(buf[0] & 0x7F)};
+	*utc = datetimeToEpoch(time);
+	return true;
+}
+
+/******************************************************************************
+function:	Wait for the next second to begin
+parameter:	utc: the second that began
+			edge: the system time it began at
+			waitMs: sleep this long first, when the caller knows roughly
+			where the edge is
+Info:		Polls the seconds every tick for up to 1.2 s; the edge is good to
+			about a millisecond.
+******************************************************************************/
+bool PCF85063_Read_Edge(time_t *utc, struct timeval *edge, uint32_t waitMs)
+{
+	uint8_t first = 0, buf[7] = {0};
+	struct timeval before, after;
+	if(waitMs)
+		vTaskDelay(pdMS_TO_TICKS(waitMs));
+	if(I2C_Read(PCF85063_ADDRESS, RTC_SECOND_ADDR, &first, 1) != ESP_OK)
+		return false;
+	gettimeofday(&before, NULL);
+	for(int i = 0; i < 1200; i++) {
+		vTaskDelay(1);
+		if(I2C_Read(PCF85063_ADDRESS, RTC_SECOND_ADDR, buf, 1) != ESP_OK)
+			return false;
+		gettimeofday(&after, NULL);
+		if((buf[0] & 0x7F) != (first & 0x7F)) {
+			// The second just began; the rest cannot roll over before this read.
+			if(I2C_Read(PCF85063_ADDRESS, RTC_SECOND_ADDR, buf, sizeof(buf)) != ESP_OK)
+				return false;
+			int64_t mid = ((int64_t)before.tv_sec * 1000000 + before.tv_usec +
+						   (int64_t)after.tv_sec * 1000000 + after.tv_usec) / 2;
+			edge->tv_sec = mid / 1000000;
+			edge->tv_usec = mid % 1000000;
+			datetime_t time = {(uint16_t)(bcdToDec(buf[6]) + YEAR_OFFSET), (uint8_t)bcdToDec(buf[5] & 0x1F),
+							   (uint8_t)bcdToDec(buf[3] & 0x3F), 0, (uint8_t)bcdToDec(buf[2] & 0x3F),
+							   (uint8_t)bcdToDec(buf[1] & 0x7F), (uint8_t)bcdToDec(buf[0] & 0x7F)};
+			*utc = datetimeToEpoch(time);
+			return true;
+		}
+		before = after;
+	}
+	return false;
+}
+
+/******************************************************************************
+function:	Stop the clock at a time
+parameter:
+Info:		Stopping clears the prescaler; PCF85063_Release() starts the clock
+			and the next second begins RTC_STOP_RELEASE_US later.  Writing the
+			seconds also clears the oscillator-stopped flag.
+******************************************************************************/
+void PCF85063_Hold(time_t utc)
+{
+	uint8_t Value = RTC_CTRL_1_DEFAULT|RTC_CTRL_1_CAP_SEL|RTC_CTRL_1_STOP;
+	I2C_Write(PCF85063_ADDRESS, RTC_CTRL_1_ADDR, &Value, 1);
+
+	CivilTime civil;
+	civilFromUtc(utc, civil);
+	datetime_t time = {(uint16_t)civil.year, civil.month, civil.day,
+					   civilWeekday(civilToDays(civil.year, civil.month, civil.day)),
+					   civil.hour, civil.minute, civil.second};
+	PCF85063_Set_All(time);
+}
+
+void PCF85063_Release()
+{
+	uint8_t Value = RTC_CTRL_1_DEFAULT|RTC_CTRL_1_CAP_SEL;
+	esp_err_t ret = I2C_Write(PCF85063_ADDRESS, RTC_CTRL_1_ADDR, &Value, 1);
+	if(ret != ESP_OK)
+		printf("PCF85063 : Failed to restart the clock\r\n");
+}
+
+/******************************************************************************
+function:	Set the frequency offset
+parameter:	steps: RTC_OFFSET_MIN..RTC_OFFSET_MAX, RTC_OFFSET_PPM each
+Info:		Correction pulses every 4 minutes rather than every 2 hours, so an
+			interval of half an hour already sees its correction in full.
+******************************************************************************/
+void PCF85063_Set_Offset(int8_t steps)
+{
+	uint8_t Value = RTC_OFFSET_MODE | ((uint8_t)steps & 0x7F);
+	esp_err_t ret = I2C_Write(PCF85063_ADDRESS, RTC_OFFSET_ADDR, &Value, 1);
+	if(ret != ESP_OK)
+		printf("PCF85063 : Failed to set the offset\r\n");
+}
+
+int8_t PCF85063_Read_Offset()
+{
+	uint8_t Value = 0;
+	if(I2C_Read(PCF85063_ADDRESS, RTC_OFFSET_ADDR, &Value, 1) != ESP_OK)
+		return 0;
+	return (int8_t)(Value << 1) >> 1;	// 7-bit two's complement
+}
+
 /******************************************************************************
 function:	Enable Alarm and Clear Alarm flag
 parameter:			
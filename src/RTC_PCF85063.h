@@ -1,6 +1,8 @@
 #pragma once
 
 #include "I2C_Driver.h"
+#include <time.h>
+#include <sys/time.h>
 
 
 //PCF85063_ADDRESS
@@ -30,6 +32,9 @@
 #define RTC_TIMER_VAL 	    (0x10)
 #define RTC_TIMER_MODE	    (0x11)
 
+//RTC_SECOND registar
+#define RTC_SECOND_OS       (0x80) //oscillator stopped since the time was written: the time is not valid
+
 //RTC_CTRL_1 registar
 #define RTC_CTRL_1_EXT_TEST (0x80)
 #define RTC_CTRL_1_STOP     (0x20) //0-RTC clock runs 1- RTC clock is stopped
@@ -46,7 +51,12 @@
 #define RTC_CTRL_2_TF       (0X08)
 
 //
-#define RTC_OFFSET_MODE     (0X80)
+#define RTC_OFFSET_MODE     (0X80) //0-correction every 2 hours 1-every 4 minutes
+#define RTC_OFFSET_PPM      (4.069) //frequency change per offset LSB with RTC_OFFSET_MODE set, positive = faster
+#define RTC_OFFSET_MIN      (-64)
+#define RTC_OFFSET_MAX      (63)
+// After the STOP bit is cleared the first second increments this much later
+#define RTC_STOP_RELEASE_US (507813)
 
 //
 #define RTC_TIMER_MODE_TE   (0X04) //timer enable 0-disalbe 1-enable
@@ -83,6 +93,16 @@ void PCF85063_Set_All(datetime_t time);
 
 void PCF85063_Read_Time(datetime_t *time);
 
+// The RTC keeps UTC.
+bool PCF85063_Time_Valid(void);
+bool PCF85063_Read_Epoch(time_t *utc);
+bool PCF85063_Read_Edge(time_t *utc, struct timeval *edge, uint32_t waitMs = 0);
+void PCF85063_Hold(time_t utc);
+void PCF85063_Release(void);
+
+void PCF85063_Set_Offset(int8_t steps);
+int8_t PCF85063_Read_Offset(void);
+
 
 void PCF85063_Enable_Alarm(void);
 uint8_t PCF85063_Get_Alarm_Flag();
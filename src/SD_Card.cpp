@@ -1,4 +1,9 @@
 #include "SD_Card.h"
+#include "sd_index.h"
+#include "esp_heap_caps.h"
+#include "esp_timer.h"
+
+extern SdIndex sdIndex;
 
 bool SDCard_Flag = 0;
 bool SDCard_Finish = 0;
@@ -14,14 +19,73 @@ void SD_D3_EN(){
   Set_EXIO(EXIO_PIN4,High);
   vTaskDelay(pdMS_TO_TICKS(10));
 }
-void SD_Init() {
-  // SD MMC
-  if(!SD_MMC.setPins(SD_CLK_PIN, SD_CMD_PIN, SD_D0_PIN,-1,-1,-1)){
+// Fastest first.  A clock is kept only if the card mounts and reads back the
+// same data twice; the SDMMC host checks every block's CRC, so a marginal
+// clock surfaces as a failed read or a mismatch.  Nothing is written to the
+// card before a clock has passed.
+static const uint32_t SD_Clocks[] = { SDMMC_FREQ_HIGHSPEED, SDMMC_FREQ_26M, SDMMC_FREQ_DEFAULT, 10000 };
+
+static bool SD_Mount(uint32_t freqKhz, bool formatIfFailed) {
+  if (!SD_MMC.setPins(SD_CLK_PIN, SD_CMD_PIN, SD_D0_PIN, -1, -1, -1)) {
     printf("SD MMC: Pin change failed!\r\n");
-    return;
+    return false;
   }
   SD_D3_EN();
-  if (SD_MMC.begin("/sdcard", true, true)) {                // "/sdcard", true, true     or  "/sdcard", true, false                            
+  return SD_MMC.begin(SD_MOUNT_POINT, true, formatIfFailed, freqKhz);
+}
+
+static uint32_t SD_Le32(const uint8_t *p) {
+  return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+// Read-only: the MBR, the FAT volume boot sector and the first
+// SD_VERIFY_SECTORS sectors of the FAT, each read twice and compared.
+static bool SD_Verify() {
+  uint8_t *a = (uint8_t *)heap_caps_malloc(1024, MALLOC_CAP_DMA);
+  if (!a) return false;
+  uint8_t *b = a + 512;
+
+  bool ok = SD_MMC.readRAW(a, 0) && a[510] == 0x55 && a[511] == 0xAA;
+  // Superfloppy cards start the volume at sector 0, partitioned ones at the
+  // first MBR entry.
+  uint32_t volume = ok && a[0] != 0xEB && a[0] != 0xE9 ? SD_Le32(a + 0x1C6) : 0;
+  ok = ok && SD_MMC.readRAW(a, volume) && a[510] == 0x55 && a[511] == 0xAA &&
+       (a[11] | (a[12] << 8)) == 512;
+  uint32_t fat = volume + (a[14] | (a[15] << 8));   // after the reserved sectors
+
+  for (uint32_t i = 0; ok && i < SD_VERIFY_SECTORS; i++) {
+    ok = SD_MMC.readRAW(a, fat + i) && SD_MMC.readRAW(b, fat + i) && memcmp(a, b, 512) == 0;
+  }
+  heap_caps_free(a);
+  return ok;
+}
+
+static bool SD_Negotiate() {
+  for (uint32_t freqKhz : SD_Clocks) {
+    if (SD_Mount(freqKhz, false)) {
+      if (SD_Verify()) {
+        SD_FreqKhz = freqKhz;
+        return true;
+      }
+      SD_MMC.end();
+    }
+    printf("SD MMC: %lukHz unstable, backing off\r\n", (unsigned long)freqKhz);
+  }
+  return false;
+}
+
+uint32_t SD_FreqKhz = 0;
+
+void SD_Init() {
+  // SD MMC
+  uint32_t start = millis();
+  if (SD_Negotiate()) {
+    printf("SD card initialization successful! 1-bit @ %lukHz (%lums)\r\n",
+           (unsigned long)SD_FreqKhz, (unsigned long)(millis() - start));
+  } else if (SD_Mount(SDMMC_FREQ_DEFAULT, true)) {
+    // Last resort: the original default-clock mount, which may format.
+    // Never formatted while probing, so a marginal clock can't wipe the card.
+    SD_FreqKhz = SDMMC_FREQ_DEFAULT;
     printf("SD card initialization successful!\r\n");
   } else {
     printf("SD card initialization failed!\r\n");
@@ -50,57 +114,20 @@ void SD_Init() {
     printf("Free space: %llu\n", totalBytes - usedBytes);
   }
 }
+// Both lookups are answered from SdIndex (see sd_index.h): O(1) / O(n) in
+// memory once the directory has been indexed, instead of an openNextFile walk.
 bool File_Search(const char* directory, const char* fileName)    
 {
-  File Path = SD_MMC.open(directory);
-  if (!Path) {
-    printf("Path: <%s> does not exist\r\n",directory);
-    return false;
-  }
-  File file = Path.openNextFile();
-  while (file) {
-    if (strcmp(file.name(), fileName) == 0) {                           
-      if (strcmp(directory, "/") == 0)
-        printf("File '%s%s' found in root directory.\r\n",directory,fileName);  
-      else
-        printf("File '%s/%s' found in root directory.\r\n",directory,fileName); 
-      Path.close();                                                     
-      return true;                                                     
-    }
-    file = Path.openNextFile();                                        
-  }
+  bool found = sdIndex.contains(directory, fileName);
   if (strcmp(directory, "/") == 0)
-    printf("File '%s%s' not found in root directory.\r\n",directory,fileName);           
+    printf("File '%s%s' %s in root directory.\r\n",directory,fileName,found ? "found" : "not found");
   else
-    printf("File '%s/%s' not found in root directory.\r\n",directory,fileName);          
-  Path.close();                                                         
-  return false;                                                         
+    printf("File '%s/%s' %s in root directory.\r\n",directory,fileName,found ? "found" : "not found");
+  return found;
 }
 uint16_t Folder_retrieval(const char* directory, const char* fileExtension, char File_Name[][100],uint16_t maxFiles)    
 {
-  File Path = SD_MMC.open(directory);
-  if (!Path) {
-    printf("Path: <%s> does not exist\r\n",directory);
-    return false;
-  }
-  
-  uint16_t fileCount = 0;
-  char filePath[100];
-  File file = Path.openNextFile();
-  while (file && fileCount < maxFiles) {
-    if (!file.isDirectory() && strstr(file.name(), fileExtension)) {
-      strncpy(File_Name[fileCount], file.name(), sizeof(File_Name[fileCount])); 
-      if (strcmp(directory, "/") == 0) {                                      
-        snprintf(filePath, 100, "%s%s", directory, file.name());   
-      } else {                                                            
-        snprintf(filePath, 100, "%s/%s", directory, file.name());
-      }
-      printf("File found: %s\r\n", filePath);
-      fileCount++;
-    }
-    file = Path.openNextFile();                                      
-  }
-  Path.close();                                                         
+  uint16_t fileCount = sdIndex.list(directory, fileExtension, File_Name, maxFiles);
   if (fileCount > 0) {
     printf("Retrieved %d mp3 files\r\n",fileCount);
     return fileCount;                                                 
@@ -110,6 +137,71 @@ uint16_t Folder_retrieval(const char* directory, const char* fileExtension, char
   }
 }
 
+static void SD_RunBench(uint32_t freqKhz, uint8_t *buf) {
+  const uint32_t fileBytes = 1024 * 1024, chunk = 32 * 1024, block = 4096, ops = 128;
+  const char *path = "/.sdbench";
+  uint32_t seed = 1;
+
+  int64_t t0 = esp_timer_get_time();
+  File file = SD_MMC.open(path, FILE_WRITE);
+  for (uint32_t off = 0; file && off < fileBytes; off += chunk) file.write(buf, chunk);
+  if (file) file.close();
+  int64_t t1 = esp_timer_get_time();
+
+  file = SD_MMC.open(path);
+  for (uint32_t off = 0; file && off < fileBytes; off += chunk) file.read(buf, chunk);
+  if (file) file.close();
+  int64_t t2 = esp_timer_get_time();
+
+  file = SD_MMC.open(path);
+  for (uint32_t i = 0; file && i < ops; i++) {
+    seed = seed * 1103515245u + 12345u;
+    file.seek((seed % (fileBytes / block)) * block);
+    file.read(buf, block);
+  }
+  if (file) file.close();
+  int64_t t3 = esp_timer_get_time();
+
+  file = SD_MMC.open(path, "r+");
+  for (uint32_t i = 0; file && i < ops; i++) {
+    seed = seed * 1103515245u + 12345u;
+    file.seek((seed % (fileBytes / block)) * block);
+    file.write(buf, block);
+  }
+  if (file) file.close();
+  int64_t t4 = esp_timer_get_time();
+  SD_MMC.remove(path);
+
+  // bytes/us == MB/s
+  printf("SD bench %5lukHz: seq write %.2f MB/s, seq read %.2f MB/s, rand read %lu IOPS, rand write %lu IOPS\r\n",
+         (unsigned long)freqKhz,
+         (double)fileBytes / (double)(t1 - t0), (double)fileBytes / (double)(t2 - t1),
+         (unsigned long)(ops * 1000000LL / (t3 - t2)), (unsigned long)(ops * 1000000LL / (t4 - t3)));
+}
+
+// Benchmarks every clock that mounts and verifies, then returns to the one
+// SD_Init() negotiated.  Takes tens of seconds; bench builds only.
+void SD_SelfTest() {
+  if (!SD_FreqKhz) return;
+  uint32_t chosen = SD_FreqKhz;
+  uint8_t *buf = (uint8_t *)heap_caps_malloc(32 * 1024, MALLOC_CAP_DMA);
+  if (!buf) return;
+  memset(buf, 0xA5, 32 * 1024);
+
+  for (uint32_t freqKhz : SD_Clocks) {
+    SD_MMC.end();
+    if (SD_Mount(freqKhz, false) && SD_Verify()) {
+      SD_RunBench(freqKhz, buf);
+    } else {
+      printf("SD bench %5lukHz: unstable\r\n", (unsigned long)freqKhz);
+    }
+  }
+  heap_caps_free(buf);
+
+  SD_MMC.end();
+  if (!SD_Mount(chosen, false)) printf("SD MMC: remount after self-test failed!\r\n");
+}
+
 void Flash_test()
 {
   printf("/********** RAM Test**********/\r\n");
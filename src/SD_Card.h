@@ -9,11 +9,19 @@
 #define SD_CLK_PIN      14
 #define SD_CMD_PIN      17 
 #define SD_D0_PIN       16 
+// 1-bit bus only: D1/D2 are not routed on this board and D3 only reaches the
+// TCA9554 (EXIO4, held high to select SD mode).
+
+#define SD_MOUNT_POINT     "/sdcard"
+#define SD_VERIFY_SECTORS  64               // FAT sectors read twice per candidate clock
+
+extern uint32_t SD_FreqKhz;                 // bus clock mounted by SD_Init(), 0 if none
 
 extern uint16_t SDCard_Size;
 extern uint16_t Flash_Size;
 
 void SD_Init();
+void SD_SelfTest();                         // build with -DSD_SELF_TEST to run at boot
 void Flash_test();
 
 bool File_Search(const char* directory, const char* fileName);
@@ -1,51 +1,30 @@
 #include "TCA9554PWR.h"
 
 /*****************************************************  Operation register REG   ****************************************************/   
-uint8_t I2C_Read_EXIO(uint8_t REG)                             // Read the value of the TCA9554PWR register REG
-{
-  if (!I2C_Lock()) {
-    printf("I2C lock timeout - I2C Read EXIO\r\n");
-    return 0;
-  }
-  Wire.beginTransmission(TCA9554_ADDRESS);                
-  Wire.write(REG);                                        
-  uint8_t result = Wire.endTransmission();               
-  if (result != 0) {                                     
-    printf("The I2C transmission fails. - I2C Read EXIO\r\n");
-    I2C_Unlock();
-    return 0;
-  }
-  int received = Wire.requestFrom(TCA9554_ADDRESS, 1); 
-  uint8_t bitsStatus = 0;
-  if (received != 1) {
-    printf("The I2C read length is invalid. - I2C Read EXIO exp=1 got=%d\r\n", received);
-    I2C_Unlock();
-    return 0;
-  }
-  if (Wire.available()) {                  
-    bitsStatus = Wire.read(); 
-  }
-  I2C_Unlock();
-  return bitsStatus;                                     
-}
-uint8_t I2C_Write_EXIO(uint8_t REG,uint8_t Data)              // Write Data to the REG register of the TCA9554PWR
-{
-  if (!I2C_Lock()) {
-    printf("I2C lock timeout - I2C Write EXIO\r\n");
-    return -1;
-  }
-  Wire.beginTransmission(TCA9554_ADDRESS);                
-  Wire.write(REG);                                        
-  Wire.write(Data);                                       
-  uint8_t result = Wire.endTransmission();                  
-  if (result != 0) {    
-    printf("The I2C transmission fails. - I2C Write EXIO\r\n");
-    I2C_Unlock();
-    return -1;
-  }
-  I2C_Unlock();
-  return 0;                                             
-}
+uint8_t I2C_Read_EXIO(uint8_t REG)                             // Read the value of the TCA9554PWR register REG
+{
+  uint8_t bitsStatus = 0;
+  i2c_transaction_t t = {};                                     // TCA9554 does not auto-increment: never merged
+  t.addr = TCA9554_ADDRESS;
+  t.reg = REG;
+  t.data = &bitsStatus;
+  t.length = 1;
+  t.flags = I2C_FLAG_READ;
+  t.prio = I2C_PRIO_NORMAL;
+  if (I2C_Transfer(&t) != ESP_OK) {
+    printf("The I2C transmission fails. - I2C Read EXIO\r\n");
+    return 0;
+  }
+  return bitsStatus;
+}
+uint8_t I2C_Write_EXIO(uint8_t REG,uint8_t Data)              // Write Data to the REG register of the TCA9554PWR
+{
+  if (I2C_Write(TCA9554_ADDRESS, REG, &Data, 1) != ESP_OK) {
+    printf("The I2C transmission fails. - I2C Write EXIO\r\n");
+    return -1;
+  }
+  return 0;
+}
 /********************************************************** Set EXIO mode **********************************************************/       
 void Mode_EXIO(uint8_t Pin,uint8_t State)                 // Set the mode of the TCA9554PWR Pin. The default is Output mode (output mode or input mode). State: 0= Output mode 1= input mode   
 {
@@ -0,0 +1,312 @@
+#include "Touch_Pipeline.h"
+#include "Touch_SPD2010.h"
+#include "Display_SPD2010.h"
+#include "PWR_Key.h"
+#include <atomic>
+#include "esp_timer.h"
+
+static TaskHandle_t s_readerTask = NULL;
+
+// SPSC ring: the reader task is the only producer, the LVGL indev callback the
+// only consumer, so head/tail need no lock — just acquire/release ordering.
+static touch_sample_t s_ring[TOUCH_RING_SIZE];
+static std::atomic<uint32_t> s_ringHead(0);   // next write
+static std::atomic<uint32_t> s_ringTail(0);   // next read
+static volatile uint32_t s_ringDropped = 0;
+
+// Latest recognised gesture, handed to the UI core.
+static portMUX_TYPE s_gestureMux = portMUX_INITIALIZER_UNLOCKED;
+static touch_gesture_t s_pendingGesture = { TOUCH_GESTURE_NONE };
+
+// Timestamp of the ISR that raised the sample LVGL consumed most recently and
+// has not been drawn yet (0 = nothing pending).
+static int64_t s_pendingLatencySampleUs = 0;
+
+static bool Touch_RingPush(const touch_sample_t *sample) {
+  uint32_t head = s_ringHead.load(std::memory_order_relaxed);
+  uint32_t tail = s_ringTail.load(std::memory_order_acquire);
+  if (head - tail >= TOUCH_RING_SIZE) {
+    s_ringDropped++;
+    return false;
+  }
+  s_ring[head & (TOUCH_RING_SIZE - 1)] = *sample;
+  s_ringHead.store(head + 1, std::memory_order_release);
+  return true;
+}
+
+bool Touch_PipelineAvailable(void) {
+  return s_ringHead.load(std::memory_order_acquire) != s_ringTail.load(std::memory_order_relaxed);
+}
+
+bool Touch_PipelinePop(touch_sample_t *sample) {
+  uint32_t tail = s_ringTail.load(std::memory_order_relaxed);
+  if (s_ringHead.load(std::memory_order_acquire) == tail) {
+    return false;
+  }
+  *sample = s_ring[tail & (TOUCH_RING_SIZE - 1)];
+  s_ringTail.store(tail + 1, std::memory_order_release);
+  return true;
+}
+
+/*************************************************** Gesture recogniser ***************************************************/
+static struct {
+  bool down;
+  bool longPressSent;
+  int16_t startX, startY;
+  int16_t lastX, lastY;
+  int64_t startUs;
+  int64_t lastUs;
+  float velX, velY;                      // px/s, exponentially smoothed
+  int64_t lastTapUs;
+  int16_t lastTapX, lastTapY;
+} s_gesture = { 0 };
+
+static void Touch_PublishGesture(touch_gesture_type_t type, int16_t x, int16_t y, uint32_t durationMs) {
+  touch_gesture_t g;
+  g.type = type;
+  g.x = x;
+  g.y = y;
+  g.velocityX = s_gesture.velX;
+  g.velocityY = s_gesture.velY;
+  g.durationMs = durationMs;
+  portENTER_CRITICAL(&s_gestureMux);
+  s_pendingGesture = g;
+  portEXIT_CRITICAL(&s_gestureMux);
+}
+
+static void Touch_GestureFeed(const touch_sample_t *s) {
+  if (s->pressed) {
+    // A lost touch-up packet must not glue two separate touches together.
+    if (s_gesture.down && s->timestampUs - s_gesture.lastUs > (int64_t)TOUCH_ACTIVE_HOLD_MS * 1000) {
+      s_gesture.down = false;
+    }
+    if (!s_gesture.down) {
+      s_gesture.down = true;
+      s_gesture.longPressSent = false;
+      s_gesture.startX = s_gesture.lastX = s->x;
+      s_gesture.startY = s_gesture.lastY = s->y;
+      s_gesture.startUs = s_gesture.lastUs = s->timestampUs;
+      s_gesture.velX = s_gesture.velY = 0.0f;
+      return;
+    }
+
+    int64_t dtUs = s->timestampUs - s_gesture.lastUs;
+    if (dtUs > 0) {
+      // EWMA over instantaneous velocity smooths the jittery SPD2010 reports
+      // without lagging a fast flick by more than a couple of samples.
+      float vx = (float)(s->x - s_gesture.lastX) * 1e6f / (float)dtUs;
+      float vy = (float)(s->y - s_gesture.lastY) * 1e6f / (float)dtUs;
+      s_gesture.velX = 0.6f * vx + 0.4f * s_gesture.velX;
+      s_gesture.velY = 0.6f * vy + 0.4f * s_gesture.velY;
+    }
+    s_gesture.lastX = s->x;
+    s_gesture.lastY = s->y;
+    s_gesture.lastUs = s->timestampUs;
+
+    uint32_t heldMs = (uint32_t)((s->timestampUs - s_gesture.startUs) / 1000);
+    int dx = s->x - s_gesture.startX;
+    int dy = s->y - s_gesture.startY;
+    if (!s_gesture.longPressSent && heldMs >= TOUCH_LONG_PRESS_MS &&
+        abs(dx) <= TOUCH_TAP_SLOP && abs(dy) <= TOUCH_TAP_SLOP) {
+      s_gesture.longPressSent = true;
+      Touch_PublishGesture(TOUCH_GESTURE_LONG_PRESS, s_gesture.startX, s_gesture.startY, heldMs);
+    }
+    return;
+  }
+
+  if (!s_gesture.down) return;
+  s_gesture.down = false;
+  if (s_gesture.longPressSent) return;
+
+  uint32_t durationMs = (uint32_t)((s_gesture.lastUs - s_gesture.startUs) / 1000);
+  int dx = s_gesture.lastX - s_gesture.startX;
+  int dy = s_gesture.lastY - s_gesture.startY;
+  float speed = sqrtf(s_gesture.velX * s_gesture.velX + s_gesture.velY * s_gesture.velY);
+
+  if ((abs(dx) >= TOUCH_SWIPE_MIN_DIST || abs(dy) >= TOUCH_SWIPE_MIN_DIST) &&
+      speed >= TOUCH_SWIPE_MIN_VELOCITY) {
+    touch_gesture_type_t type;
+    if (abs(dx) >= abs(dy)) type = dx < 0 ? TOUCH_GESTURE_SWIPE_LEFT : TOUCH_GESTURE_SWIPE_RIGHT;
+    else                    type = dy < 0 ? TOUCH_GESTURE_SWIPE_UP : TOUCH_GESTURE_SWIPE_DOWN;
+    Touch_PublishGesture(type, s_gesture.startX, s_gesture.startY, durationMs);
+    s_gesture.lastTapUs = 0;
+    return;
+  }
+
+  if (abs(dx) <= TOUCH_TAP_SLOP && abs(dy) <= TOUCH_TAP_SLOP && durationMs <= TOUCH_TAP_MAX_MS) {
+    bool isDouble = s_gesture.lastTapUs != 0 &&
+                    (s_gesture.startUs - s_gesture.lastTapUs) <= (int64_t)TOUCH_DOUBLE_TAP_MS * 1000 &&
+                    abs(s_gesture.startX - s_gesture.lastTapX) <= TOUCH_TAP_SLOP * 2 &&
+                    abs(s_gesture.startY - s_gesture.lastTapY) <= TOUCH_TAP_SLOP * 2;
+    if (isDouble) {
+      Touch_PublishGesture(TOUCH_GESTURE_DOUBLE_TAP, s_gesture.startX, s_gesture.startY, durationMs);
+      s_gesture.lastTapUs = 0;
+    } else {
+      Touch_PublishGesture(TOUCH_GESTURE_TAP, s_gesture.startX, s_gesture.startY, durationMs);
+      s_gesture.lastTapUs = s_gesture.lastUs;
+      s_gesture.lastTapX = s_gesture.startX;
+      s_gesture.lastTapY = s_gesture.startY;
+    }
+  }
+}
+
+bool Touch_ConsumeGesture(touch_gesture_t *gesture) {
+  portENTER_CRITICAL(&s_gestureMux);
+  bool have = s_pendingGesture.type != TOUCH_GESTURE_NONE;
+  if (have) {
+    *gesture = s_pendingGesture;
+    s_pendingGesture.type = TOUCH_GESTURE_NONE;
+  }
+  portEXIT_CRITICAL(&s_gestureMux);
+  return have;
+}
+
+const char *Touch_GestureName(touch_gesture_type_t type) {
+  switch (type) {
+    case TOUCH_GESTURE_SWIPE_LEFT:  return "SWIPE_LEFT";
+    case TOUCH_GESTURE_SWIPE_RIGHT: return "SWIPE_RIGHT";
+    case TOUCH_GESTURE_SWIPE_UP:    return "SWIPE_UP";
+    case TOUCH_GESTURE_SWIPE_DOWN:  return "SWIPE_DOWN";
+    case TOUCH_GESTURE_TAP:         return "TAP";
+    case TOUCH_GESTURE_DOUBLE_TAP:  return "DOUBLE_TAP";
+    case TOUCH_GESTURE_LONG_PRESS:  return "LONG_PRESS";
+    default:                        return "none";
+  }
+}
+
+/*************************************************** Reader task ***************************************************/
+static volatile int64_t s_lastIsrUs = 0;
+
+void IRAM_ATTR Touch_PipelineNotifyFromISR(void) {
+  if (!s_readerTask) return;
+  s_lastIsrUs = esp_timer_get_time();
+  BaseType_t woken = pdFALSE;
+  vTaskNotifyGiveFromISR(s_readerTask, &woken);
+  portYIELD_FROM_ISR(woken);
+}
+
+static void Touch_ReaderTask(void *parameter) {
+  while (1) {
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+
+    // While the panel is blanked the SPD2010 raises phantom interrupts; the
+    // UI loop owns wake-from-sleep through Touch_HasPendingInterrupt().
+    if (!PWR_IsDisplayAwake()) continue;
+
+    int64_t isrUs = s_lastIsrUs;
+    struct SPD2010_Touch touch = {0};
+    if (tp_read_data(&touch) != ESP_OK) continue;
+
+    touch_sample_t sample;
+    sample.timestampUs = isrUs;
+    sample.pressed = touch.touch_num > 0 && touch.rpt[0].weight > 0;
+    sample.weight = touch.touch_num > 0 ? touch.rpt[0].weight : 0;
+    if (touch.touch_num > 0) {
+      // Panel is mounted rotated 90° relative to the LVGL frame.
+      sample.x = touch.rpt[0].y;
+      sample.y = EXAMPLE_LCD_HEIGHT - 1 - touch.rpt[0].x;
+    } else {
+      sample.x = s_gesture.lastX;
+      sample.y = s_gesture.lastY;
+    }
+
+    if (sample.pressed) {
+      PWR_UpdateActivity();
+    }
+    Touch_RingPush(&sample);
+    Touch_GestureFeed(&sample);
+  }
+}
+
+void Touch_PipelineStart(void) {
+  if (s_readerTask) return;
+  // Priority 2 on the UI core: above UI_Loop_Task so a pending report is
+  // fetched before the next LVGL read, but below the I2C worker it waits on.
+  // The stack stays in internal RAM (unlike the other task stacks): this task
+  // runs on every touch interrupt and a PSRAM stack adds cache misses to the
+  // touch-to-pixel path.
+  xTaskCreatePinnedToCore(
+    Touch_ReaderTask,
+    "Touch Reader",
+    4096,
+    NULL,
+    2,
+    &s_readerTask,
+    1);
+}
+
+/*************************************************** Accounting ***************************************************/
+static struct {
+  uint32_t windowStartMs;
+  uint32_t windowI2C;
+  bool windowHadPress;
+  uint32_t idleI2C, idleSecs;
+  uint32_t dragI2C, dragSecs;
+  uint32_t latencyCount;
+  uint64_t latencyUsSum;
+  uint32_t latencyUsMax;
+  uint32_t lastLogMs;
+} s_stats = { 0 };
+
+void Touch_PipelineNoteConsumed(const touch_sample_t *sample) {
+  if (sample->pressed) {
+    s_stats.windowHadPress = true;
+    if (s_pendingLatencySampleUs == 0) {
+      s_pendingLatencySampleUs = sample->timestampUs;
+    }
+  }
+}
+
+void Touch_PipelineNoteFlush(void) {
+  if (s_pendingLatencySampleUs == 0) return;
+  uint32_t latencyUs = (uint32_t)(esp_timer_get_time() - s_pendingLatencySampleUs);
+  s_pendingLatencySampleUs = 0;
+  s_stats.latencyCount++;
+  s_stats.latencyUsSum += latencyUs;
+  if (latencyUs > s_stats.latencyUsMax) s_stats.latencyUsMax = latencyUs;
+}
+
+void Touch_PipelineTick(void) {
+  uint32_t now = millis();
+  if (s_stats.windowStartMs == 0) {
+    s_stats.windowStartMs = now;
+    s_stats.windowI2C = Touch_GetI2CTransferCount();
+    s_stats.lastLogMs = now;
+    return;
+  }
+
+  // One-second windows, classified by whether a finger was down in them.
+  if (now - s_stats.windowStartMs >= 1000) {
+    uint32_t transfers = Touch_GetI2CTransferCount();
+    uint32_t delta = transfers - s_stats.windowI2C;
+    if (s_stats.windowHadPress) {
+      s_stats.dragI2C += delta;
+      s_stats.dragSecs++;
+    } else {
+      s_stats.idleI2C += delta;
+      s_stats.idleSecs++;
+    }
+    s_stats.windowI2C = transfers;
+    s_stats.windowHadPress = false;
+    s_stats.windowStartMs = now;
+  }
+
+  if (now - s_stats.lastLogMs < 60000) return;
+  s_stats.lastLogMs = now;
+#ifdef STATS_LOG
+  {
+    Serial.printf("[Touch] i2c/s idle=%lu drag=%lu latency_avg=%lums max=%lums frames=%lu dropped=%lu\n",
+                  (unsigned long)(s_stats.idleSecs ? s_stats.idleI2C / s_stats.idleSecs : 0),
+                  (unsigned long)(s_stats.dragSecs ? s_stats.dragI2C / s_stats.dragSecs : 0),
+                  (unsigned long)(s_stats.latencyCount ? s_stats.latencyUsSum / s_stats.latencyCount / 1000 : 0),
+                  (unsigned long)(s_stats.latencyUsMax / 1000),
+                  (unsigned long)s_stats.latencyCount,
+                  (unsigned long)s_ringDropped);
+  }
+#endif
+  s_stats.idleI2C = s_stats.idleSecs = 0;
+  s_stats.dragI2C = s_stats.dragSecs = 0;
+  s_stats.latencyCount = 0;
+  s_stats.latencyUsSum = 0;
+  s_stats.latencyUsMax = 0;
+}
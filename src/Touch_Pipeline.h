@@ -0,0 +1,63 @@
+#pragma once
+
+#include <Arduino.h>
+
+// Interrupt-driven touch pipeline.
+//
+// TP_INT wakes a reader task, which fetches points from the SPD2010 only when
+// the controller has data, timestamps them and pushes them into a lock-free
+// single-producer/single-consumer ring.  The LVGL indev read callback drains
+// the ring instead of touching I2C.  A gesture recogniser runs on the same
+// samples.
+
+#define TOUCH_RING_SIZE              32     // power of two
+#define TOUCH_SWIPE_MIN_DIST         40     // px
+#define TOUCH_SWIPE_MIN_VELOCITY     300    // px/s
+#define TOUCH_TAP_SLOP               12     // px of movement still counted as a tap
+#define TOUCH_TAP_MAX_MS             250
+#define TOUCH_DOUBLE_TAP_MS          300    // max gap between the two taps
+#define TOUCH_LONG_PRESS_MS          1000   // matches indev long_press_time
+
+typedef struct {
+  int16_t x;                // LVGL (rotated) screen coordinates
+  int16_t y;
+  uint8_t weight;
+  bool pressed;
+  int64_t timestampUs;      // time the interrupt fired
+} touch_sample_t;
+
+typedef enum {
+  TOUCH_GESTURE_NONE = 0,
+  TOUCH_GESTURE_SWIPE_LEFT,
+  TOUCH_GESTURE_SWIPE_RIGHT,
+  TOUCH_GESTURE_SWIPE_UP,
+  TOUCH_GESTURE_SWIPE_DOWN,
+  TOUCH_GESTURE_TAP,
+  TOUCH_GESTURE_DOUBLE_TAP,
+  TOUCH_GESTURE_LONG_PRESS,
+} touch_gesture_type_t;
+
+typedef struct {
+  touch_gesture_type_t type;
+  int16_t x;                // where the gesture started
+  int16_t y;
+  float velocityX;          // px/s at release (swipes)
+  float velocityY;
+  uint32_t durationMs;
+} touch_gesture_t;
+
+void Touch_PipelineStart(void);
+void Touch_PipelineNotifyFromISR(void);
+
+// Consumer side (LVGL/UI core).
+bool Touch_PipelinePop(touch_sample_t *sample);
+bool Touch_PipelineAvailable(void);
+bool Touch_ConsumeGesture(touch_gesture_t *gesture);
+const char *Touch_GestureName(touch_gesture_type_t type);
+
+// Latency / I2C accounting.  Call NoteFlush at the start of every flush
+// callback and Tick from the consumer loop; stats are logged every minute
+// in STATS_LOG builds.
+void Touch_PipelineNoteConsumed(const touch_sample_t *sample);
+void Touch_PipelineNoteFlush(void);
+void Touch_PipelineTick(void);
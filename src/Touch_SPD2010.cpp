@@ -1,10 +1,16 @@
 #include "Touch_SPD2010.h"
 #include "PWR_Key.h"
+#include "Touch_Pipeline.h"
 
 struct SPD2010_Touch touch_data = {0};
 volatile bool Touch_interrupts = false;
 static bool s_touchSessionActive = false;
 static unsigned long s_lastAcceptedTouchMs = 0;
+static volatile uint32_t s_touchI2CTransfers = 0;
+
+uint32_t Touch_GetI2CTransferCount(void) {
+  return s_touchI2CTransfers;
+}
 
 // Consuming check: returns true if the touch ISR has fired, and clears the
 // flag so a single interrupt only triggers one wake attempt.
@@ -27,59 +33,37 @@ void Touch_ClearPendingInterrupt(void) {
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// SPD2010 transfers use 16-bit register addresses and go to the front of the
+// I2C transaction queue so input latency is not stuck behind IMU/RTC traffic.
 bool I2C_Read_Touch(uint8_t Driver_addr, uint16_t Reg_addr, uint8_t *Reg_data, uint32_t Length)
 {
   if (!Reg_data || Length == 0) {
     return false;
   }
-  if (!I2C_Lock()) {
-    printf("I2C lock timeout - I2C Read Touch\r\n");
-    return false;
-  }
-
-  Wire.beginTransmission(Driver_addr);
-  Wire.write((uint8_t)(Reg_addr >> 8)); 
-  Wire.write((uint8_t)Reg_addr);        
-  if (Wire.endTransmission(true)){
-    printf("The I2C transmission fails. - I2C Read Touch\r\n");
-    I2C_Unlock();
-    return false;
-  }
-  int received = Wire.requestFrom(Driver_addr, Length);
-  if (received != (int)Length) {
-    printf("The I2C read length is invalid. - I2C Read Touch exp=%u got=%d\r\n", (unsigned)Length, received);
-    I2C_Unlock();
-    return false;
-  }
-  for (uint32_t i = 0; i < Length && Wire.available(); i++) {
-    *Reg_data++ = Wire.read();
-  }
-  I2C_Unlock();
-  return true;
+  s_touchI2CTransfers++;
+  i2c_transaction_t t = {};
+  t.addr = Driver_addr;
+  t.reg = Reg_addr;
+  t.data = Reg_data;
+  t.length = Length;
+  t.flags = I2C_FLAG_READ | I2C_FLAG_REG16;
+  t.prio = I2C_PRIO_TOUCH;
+  return I2C_Transfer(&t) == ESP_OK;
 }
 bool I2C_Write_Touch(uint8_t Driver_addr, uint16_t Reg_addr, const uint8_t *Reg_data, uint32_t Length)
 {
- if ((Length > 0 && !Reg_data) || !I2C_Lock()) {
-  if (Length > 0 && !Reg_data) {
+  if (Length == 0 || !Reg_data) {
     return false;
   }
-  printf("I2C lock timeout - I2C Write Touch\r\n");
-  return false;
- }
- Wire.beginTransmission(Driver_addr);
- Wire.write((uint8_t)(Reg_addr >> 8)); 
- Wire.write((uint8_t)Reg_addr);         
-  for (int i = 0; i < Length; i++) {
-   Wire.write(*Reg_data++);
-  }
-  if (Wire.endTransmission(true))
-  {
-    printf("The I2C transmission fails. - I2C Write Touch\r\n");
-    I2C_Unlock();
-    return false;
-  }
-  I2C_Unlock();
-  return true;
+  s_touchI2CTransfers++;
+  i2c_transaction_t t = {};
+  t.addr = Driver_addr;
+  t.reg = Reg_addr;
+  t.data = (uint8_t *)Reg_data;
+  t.length = Length;
+  t.flags = I2C_FLAG_REG16;
+  t.prio = I2C_PRIO_TOUCH;
+  return I2C_Transfer(&t) == ESP_OK;
 }
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -87,6 +71,7 @@ bool I2C_Write_Touch(uint8_t Driver_addr, uint16_t Reg_addr, const uint8_t *Reg_
 
 void IRAM_ATTR Touch_SPD2010_ISR(void) {
   Touch_interrupts = true;
+  Touch_PipelineNotifyFromISR();
 }
 uint8_t Touch_Init(void) {
   SPD2010_Touch_Reset();
@@ -94,6 +79,7 @@ uint8_t Touch_Init(void) {
 
   pinMode(EXAMPLE_PIN_NUM_TOUCH_INT, INPUT_PULLUP);
   attachInterrupt(EXAMPLE_PIN_NUM_TOUCH_INT, Touch_SPD2010_ISR, FALLING);  
+  Touch_PipelineStart();
   return true;
 }
 /* Reset controller */
@@ -86,6 +86,7 @@ void Touch_Read_Data(void);
 bool Touch_Get_xy(uint16_t *x, uint16_t *y, uint16_t *strength, uint8_t *point_num, uint8_t max_point_num);
 bool Touch_HasPendingInterrupt(void);
 void Touch_ClearPendingInterrupt(void);
+uint32_t Touch_GetI2CTransferCount(void);          // SPD2010 bus transfers since boot
 void example_touchpad_read(void);
 //
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -12,8 +12,10 @@
 #include "src/screens.h"
 #include "alarm_timer.h"
 #include "serializable_configs.h"
+#include "sound_bank.h"
 
 extern SerializableConfigs serializableConfigs;
+extern SoundBank soundBank;
 
 // CRITICAL FIX: Debouncing to prevent rapid alarm triggering
 static unsigned long lastAlarmCheck = 0;
@@ -26,42 +28,58 @@ const unsigned long ALARM_CHECK_DEBOUNCE_MS = 1000;   // Only check once per sec
 const unsigned long ALARM_RETRIGGER_DELAY_MS = 5000;  // 5 seconds between alarm triggers
 const unsigned long TIMER_RETRIGGER_DELAY_MS = 5000;  // 5 seconds between timer triggers
 
-void playSound(const char *directory, const char *filename) {
+// Indexed by the ALARM_SOUND / TIMER_SOUND flow globals; 0 is "no sound".
+static const char *const alarmSoundFiles[] = {
+  nullptr,
+  "alarm-clock-beep-988-2.wav",
+  "alarm-digital-clock-beep-989-2.wav",
+  "alarm-tone-996.wav",
+  "alert-alarm-1005.wav",
+  "casino-jackpot-alarm-and-coins-1991.wav",
+  "casino-win-alarm-and-coins-1990.wav",
+  "city-alert-siren-loop-1008.wav",
+  "classic-alarm-995.wav",
+  "classic-short-alarm-993-2.wav",
+  "critical-alarm-1004.wav",
+  "data-scanner-2847.wav",
+  "digital-clock-digital-alarm-buzzer-992-2.wav",
+  "facility-alarm-908-2.wav",
+  "facility-alarm-sound-999.wav",
+  "game-notification-wave-alarm-987-2.wav",
+  "interface-hint-notification-911-2.wav",
+  "morning-clock-alarm-1003.wav",
+  "retro-game-emergency-alarm-1000.wav",
+  "rooster-crowing-in-the-morning-2462-2.wav",
+  "security-facility-breach-alarm-994.wav",
+  "short-rooster-crowing-2470-2.wav",
+  "slot-machine-win-alarm-1995.wav",
+  "sound-alert-in-hall-1006.wav",
+  "space-shooter-alarm-1002.wav",
+  "spaceship-alarm-998.wav",
+  "street-public-alarm-997.wav",
+  "vintage-warning-alarm-990-2.wav",
+};
+
+static const char *alarmSoundFile(int sound) {
+  if (sound <= 0 || sound >= (int)(sizeof(alarmSoundFiles) / sizeof(alarmSoundFiles[0]))) return nullptr;
+  return alarmSoundFiles[sound];
+}
+
+void playSound(int sound, AudioPriority priority) {
+  const char *file = alarmSoundFile(sound);
+  if (!file) return;
   Serial.println(F("Playing alarm"));
-  Play_Music(directory, filename);
+  soundBank.play(file, priority);
 }
 
-void playSound(int sound) {
-  switch (sound) {
-    case 0: break;  // no sound
-    case 1: playSound("/System/alarms", "alarm-clock-beep-988-2.wav"); break;
-    case 2: playSound("/System/alarms", "alarm-digital-clock-beep-989-2.wav"); break;
-    case 3: playSound("/System/alarms", "alarm-tone-996.wav"); break;
-    case 4: playSound("/System/alarms", "alert-alarm-1005.wav"); break;
-    case 5: playSound("/System/alarms", "casino-jackpot-alarm-and-coins-1991.wav"); break;
-    case 6: playSound("/System/alarms", "casino-win-alarm-and-coins-1990.wav"); break;
-    case 7: playSound("/System/alarms", "city-alert-siren-loop-1008.wav"); break;
-    case 8: playSound("/System/alarms", "classic-alarm-995.wav"); break;
-    case 9: playSound("/System/alarms", "classic-short-alarm-993-2.wav"); break;
-    case 10: playSound("/System/alarms", "critical-alarm-1004.wav"); break;
-    case 11: playSound("/System/alarms", "data-scanner-2847.wav"); break;
-    case 12: playSound("/System/alarms", "digital-clock-digital-alarm-buzzer-992-2.wav"); break;
-    case 13: playSound("/System/alarms", "facility-alarm-908-2.wav"); break;
-    case 14: playSound("/System/alarms", "facility-alarm-sound-999.wav"); break;
-    case 15: playSound("/System/alarms", "game-notification-wave-alarm-987-2.wav"); break;
-    case 16: playSound("/System/alarms", "interface-hint-notification-911-2.wav"); break;
-    case 17: playSound("/System/alarms", "morning-clock-alarm-1003.wav"); break;
-    case 18: playSound("/System/alarms", "retro-game-emergency-alarm-1000.wav"); break;
-    case 19: playSound("/System/alarms", "rooster-crowing-in-the-morning-2462-2.wav"); break;
-    case 20: playSound("/System/alarms", "security-facility-breach-alarm-994.wav"); break;
-    case 21: playSound("/System/alarms", "short-rooster-crowing-2470-2.wav"); break;
-    case 22: playSound("/System/alarms", "slot-machine-win-alarm-1995.wav"); break;
-    case 23: playSound("/System/alarms", "sound-alert-in-hall-1006.wav"); break;
-    case 24: playSound("/System/alarms", "space-shooter-alarm-1002.wav"); break;
-    case 25: playSound("/System/alarms", "spaceship-alarm-998.wav"); break;
-    case 26: playSound("/System/alarms", "street-public-alarm-997.wav"); break;
-    case 27: playSound("/System/alarms", "vintage-warning-alarm-990-2.wav"); break;
-  }
+void stopSound(int sound) {
+  soundBank.stop(alarmSoundFile(sound));
+}
+
+// Keep the selected alarm and timer tones resident so they start instantly.
+static void selectResidentSounds() {
+  soundBank.select(SOUND_BANK_SLOT_ALARM, alarmSoundFile(eez::flow::getGlobalVariable(FLOW_GLOBAL_VARIABLE_ALARM_SOUND).getInt()));
+  soundBank.select(SOUND_BANK_SLOT_TIMER, alarmSoundFile(eez::flow::getGlobalVariable(FLOW_GLOBAL_VARIABLE_TIMER_SOUND).getInt()));
 }
 
 void action_check_alarm_native(lv_event_t *e) {
@@ -102,7 +120,7 @@ void action_play_alarm_sound(lv_event_t *e) {
   int soundIndex = eez::flow::getGlobalVariable(FLOW_GLOBAL_VARIABLE_ALARM_SOUND).getInt();
 
   Serial.printf("Playing sound %d\n", soundIndex);
-  playSound(soundIndex);  // This blocks for a few seconds
+  playSound(soundIndex, AUDIO_PRIORITY_ALARM);
 }
 
 void action_update_next_alarm_string(lv_event_t *e) {
@@ -248,7 +266,7 @@ void action_activate_alarm(lv_event_t *e) {
 void action_stop_alarm_sound(lv_event_t *e) {
   Serial.println(F("Stop Alarm"));
   alarmCurrentlyPlaying = false;
-  Music_pause();
+  stopSound(eez::flow::getGlobalVariable(FLOW_GLOBAL_VARIABLE_ALARM_SOUND).getInt());
 }
 
 void action_play_timer_sound(lv_event_t *e) {
@@ -266,17 +284,18 @@ void action_play_timer_sound(lv_event_t *e) {
   int soundIndex = eez::flow::getGlobalVariable(FLOW_GLOBAL_VARIABLE_TIMER_SOUND).getInt();
 
   Serial.printf("Playing sound %d\n", soundIndex);
-  playSound(soundIndex);  // This blocks for a few seconds
+  playSound(soundIndex, AUDIO_PRIORITY_TIMER);
 }
 
 void action_stop_timer_sound(lv_event_t *e) {
   Serial.println(F("Stop Timer"));
   timerCurrentlyPlaying = false;
-  Music_pause();
+  stopSound(eez::flow::getGlobalVariable(FLOW_GLOBAL_VARIABLE_TIMER_SOUND).getInt());
 }
 
 void action_update_alarm_timer_settings(lv_event_t *e) {
   serializableConfigs.write();
+  selectResidentSounds();
 }
 
 void AlarmTimer::serializeConfig(JsonDocument &doc) {
@@ -303,4 +322,6 @@ void AlarmTimer::deserializeConfig(JsonDocument &doc) {
 
   JsonObject timerObj = doc["timer"];
   eez::flow::setGlobalVariable(FLOW_GLOBAL_VARIABLE_TIMER_SOUND, eez::IntegerValue(timerObj["timer-sound"]));
+
+  selectResidentSounds();
 }
@@ -0,0 +1,267 @@
+#include "asset_pack.h"
+#include "SD_Card.h"
+#include "esp_heap_caps.h"
+#include "esp_timer.h"
+
+extern AssetPack assetPack;
+
+bool AssetPack::begin() {
+#ifdef USE_ASSET_PACK
+  unsigned long start = millis();
+
+  if (!mapPartition() && !openFromSD()) {
+    Serial.println("[Assets] No asset pack found - images and large fonts will be blank");
+    return false;
+  }
+
+  bindFonts();
+
+  lv_img_decoder_t *decoder = lv_img_decoder_create();
+  lv_img_decoder_set_info_cb(decoder, decoderInfo);
+  lv_img_decoder_set_open_cb(decoder, decoderOpen);
+  lv_img_decoder_set_close_cb(decoder, decoderClose);
+
+  loadMs = millis() - start;
+  Serial.printf("[Assets] %u entries, %uKB %s, fonts %uKB, ready in %lums\n",
+                count, (unsigned)(packSize / 1024), mapped ? "mapped" : "from SD",
+                (unsigned)(fontBytes / 1024), (unsigned long)loadMs);
+  return true;
+#else
+  return false;
+#endif
+}
+
+static bool validHeader(const asset_pack_header_t *header, uint32_t available) {
+  return header->magic == ASSET_PACK_MAGIC &&
+         header->version == ASSET_PACK_VERSION &&
+         header->totalSize <= available &&
+         sizeof(asset_pack_header_t) + header->count * sizeof(asset_pack_entry_t) <= header->totalSize;
+}
+
+bool AssetPack::mapPartition() {
+  const esp_partition_t *part = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ASSET_PACK_PARTITION_TYPE,
+                                                         ASSET_PACK_PARTITION_LABEL);
+  if (!part) return false;
+
+  asset_pack_header_t header;
+  if (esp_partition_read(part, 0, &header, sizeof(header)) != ESP_OK || !validHeader(&header, part->size)) {
+    Serial.println("[Assets] assets partition holds no valid pack");
+    return false;
+  }
+
+  // Map only what the pack uses; the MMU data window is shared with rodata.
+  const void *ptr = nullptr;
+  if (esp_partition_mmap(part, 0, header.totalSize, ESP_PARTITION_MMAP_DATA, &ptr, &mapHandle) != ESP_OK) {
+    Serial.println("[Assets] Failed to map assets partition");
+    return false;
+  }
+
+  mapped = (const uint8_t *)ptr;
+  entries = (const asset_pack_entry_t *)(mapped + sizeof(asset_pack_header_t));
+  count = header.count;
+  packSize = header.totalSize;
+  return true;
+}
+
+bool AssetPack::openFromSD() {
+  sdFile = SD_MMC.open(ASSET_PACK_SD_PATH);
+  if (!sdFile) return false;
+
+  asset_pack_header_t header;
+  if (sdFile.read((uint8_t *)&header, sizeof(header)) != sizeof(header) || !validHeader(&header, sdFile.size())) {
+    Serial.println("[Assets] " ASSET_PACK_SD_PATH " is not a valid pack");
+    sdFile.close();
+    return false;
+  }
+
+  size_t indexSize = header.count * sizeof(asset_pack_entry_t);
+  asset_pack_entry_t *index = (asset_pack_entry_t *)heap_caps_malloc(indexSize, MALLOC_CAP_SPIRAM);
+  if (!index || sdFile.read((uint8_t *)index, indexSize) != indexSize) {
+    heap_caps_free(index);
+    sdFile.close();
+    return false;
+  }
+
+  entries = index;
+  count = header.count;
+  packSize = header.totalSize;
+  return true;
+}
+
+void AssetPack::bindFonts() {
+#ifdef USE_ASSET_PACK
+  for (size_t i = 0; i < asset_pack_font_count; i++) {
+    const asset_pack_entry_t *entry = find(asset_pack_fonts[i].name);
+    if (!entry || entry->type != ASSET_TYPE_FONT || entry->codec != ASSET_CODEC_RAW) {
+      Serial.printf("[Assets] Font %s missing from pack\n", asset_pack_fonts[i].name);
+      continue;
+    }
+
+    const uint8_t *bitmap = nullptr;
+    if (mapped) {
+      bitmap = mapped + entry->offset;
+    } else {
+      // Streaming glyphs from SD per draw would be far too slow; keep the
+      // bitmap resident in PSRAM instead.
+      uint8_t *copy = (uint8_t *)heap_caps_malloc(entry->rawSize, MALLOC_CAP_SPIRAM);
+      if (copy && readBlob(entry, copy)) {
+        bitmap = copy;
+      } else {
+        heap_caps_free(copy);
+      }
+    }
+
+    if (bitmap) {
+      asset_pack_fonts[i].dsc->glyph_bitmap = bitmap;
+      fontBytes += entry->rawSize;
+    }
+  }
+#endif
+}
+
+const asset_pack_entry_t *AssetPack::find(const char *name) {
+  if (!entries || !name) return nullptr;
+
+  char key[ASSET_NAME_LEN] = {};
+  strncpy(key, name, ASSET_NAME_LEN - 1);
+
+  int lo = 0, hi = (int)count - 1;
+  while (lo <= hi) {
+    int mid = (lo + hi) / 2;
+    int cmp = memcmp(key, entries[mid].name, ASSET_NAME_LEN);
+    if (cmp == 0) return &entries[mid];
+    if (cmp < 0) hi = mid - 1;
+    else lo = mid + 1;
+  }
+  return nullptr;
+}
+
+bool AssetPack::readBlob(const asset_pack_entry_t *entry, uint8_t *dst) {
+  if (mapped) {
+    const uint8_t *blob = mapped + entry->offset;
+    if (entry->codec == ASSET_CODEC_RAW) {
+      memcpy(dst, blob, entry->rawSize);
+      return true;
+    }
+    return rleDecode(blob, entry->storedSize, dst, entry->rawSize, entry->unitSize);
+  }
+
+  if (!sdFile.seek(entry->offset)) return false;
+  if (entry->codec == ASSET_CODEC_RAW) {
+    return sdFile.read(dst, entry->rawSize) == entry->rawSize;
+  }
+
+  uint8_t *packed = (uint8_t *)heap_caps_malloc(entry->storedSize, MALLOC_CAP_SPIRAM);
+  if (!packed) return false;
+  bool ok = sdFile.read(packed, entry->storedSize) == entry->storedSize &&
+            rleDecode(packed, entry->storedSize, dst, entry->rawSize, entry->unitSize);
+  heap_caps_free(packed);
+  return ok;
+}
+
+// Control byte c: c & 0x80 -> repeat the next unit (c & 0x7f) + 1 times,
+// otherwise (c + 1) literal units follow.
+bool AssetPack::rleDecode(const uint8_t *in, uint32_t inLen, uint8_t *out, uint32_t outLen, uint8_t unit) {
+  const uint8_t *inEnd = in + inLen;
+  uint8_t *outEnd = out + outLen;
+
+  while (in < inEnd) {
+    uint8_t c = *in++;
+    uint32_t n = (c & 0x7f) + 1;
+    if (c & 0x80) {
+      if (in + unit > inEnd || out + n * unit > outEnd) return false;
+      for (uint32_t i = 0; i < n; i++) {
+        memcpy(out, in, unit);
+        out += unit;
+      }
+      in += unit;
+    } else {
+      uint32_t len = n * unit;
+      if (in + len > inEnd || out + len > outEnd) return false;
+      memcpy(out, in, len);
+      in += len;
+      out += len;
+    }
+  }
+  return out == outEnd;
+}
+
+bool AssetPack::imageHeader(const lv_img_dsc_t *src, lv_img_header_t *header) {
+  const asset_pack_entry_t *entry = find((const char *)src->data);
+  if (!entry || entry->type != ASSET_TYPE_IMAGE) return false;
+
+  header->cf = entry->cf;
+  header->always_zero = 0;
+  header->reserved = 0;
+  header->w = entry->w;
+  header->h = entry->h;
+  return true;
+}
+
+bool AssetPack::readImage(const lv_img_dsc_t *src, uint8_t *dst) {
+  const asset_pack_entry_t *entry = find((const char *)src->data);
+  if (!entry || entry->type != ASSET_TYPE_IMAGE) return false;
+
+  int64_t start = esp_timer_get_time();
+  bool ok = readBlob(entry, dst);
+  decodeUs += (uint32_t)(esp_timer_get_time() - start);
+  imagesDecoded++;
+  return ok;
+}
+
+void AssetPack::logStats() {
+  if (!isLoaded()) return;
+  Serial.printf("[Assets] %s pack=%uKB fonts=%uKB boot=%lums decoded=%lu decode_avg=%luus\n",
+                mapped ? "mapped" : "sd",
+                (unsigned)(packSize / 1024),
+                (unsigned)(fontBytes / 1024),
+                (unsigned long)loadMs,
+                (unsigned long)imagesDecoded,
+                (unsigned long)(imagesDecoded ? decodeUs / imagesDecoded : 0));
+  imagesDecoded = 0;
+  decodeUs = 0;
+}
+
+lv_res_t AssetPack::decoderInfo(lv_img_decoder_t *decoder, const void *src, lv_img_header_t *header) {
+  if (lv_img_src_get_type(src) != LV_IMG_SRC_VARIABLE) return LV_RES_INV;
+  const lv_img_dsc_t *img = (const lv_img_dsc_t *)src;
+  if (!isPackImage(img)) return LV_RES_INV;
+  return assetPack.imageHeader(img, header) ? LV_RES_OK : LV_RES_INV;
+}
+
+// Raw entries are drawn straight from the mapping, everything else is
+// decoded for the lifetime of the decoder session (LVGL's image cache keeps
+// recently opened sessions).
+lv_res_t AssetPack::decoderOpen(lv_img_decoder_t *decoder, lv_img_decoder_dsc_t *dsc) {
+  const lv_img_dsc_t *src = (const lv_img_dsc_t *)dsc->src;
+  const asset_pack_entry_t *entry = assetPack.find((const char *)src->data);
+  if (!entry) return LV_RES_INV;
+
+  if (assetPack.mapped && entry->codec == ASSET_CODEC_RAW) {
+    dsc->img_data = assetPack.mapped + entry->offset;
+    return LV_RES_OK;
+  }
+
+  uint8_t *pixels = (uint8_t *)heap_caps_malloc(entry->rawSize, MALLOC_CAP_SPIRAM);
+  if (!pixels) return LV_RES_INV;
+  if (!assetPack.readImage(src, pixels)) {
+    heap_caps_free(pixels);
+    return LV_RES_INV;
+  }
+  dsc->img_data = pixels;
+  dsc->user_data = pixels;
+  return LV_RES_OK;
+}
+
+void AssetPack::decoderClose(lv_img_decoder_t *decoder, lv_img_decoder_dsc_t *dsc) {
+  if (dsc->user_data) {
+    heap_caps_free(dsc->user_data);
+    dsc->user_data = nullptr;
+  }
+}
+
+bool AssetPack_FontGetGlyphDsc(const lv_font_t *font, lv_font_glyph_dsc_t *dsc_out, uint32_t unicode_letter, uint32_t unicode_letter_next) {
+  const lv_font_fmt_txt_dsc_t *fdsc = (const lv_font_fmt_txt_dsc_t *)font->dsc;
+  if (!fdsc->glyph_bitmap) return false;
+  return lv_font_get_glyph_dsc_fmt_txt(font, dsc_out, unicode_letter, unicode_letter_next);
+}
@@ -0,0 +1,62 @@
+#pragma once
+
+#ifndef ASSET_PACK_H
+#define ASSET_PACK_H
+
+#include <Arduino.h>
+#include <lvgl.h>
+#include "FS.h"
+#include "esp_partition.h"
+#include "asset_pack_format.h"
+
+// Images and large fonts served from an external asset pack instead of the
+// app partition (build with -DUSE_ASSET_PACK, see pack_assets.py).
+//
+// The pack is memory-mapped from the `assets` data partition; if that is
+// missing or invalid it is streamed from /assets.bin on the SD card.  Stub
+// image descriptors (cf ASSET_PACK_IMG_CF, .data = entry name) are decoded by
+// an LVGL decoder registered here.
+#define ASSET_PACK_PARTITION_LABEL  "assets"
+#define ASSET_PACK_PARTITION_TYPE   ((esp_partition_subtype_t)0x40)
+#define ASSET_PACK_SD_PATH          "/assets.bin"
+
+class AssetPack {
+  public:
+    // Call after Lvgl_Init() (and SD_Init()) and before ui_init().
+    bool begin();
+    bool isLoaded() { return entries != nullptr; }
+
+    static bool isPackImage(const lv_img_dsc_t *src) { return src->header.cf == ASSET_PACK_IMG_CF; }
+    bool imageHeader(const lv_img_dsc_t *src, lv_img_header_t *header);
+    // Decodes the image into dst (imageSize() bytes).
+    bool readImage(const lv_img_dsc_t *src, uint8_t *dst);
+
+    void logStats();
+
+    // LVGL decoder callbacks.
+    static lv_res_t decoderInfo(lv_img_decoder_t *decoder, const void *src, lv_img_header_t *header);
+    static lv_res_t decoderOpen(lv_img_decoder_t *decoder, lv_img_decoder_dsc_t *dsc);
+    static void decoderClose(lv_img_decoder_t *decoder, lv_img_decoder_dsc_t *dsc);
+
+  private:
+    bool mapPartition();
+    bool openFromSD();
+    void bindFonts();
+    const asset_pack_entry_t *find(const char *name);
+    bool readBlob(const asset_pack_entry_t *entry, uint8_t *dst);
+    static bool rleDecode(const uint8_t *in, uint32_t inLen, uint8_t *out, uint32_t outLen, uint8_t unit);
+
+    const uint8_t *mapped = nullptr;            // whole pack when memory-mapped
+    esp_partition_mmap_handle_t mapHandle = 0;
+    File sdFile;
+    const asset_pack_entry_t *entries = nullptr;
+    uint16_t count = 0;
+    uint32_t packSize = 0;
+
+    uint32_t loadMs = 0;
+    uint32_t imagesDecoded = 0;
+    uint32_t decodeUs = 0;
+    uint32_t fontBytes = 0;
+};
+
+#endif /* asset_pack.h */
@@ -0,0 +1,72 @@
+#pragma once
+
+#ifndef ASSET_PACK_FORMAT_H
+#define ASSET_PACK_FORMAT_H
+
+#include <lvgl.h>
+#include <stdint.h>
+#include <stddef.h>
+
+// On-flash layout of the asset pack written by pack_assets.py.  Shared by the
+// C stubs in asset_stubs/ and AssetPack, so keep it plain C.
+//
+//   asset_pack_header_t
+//   asset_pack_entry_t[count]   sorted by name (memcmp order)
+//   blobs                       4-byte aligned
+
+#define ASSET_PACK_MAGIC       0x4B504157     // "WAPK"
+#define ASSET_PACK_VERSION     1
+#define ASSET_NAME_LEN         40
+
+#define ASSET_TYPE_IMAGE       1
+#define ASSET_TYPE_FONT        2
+
+#define ASSET_CODEC_RAW        0
+#define ASSET_CODEC_RLE        1              // see AssetPack::rleDecode()
+
+// Stub image descriptors carry this format; the real one is in the entry.
+#define ASSET_PACK_IMG_CF      LV_IMG_CF_USER_ENCODED_0
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct __attribute__((packed)) {
+  uint32_t magic;
+  uint16_t version;
+  uint16_t count;
+  uint32_t totalSize;          // header + index + blobs
+} asset_pack_header_t;
+
+typedef struct __attribute__((packed)) {
+  char name[ASSET_NAME_LEN];   // NUL padded
+  uint8_t type;
+  uint8_t codec;
+  uint8_t cf;                  // lv_img_cf_t (images)
+  uint8_t unitSize;            // RLE unit in bytes (bytes per pixel)
+  uint16_t w;
+  uint16_t h;
+  uint32_t offset;             // from the start of the pack
+  uint32_t storedSize;
+  uint32_t rawSize;
+} asset_pack_entry_t;
+
+// Generated font stubs keep their glyph descriptors and kerning in flash;
+// only the glyph bitmap moves to the pack and is bound at boot.
+typedef struct {
+  const char *name;
+  lv_font_fmt_txt_dsc_t *dsc;
+} asset_font_binding_t;
+
+extern const asset_font_binding_t asset_pack_fonts[];
+extern const size_t asset_pack_font_count;
+
+// get_glyph_dsc for stub fonts: reports "no glyph" until the bitmap is bound
+// so LVGL falls back to the built-in font instead of reading a NULL bitmap.
+bool AssetPack_FontGetGlyphDsc(const lv_font_t *font, lv_font_glyph_dsc_t *dsc_out, uint32_t unicode_letter, uint32_t unicode_letter_next);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* asset_pack_format.h */
@@ -0,0 +1,19 @@
+/* Generated by pack_assets.py — do not edit. */
+#ifdef USE_ASSET_PACK
+
+#include "../asset_pack_format.h"
+
+extern lv_font_fmt_txt_dsc_t ui_font_monserrat_normal_60_dsc;
+extern lv_font_fmt_txt_dsc_t ui_font_montserrat_light_80_dsc;
+extern lv_font_fmt_txt_dsc_t ui_font_montserrat_regular_90_dsc;
+extern lv_font_fmt_txt_dsc_t ui_font_montserrat_normal_100_dsc;
+
+const asset_font_binding_t asset_pack_fonts[] = {
+    { "ui_font_monserrat_normal_60", &ui_font_monserrat_normal_60_dsc },
+    { "ui_font_montserrat_light_80", &ui_font_montserrat_light_80_dsc },
+    { "ui_font_montserrat_regular_90", &ui_font_montserrat_regular_90_dsc },
+    { "ui_font_montserrat_normal_100", &ui_font_montserrat_normal_100_dsc },
+};
+const size_t asset_pack_font_count = 4;
+
+#endif /*USE_ASSET_PACK*/
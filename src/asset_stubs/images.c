@@ -0,0 +1,133 @@
+/* Generated by pack_assets.py — do not edit. */
+#ifdef USE_ASSET_PACK
+
+#include "../src/images.h"
+#include "../asset_pack_format.h"
+
+/* Pixel data lives in the asset pack; .data carries the entry name. */
+const lv_img_dsc_t img_01_small = { .header.cf = ASSET_PACK_IMG_CF, .header.w = 24, .header.h = 24, .data_size = 0, .data = (const uint8_t *)"img_01_small" };
+const lv_img_dsc_t img_01d_2x = { .header.cf = ASSET_PACK_IMG_CF, .header.w = 100, .header.h = 100, .data_size = 0, .data = (const uint8_t *)"img_01d_2x" };
+const lv_img_dsc_t img_01n_2x = { .header.cf = ASSET_PACK_IMG_CF, .header.w = 100, .header.h = 100, .data_size = 0, .data = (const uint8_t *)"img_01n_2x" };
+const lv_img_dsc_t img_02_small = { .header.cf = ASSET_PACK_IMG_CF, .header.w = 24, .header.h = 24, .data_size = 0, .data = (const uint8_t *)"img_02_small" };
+const lv_img_dsc_t img_02d_2x = { .header.cf = ASSET_PACK_IMG_CF, .header.w = 100, .header.h = 100, .data_size = 0, .data = (const uint8_t *)"img_02d_2x" };
+const lv_img_dsc_t img_02n_2x = { .header.cf = ASSET_PACK_IMG_CF, .header.w = 100, .header.h = 100, .data_size = 0, .data = (const uint8_t *)"img_02n_2x" };
+const lv_img_dsc_t img_03_small = { .header.cf = ASSET_PACK_IMG_CF, .header.w = 24, .header.h = 24, .data_size = 0, .data = (const uint8_t *)"img_03_small" };
+const lv_img_dsc_t img_03d_2x = { .header.cf = ASSET_PACK_IMG_CF, .header.w = 100, .header.h = 100, .data_size = 0, .data = (const uint8_t *)"img_03d_2x" };
+const lv_img_dsc_t img_03n_2x = { .header.cf = ASSET_PACK_IMG_CF, .header.w = 100, .header.h = 100, .data_size = 0, .data = (const uint8_t *)"img_03n_2x" };
+const lv_img_dsc_t img_04_small = { .header.cf = ASSET_PACK_IMG_CF, .header.w = 24, .header.h = 24, .data_size = 0, .data = (const uint8_t *)"img_04_small" };
+const lv_img_dsc_t img_04d_2x = { .header.cf = ASSET_PACK_IMG_CF, .header.w = 100, .header.h = 100, .data_size = 0, .data = (const uint8_t *)"img_04d_2x" };
+const lv_img_dsc_t img_04n_2x = { .header.cf = ASSET_PACK_IMG_CF, .header.w = 100, .header.h = 100, .data_size = 0, .data = (const uint8_t *)"img_04n_2x" };
+const lv_img_dsc_t img_09_small = { .header.cf = ASSET_PACK_IMG_CF, .header.w = 24, .header.h = 24, .data_size = 0, .data = (const uint8_t *)"img_09_small" };
+const lv_img_dsc_t img_09d_2x = { .header.cf = ASSET_PACK_IMG_CF, .header.w = 100, .header.h = 100, .data_size = 0, .data = (const uint8_t *)"img_09d_2x" };
+const lv_img_dsc_t img_09n_2x = { .header.cf = ASSET_PACK_IMG_CF, .header.w = 100, .header.h = 100, .data_size = 0, .data = (const uint8_t *)"img_09n_2x" };
+const lv_img_dsc_t img_10_small = { .header.cf = ASSET_PACK_IMG_CF, .header.w = 24, .header.h = 24, .data_size = 0, .data = (const uint8_t *)"img_10_small" };
+const lv_img_dsc_t img_10d_2x = { .header.cf = ASSET_PACK_IMG_CF, .header.w = 100, .header.h = 100, .data_size = 0, .data = (const uint8_t *)"img_10d_2x" };
+const lv_img_dsc_t img_10n_2x = { .header.cf = ASSET_PACK_IMG_CF, .header.w = 100, .header.h = 100, .data_size = 0, .data = (const uint8_t *)"img_10n_2x" };
+const lv_img_dsc_t img_11_small = { .header.cf = ASSET_PACK_IMG_CF, .header.w = 24, .header.h = 24, .data_size = 0, .data = (const uint8_t *)"img_11_small" };
+const lv_img_dsc_t img_11d_2x = { .header.cf = ASSET_PACK_IMG_CF, .header.w = 100, .header.h = 100, .data_size = 0, .data = (const uint8_t *)"img_11d_2x" };
+const lv_img_dsc_t img_11n_2x = { .header.cf = ASSET_PACK_IMG_CF, .header.w = 100, .header.h = 100, .data_size = 0, .data = (const uint8_t *)"img_11n_2x" };
+const lv_img_dsc_t img_13_small = { .header.cf = ASSET_PACK_IMG_CF, .header.w = 24, .header.h = 24, .data_size = 0, .data = (const uint8_t *)"img_13_small" };
+const lv_img_dsc_t img_13n_2x = { .header.cf = ASSET_PACK_IMG_CF, .header.w = 100, .header.h = 100, .data_size = 0, .data = (const uint8_t *)"img_13n_2x" };
+const lv_img_dsc_t img_45_small = { .header.cf = ASSET_PACK_IMG_CF, .header.w = 30, .header.h = 30, .data_size = 0, .data = (const uint8_t *)"img_45_small" };
+const lv_img_dsc_t img_50_small = { .header.cf = ASSET_PACK_IMG_CF, .header.w = 24, .header.h = 24, .data_size = 0, .data = (const uint8_t *)"img_50_small" };
+const lv_img_dsc_t img_50d_2x = { .header.cf = ASSET_PACK_IMG_CF, .header.w = 100, .header.h = 100, .data_size = 0, .data = (const uint8_t *)"img_50d_2x" };
+const lv_img_dsc_t img_50n_2x = { .header.cf = ASSET_PACK_IMG_CF, .header.w = 100, .header.h = 100, .data_size = 0, .data = (const uint8_t *)"img_50n_2x" };
+const lv_img_dsc_t img_alarm = { .header.cf = ASSET_PACK_IMG_CF, .header.w = 72, .header.h = 70, .data_size = 0, .data = (const uint8_t *)"img_alarm" };
+const lv_img_dsc_t img_alarm_50 = { .header.cf = ASSET_PACK_IMG_CF, .header.w = 50, .header.h = 49, .data_size = 0, .data = (const uint8_t *)"img_alarm_50" };
+const lv_img_dsc_t img_alarm_small = { .header.cf = ASSET_PACK_IMG_CF, .header.w = 20, .header.h = 19, .data_size = 0, .data = (const uint8_t *)"img_alarm_small" };
+const lv_img_dsc_t img_album = { .header.cf = ASSET_PACK_IMG_CF, .header.w = 196, .header.h = 134, .data_size = 0, .data = (const uint8_t *)"img_album" };
+const lv_img_dsc_t img_apple_30 = { .header.cf = ASSET_PACK_IMG_CF, .header.w = 30, .header.h = 30, .data_size = 0, .data = (const uint8_t *)"img_apple_30" };
+const lv_img_dsc_t img_battery = { .header.cf = ASSET_PACK_IMG_CF, .header.w = 14, .header.h = 23, .data_size = 0, .data = (const uint8_t *)"img_battery" };
+const lv_img_dsc_t img_calculator = { .header.cf = ASSET_PACK_IMG_CF, .header.w = 24, .header.h = 24, .data_size = 0, .data = (const uint8_t *)"img_calculator" };
+const lv_img_dsc_t img_calculator_50 = { .header.cf = ASSET_PACK_IMG_CF, .header.w = 40, .header.h = 50, .data_size = 0, .data = (const uint8_t *)"img_calculator_50" };
+const lv_img_dsc_t img_calendar_20 = { .header.cf = ASSET_PACK_IMG_CF, .header.w = 20, .header.h = 20, .data_size = 0, .data = (const uint8_t *)"img_calendar_20" };
+const lv_img_dsc_t img_calendar_50 = { .header.cf = ASSET_PACK_IMG_CF, .header.w = 50, .header.h = 50, .data_size = 0, .data = (const uint8_t *)"img_calendar_50" };
+const lv_img_dsc_t img_call_30 = { .header.cf = ASSET_PACK_IMG_CF, .header.w = 30, .header.h = 30, .data_size = 0, .data = (const uint8_t *)"img_call_30" };
+const lv_img_dsc_t img_charging = { .header.cf = ASSET_PACK_IMG_CF, .header.w = 10, .header.h = 19, .data_size = 0, .data = (const uint8_t *)"img_charging" };
+const lv_img_dsc_t img_clear_20 = { .header.cf = ASSET_PACK_IMG_CF, .header.w = 20, .header.h = 20, .data_size = 0, .data = (const uint8_t *)"img_clear_20" };
+const lv_img_dsc_t img_daily_mission = { .header.cf = ASSET_PACK_IMG_CF, .header.w = 84, .header.h = 114, .data_size = 0, .data = (const uint8_t *)"img_daily_mission" };
+const lv_img_dsc_t img_emby_30 = { .header.cf = ASSET_PACK_IMG_CF, .header.w = 30, .header.h = 30, .data_size = 0, .data = (const uint8_t *)"img_emby_30" };
+const lv_img_dsc_t img_gear = { .header.cf = ASSET_PACK_IMG_CF, .header.w = 24, .header.h = 24, .data_size = 0, .data = (const uint8_t *)"img_gear" };
+const lv_img_dsc_t img_gear_50 = { .header.cf = ASSET_PACK_IMG_CF, .header.w = 50, .header.h = 50, .data_size = 0, .data = (const uint8_t *)"img_gear_50" };
+const lv_img_dsc_t img_greencheck = { .header.cf = ASSET_PACK_IMG_CF, .header.w = 16, .header.h = 16, .data_size = 0, .data = (const uint8_t *)"img_greencheck" };
+const lv_img_dsc_t img_home_24_white = { .header.cf = ASSET_PACK_IMG_CF, .header.w = 24, .header.h = 24, .data_size = 0, .data = (const uint8_t *)"img_home_24_white" };
+const lv_img_dsc_t img_home_50_white = { .header.cf = ASSET_PACK_IMG_CF, .header.w = 50, .header.h = 50, .data_size = 0, .data = (const uint8_t *)"img_home_50_white" };
+const lv_img_dsc_t img_hourglass = { .header.cf = ASSET_PACK_IMG_CF, .header.w = 100, .header.h = 100, .data_size = 0, .data = (const uint8_t *)"img_hourglass" };
+const lv_img_dsc_t img_humidity = { .header.cf = ASSET_PACK_IMG_CF, .header.w = 14, .header.h = 19, .data_size = 0, .data = (const uint8_t *)"img_humidity" };
+const lv_img_dsc_t img_lock_24 = { .header.cf = ASSET_PACK_IMG_CF, .header.w = 24, .header.h = 24, .data_size = 0, .data = (const uint8_t *)"img_lock_24" };
+const lv_img_dsc_t img_messages_50 = { .header.cf = ASSET_PACK_IMG_CF, .header.w = 50, .header.h = 44, .data_size = 0, .data = (const uint8_t *)"img_messages_50" };
+const lv_img_dsc_t img_music_100 = { .header.cf = ASSET_PACK_IMG_CF, .header.w = 100, .header.h = 100, .data_size = 0, .data = (const uint8_t *)"img_music_100" };
+const lv_img_dsc_t img_music_24_white = { .header.cf = ASSET_PACK_IMG_CF, .header.w = 23, .header.h = 25, .data_size = 0, .data = (const uint8_t *)"img_music_24_white" };
+const lv_img_dsc_t img_music_32 = { .header.cf = ASSET_PACK_IMG_CF, .header.w = 32, .header.h = 32, .data_size = 0, .data = (const uint8_t *)"img_music_32" };
+const lv_img_dsc_t img_music_50 = { .header.cf = ASSET_PACK_IMG_CF, .header.w = 50, .header.h = 54, .data_size = 0, .data = (const uint8_t *)"img_music_50" };
+const lv_img_dsc_t img_musical_note_32 = { .header.cf = ASSET_PACK_IMG_CF, .header.w = 32, .header.h = 32, .data_size = 0, .data = (const uint8_t *)"img_musical_note_32" };
+const lv_img_dsc_t img_next_button = { .header.cf = ASSET_PACK_IMG_CF, .header.w = 34, .header.h = 27, .data_size = 0, .data = (const uint8_t *)"img_next_button" };
+const lv_img_dsc_t img_no_events_50 = { .header.cf = ASSET_PACK_IMG_CF, .header.w = 50, .header.h = 50, .data_size = 0, .data = (const uint8_t *)"img_no_events_50" };
+const lv_img_dsc_t img_notification_amazon = { .header.cf = ASSET_PACK_IMG_CF, .header.w = 80, .header.h = 80, .data_size = 0, .data = (const uint8_t *)"img_notification_amazon" };
+const lv_img_dsc_t img_notification_bambulab_80 = { .header.cf = ASSET_PACK_IMG_CF, .header.w = 80, .header.h = 80, .data_size = 0, .data = (const uint8_t *)"img_notification_bambulab_80" };
+const lv_img_dsc_t img_notification_calendar = { .header.cf = ASSET_PACK_IMG_CF, .header.w = 80, .header.h = 80, .data_size = 0, .data = (const uint8_t *)"img_notification_calendar" };
+const lv_img_dsc_t img_notification_dogdetector = { .header.cf = ASSET_PACK_IMG_CF, .header.w = 80, .header.h = 80, .data_size = 0, .data = (const uint8_t *)"img_notification_dogdetector" };
+const lv_img_dsc_t img_notification_fantasyfootball = { .header.cf = ASSET_PACK_IMG_CF, .header.w = 80, .header.h = 80, .data_size = 0, .data = (const uint8_t *)"img_notification_fantasyfootball" };
+const lv_img_dsc_t img_notification_generic = { .header.cf = ASSET_PACK_IMG_CF, .header.w = 80, .header.h = 80, .data_size = 0, .data = (const uint8_t *)"img_notification_generic" };
+const lv_img_dsc_t img_notification_hangup = { .header.cf = ASSET_PACK_IMG_CF, .header.w = 80, .header.h = 80, .data_size = 0, .data = (const uint8_t *)"img_notification_hangup" };
+const lv_img_dsc_t img_notification_hangup_pressed = { .header.cf = ASSET_PACK_IMG_CF, .header.w = 80, .header.h = 80, .data_size = 0, .data = (const uint8_t *)"img_notification_hangup_pressed" };
+const lv_img_dsc_t img_notification_imessage = { .header.cf = ASSET_PACK_IMG_CF, .header.w = 80, .header.h = 80, .data_size = 0, .data = (const uint8_t *)"img_notification_imessage" };
+const lv_img_dsc_t img_notification_incoming_pressed = { .header.cf = ASSET_PACK_IMG_CF, .header.w = 80, .header.h = 80, .data_size = 0, .data = (const uint8_t *)"img_notification_incoming_pressed" };
+const lv_img_dsc_t img_notification_incomingcall = { .header.cf = ASSET_PACK_IMG_CF, .header.w = 80, .header.h = 80, .data_size = 0, .data = (const uint8_t *)"img_notification_incomingcall" };
+const lv_img_dsc_t img_notification_mail = { .header.cf = ASSET_PACK_IMG_CF, .header.w = 80, .header.h = 80, .data_size = 0, .data = (const uint8_t *)"img_notification_mail" };
+const lv_img_dsc_t img_notification_missedcall = { .header.cf = ASSET_PACK_IMG_CF, .header.w = 80, .header.h = 80, .data_size = 0, .data = (const uint8_t *)"img_notification_missedcall" };
+const lv_img_dsc_t img_notification_myq = { .header.cf = ASSET_PACK_IMG_CF, .header.w = 80, .header.h = 80, .data_size = 0, .data = (const uint8_t *)"img_notification_myq" };
+const lv_img_dsc_t img_notification_pandora_80 = { .header.cf = ASSET_PACK_IMG_CF, .header.w = 80, .header.h = 81, .data_size = 0, .data = (const uint8_t *)"img_notification_pandora_80" };
+const lv_img_dsc_t img_notification_rachio = { .header.cf = ASSET_PACK_IMG_CF, .header.w = 80, .header.h = 80, .data_size = 0, .data = (const uint8_t *)"img_notification_rachio" };
+const lv_img_dsc_t img_notification_reolink = { .header.cf = ASSET_PACK_IMG_CF, .header.w = 80, .header.h = 80, .data_size = 0, .data = (const uint8_t *)"img_notification_reolink" };
+const lv_img_dsc_t img_notification_ring = { .header.cf = ASSET_PACK_IMG_CF, .header.w = 80, .header.h = 80, .data_size = 0, .data = (const uint8_t *)"img_notification_ring" };
+const lv_img_dsc_t img_notification_slack = { .header.cf = ASSET_PACK_IMG_CF, .header.w = 80, .header.h = 80, .data_size = 0, .data = (const uint8_t *)"img_notification_slack" };
+const lv_img_dsc_t img_notification_spotify_80 = { .header.cf = ASSET_PACK_IMG_CF, .header.w = 80, .header.h = 79, .data_size = 0, .data = (const uint8_t *)"img_notification_spotify_80" };
+const lv_img_dsc_t img_notification_uber = { .header.cf = ASSET_PACK_IMG_CF, .header.w = 80, .header.h = 80, .data_size = 0, .data = (const uint8_t *)"img_notification_uber" };
+const lv_img_dsc_t img_notification_voicemail = { .header.cf = ASSET_PACK_IMG_CF, .header.w = 80, .header.h = 80, .data_size = 0, .data = (const uint8_t *)"img_notification_voicemail" };
+const lv_img_dsc_t img_notification_weather_80 = { .header.cf = ASSET_PACK_IMG_CF, .header.w = 80, .header.h = 79, .data_size = 0, .data = (const uint8_t *)"img_notification_weather_80" };
+const lv_img_dsc_t img_notifications_24_white = { .header.cf = ASSET_PACK_IMG_CF, .header.w = 26, .header.h = 23, .data_size = 0, .data = (const uint8_t *)"img_notifications_24_white" };
+const lv_img_dsc_t img_pandora_30 = { .header.cf = ASSET_PACK_IMG_CF, .header.w = 30, .header.h = 30, .data_size = 0, .data = (const uint8_t *)"img_pandora_30" };
+const lv_img_dsc_t img_pause_100 = { .header.cf = ASSET_PACK_IMG_CF, .header.w = 100, .header.h = 100, .data_size = 0, .data = (const uint8_t *)"img_pause_100" };
+const lv_img_dsc_t img_pause_20 = { .header.cf = ASSET_PACK_IMG_CF, .header.w = 20, .header.h = 20, .data_size = 0, .data = (const uint8_t *)"img_pause_20" };
+const lv_img_dsc_t img_pause_button_64 = { .header.cf = ASSET_PACK_IMG_CF, .header.w = 64, .header.h = 64, .data_size = 0, .data = (const uint8_t *)"img_pause_button_64" };
+const lv_img_dsc_t img_play = { .header.cf = ASSET_PACK_IMG_CF, .header.w = 24, .header.h = 24, .data_size = 0, .data = (const uint8_t *)"img_play" };
+const lv_img_dsc_t img_play_100 = { .header.cf = ASSET_PACK_IMG_CF, .header.w = 100, .header.h = 100, .data_size = 0, .data = (const uint8_t *)"img_play_100" };
+const lv_img_dsc_t img_play_20 = { .header.cf = ASSET_PACK_IMG_CF, .header.w = 20, .header.h = 20, .data_size = 0, .data = (const uint8_t *)"img_play_20" };
+const lv_img_dsc_t img_play_64 = { .header.cf = ASSET_PACK_IMG_CF, .header.w = 64, .header.h = 64, .data_size = 0, .data = (const uint8_t *)"img_play_64" };
+const lv_img_dsc_t img_prev_button = { .header.cf = ASSET_PACK_IMG_CF, .header.w = 34, .header.h = 27, .data_size = 0, .data = (const uint8_t *)"img_prev_button" };
+const lv_img_dsc_t img_refresh = { .header.cf = ASSET_PACK_IMG_CF, .header.w = 24, .header.h = 24, .data_size = 0, .data = (const uint8_t *)"img_refresh" };
+const lv_img_dsc_t img_restart_35 = { .header.cf = ASSET_PACK_IMG_CF, .header.w = 35, .header.h = 35, .data_size = 0, .data = (const uint8_t *)"img_restart_35" };
+const lv_img_dsc_t img_scroll_gradient = { .header.cf = ASSET_PACK_IMG_CF, .header.w = 300, .header.h = 90, .data_size = 0, .data = (const uint8_t *)"img_scroll_gradient" };
+const lv_img_dsc_t img_sec_dot = { .header.cf = ASSET_PACK_IMG_CF, .header.w = 8, .header.h = 8, .data_size = 0, .data = (const uint8_t *)"img_sec_dot" };
+const lv_img_dsc_t img_snoooze = { .header.cf = ASSET_PACK_IMG_CF, .header.w = 50, .header.h = 50, .data_size = 0, .data = (const uint8_t *)"img_snoooze" };
+const lv_img_dsc_t img_spotify_30 = { .header.cf = ASSET_PACK_IMG_CF, .header.w = 30, .header.h = 30, .data_size = 0, .data = (const uint8_t *)"img_spotify_30" };
+const lv_img_dsc_t img_step = { .header.cf = ASSET_PACK_IMG_CF, .header.w = 19, .header.h = 15, .data_size = 0, .data = (const uint8_t *)"img_step" };
+const lv_img_dsc_t img_step2 = { .header.cf = ASSET_PACK_IMG_CF, .header.w = 19, .header.h = 15, .data_size = 0, .data = (const uint8_t *)"img_step2" };
+const lv_img_dsc_t img_step3 = { .header.cf = ASSET_PACK_IMG_CF, .header.w = 19, .header.h = 15, .data_size = 0, .data = (const uint8_t *)"img_step3" };
+const lv_img_dsc_t img_stop = { .header.cf = ASSET_PACK_IMG_CF, .header.w = 24, .header.h = 24, .data_size = 0, .data = (const uint8_t *)"img_stop" };
+const lv_img_dsc_t img_stop_20 = { .header.cf = ASSET_PACK_IMG_CF, .header.w = 20, .header.h = 20, .data_size = 0, .data = (const uint8_t *)"img_stop_20" };
+const lv_img_dsc_t img_stopwatch_24 = { .header.cf = ASSET_PACK_IMG_CF, .header.w = 24, .header.h = 24, .data_size = 0, .data = (const uint8_t *)"img_stopwatch_24" };
+const lv_img_dsc_t img_stopwatch_50 = { .header.cf = ASSET_PACK_IMG_CF, .header.w = 50, .header.h = 50, .data_size = 0, .data = (const uint8_t *)"img_stopwatch_50" };
+const lv_img_dsc_t img_sun_35 = { .header.cf = ASSET_PACK_IMG_CF, .header.w = 35, .header.h = 35, .data_size = 0, .data = (const uint8_t *)"img_sun_35" };
+const lv_img_dsc_t img_timer_24 = { .header.cf = ASSET_PACK_IMG_CF, .header.w = 24, .header.h = 24, .data_size = 0, .data = (const uint8_t *)"img_timer_24" };
+const lv_img_dsc_t img_timer_50 = { .header.cf = ASSET_PACK_IMG_CF, .header.w = 50, .header.h = 50, .data_size = 0, .data = (const uint8_t *)"img_timer_50" };
+const lv_img_dsc_t img_volume_35 = { .header.cf = ASSET_PACK_IMG_CF, .header.w = 35, .header.h = 35, .data_size = 0, .data = (const uint8_t *)"img_volume_35" };
+const lv_img_dsc_t img_volume_down = { .header.cf = ASSET_PACK_IMG_CF, .header.w = 34, .header.h = 32, .data_size = 0, .data = (const uint8_t *)"img_volume_down" };
+const lv_img_dsc_t img_volume_up = { .header.cf = ASSET_PACK_IMG_CF, .header.w = 41, .header.h = 32, .data_size = 0, .data = (const uint8_t *)"img_volume_up" };
+const lv_img_dsc_t img_weather = { .header.cf = ASSET_PACK_IMG_CF, .header.w = 28, .header.h = 23, .data_size = 0, .data = (const uint8_t *)"img_weather" };
+const lv_img_dsc_t img_weather_50 = { .header.cf = ASSET_PACK_IMG_CF, .header.w = 50, .header.h = 50, .data_size = 0, .data = (const uint8_t *)"img_weather_50" };
+const lv_img_dsc_t img_weather_cloud = { .header.cf = ASSET_PACK_IMG_CF, .header.w = 37, .header.h = 30, .data_size = 0, .data = (const uint8_t *)"img_weather_cloud" };
+const lv_img_dsc_t img_weather_cloud_fog = { .header.cf = ASSET_PACK_IMG_CF, .header.w = 37, .header.h = 29, .data_size = 0, .data = (const uint8_t *)"img_weather_cloud_fog" };
+const lv_img_dsc_t img_weather_sun = { .header.cf = ASSET_PACK_IMG_CF, .header.w = 28, .header.h = 28, .data_size = 0, .data = (const uint8_t *)"img_weather_sun" };
+const lv_img_dsc_t img_weather_sun_cloud = { .header.cf = ASSET_PACK_IMG_CF, .header.w = 37, .header.h = 30, .data_size = 0, .data = (const uint8_t *)"img_weather_sun_cloud" };
+const lv_img_dsc_t img_wifi = { .header.cf = ASSET_PACK_IMG_CF, .header.w = 35, .header.h = 26, .data_size = 0, .data = (const uint8_t *)"img_wifi" };
+const lv_img_dsc_t img_wifi_24 = { .header.cf = ASSET_PACK_IMG_CF, .header.w = 24, .header.h = 18, .data_size = 0, .data = (const uint8_t *)"img_wifi_24" };
+const lv_img_dsc_t img_wifi_one_24 = { .header.cf = ASSET_PACK_IMG_CF, .header.w = 24, .header.h = 18, .data_size = 0, .data = (const uint8_t *)"img_wifi_one_24" };
+const lv_img_dsc_t img_wifi_three_24 = { .header.cf = ASSET_PACK_IMG_CF, .header.w = 24, .header.h = 18, .data_size = 0, .data = (const uint8_t *)"img_wifi_three_24" };
+const lv_img_dsc_t img_wifi_two_24 = { .header.cf = ASSET_PACK_IMG_CF, .header.w = 24, .header.h = 18, .data_size = 0, .data = (const uint8_t *)"img_wifi_two_24" };
+const lv_img_dsc_t img_wiim_30 = { .header.cf = ASSET_PACK_IMG_CF, .header.w = 30, .header.h = 30, .data_size = 0, .data = (const uint8_t *)"img_wiim_30" };
+const lv_img_dsc_t img_wind = { .header.cf = ASSET_PACK_IMG_CF, .header.w = 20, .header.h = 20, .data_size = 0, .data = (const uint8_t *)"img_wind" };
+const lv_img_dsc_t img_youtube_30 = { .header.cf = ASSET_PACK_IMG_CF, .header.w = 30, .header.h = 30, .data_size = 0, .data = (const uint8_t *)"img_youtube_30" };
+
+#endif /*USE_ASSET_PACK*/
@@ -0,0 +1,927 @@
+/* Generated by pack_assets.py — do not edit. */
+#ifdef USE_ASSET_PACK
+
+/*******************************************************************************
+ * Size: 60 px
+ * Bpp: 8
+ * Opts: --bpp 8 --size 60 --no-compress --font fonts/Montserrat-Medium.ttf --range 32-255 --format lvgl
+ ******************************************************************************/
+
+#ifdef __has_include
+    #if __has_include("lvgl.h")
+        #ifndef LV_LVGL_H_INCLUDE_SIMPLE
+            #define LV_LVGL_H_INCLUDE_SIMPLE
+        #endif
+    #endif
+#endif
+
+#ifdef LV_LVGL_H_INCLUDE_SIMPLE
+    #include "lvgl.h"
+#else
+    #include "lvgl.h"
+#endif
+#include "../asset_pack_format.h"
+
+#ifndef UI_FONT_MONSERRAT_NORMAL_60
+#define UI_FONT_MONSERRAT_NORMAL_60 1
+#endif
+
+#if UI_FONT_MONSERRAT_NORMAL_60
+
+/*-----------------
+ *    BITMAPS
+ *----------------*/
+
+
+
+
+/*---------------------
+ *  GLYPH DESCRIPTION
+ *--------------------*/
+
+static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
+    {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
+    {.bitmap_index = 0, .adv_w = 258, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 0, .adv_w = 257, .box_w = 8, .box_h = 42, .ofs_x = 4, .ofs_y = 0},
+    {.bitmap_index = 336, .adv_w = 375, .box_w = 17, .box_h = 17, .ofs_x = 3, .ofs_y = 25},
+    {.bitmap_index = 625, .adv_w = 675, .box_w = 40, .box_h = 42, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2305, .adv_w = 596, .box_w = 33, .box_h = 57, .ofs_x = 2, .ofs_y = -7},
+    {.bitmap_index = 4186, .adv_w = 809, .box_w = 47, .box_h = 42, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 6160, .adv_w = 659, .box_w = 39, .box_h = 43, .ofs_x = 2, .ofs_y = -1},
+    {.bitmap_index = 7837, .adv_w = 202, .box_w = 6, .box_h = 17, .ofs_x = 3, .ofs_y = 25},
+    {.bitmap_index = 7939, .adv_w = 324, .box_w = 14, .box_h = 56, .ofs_x = 5, .ofs_y = -12},
+    {.bitmap_index = 8723, .adv_w = 324, .box_w = 14, .box_h = 56, .ofs_x = 1, .ofs_y = -12},
+    {.bitmap_index = 9507, .adv_w = 384, .box_w = 22, .box_h = 23, .ofs_x = 1, .ofs_y = 22},
+    {.bitmap_index = 10013, .adv_w = 559, .box_w = 27, .box_h = 27, .ofs_x = 4, .ofs_y = 8},
+    {.bitmap_index = 10742, .adv_w = 218, .box_w = 9, .box_h = 17, .ofs_x = 2, .ofs_y = -9},
+    {.bitmap_index = 10895, .adv_w = 368, .box_w = 17, .box_h = 5, .ofs_x = 3, .ofs_y = 14},
+    {.bitmap_index = 10980, .adv_w = 218, .box_w = 9, .box_h = 9, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 11061, .adv_w = 338, .box_w = 26, .box_h = 57, .ofs_x = -2, .ofs_y = -6},
+    {.bitmap_index = 12543, .adv_w = 640, .box_w = 36, .box_h = 42, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 14055, .adv_w = 355, .box_w = 16, .box_h = 42, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 14727, .adv_w = 551, .box_w = 33, .box_h = 42, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 16113, .adv_w = 549, .box_w = 32, .box_h = 42, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 17457, .adv_w = 642, .box_w = 38, .box_h = 42, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 19053, .adv_w = 551, .box_w = 32, .box_h = 42, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 20397, .adv_w = 592, .box_w = 34, .box_h = 42, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 21825, .adv_w = 574, .box_w = 33, .box_h = 42, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 23211, .adv_w = 618, .box_w = 34, .box_h = 42, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 24639, .adv_w = 592, .box_w = 34, .box_h = 42, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 26067, .adv_w = 218, .box_w = 9, .box_h = 32, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 26355, .adv_w = 218, .box_w = 9, .box_h = 41, .ofs_x = 2, .ofs_y = -9},
+    {.bitmap_index = 26724, .adv_w = 559, .box_w = 27, .box_h = 28, .ofs_x = 4, .ofs_y = 7},
+    {.bitmap_index = 27480, .adv_w = 559, .box_w = 27, .box_h = 19, .ofs_x = 4, .ofs_y = 11},
+    {.bitmap_index = 27993, .adv_w = 559, .box_w = 27, .box_h = 28, .ofs_x = 4, .ofs_y = 7},
+    {.bitmap_index = 28749, .adv_w = 550, .box_w = 31, .box_h = 42, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 30051, .adv_w = 993, .box_w = 58, .box_h = 54, .ofs_x = 2, .ofs_y = -12},
+    {.bitmap_index = 33183, .adv_w = 703, .box_w = 45, .box_h = 42, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 35073, .adv_w = 727, .box_w = 37, .box_h = 42, .ofs_x = 6, .ofs_y = 0},
+    {.bitmap_index = 36627, .adv_w = 694, .box_w = 40, .box_h = 42, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 38307, .adv_w = 793, .box_w = 41, .box_h = 42, .ofs_x = 6, .ofs_y = 0},
+    {.bitmap_index = 40029, .adv_w = 643, .box_w = 31, .box_h = 42, .ofs_x = 6, .ofs_y = 0},
+    {.bitmap_index = 41331, .adv_w = 610, .box_w = 30, .box_h = 42, .ofs_x = 6, .ofs_y = 0},
+    {.bitmap_index = 42591, .adv_w = 741, .box_w = 40, .box_h = 42, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 44271, .adv_w = 780, .box_w = 37, .box_h = 42, .ofs_x = 6, .ofs_y = 0},
+    {.bitmap_index = 45825, .adv_w = 298, .box_w = 7, .box_h = 42, .ofs_x = 6, .ofs_y = 0},
+    {.bitmap_index = 46119, .adv_w = 492, .box_w = 26, .box_h = 42, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 47211, .adv_w = 690, .box_w = 38, .box_h = 42, .ofs_x = 6, .ofs_y = 0},
+    {.bitmap_index = 48807, .adv_w = 570, .box_w = 30, .box_h = 42, .ofs_x = 6, .ofs_y = 0},
+    {.bitmap_index = 50067, .adv_w = 917, .box_w = 45, .box_h = 42, .ofs_x = 6, .ofs_y = 0},
+    {.bitmap_index = 51957, .adv_w = 780, .box_w = 37, .box_h = 42, .ofs_x = 6, .ofs_y = 0},
+    {.bitmap_index = 53511, .adv_w = 806, .box_w = 46, .box_h = 42, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 55443, .adv_w = 693, .box_w = 35, .box_h = 42, .ofs_x = 6, .ofs_y = 0},
+    {.bitmap_index = 56913, .adv_w = 806, .box_w = 48, .box_h = 51, .ofs_x = 2, .ofs_y = -9},
+    {.bitmap_index = 59361, .adv_w = 698, .box_w = 35, .box_h = 42, .ofs_x = 6, .ofs_y = 0},
+    {.bitmap_index = 60831, .adv_w = 596, .box_w = 33, .box_h = 42, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 62217, .adv_w = 564, .box_w = 35, .box_h = 42, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 63687, .adv_w = 759, .box_w = 37, .box_h = 42, .ofs_x = 5, .ofs_y = 0},
+    {.bitmap_index = 65241, .adv_w = 684, .box_w = 44, .box_h = 42, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 67089, .adv_w = 1081, .box_w = 65, .box_h = 42, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 69819, .adv_w = 646, .box_w = 40, .box_h = 42, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 71499, .adv_w = 621, .box_w = 41, .box_h = 42, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 73221, .adv_w = 631, .box_w = 36, .box_h = 42, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 74733, .adv_w = 320, .box_w = 13, .box_h = 56, .ofs_x = 6, .ofs_y = -12},
+    {.bitmap_index = 75461, .adv_w = 338, .box_w = 26, .box_h = 57, .ofs_x = -3, .ofs_y = -6},
+    {.bitmap_index = 76943, .adv_w = 320, .box_w = 13, .box_h = 56, .ofs_x = 1, .ofs_y = -12},
+    {.bitmap_index = 77671, .adv_w = 560, .box_w = 27, .box_h = 25, .ofs_x = 4, .ofs_y = 9},
+    {.bitmap_index = 78346, .adv_w = 480, .box_w = 30, .box_h = 4, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 78466, .adv_w = 576, .box_w = 16, .box_h = 8, .ofs_x = 7, .ofs_y = 36},
+    {.bitmap_index = 78594, .adv_w = 574, .box_w = 28, .box_h = 32, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 79490, .adv_w = 655, .box_w = 34, .box_h = 45, .ofs_x = 5, .ofs_y = 0},
+    {.bitmap_index = 81020, .adv_w = 548, .box_w = 31, .box_h = 32, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 82012, .adv_w = 655, .box_w = 34, .box_h = 45, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 83542, .adv_w = 588, .box_w = 33, .box_h = 32, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 84598, .adv_w = 339, .box_w = 24, .box_h = 45, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 85678, .adv_w = 662, .box_w = 34, .box_h = 44, .ofs_x = 2, .ofs_y = -12},
+    {.bitmap_index = 87174, .adv_w = 654, .box_w = 31, .box_h = 45, .ofs_x = 5, .ofs_y = 0},
+    {.bitmap_index = 88569, .adv_w = 268, .box_w = 9, .box_h = 46, .ofs_x = 4, .ofs_y = 0},
+    {.bitmap_index = 88983, .adv_w = 273, .box_w = 19, .box_h = 58, .ofs_x = -6, .ofs_y = -12},
+    {.bitmap_index = 90085, .adv_w = 591, .box_w = 32, .box_h = 45, .ofs_x = 5, .ofs_y = 0},
+    {.bitmap_index = 91525, .adv_w = 268, .box_w = 7, .box_h = 45, .ofs_x = 5, .ofs_y = 0},
+    {.bitmap_index = 91840, .adv_w = 1015, .box_w = 54, .box_h = 32, .ofs_x = 5, .ofs_y = 0},
+    {.bitmap_index = 93568, .adv_w = 654, .box_w = 31, .box_h = 32, .ofs_x = 5, .ofs_y = 0},
+    {.bitmap_index = 94560, .adv_w = 610, .box_w = 34, .box_h = 32, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 95648, .adv_w = 655, .box_w = 34, .box_h = 44, .ofs_x = 5, .ofs_y = -12},
+    {.bitmap_index = 97144, .adv_w = 655, .box_w = 34, .box_h = 44, .ofs_x = 2, .ofs_y = -12},
+    {.bitmap_index = 98640, .adv_w = 394, .box_w = 18, .box_h = 32, .ofs_x = 5, .ofs_y = 0},
+    {.bitmap_index = 99216, .adv_w = 481, .box_w = 28, .box_h = 32, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 100112, .adv_w = 397, .box_w = 24, .box_h = 39, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 101048, .adv_w = 650, .box_w = 31, .box_h = 32, .ofs_x = 5, .ofs_y = 0},
+    {.bitmap_index = 102040, .adv_w = 537, .box_w = 35, .box_h = 32, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 103160, .adv_w = 863, .box_w = 54, .box_h = 32, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 104888, .adv_w = 530, .box_w = 33, .box_h = 32, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 105944, .adv_w = 537, .box_w = 36, .box_h = 44, .ofs_x = -2, .ofs_y = -12},
+    {.bitmap_index = 107528, .adv_w = 500, .box_w = 28, .box_h = 32, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 108424, .adv_w = 337, .box_w = 17, .box_h = 56, .ofs_x = 3, .ofs_y = -12},
+    {.bitmap_index = 109376, .adv_w = 287, .box_w = 6, .box_h = 56, .ofs_x = 6, .ofs_y = -12},
+    {.bitmap_index = 109712, .adv_w = 337, .box_w = 17, .box_h = 56, .ofs_x = 1, .ofs_y = -12},
+    {.bitmap_index = 110664, .adv_w = 559, .box_w = 29, .box_h = 11, .ofs_x = 3, .ofs_y = 16},
+    {.bitmap_index = 110983, .adv_w = 258, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 110983, .adv_w = 257, .box_w = 8, .box_h = 41, .ofs_x = 4, .ofs_y = -9},
+    {.bitmap_index = 111311, .adv_w = 548, .box_w = 31, .box_h = 47, .ofs_x = 2, .ofs_y = -7},
+    {.bitmap_index = 112768, .adv_w = 620, .box_w = 37, .box_h = 42, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 114322, .adv_w = 672, .box_w = 40, .box_h = 39, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 115882, .adv_w = 679, .box_w = 44, .box_h = 42, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 117730, .adv_w = 287, .box_w = 6, .box_h = 56, .ofs_x = 6, .ofs_y = -12},
+    {.bitmap_index = 118066, .adv_w = 480, .box_w = 28, .box_h = 49, .ofs_x = 1, .ofs_y = -7},
+    {.bitmap_index = 119438, .adv_w = 576, .box_w = 18, .box_h = 7, .ofs_x = 9, .ofs_y = 37},
+    {.bitmap_index = 119564, .adv_w = 770, .box_w = 44, .box_h = 42, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 121412, .adv_w = 388, .box_w = 19, .box_h = 19, .ofs_x = 2, .ofs_y = 26},
+    {.bitmap_index = 121773, .adv_w = 484, .box_w = 27, .box_h = 23, .ofs_x = 2, .ofs_y = 4},
+    {.bitmap_index = 122394, .adv_w = 559, .box_w = 27, .box_h = 16, .ofs_x = 4, .ofs_y = 8},
+    {.bitmap_index = 122826, .adv_w = 368, .box_w = 17, .box_h = 5, .ofs_x = 3, .ofs_y = 14},
+    {.bitmap_index = 122911, .adv_w = 770, .box_w = 44, .box_h = 42, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 124759, .adv_w = 576, .box_w = 20, .box_h = 4, .ofs_x = 8, .ofs_y = 38},
+    {.bitmap_index = 124839, .adv_w = 402, .box_w = 21, .box_h = 20, .ofs_x = 2, .ofs_y = 23},
+    {.bitmap_index = 125259, .adv_w = 559, .box_w = 27, .box_h = 37, .ofs_x = 4, .ofs_y = 0},
+    {.bitmap_index = 126258, .adv_w = 413, .box_w = 22, .box_h = 25, .ofs_x = 1, .ofs_y = 20},
+    {.bitmap_index = 126808, .adv_w = 413, .box_w = 22, .box_h = 25, .ofs_x = 1, .ofs_y = 20},
+    {.bitmap_index = 127358, .adv_w = 576, .box_w = 16, .box_h = 8, .ofs_x = 13, .ofs_y = 36},
+    {.bitmap_index = 127486, .adv_w = 655, .box_w = 31, .box_h = 44, .ofs_x = 5, .ofs_y = -12},
+    {.bitmap_index = 128850, .adv_w = 622, .box_w = 32, .box_h = 51, .ofs_x = 1, .ofs_y = -6},
+    {.bitmap_index = 130482, .adv_w = 256, .box_w = 9, .box_h = 9, .ofs_x = 3, .ofs_y = 12},
+    {.bitmap_index = 130563, .adv_w = 576, .box_w = 13, .box_h = 14, .ofs_x = 11, .ofs_y = -13},
+    {.bitmap_index = 130745, .adv_w = 413, .box_w = 19, .box_h = 25, .ofs_x = 4, .ofs_y = 20},
+    {.bitmap_index = 131220, .adv_w = 401, .box_w = 23, .box_h = 20, .ofs_x = 1, .ofs_y = 25},
+    {.bitmap_index = 131680, .adv_w = 484, .box_w = 26, .box_h = 23, .ofs_x = 2, .ofs_y = 4},
+    {.bitmap_index = 132278, .adv_w = 993, .box_w = 57, .box_h = 42, .ofs_x = 4, .ofs_y = 0},
+    {.bitmap_index = 134672, .adv_w = 993, .box_w = 56, .box_h = 42, .ofs_x = 4, .ofs_y = 0},
+    {.bitmap_index = 137024, .adv_w = 993, .box_w = 60, .box_h = 42, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 139544, .adv_w = 550, .box_w = 30, .box_h = 42, .ofs_x = 4, .ofs_y = -10},
+    {.bitmap_index = 140804, .adv_w = 703, .box_w = 45, .box_h = 53, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 143189, .adv_w = 703, .box_w = 45, .box_h = 53, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 145574, .adv_w = 703, .box_w = 45, .box_h = 53, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 147959, .adv_w = 703, .box_w = 45, .box_h = 53, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 150344, .adv_w = 703, .box_w = 45, .box_h = 53, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 152729, .adv_w = 703, .box_w = 45, .box_h = 59, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 155384, .adv_w = 1005, .box_w = 61, .box_h = 42, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 157946, .adv_w = 694, .box_w = 40, .box_h = 55, .ofs_x = 2, .ofs_y = -13},
+    {.bitmap_index = 160146, .adv_w = 643, .box_w = 31, .box_h = 53, .ofs_x = 6, .ofs_y = 0},
+    {.bitmap_index = 161789, .adv_w = 643, .box_w = 31, .box_h = 53, .ofs_x = 6, .ofs_y = 0},
+    {.bitmap_index = 163432, .adv_w = 643, .box_w = 31, .box_h = 53, .ofs_x = 6, .ofs_y = 0},
+    {.bitmap_index = 165075, .adv_w = 643, .box_w = 31, .box_h = 53, .ofs_x = 6, .ofs_y = 0},
+    {.bitmap_index = 166718, .adv_w = 298, .box_w = 16, .box_h = 53, .ofs_x = -2, .ofs_y = 0},
+    {.bitmap_index = 167566, .adv_w = 298, .box_w = 17, .box_h = 53, .ofs_x = 4, .ofs_y = 0},
+    {.bitmap_index = 168467, .adv_w = 298, .box_w = 23, .box_h = 53, .ofs_x = -2, .ofs_y = 0},
+    {.bitmap_index = 169686, .adv_w = 298, .box_w = 18, .box_h = 53, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 170640, .adv_w = 801, .box_w = 48, .box_h = 42, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 172656, .adv_w = 780, .box_w = 37, .box_h = 53, .ofs_x = 6, .ofs_y = 0},
+    {.bitmap_index = 174617, .adv_w = 806, .box_w = 46, .box_h = 54, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 177101, .adv_w = 806, .box_w = 46, .box_h = 54, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 179585, .adv_w = 806, .box_w = 46, .box_h = 54, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 182069, .adv_w = 806, .box_w = 46, .box_h = 54, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 184553, .adv_w = 806, .box_w = 46, .box_h = 53, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 186991, .adv_w = 559, .box_w = 23, .box_h = 24, .ofs_x = 6, .ofs_y = 9},
+    {.bitmap_index = 187543, .adv_w = 806, .box_w = 46, .box_h = 51, .ofs_x = 2, .ofs_y = -4},
+    {.bitmap_index = 189889, .adv_w = 759, .box_w = 37, .box_h = 54, .ofs_x = 5, .ofs_y = 0},
+    {.bitmap_index = 191887, .adv_w = 759, .box_w = 37, .box_h = 54, .ofs_x = 5, .ofs_y = 0},
+    {.bitmap_index = 193885, .adv_w = 759, .box_w = 37, .box_h = 54, .ofs_x = 5, .ofs_y = 0},
+    {.bitmap_index = 195883, .adv_w = 759, .box_w = 37, .box_h = 53, .ofs_x = 5, .ofs_y = 0},
+    {.bitmap_index = 197844, .adv_w = 621, .box_w = 41, .box_h = 53, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 200017, .adv_w = 693, .box_w = 35, .box_h = 42, .ofs_x = 6, .ofs_y = 0},
+    {.bitmap_index = 201487, .adv_w = 649, .box_w = 33, .box_h = 46, .ofs_x = 5, .ofs_y = 0},
+    {.bitmap_index = 203005, .adv_w = 574, .box_w = 28, .box_h = 45, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 204265, .adv_w = 574, .box_w = 28, .box_h = 45, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 205525, .adv_w = 574, .box_w = 28, .box_h = 45, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 206785, .adv_w = 574, .box_w = 28, .box_h = 45, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 208045, .adv_w = 574, .box_w = 28, .box_h = 44, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 209277, .adv_w = 574, .box_w = 28, .box_h = 49, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 210649, .adv_w = 949, .box_w = 54, .box_h = 32, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 212377, .adv_w = 548, .box_w = 31, .box_h = 45, .ofs_x = 2, .ofs_y = -13},
+    {.bitmap_index = 213772, .adv_w = 588, .box_w = 33, .box_h = 45, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 215257, .adv_w = 588, .box_w = 33, .box_h = 45, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 216742, .adv_w = 588, .box_w = 33, .box_h = 45, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 218227, .adv_w = 588, .box_w = 33, .box_h = 44, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 219679, .adv_w = 268, .box_w = 16, .box_h = 44, .ofs_x = -3, .ofs_y = 0},
+    {.bitmap_index = 220383, .adv_w = 268, .box_w = 17, .box_h = 44, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 221131, .adv_w = 268, .box_w = 19, .box_h = 44, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 221967, .adv_w = 268, .box_w = 15, .box_h = 44, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 222627, .adv_w = 614, .box_w = 34, .box_h = 44, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 224123, .adv_w = 654, .box_w = 31, .box_h = 44, .ofs_x = 5, .ofs_y = 0},
+    {.bitmap_index = 225487, .adv_w = 610, .box_w = 34, .box_h = 45, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 227017, .adv_w = 610, .box_w = 34, .box_h = 45, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 228547, .adv_w = 610, .box_w = 34, .box_h = 45, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 230077, .adv_w = 610, .box_w = 34, .box_h = 45, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 231607, .adv_w = 610, .box_w = 34, .box_h = 44, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 233103, .adv_w = 559, .box_w = 27, .box_h = 31, .ofs_x = 4, .ofs_y = 6},
+    {.bitmap_index = 233940, .adv_w = 610, .box_w = 34, .box_h = 40, .ofs_x = 2, .ofs_y = -4},
+    {.bitmap_index = 235300, .adv_w = 650, .box_w = 31, .box_h = 45, .ofs_x = 5, .ofs_y = 0},
+    {.bitmap_index = 236695, .adv_w = 650, .box_w = 31, .box_h = 45, .ofs_x = 5, .ofs_y = 0},
+    {.bitmap_index = 238090, .adv_w = 650, .box_w = 31, .box_h = 45, .ofs_x = 5, .ofs_y = 0},
+    {.bitmap_index = 239485, .adv_w = 650, .box_w = 31, .box_h = 44, .ofs_x = 5, .ofs_y = 0},
+    {.bitmap_index = 240849, .adv_w = 537, .box_w = 36, .box_h = 56, .ofs_x = -2, .ofs_y = -12},
+    {.bitmap_index = 242865, .adv_w = 655, .box_w = 34, .box_h = 56, .ofs_x = 5, .ofs_y = -12},
+    {.bitmap_index = 244769, .adv_w = 537, .box_w = 36, .box_h = 56, .ofs_x = -2, .ofs_y = -12}
+};
+
+/*---------------------
+ *  CHARACTER MAPPING
+ *--------------------*/
+
+
+
+/*Collect the unicode lists and glyph_id offsets*/
+static const lv_font_fmt_txt_cmap_t cmaps[] =
+{
+    {
+        .range_start = 32, .range_length = 95, .glyph_id_start = 1,
+        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
+    },
+    {
+        .range_start = 160, .range_length = 96, .glyph_id_start = 96,
+        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
+    }
+};
+
+/*-----------------
+ *    KERNING
+ *----------------*/
+
+
+/*Map glyph_ids to kern left classes*/
+static const uint8_t kern_left_class_mapping[] =
+{
+    0, 0, 1, 2, 0, 3, 4, 5,
+    2, 6, 7, 8, 9, 10, 9, 10,
+    11, 12, 0, 13, 14, 15, 16, 17,
+    18, 19, 12, 20, 20, 0, 0, 0,
+    21, 22, 23, 24, 25, 22, 26, 27,
+    28, 29, 29, 30, 31, 32, 29, 29,
+    22, 33, 34, 35, 3, 36, 30, 37,
+    37, 38, 39, 40, 41, 42, 43, 0,
+    44, 0, 45, 46, 47, 48, 49, 50,
+    51, 45, 52, 52, 53, 48, 45, 45,
+    46, 46, 54, 55, 56, 57, 51, 58,
+    58, 59, 58, 60, 41, 0, 0, 9,
+    0, 61, 47, 62, 63, 64, 0, 65,
+    0, 22, 8, 66, 0, 9, 22, 0,
+    67, 0, 0, 0, 0, 51, 29, 9,
+    0, 0, 8, 9, 0, 0, 0, 68,
+    23, 23, 23, 23, 23, 23, 26, 25,
+    26, 26, 26, 26, 29, 29, 29, 29,
+    22, 29, 22, 22, 22, 22, 22, 0,
+    22, 30, 30, 30, 30, 39, 69, 46,
+    45, 45, 45, 45, 45, 45, 49, 47,
+    49, 49, 49, 49, 51, 51, 70, 51,
+    71, 45, 46, 46, 46, 46, 46, 9,
+    46, 51, 51, 51, 51, 58, 46, 58
+};
+
+/*Map glyph_ids to kern right classes*/
+static const uint8_t kern_right_class_mapping[] =
+{
+    0, 0, 1, 2, 0, 3, 4, 5,
+    2, 6, 7, 8, 9, 10, 9, 10,
+    11, 12, 13, 14, 15, 16, 17, 12,
+    18, 19, 20, 21, 21, 0, 0, 0,
+    22, 23, 24, 25, 23, 25, 25, 25,
+    23, 25, 25, 26, 25, 25, 25, 25,
+    23, 25, 23, 25, 3, 27, 28, 29,
+    29, 30, 31, 32, 33, 34, 35, 0,
+    36, 0, 37, 38, 39, 39, 39, 0,
+    39, 38, 40, 41, 38, 38, 42, 42,
+    39, 42, 39, 42, 43, 44, 45, 46,
+    46, 47, 46, 48, 0, 0, 35, 9,
+    0, 49, 39, 50, 51, 52, 0, 53,
+    0, 23, 8, 9, 9, 9, 23, 0,
+    54, 0, 0, 0, 0, 42, 55, 9,
+    0, 0, 8, 56, 0, 0, 0, 57,
+    24, 24, 24, 24, 24, 24, 24, 23,
+    25, 25, 25, 25, 25, 25, 25, 25,
+    25, 25, 23, 23, 23, 23, 23, 0,
+    23, 28, 28, 28, 28, 31, 25, 38,
+    37, 37, 37, 37, 37, 37, 37, 39,
+    39, 39, 39, 39, 58, 42, 59, 60,
+    39, 42, 39, 39, 39, 39, 39, 9,
+    39, 45, 45, 45, 45, 46, 38, 46
+};
+
+/*Kern values between classes*/
+static const int8_t kern_class_values[] =
+{
+    0, 3, 0, 0, 0, 0, 0, 0,
+    0, 3, 0, 0, 9, 0, 0, 0,
+    0, 6, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 3, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 9, 0, 0, 0, 0,
+    0, 0, 0, 0, 3, 38, 0, 23,
+    -19, 0, 0, 0, 0, -47, -51, 6,
+    40, 19, 15, -34, 6, 42, 3, 36,
+    9, 27, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 51, 7, -6,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -17, 17,
+    0, 17, 39, 0, -37, 0, 0, 0,
+    0, -26, 0, 0, 0, 0, 0, -17,
+    15, 17, 0, 0, -9, 0, -6, 9,
+    0, -9, 0, -9, -4, -17, 0, 0,
+    0, 0, -9, 0, 0, -11, -13, 0,
+    0, -9, 0, -17, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -9, -9, 0,
+    -2, 0, 0, 0, 0, -13, 0, 0,
+    -9, 0, 0, 0, 0, -23, 0, -103,
+    0, 0, -17, 0, 17, 26, 1, 0,
+    -17, 9, 9, 28, 17, -15, 17, 0,
+    0, -49, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -32, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, -23, 0, 0, 0, 0, 0, 0,
+    -10, -42, 0, -34, -6, 0, 0, 0,
+    0, 2, 33, 0, -26, -7, -3, 3,
+    0, -15, 0, 0, -6, -63, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, -68, -7, 32, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    -9, 0, 0, 0, 0, -35, -38, 0,
+    -3, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 28, 0,
+    9, 0, 0, -17, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 32, 7, 3,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 12,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -32, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 6, 17, 9, 26,
+    -9, 0, 0, 17, -9, -28, -117, 6,
+    23, 17, 2, -11, 0, 31, 0, 27,
+    0, 27, 0, -79, 0, -10, 26, 0,
+    28, -9, 17, 9, 0, 0, 3, -9,
+    0, 0, -15, 68, 0, 68, 0, 26,
+    0, 36, 11, 15, 0, 0, 6, 0,
+    0, 26, 32, 11, -70, 68, 68, 68,
+    0, 0, 0, -32, 0, 0, 0, 0,
+    3, -6, 0, 6, -15, -11, -17, 6,
+    0, -9, 0, 0, 0, -34, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, -55, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 6, -20, 9, 0, -74, -9,
+    0, 0, 0, 0, 3, -47, 0, -54,
+    0, 0, 0, 0, -6, 0, 84, -10,
+    -11, 9, 9, -8, 0, -11, 9, 0,
+    0, -45, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -83, 0, 9,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 3, 0, -9, -26,
+    0, -54, -110, 3, 9, 0, 0, 0,
+    0, 51, 0, 0, -32, 0, 28, 0,
+    -58, -83, -58, -17, 26, 0, 0, -57,
+    0, 10, -20, 0, -13, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 22, 26, -104, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    -55, -9, 0, 34, -17, 40, 0, -42,
+    -64, 0, 0, 0, 0, 6, 0, 0,
+    0, 0, 0, 6, 6, -10, -17, 0,
+    -3, -3, -9, 0, 0, -6, 0, 0,
+    0, -17, 0, -7, 0, -20, -17, 0,
+    -21, -28, -28, -16, 0, -17, 0, -17,
+    0, 0, 0, 0, -7, 0, 0, 9,
+    0, 6, -9, 0, 0, 0, 0, -10,
+    0, 3, 0, 0, -26, 0, 0, 0,
+    0, 0, 0, 9, -6, 0, 0, 0,
+    -6, 9, 9, -3, 0, 0, 0, -16,
+    0, -3, 0, 0, 0, 0, 0, 3,
+    0, 11, -6, 0, -10, 0, -15, 0,
+    0, -6, 0, 26, 0, 0, -9, 0,
+    0, 0, 0, 0, -3, 3, -6, -6,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -9, 0, -9,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, -4, -4, 0, -9, -10, 0, 0,
+    0, 0, 0, 3, 0, 0, -6, 0,
+    -9, -9, -9, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -5, 0, 0, 0,
+    0, -6, -11, 0, 0, 0, 0, 0,
+    0, -13, 0, 0, 0, 0, 0, 0,
+    0, -26, -6, -26, 17, 0, 0, -17,
+    9, 17, 23, 0, -21, -3, -10, 0,
+    -3, -40, 9, -6, 6, -45, 9, 0,
+    0, 3, -44, 0, -45, -7, -74, -6,
+    0, -43, 0, 17, 24, 0, 11, 0,
+    0, 0, 0, 2, 0, -15, -11, 0,
+    0, 9, 9, -9, 18, -26, -15, 0,
+    9, 0, 0, 0, 0, 0, 0, -9,
+    0, 0, 0, -9, 0, 0, 0, 0,
+    0, -4, -4, 0, -4, -11, 0, 0,
+    0, 0, 0, 0, 0, -9, -9, 0,
+    -6, -10, -7, 0, 0, -9, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, -7, -7, 0, 0, 0, 0, 0,
+    0, -10, 0, 0, 0, 0, 0, 0,
+    0, -6, 0, -17, 9, 0, 0, -10,
+    4, 9, 9, 0, 0, 0, 0, 0,
+    0, -6, 0, 0, 0, 0, 0, 6,
+    0, 0, -9, 0, -9, -6, -10, 0,
+    0, 0, 0, 0, 0, 0, 7, 0,
+    -7, 0, 0, 0, 0, -9, -13, 0,
+    0, 0, 9, 0, 17, -16, 0, 0,
+    0, 0, 0, 0, 0, 26, -6, 3,
+    -27, 0, 0, 23, -43, -44, -36, -17,
+    9, 0, -7, -55, -15, 0, -15, 0,
+    -17, 13, -15, -55, 0, -23, 0, 0,
+    4, -3, 7, -6, 0, 9, 1, -26,
+    -32, 0, -43, -20, -18, -20, -26, -10,
+    -23, -2, -16, -23, -23, -11, -17, 11,
+    -9, 5, 23, -15, -53, -20, -20, -20,
+    0, 3, 0, -9, 0, 0, 0, 6,
+    0, 9, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -9, 0, -4,
+    0, -3, -9, 0, -15, -19, -19, -3,
+    0, -26, 0, 0, 0, 0, 0, 0,
+    -7, 0, 0, 0, 0, 3, -5, 0,
+    0, 0, 0, -9, 9, 0, 0, 0,
+    -17, 0, 0, 0, 0, 9, 0, 0,
+    0, 0, 0, 0, 0, 0, 41, 0,
+    0, 0, 0, 0, 0, 6, 0, 0,
+    0, -9, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -15, 0, 9,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, -34,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    -6, 0, 0, 0, -16, 0, 0, 0,
+    0, -43, -26, 0, 0, 0, -13, -43,
+    0, 0, -9, 9, 0, -23, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    -14, 0, 0, -16, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    -6, 0, 0, -13, 0, 9, 0, 9,
+    -91, 0, 0, 0, 0, -15, 0, 0,
+    0, 0, 10, 0, 6, -17, -17, 0,
+    -9, -9, -10, 0, 0, 0, 0, 0,
+    0, -26, 0, -9, 0, -13, -9, 0,
+    -19, -21, -26, -7, 0, -17, 0, -26,
+    0, 0, 0, 0, 68, 0, 0, 4,
+    0, 0, -11, 0, 0, 0, 0, 0,
+    0, 9, 0, 0, -17, 0, 0, 0,
+    0, -37, 0, 0, 0, 0, 0, -79,
+    -15, 28, 26, -7, -36, 0, 9, -13,
+    0, -43, -4, -11, 9, -60, -9, 11,
+    0, 13, -30, -13, -32, -28, -36, 0,
+    0, -51, 0, 49, 0, 0, -4, 0,
+    0, 0, -4, -4, -9, -23, -28, -2,
+    9, 0, 0, 0, 0, -79, -68, 10,
+    17, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 3, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -9, 0,
+    -4, -9, -13, 0, 0, -17, 0, -9,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -3, 0, -17, 0, 0, 17,
+    -3, 11, 0, -19, 9, -6, -3, -22,
+    -9, 0, -11, -9, -6, 0, -13, -15,
+    0, 0, -7, -3, -6, -15, -10, 0,
+    0, -9, 0, 9, -6, 0, -19, 0,
+    0, 0, -17, 0, -15, 0, -15, -15,
+    -9, 0, 0, 0, -6, 9, 6, -3,
+    -10, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -17, 9, 0, -12,
+    0, -6, -10, -26, -6, -6, -6, -3,
+    -6, -10, -3, 0, 0, 0, 0, 0,
+    -9, -7, -7, 0, 0, 0, 0, 10,
+    -6, 0, -6, 0, 0, 0, -6, -10,
+    -6, -8, -10, -8, -6, 0, 0, 0,
+    -6, 0, 0, 0, 0, 0, 0, 0,
+    7, 34, -3, 0, -23, 0, -6, 17,
+    0, -9, -36, -11, 13, 1, 0, -40,
+    -15, 9, -15, 6, 0, -6, -7, -27,
+    0, -13, 4, 0, 0, -15, 0, 0,
+    0, 9, 9, -17, -16, 0, -15, -9,
+    -13, -9, -9, 0, -15, 4, -16, -15,
+    -9, 0, 0, 0, -6, 26, 9, -11,
+    -40, -9, 10, 3, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 9, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -15, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -6, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -7, -9, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -13, 0, 0, -11, 0,
+    0, -9, -9, 0, 0, 0, 0, -9,
+    0, 0, 0, 0, -4, 0, 0, 0,
+    0, 0, -6, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -6, 0, 0, 0,
+    0, 0, -13, 0, -17, 0, 0, 0,
+    -28, 0, 6, -19, 17, 2, -6, -40,
+    0, 0, -19, -9, 0, -34, -21, -24,
+    0, 0, -37, -9, -34, -32, -41, 0,
+    -22, 0, 7, 57, -11, 0, -20, -9,
+    -3, -9, -15, -23, -15, -32, -35, -20,
+    0, 0, 0, 0, 0, -9, -7, -3,
+    0, -9, -9, -9, 0, 0, -6, 0,
+    3, 0, 0, -60, -8, 26, 19, -19,
+    -32, 0, 3, -26, 0, -43, -6, -9,
+    17, -79, -11, 3, 0, 0, -55, -10,
+    -44, -9, -62, 0, 0, -60, 0, 50,
+    3, 0, -6, 0, 0, 0, 0, -4,
+    -6, -32, -6, 0, 0, 0, 0, 0,
+    0, -55, -67, 6, 0, 0, 0, 0,
+    0, 0, 0, 0, -27, 0, -8, 0,
+    -3, -24, -40, 0, 0, -4, -13, -26,
+    -9, 0, -6, 0, 0, 0, 0, -38,
+    -9, -28, -27, -7, -15, -21, -9, -15,
+    0, -17, -8, -28, -13, 0, -10, -16,
+    -9, -16, 0, 4, 0, -6, -28, 0,
+    0, 0, 0, 0, 0, 17, 0, 0,
+    -44, -16, -16, -16, 0, -15, 0, 0,
+    0, 0, 10, 0, 6, -17, 35, 0,
+    -9, -9, -10, 0, 0, 0, 0, 0,
+    0, -26, 0, -9, 0, -13, -9, 0,
+    -19, -21, -26, -7, 0, -17, 7, 34,
+    0, 0, 0, 0, 68, 0, 0, 4,
+    0, 0, -11, 0, 0, 0, 0, 0,
+    0, 9, 0, 0, -17, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    -2, 0, 0, 0, 0, 0, -6, -17,
+    0, 0, 0, 0, 0, -4, 0, 0,
+    0, -9, -9, 0, 0, -17, -9, 0,
+    0, -17, 0, 15, -4, 0, 0, 0,
+    0, 0, 0, 4, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 13, 0, 0,
+    -9, 0, 0, 0, 17, 7, -8, 0,
+    -27, -14, 0, 26, -28, -27, -17, -17,
+    34, 15, 9, -74, -6, 17, -9, 0,
+    -9, 9, -9, -30, 0, -9, 9, -11,
+    -7, -26, -7, 0, 0, 26, 17, 0,
+    -24, 0, -47, -11, 25, -11, -32, 3,
+    -11, -28, -28, -9, -17, 0, 0, 0,
+    0, 34, 26, -11, -49, 10, 29, 15,
+    9, 0, -13, 0, -23, 0, 7, 28,
+    -20, -32, -34, -21, 26, 0, 3, -62,
+    -7, 9, -15, -6, -20, 0, -19, -32,
+    -13, -13, -7, 0, 0, -20, -18, -9,
+    0, 26, 20, -9, -47, 0, -47, -12,
+    0, -30, -49, -3, -27, -15, -28, -24,
+    -26, 0, 0, 0, 0, 23, 19, -11,
+    -61, 15, 31, 16, 0, 0, -11, 0,
+    -17, -8, 0, -9, -15, 0, 15, -28,
+    9, 0, 0, -45, 0, -9, -19, -15,
+    -6, -26, -21, -28, -20, 0, -26, -9,
+    -20, -16, -26, -9, 0, 0, 3, 40,
+    -15, 0, -26, -9, 0, -9, -17, -20,
+    -23, -24, -32, -11, -9, 0, 0, 0,
+    0, -17, 0, -7, 3, -9, -9, -9,
+    17, 0, -13, 0, -43, -10, 5, 17,
+    -27, -32, -17, -28, 28, -9, 4, -79,
+    -15, 17, -19, -15, -32, 0, -26, -36,
+    -10, -9, -7, -9, -18, -26, -3, 0,
+    0, 26, 24, -6, -55, 0, -51, -20,
+    20, -32, -58, -17, -30, -36, -43, -28,
+    -34, 0, 0, 0, -17, 17, 19, -15,
+    -70, 28, 25, 20, 0, 0, 0, 0,
+    -10, 0, 0, 9, -10, 17, 6, -16,
+    17, 0, 0, -26, -3, 0, -3, 0,
+    3, 3, -7, 0, 0, 0, 0, 0,
+    0, -9, 0, 0, 0, 0, 7, 26,
+    2, 0, -10, 0, 0, 0, 0, -6,
+    -6, -10, 0, 0, 3, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    3, 7, 0, 0, 0, 0, 7, 0,
+    -7, 0, 32, 0, 15, 3, 3, -11,
+    0, 17, 0, 0, 0, 7, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 26, 0, 24, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    3, 0, 0, 12, 0, 0, 3, 0,
+    0, 0, 0, 0, 0, -51, 0, -9,
+    15, 0, 26, 0, 0, 84, 10, -17,
+    -17, 9, 9, -6, 3, -43, 0, 0,
+    41, -51, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -58, 32, 119,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 34, 0, 0, 0,
+    26, -51, -26, 8, 26, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -14, 0, 0, -16, -8, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -6, 0, -23,
+    0, 0, 3, 0, 0, 9, 110, -17,
+    -7, 27, 23, -23, 9, 0, 0, 9,
+    9, -11, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -111, 24, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 9, 15, -6, -9,
+    23, 0, -61, 9, 0, 0, 0, 0,
+    0, 0, 0, -24, 0, 0, 0, -23,
+    0, 0, 0, 0, -19, -4, 0, 0,
+    0, -19, 0, -10, 0, -40, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, -57, 0, 0, 0, 0, 3, 0,
+    0, 0, 0, 0, 0, -9, 0, 0,
+    0, 0, 0, 0, 0, -16, -19, 0,
+    0, 0, 0, 0, 0, -13, 0, -23,
+    0, 0, 0, -15, 9, -10, 0, 0,
+    -23, -9, -20, 0, 0, -23, 0, -9,
+    0, -40, 0, -9, 0, 0, -69, -16,
+    -34, -9, -31, 0, 0, -57, 0, -23,
+    -4, 0, 0, 0, 0, 0, 0, 0,
+    0, -13, -15, -7, 0, 0, 0, 0,
+    0, -15, -20, 0, -9, 0, 0, 0,
+    0, 0, 0, 0, -19, 0, -19, 11,
+    -9, 17, 0, -6, -20, -6, -15, -16,
+    0, -10, -4, -6, 6, -23, -3, 0,
+    0, 0, -75, -7, -12, 0, -19, 0,
+    -6, -40, -8, 0, 0, -6, -7, 0,
+    0, 0, 0, 6, 0, -6, -15, -6,
+    0, 0, 0, 0, -8, 15, 0, 0,
+    -6, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 11,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, -19, 0, -6, 0, 0, 0, -17,
+    9, 0, 0, 0, -23, -9, -17, 0,
+    0, -24, 0, -9, 0, -40, 0, 0,
+    0, 0, -83, 0, -17, -32, -43, 0,
+    0, -57, 0, -6, -13, 0, 0, 0,
+    0, 0, 0, 0, 0, -9, -13, -4,
+    0, 0, 0, 0, 0, -13, -17, 0,
+    -9, 0, 0, 0, 3, 0, 0, 15,
+    -11, 0, 26, 42, -9, -9, -26, 10,
+    42, 15, 19, -23, 10, 36, 10, 25,
+    19, 23, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 54, 40, -15,
+    -9, 0, -7, 68, 37, 68, 0, 0,
+    0, 9, 0, 0, 0, 0, 0, 0,
+    0, 32, 36, -3, -11, 57, 41, 51,
+    0, 0, -14, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -6, 0, 0, 0,
+    0, 0, 0, 0, 0, 12, 0, 0,
+    0, 0, -72, -10, -7, -35, -42, 0,
+    0, -57, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -14, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    -6, 0, 0, 0, 0, 0, 0, 0,
+    0, 12, 0, 0, 0, 0, -72, -10,
+    -7, -35, -42, 0, 0, -34, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -7, 0, 0, 0,
+    -20, 9, 0, -9, 7, 15, 9, -26,
+    0, -2, -7, 9, 0, 7, 0, 0,
+    0, 0, -21, 0, -8, -6, -17, 0,
+    -8, -34, 0, 53, -9, 0, -19, -6,
+    0, -6, -15, 0, -9, -24, -17, -10,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, -6, -6, -6, 0, 0, -14, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    -6, 0, 0, 0, 0, 0, 0, 0,
+    0, 12, 0, 0, 0, 0, -72, -10,
+    -7, -35, -42, 0, 0, -57, 0, 0,
+    0, 0, 0, 0, 43, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -14, 0, -27, -10, -8, 26,
+    -8, -9, -34, 3, -5, 3, -6, -23,
+    2, 19, 2, 7, 3, 7, -20, -34,
+    -10, 0, -32, -16, -23, -36, -33, 0,
+    -14, -17, -10, -11, -7, -6, -10, -6,
+    0, -6, -3, 13, 0, 13, -6, 0,
+    0, 0, 0, 0, 9, 26, 26, 3,
+    -32, -6, -6, -6, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    -6, -9, -9, 0, 0, -23, 0, -4,
+    0, -15, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -51, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, -9, -9, 0, 0, 0, 0, 0,
+    0, -11, -20, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -7, 0, 0, -15,
+    -9, 9, 0, -15, -16, -6, 0, -25,
+    -6, -19, -6, -10, 0, -15, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, -57, 0, 27, 0, 0, -15, 0,
+    0, 0, 0, -11, 0, -9, 0, 0,
+    0, 0, 0, 0, -8, -4, -17, 0,
+    0, 0, 0, 0, 0, 0, -6, 0,
+    -20, 0, 0, 36, -11, -28, -26, 6,
+    9, 9, -2, -24, 6, 13, 6, 26,
+    6, 28, -6, -23, 0, 0, -34, 0,
+    0, -26, -23, 0, 0, -17, 0, -11,
+    -15, 0, -13, 0, -13, 0, -6, 13,
+    0, -7, -26, -9, 0, 0, 0, 0,
+    0, 32, 26, 0, -28, 0, 0, 0,
+    0, 0, -8, 0, -17, 0, 0, 11,
+    -20, 0, 9, -9, 7, 1, 0, -28,
+    0, -6, -3, 0, -9, 9, -7, 0,
+    0, 0, -35, -10, -19, 0, -26, 0,
+    0, -40, 0, 32, -9, 0, -15, 0,
+    5, 0, -9, 0, -9, -26, 0, -9,
+    0, 0, 0, 0, 0, 9, 3, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    -6, 0, 0, 9, -11, 3, 0, 0,
+    -10, -6, 0, -10, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -53, 0, 19,
+    0, 0, -7, 0, 0, 0, 0, 2,
+    0, -9, -9, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 3, 34, 0, -17, 0, 0, 0,
+    0, 0, 0, 0, 0, -3, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, -47, 3, 9, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -17, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -9, 0,
+    -32, 0, 0, 22, -26, -3, 10, -32,
+    15, -9, -9, -29, -11, 6, -28, -17,
+    -26, 0, -11, -38, 0, -17, 0, 0,
+    0, -9, 9, 0, 0, 15, 3, 15,
+    -34, 0, -26, -17, -21, -17, -34, -17,
+    -23, -17, -21, -34, -21, 0, 0, 0,
+    -9, 0, 10, -11, -19, -17, 24, 7,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    6, -9, 0, 0, 0, -7, 0, 0,
+    0, -10, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -6, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    -6, 0, 0, 0, 9, 17, 0, 0,
+    0, 0, 12, 0, -20, -26, -26, -10,
+    26, 0, 9, -9, 0, 23, -9, 0,
+    -34, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 43, 12, -9,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -17, 0, 0, 0,
+    0, 0, 0, 0, -34, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    17, 0, 19, 0, 0, 0, 0, 15,
+    0, 6, 9, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 6, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -9, 3, 8, 0,
+    -3, 0, 0, 6, 6, 0, 0, 0,
+    0, -9, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -49, 0, 9,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 6, 0, 0, 0,
+    0, 17, 0, 20, 0, 0, 0, 0,
+    0, -54, -49, 3, 37, 26, 15, -34,
+    6, 36, 0, 32, 0, 17, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 45, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    -53, 0, 0, 0, -3, -29, 0, -51,
+    -15, 0, 0, 0, -34, 3, 34, -41,
+    -37, 0, 0, -37, 0, -37, -37, 0,
+    -3, -113, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -80, 7, 43,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 7, -16, -43,
+    3, -49, -75, -9, -22, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, -20, -26, 0, -17, -21, -17, 0,
+    -9, 0, 0, 0, 0, -26, 0, -26,
+    0, -34, -21, 0, -9, -26, -26, -15,
+    0, -34, 0, -26, -9, 0, 0, 0,
+    -9, 0, 0, 4, 0, 0, -9, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    -21, 0, 0, 0, 0, 0, -14, 0,
+    0, 0, 0, 68, 0, 0, 0, 0,
+    -6, 0, 0, 0, 0, 0, 0, 0,
+    0, 34, 0, 0, 0, 0, -72, -10,
+    -7, -35, -42, 0, 0, -57, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 9,
+    0, -15, 0, 6, 0, 0, -6, 0,
+    0, 0, 0, 0, 0, -6, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, -9, 0, -17, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 17, 0, 0,
+    -6, 0, 0, 0
+};
+
+
+/*Collect the kern class' data in one place*/
+static const lv_font_fmt_txt_kern_classes_t kern_classes =
+{
+    .class_pair_values   = kern_class_values,
+    .left_class_mapping  = kern_left_class_mapping,
+    .right_class_mapping = kern_right_class_mapping,
+    .left_class_cnt      = 71,
+    .right_class_cnt     = 60,
+};
+
+/*--------------------
+ *  ALL CUSTOM DATA
+ *--------------------*/
+
+#if LVGL_VERSION_MAJOR == 8
+/*Store all the custom data of the font*/
+static  lv_font_fmt_txt_glyph_cache_t cache;
+#endif
+
+lv_font_fmt_txt_dsc_t ui_font_monserrat_normal_60_dsc = {
+    .glyph_bitmap = NULL,        /*Bound by AssetPack::begin()*/
+    .glyph_dsc = glyph_dsc,
+    .cmaps = cmaps,
+    .kern_dsc = &kern_classes,
+    .kern_scale = 18,
+    .cmap_num = 2,
+    .bpp = 8,
+    .kern_classes = 1,
+    .bitmap_format = 0,
+#if LVGL_VERSION_MAJOR == 8
+    .cache = &cache
+#endif
+};
+
+
+
+/*-----------------
+ *  PUBLIC FONT
+ *----------------*/
+
+/*Initialize a public general font descriptor*/
+#if LVGL_VERSION_MAJOR >= 8
+const lv_font_t ui_font_monserrat_normal_60 = {
+#else
+lv_font_t ui_font_monserrat_normal_60 = {
+#endif
+    .get_glyph_dsc = AssetPack_FontGetGlyphDsc,    /*Function pointer to get glyph's data*/
+    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,    /*Function pointer to get glyph's bitmap*/
+    .line_height = 72,          /*The maximum line height required by the font*/
+    .base_line = 13,             /*Baseline measured from the bottom of the line*/
+#if !(LVGL_VERSION_MAJOR == 6 && LVGL_VERSION_MINOR == 0)
+    .subpx = LV_FONT_SUBPX_NONE,
+#endif
+#if LV_VERSION_CHECK(7, 4, 0) || LVGL_VERSION_MAJOR >= 8
+    .underline_position = -4,
+    .underline_thickness = 3,
+#endif
+    .dsc = &ui_font_monserrat_normal_60_dsc,          /*The custom font data. Will be accessed by `get_glyph_bitmap/dsc` */
+#if LV_VERSION_CHECK(8, 2, 0) || LVGL_VERSION_MAJOR >= 9
+    .fallback = &lv_font_montserrat_48,
+#endif
+    .user_data = NULL,
+};
+
+
+
+#endif /*#if UI_FONT_MONSERRAT_NORMAL_60*/
+
+
+#endif /*USE_ASSET_PACK*/
@@ -0,0 +1,630 @@
+/* Generated by pack_assets.py — do not edit. */
+#ifdef USE_ASSET_PACK
+
+/*******************************************************************************
+ * Size: 80 px
+ * Bpp: 8
+ * Opts: --bpp 8 --size 80 --no-compress --font fonts/Montserrat-Light.ttf --range 32-127 --format lvgl
+ ******************************************************************************/
+
+#ifdef __has_include
+    #if __has_include("lvgl.h")
+        #ifndef LV_LVGL_H_INCLUDE_SIMPLE
+            #define LV_LVGL_H_INCLUDE_SIMPLE
+        #endif
+    #endif
+#endif
+
+#ifdef LV_LVGL_H_INCLUDE_SIMPLE
+    #include "lvgl.h"
+#else
+    #include "lvgl.h"
+#endif
+#include "../asset_pack_format.h"
+
+#ifndef UI_FONT_MONTSERRAT_LIGHT_80
+#define UI_FONT_MONTSERRAT_LIGHT_80 1
+#endif
+
+#if UI_FONT_MONTSERRAT_LIGHT_80
+
+/*-----------------
+ *    BITMAPS
+ *----------------*/
+
+
+
+
+/*---------------------
+ *  GLYPH DESCRIPTION
+ *--------------------*/
+
+static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
+    {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
+    {.bitmap_index = 0, .adv_w = 329, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 0, .adv_w = 323, .box_w = 8, .box_h = 56, .ofs_x = 6, .ofs_y = 0},
+    {.bitmap_index = 448, .adv_w = 457, .box_w = 18, .box_h = 21, .ofs_x = 5, .ofs_y = 35},
+    {.bitmap_index = 826, .adv_w = 883, .box_w = 51, .box_h = 56, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 3682, .adv_w = 780, .box_w = 41, .box_h = 76, .ofs_x = 4, .ofs_y = -10},
+    {.bitmap_index = 6798, .adv_w = 1046, .box_w = 59, .box_h = 56, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 10102, .adv_w = 838, .box_w = 48, .box_h = 57, .ofs_x = 4, .ofs_y = -1},
+    {.bitmap_index = 12838, .adv_w = 248, .box_w = 5, .box_h = 21, .ofs_x = 5, .ofs_y = 35},
+    {.bitmap_index = 12943, .adv_w = 411, .box_w = 14, .box_h = 74, .ofs_x = 8, .ofs_y = -15},
+    {.bitmap_index = 13979, .adv_w = 412, .box_w = 14, .box_h = 74, .ofs_x = 3, .ofs_y = -15},
+    {.bitmap_index = 15015, .adv_w = 480, .box_w = 28, .box_h = 29, .ofs_x = 1, .ofs_y = 30},
+    {.bitmap_index = 15827, .adv_w = 728, .box_w = 35, .box_h = 34, .ofs_x = 5, .ofs_y = 11},
+    {.bitmap_index = 17017, .adv_w = 256, .box_w = 8, .box_h = 18, .ofs_x = 4, .ofs_y = -11},
+    {.bitmap_index = 17161, .adv_w = 488, .box_w = 22, .box_h = 4, .ofs_x = 4, .ofs_y = 20},
+    {.bitmap_index = 17249, .adv_w = 256, .box_w = 8, .box_h = 7, .ofs_x = 4, .ofs_y = 0},
+    {.bitmap_index = 17305, .adv_w = 410, .box_w = 31, .box_h = 75, .ofs_x = -2, .ofs_y = -8},
+    {.bitmap_index = 19630, .adv_w = 842, .box_w = 45, .box_h = 56, .ofs_x = 4, .ofs_y = 0},
+    {.bitmap_index = 22150, .adv_w = 452, .box_w = 19, .box_h = 56, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 23214, .adv_w = 721, .box_w = 41, .box_h = 56, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 25510, .adv_w = 714, .box_w = 40, .box_h = 56, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 27750, .adv_w = 837, .box_w = 49, .box_h = 56, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 30494, .adv_w = 714, .box_w = 40, .box_h = 56, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 32734, .adv_w = 771, .box_w = 42, .box_h = 56, .ofs_x = 4, .ofs_y = 0},
+    {.bitmap_index = 35086, .adv_w = 744, .box_w = 41, .box_h = 56, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 37382, .adv_w = 809, .box_w = 43, .box_h = 56, .ofs_x = 4, .ofs_y = 0},
+    {.bitmap_index = 39790, .adv_w = 771, .box_w = 42, .box_h = 56, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 42142, .adv_w = 256, .box_w = 8, .box_h = 42, .ofs_x = 4, .ofs_y = 0},
+    {.bitmap_index = 42478, .adv_w = 256, .box_w = 8, .box_h = 53, .ofs_x = 4, .ofs_y = -11},
+    {.bitmap_index = 42902, .adv_w = 728, .box_w = 35, .box_h = 32, .ofs_x = 5, .ofs_y = 12},
+    {.bitmap_index = 44022, .adv_w = 728, .box_w = 35, .box_h = 22, .ofs_x = 5, .ofs_y = 17},
+    {.bitmap_index = 44792, .adv_w = 728, .box_w = 35, .box_h = 32, .ofs_x = 5, .ofs_y = 12},
+    {.bitmap_index = 45912, .adv_w = 719, .box_w = 38, .box_h = 56, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 48040, .adv_w = 1322, .box_w = 75, .box_h = 71, .ofs_x = 4, .ofs_y = -15},
+    {.bitmap_index = 53365, .adv_w = 902, .box_w = 56, .box_h = 56, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 56501, .adv_w = 963, .box_w = 47, .box_h = 56, .ofs_x = 9, .ofs_y = 0},
+    {.bitmap_index = 59133, .adv_w = 916, .box_w = 50, .box_h = 56, .ofs_x = 4, .ofs_y = 0},
+    {.bitmap_index = 61933, .adv_w = 1057, .box_w = 53, .box_h = 56, .ofs_x = 9, .ofs_y = 0},
+    {.bitmap_index = 64901, .adv_w = 856, .box_w = 40, .box_h = 56, .ofs_x = 9, .ofs_y = 0},
+    {.bitmap_index = 67141, .adv_w = 808, .box_w = 39, .box_h = 56, .ofs_x = 9, .ofs_y = 0},
+    {.bitmap_index = 69325, .adv_w = 989, .box_w = 50, .box_h = 56, .ofs_x = 4, .ofs_y = 0},
+    {.bitmap_index = 72125, .adv_w = 1042, .box_w = 47, .box_h = 56, .ofs_x = 9, .ofs_y = 0},
+    {.bitmap_index = 74757, .adv_w = 378, .box_w = 5, .box_h = 56, .ofs_x = 9, .ofs_y = 0},
+    {.bitmap_index = 75037, .adv_w = 628, .box_w = 31, .box_h = 56, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 76773, .adv_w = 900, .box_w = 47, .box_h = 56, .ofs_x = 9, .ofs_y = 0},
+    {.bitmap_index = 79405, .adv_w = 749, .box_w = 38, .box_h = 56, .ofs_x = 9, .ofs_y = 0},
+    {.bitmap_index = 81533, .adv_w = 1224, .box_w = 58, .box_h = 56, .ofs_x = 9, .ofs_y = 0},
+    {.bitmap_index = 84781, .adv_w = 1042, .box_w = 47, .box_h = 56, .ofs_x = 9, .ofs_y = 0},
+    {.bitmap_index = 87413, .adv_w = 1073, .box_w = 59, .box_h = 56, .ofs_x = 4, .ofs_y = 0},
+    {.bitmap_index = 90717, .adv_w = 915, .box_w = 44, .box_h = 56, .ofs_x = 9, .ofs_y = 0},
+    {.bitmap_index = 93181, .adv_w = 1073, .box_w = 62, .box_h = 67, .ofs_x = 4, .ofs_y = -11},
+    {.bitmap_index = 97335, .adv_w = 922, .box_w = 45, .box_h = 56, .ofs_x = 9, .ofs_y = 0},
+    {.bitmap_index = 99855, .adv_w = 780, .box_w = 41, .box_h = 56, .ofs_x = 4, .ofs_y = 0},
+    {.bitmap_index = 102151, .adv_w = 721, .box_w = 45, .box_h = 56, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 104671, .adv_w = 1015, .box_w = 46, .box_h = 56, .ofs_x = 9, .ofs_y = 0},
+    {.bitmap_index = 107247, .adv_w = 879, .box_w = 55, .box_h = 56, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 110327, .adv_w = 1405, .box_w = 82, .box_h = 56, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 114919, .adv_w = 822, .box_w = 49, .box_h = 56, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 117663, .adv_w = 800, .box_w = 50, .box_h = 56, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 120463, .adv_w = 827, .box_w = 46, .box_h = 56, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 123039, .adv_w = 392, .box_w = 14, .box_h = 74, .ofs_x = 9, .ofs_y = -15},
+    {.bitmap_index = 124075, .adv_w = 410, .box_w = 31, .box_h = 75, .ofs_x = -3, .ofs_y = -8},
+    {.bitmap_index = 126400, .adv_w = 392, .box_w = 14, .box_h = 74, .ofs_x = 1, .ofs_y = -15},
+    {.bitmap_index = 127436, .adv_w = 730, .box_w = 32, .box_h = 33, .ofs_x = 7, .ofs_y = 12},
+    {.bitmap_index = 128492, .adv_w = 640, .box_w = 40, .box_h = 3, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 128612, .adv_w = 768, .box_w = 18, .box_h = 10, .ofs_x = 11, .ofs_y = 48},
+    {.bitmap_index = 128792, .adv_w = 746, .box_w = 35, .box_h = 42, .ofs_x = 4, .ofs_y = 0},
+    {.bitmap_index = 130262, .adv_w = 864, .box_w = 43, .box_h = 59, .ofs_x = 8, .ofs_y = 0},
+    {.bitmap_index = 132799, .adv_w = 710, .box_w = 38, .box_h = 42, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 134395, .adv_w = 864, .box_w = 43, .box_h = 59, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 136932, .adv_w = 764, .box_w = 41, .box_h = 42, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 138654, .adv_w = 420, .box_w = 29, .box_h = 60, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 140394, .adv_w = 873, .box_w = 44, .box_h = 57, .ofs_x = 3, .ofs_y = -15},
+    {.bitmap_index = 142902, .adv_w = 861, .box_w = 38, .box_h = 59, .ofs_x = 8, .ofs_y = 0},
+    {.bitmap_index = 145144, .adv_w = 334, .box_w = 7, .box_h = 59, .ofs_x = 7, .ofs_y = 0},
+    {.bitmap_index = 145557, .adv_w = 340, .box_w = 23, .box_h = 74, .ofs_x = -8, .ofs_y = -15},
+    {.bitmap_index = 147259, .adv_w = 753, .box_w = 39, .box_h = 59, .ofs_x = 8, .ofs_y = 0},
+    {.bitmap_index = 149560, .adv_w = 334, .box_w = 5, .box_h = 59, .ofs_x = 8, .ofs_y = 0},
+    {.bitmap_index = 149855, .adv_w = 1362, .box_w = 70, .box_h = 42, .ofs_x = 8, .ofs_y = 0},
+    {.bitmap_index = 152795, .adv_w = 861, .box_w = 38, .box_h = 42, .ofs_x = 8, .ofs_y = 0},
+    {.bitmap_index = 154391, .adv_w = 794, .box_w = 43, .box_h = 42, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 156197, .adv_w = 864, .box_w = 43, .box_h = 57, .ofs_x = 8, .ofs_y = -15},
+    {.bitmap_index = 158648, .adv_w = 864, .box_w = 43, .box_h = 57, .ofs_x = 3, .ofs_y = -15},
+    {.bitmap_index = 161099, .adv_w = 504, .box_w = 21, .box_h = 42, .ofs_x = 8, .ofs_y = 0},
+    {.bitmap_index = 161981, .adv_w = 612, .box_w = 34, .box_h = 42, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 163409, .adv_w = 509, .box_w = 29, .box_h = 51, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 164888, .adv_w = 856, .box_w = 38, .box_h = 42, .ofs_x = 8, .ofs_y = 0},
+    {.bitmap_index = 166484, .adv_w = 676, .box_w = 42, .box_h = 42, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 168248, .adv_w = 1103, .box_w = 69, .box_h = 42, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 171146, .adv_w = 664, .box_w = 39, .box_h = 42, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 172784, .adv_w = 676, .box_w = 45, .box_h = 57, .ofs_x = -3, .ofs_y = -15},
+    {.bitmap_index = 175349, .adv_w = 644, .box_w = 34, .box_h = 42, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 176777, .adv_w = 410, .box_w = 20, .box_h = 74, .ofs_x = 4, .ofs_y = -15},
+    {.bitmap_index = 178257, .adv_w = 372, .box_w = 5, .box_h = 74, .ofs_x = 9, .ofs_y = -15},
+    {.bitmap_index = 178627, .adv_w = 410, .box_w = 20, .box_h = 74, .ofs_x = 1, .ofs_y = -15},
+    {.bitmap_index = 180107, .adv_w = 728, .box_w = 36, .box_h = 12, .ofs_x = 5, .ofs_y = 22}
+};
+
+/*---------------------
+ *  CHARACTER MAPPING
+ *--------------------*/
+
+
+
+/*Collect the unicode lists and glyph_id offsets*/
+static const lv_font_fmt_txt_cmap_t cmaps[] =
+{
+    {
+        .range_start = 32, .range_length = 95, .glyph_id_start = 1,
+        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
+    }
+};
+
+/*-----------------
+ *    KERNING
+ *----------------*/
+
+
+/*Map glyph_ids to kern left classes*/
+static const uint8_t kern_left_class_mapping[] =
+{
+    0, 0, 1, 2, 0, 3, 4, 5,
+    2, 6, 7, 8, 9, 10, 9, 10,
+    11, 12, 0, 13, 14, 15, 16, 17,
+    18, 19, 12, 20, 20, 0, 0, 0,
+    21, 22, 23, 24, 25, 22, 26, 27,
+    28, 29, 29, 30, 31, 32, 29, 29,
+    22, 33, 34, 35, 3, 36, 30, 37,
+    37, 38, 39, 40, 41, 42, 43, 0,
+    44, 0, 45, 46, 47, 48, 49, 50,
+    51, 45, 52, 52, 53, 48, 45, 45,
+    46, 46, 54, 55, 56, 57, 51, 58,
+    58, 59, 58, 60, 41, 0, 0, 9
+};
+
+/*Map glyph_ids to kern right classes*/
+static const uint8_t kern_right_class_mapping[] =
+{
+    0, 0, 1, 2, 0, 3, 4, 5,
+    2, 6, 7, 8, 9, 10, 9, 10,
+    11, 12, 13, 14, 15, 16, 17, 12,
+    18, 19, 20, 21, 21, 0, 0, 0,
+    22, 23, 24, 25, 23, 25, 25, 25,
+    23, 25, 25, 26, 25, 25, 25, 25,
+    23, 25, 23, 25, 3, 27, 28, 29,
+    29, 30, 31, 32, 33, 34, 35, 0,
+    36, 0, 37, 38, 39, 39, 39, 0,
+    39, 38, 40, 41, 38, 38, 42, 42,
+    39, 42, 39, 42, 43, 44, 45, 46,
+    46, 47, 46, 48, 0, 0, 35, 9
+};
+
+/*Kern values between classes*/
+static const int8_t kern_class_values[] =
+{
+    0, 1, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 8, 0, 0, 0,
+    0, 7, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1, 37, 0, 24, -22, 0, 0, 0,
+    0, -45, -49, 7, 40, 22, 16, -33,
+    7, 46, 3, 39, 8, 30, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 49, 2, -7, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, -25, 0, 0, 0, 0, 0, -16,
+    16, 16, 0, 0, -8, 0, -7, 8,
+    0, -8, 0, -8, -4, -16, 0, 0,
+    0, 0, -8, 0, 0, -11, -12, 0,
+    0, -8, 0, -16, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -8, -8, 0,
+    0, -24, 0, -96, 0, 0, -16, 0,
+    16, 25, 1, 0, -16, 8, 8, 28,
+    16, -16, 16, 0, 0, -48, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, -32, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    -9, -46, 0, -33, -7, 0, 0, 0,
+    0, 6, 38, 0, -25, -2, -1, 1,
+    0, -16, 0, 0, -5, -66, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, -66, -2, 42, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 25, 0, 8, 0, 0, -16,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 27, 2, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -32, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    5, 16, 8, 25, -8, 0, 0, 16,
+    -8, -25, -116, 7, 24, 16, 3, -11,
+    0, 36, 0, 30, 0, 30, 0, -75,
+    0, -9, 25, 0, 28, -8, 16, 8,
+    0, 0, 1, -8, 0, 0, -16, 66,
+    0, 66, 0, 25, 0, 39, 9, 16,
+    0, 0, 0, -32, 0, 0, 0, 0,
+    1, -5, 0, 7, -13, -9, -16, 7,
+    0, -8, 0, 0, 0, -33, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, -53, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1, -45, 0, -50, 0, 0, 0, 0,
+    -5, 0, 87, -9, -9, 8, 8, -13,
+    0, -9, 8, 0, 0, -42, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, -81, 0, 8, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 49, 0, 0, -32, 0, 25, 0,
+    -54, -81, -52, -16, 25, 0, 0, -57,
+    0, 14, -17, 0, -12, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 28, 25, -104, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 7, 0, 0, 0, 0, 0, 7,
+    7, -9, -16, 0, -1, -1, -8, 0,
+    0, -7, 0, 0, 0, -16, 0, -5,
+    0, -17, -16, 0, -20, -25, -25, -19,
+    0, -16, 0, -16, 0, 0, 0, 0,
+    -7, 0, 0, 8, 0, 7, -8, 0,
+    0, 0, 0, 8, -7, 0, 0, 0,
+    -7, 8, 8, -3, 0, 0, 0, -21,
+    0, -3, 0, 0, 0, 0, 0, 1,
+    0, 9, -7, 0, -9, 0, -13, 0,
+    0, -7, 0, 25, 0, 0, -8, 0,
+    0, 0, 0, 0, -3, 3, -7, -7,
+    0, -8, 0, -8, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -4, -4, 0,
+    -8, -11, 0, 0, 0, 0, 0, 3,
+    0, 0, -5, 0, -8, -8, -8, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    -4, 0, 0, 0, 0, -5, -9, 0,
+    0, -25, -7, -25, 16, 0, 0, -16,
+    8, 16, 24, 0, -20, -3, -14, 0,
+    -3, -43, 8, -7, 5, -42, 8, 0,
+    0, 1, -42, 0, -42, -5, -70, -7,
+    0, -41, 0, 16, 24, 0, 9, 0,
+    0, 0, 0, 1, 0, -11, -9, 0,
+    0, 0, 0, -8, 0, 0, 0, -8,
+    0, 0, 0, 0, 0, -4, -4, 0,
+    -4, -11, 0, 0, 0, 0, 0, 0,
+    0, -8, -8, 0, -5, -9, -7, 0,
+    0, -8, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -5, -5, 0,
+    0, -7, 0, -16, 8, 0, 0, -14,
+    4, 8, 8, 0, 0, 0, 0, 0,
+    0, -7, 0, 0, 0, 0, 0, 7,
+    0, 0, -8, 0, -8, -7, -14, 0,
+    0, 0, 0, 0, 0, 0, 7, 0,
+    -7, 0, 0, 0, 0, -6, -12, 0,
+    0, 25, -7, 1, -30, 0, 0, 24,
+    -41, -44, -36, -16, 8, 0, -7, -53,
+    -16, 0, -16, 0, -16, 12, -16, -56,
+    0, -24, 0, 0, 4, -3, 5, -7,
+    0, 8, -5, -25, -32, 0, -41, -23,
+    -16, -23, -25, -14, -24, -6, -21, -26,
+    0, 3, 0, -8, 0, 0, 0, 7,
+    0, 8, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -8, 0, -4,
+    0, -3, -8, 0, -13, -17, -17, -3,
+    0, -25, 0, 0, 0, 0, 0, 0,
+    -7, 0, 0, 0, 0, 7, -2, 0,
+    0, 8, 0, 0, 0, 0, 0, 0,
+    0, 0, 35, 0, 0, 0, 0, 0,
+    0, 7, 0, 0, 0, -8, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, -13, 0, 8, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    -7, 0, 0, 0, -21, 0, 0, 0,
+    0, -41, -25, 0, 0, 0, -12, -41,
+    0, 0, -8, 8, 0, -29, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    -17, 0, 0, -19, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, -16, 0, 0, 0, 0, 14, 0,
+    7, -16, -16, 0, -8, -8, -9, 0,
+    0, 0, 0, 0, 0, -25, 0, -8,
+    0, -12, -8, 0, -17, -20, -25, -7,
+    0, -16, 0, -25, 0, 0, 0, 0,
+    66, 0, 0, 4, 0, 0, -9, 0,
+    0, -36, 0, 0, 0, 0, 0, -75,
+    -11, 28, 25, -5, -34, 0, 8, -12,
+    0, -41, -4, -11, 8, -57, -8, 4,
+    0, 12, -29, -12, -29, -25, -34, 0,
+    0, -49, 0, 48, 0, 0, -4, 0,
+    0, 0, -4, -4, -8, -21, -25, -1,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -8, 0, -4, -8, -12, 0,
+    0, -16, 0, -8, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -3, 0, -16, 0, 0, 16,
+    -1, 11, 0, -20, 8, -7, -3, -28,
+    -8, 0, -11, -8, -4, 0, -12, -16,
+    0, 0, -7, -1, -7, -16, -14, 0,
+    0, -8, 0, 8, -7, 0, -20, 0,
+    0, 0, -16, 0, -16, 0, -16, -16,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    -16, 8, 0, -15, 0, -7, -14, -35,
+    -7, -7, -7, -3, -7, -14, -3, 0,
+    0, 0, 0, 0, -8, -7, -7, 0,
+    0, 0, 0, 14, -7, 0, -7, 0,
+    0, 0, -7, -14, -7, -11, -14, -11,
+    2, 33, -3, 0, -26, 0, -7, 16,
+    0, -8, -36, -11, 12, -2, 0, -43,
+    -16, 8, -16, 5, 0, -12, -7, -28,
+    0, -12, 4, 0, 0, -16, 0, 0,
+    0, 8, 8, -16, -19, 0, -16, -8,
+    -12, -8, -8, 0, -16, 4, -19, -16,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 8, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, -16, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -7, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, -7, -8, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, -12,
+    0, 0, -11, 0, 0, -8, -8, 0,
+    0, 0, 0, -8, 0, 0, 0, 0,
+    -4, 0, 0, 0, 0, 0, -7, 0,
+    0, 0, -12, 0, -16, 0, 0, 0,
+    -25, 0, 7, -17, 16, 1, -7, -40,
+    0, 0, -17, -8, 0, -33, -20, -21,
+    0, 0, -31, -8, -33, -29, -38, 0,
+    -28, 0, 2, 57, -11, 0, -20, -8,
+    -3, -8, -16, -24, -16, -29, -30, -17,
+    0, 0, -7, 0, 1, 0, 0, -57,
+    -13, 25, 22, -22, -32, 0, 1, -35,
+    0, -41, -7, -8, 16, -79, -11, 1,
+    0, 0, -53, -11, -44, -8, -61, 0,
+    0, -57, 0, 54, 1, 0, -7, 0,
+    0, 0, 0, -4, -7, -32, -7, 0,
+    0, 0, 0, 0, -28, 0, -11, 0,
+    -1, -24, -40, 0, 0, -4, -12, -25,
+    -8, 0, -5, 0, 0, 0, 0, -37,
+    -8, -28, -28, -2, -13, -20, -8, -16,
+    0, -16, -11, -25, -12, 0, -11, -21,
+    -8, -21, 0, 4, 0, -7, -28, 0,
+    0, -16, 0, 0, 0, 0, 14, 0,
+    7, -16, 28, 0, -8, -8, -9, 0,
+    0, 0, 0, 0, 0, -25, 0, -8,
+    0, -12, -8, 0, -17, -20, -25, -7,
+    0, -16, 2, 33, 0, 0, 0, 0,
+    66, 0, 0, 4, 0, 0, -9, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    -1, 0, 0, 0, 0, 0, -7, -16,
+    0, 0, 0, 0, 0, -4, 0, 0,
+    0, -8, -8, 0, 0, -16, -8, 0,
+    0, -16, 0, 16, -4, 0, 0, 0,
+    0, 0, 0, 4, 0, 0, 0, 0,
+    16, 2, -11, 0, -30, -17, 0, 25,
+    -25, -25, -16, -16, 33, 11, 8, -73,
+    -5, 16, -8, 0, -8, 3, -8, -29,
+    0, -8, 8, -11, -2, -25, -2, 0,
+    0, 25, 16, 0, -24, 0, -45, -11,
+    14, -11, -32, 1, -11, -28, -28, -8,
+    8, 0, -12, 0, -24, 0, 2, 28,
+    -17, -29, -33, -20, 25, 0, 1, -58,
+    -5, 8, -13, -5, -17, 0, -17, -29,
+    -12, -12, -2, 0, 0, -17, -14, -8,
+    0, 25, 17, -8, -45, 0, -45, -17,
+    0, -29, -46, -1, -25, -13, -28, -21,
+    0, 0, -11, 0, -16, -11, 0, -8,
+    -13, 0, 16, -25, 8, 0, 0, -42,
+    0, -8, -17, -13, -5, -25, -20, -25,
+    -20, 0, -25, -8, -17, -21, -25, -8,
+    0, 0, 1, 40, -13, 0, -25, -8,
+    0, -8, -16, -17, -21, -19, -27, -9,
+    16, 0, -12, 0, -41, -14, 2, 16,
+    -25, -29, -16, -25, 25, -8, 4, -75,
+    -13, 16, -17, -13, -29, 0, -25, -34,
+    -14, -8, -2, -8, -14, -25, -1, 0,
+    0, 25, 19, -7, -53, 0, -49, -27,
+    13, -32, -54, -16, -29, -34, -41, -25,
+    0, 0, 0, 0, -14, 0, 0, 8,
+    -14, 16, 7, -19, 16, 0, 0, -35,
+    -3, 0, -3, 0, 1, 1, -7, 0,
+    0, 0, 0, 0, 0, -8, 0, 0,
+    0, 0, 2, 25, 1, 0, -14, 0,
+    0, 0, 0, -7, -7, -14, 0, 0,
+    1, 2, 0, 0, 0, 0, 2, 0,
+    -9, 0, 27, 0, 11, 1, 1, -9,
+    0, 16, 0, 0, 0, 2, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 25, 0, 19, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, -49, 0, -8, 16, 0, 25, 0,
+    0, 87, 14, -16, -16, 8, 8, -7,
+    1, -41, 0, 0, 35, -49, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, -52, 27, 115, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -17, 0, 0, -21, -11, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, -7, 0, -24, 0, 0, 1, 0,
+    0, 8, 111, -16, -7, 30, 24, -24,
+    8, 0, 0, 8, 8, -7, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, -106, 19, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -24, 0, 0, 0, -24,
+    0, 0, 0, 0, -20, -4, 0, 0,
+    0, -20, 0, -14, 0, -40, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, -57, 0, 0, 0, 0, 1, 0,
+    0, 0, 0, 0, 0, -8, 0, 0,
+    0, -12, 0, -24, 0, 0, 0, -16,
+    8, -14, 0, 0, -24, -8, -20, 0,
+    0, -24, 0, -8, 0, -40, 0, -3,
+    0, 0, -70, -21, -33, -3, -26, 0,
+    0, -57, 0, -24, -2, 0, 0, 0,
+    0, 0, 0, 0, 0, -12, -16, -7,
+    0, 0, 0, 0, -22, 0, -17, 9,
+    -3, 16, 0, -7, -20, -7, -16, -21,
+    0, -14, -4, -7, 5, -24, -1, 0,
+    0, 0, -83, -2, -5, 0, -7, 0,
+    -7, -40, -11, 0, 0, -7, -7, 0,
+    0, 0, 0, 5, 0, -7, -16, -7,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -6, 0, 0, 0, 0,
+    0, -22, 0, -7, 0, 0, 0, -16,
+    8, 0, 0, 0, -24, -8, -16, 0,
+    0, -24, 0, -8, 0, -40, 0, 0,
+    0, 0, -81, 0, -16, -29, -41, 0,
+    0, -57, 0, -5, -12, 0, 0, 0,
+    0, 0, 0, 0, 0, -8, -12, -4,
+    1, 0, 0, 16, -9, 0, 20, 46,
+    -8, -8, -25, 14, 46, 16, 22, -24,
+    14, 39, 14, 27, 22, 24, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 52, 40, -11, -8, 0, -7, 66,
+    34, 66, 0, 0, 0, 8, 0, 0,
+    0, 0, -17, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -7, 0, 0, 0,
+    0, 0, 0, 0, 0, 5, 0, 0,
+    0, 0, -82, -14, -2, -38, -46, 0,
+    0, -57, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -17, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -7, 0, 0, 0,
+    0, 0, 0, 0, 0, 5, 0, 0,
+    0, 0, -82, -14, -2, -38, -46, 0,
+    0, -48, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -2, 0, 0, 0,
+    -17, 8, 0, -8, 2, 11, 8, -25,
+    0, -6, -5, 8, 0, 2, 0, 0,
+    0, 0, -30, 0, -11, -7, -16, 0,
+    -11, -33, 0, 55, -8, 0, -17, -7,
+    0, -7, -13, 0, -8, -21, -16, -9,
+    0, 0, -17, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -7, 0, 0, 0,
+    0, 0, 0, 0, 0, 5, 0, 0,
+    0, 0, -82, -14, -2, -38, -46, 0,
+    0, -57, 0, 0, 0, 0, 0, 0,
+    41, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -17, 0, -30, -14, -11, 25,
+    -11, -8, -33, 1, -11, 1, -7, -26,
+    1, 17, 1, 2, 1, 2, -23, -29,
+    -14, 0, -42, -21, -24, -36, -35, 0,
+    -17, -16, -14, -9, -7, -7, -11, -7,
+    0, -7, -3, 12, 0, 12, -7, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -7, -8, -8, 0,
+    0, -24, 0, -4, 0, -16, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, -49, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -8, -8, 0,
+    0, 0, 0, 0, -7, 0, 0, -16,
+    -8, 8, 0, -16, -19, -7, 0, -29,
+    -7, -22, -5, -14, 0, -16, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, -57, 0, 30, 0, 0, -16, 0,
+    0, 0, 0, -11, 0, -8, 0, 0,
+    0, 0, -7, 0, -17, 0, 0, 39,
+    -9, -28, -22, 7, 3, 3, -6, -19,
+    7, 12, 7, 25, 7, 25, -7, -21,
+    0, 0, -48, 0, 0, -25, -24, 0,
+    0, -16, 0, -9, -13, 0, -12, 0,
+    -12, 0, -5, 12, 0, -2, -25, -8,
+    0, 0, -11, 0, -16, 0, 0, 9,
+    -17, 0, 8, -8, 2, -5, 0, -25,
+    0, -7, -1, 0, -8, 3, -2, 0,
+    0, 0, -46, -14, -17, 0, -25, 0,
+    0, -40, 0, 32, -8, 0, -16, 0,
+    -8, 0, -8, 0, -8, -25, 0, -8,
+    0, 0, 0, 0, -7, 0, 0, 8,
+    -11, 1, 0, 0, -14, -7, 0, -14,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, -55, 0, 22, 0, 0, -7, 0,
+    0, 0, 0, 1, 0, -8, -8, 0
+};
+
+
+/*Collect the kern class' data in one place*/
+static const lv_font_fmt_txt_kern_classes_t kern_classes =
+{
+    .class_pair_values   = kern_class_values,
+    .left_class_mapping  = kern_left_class_mapping,
+    .right_class_mapping = kern_right_class_mapping,
+    .left_class_cnt      = 60,
+    .right_class_cnt     = 48,
+};
+
+/*--------------------
+ *  ALL CUSTOM DATA
+ *--------------------*/
+
+#if LVGL_VERSION_MAJOR == 8
+/*Store all the custom data of the font*/
+static  lv_font_fmt_txt_glyph_cache_t cache;
+#endif
+
+lv_font_fmt_txt_dsc_t ui_font_montserrat_light_80_dsc = {
+    .glyph_bitmap = NULL,        /*Bound by AssetPack::begin()*/
+    .glyph_dsc = glyph_dsc,
+    .cmaps = cmaps,
+    .kern_dsc = &kern_classes,
+    .kern_scale = 25,
+    .cmap_num = 1,
+    .bpp = 8,
+    .kern_classes = 1,
+    .bitmap_format = 0,
+#if LVGL_VERSION_MAJOR == 8
+    .cache = &cache
+#endif
+};
+
+
+
+/*-----------------
+ *  PUBLIC FONT
+ *----------------*/
+
+/*Initialize a public general font descriptor*/
+#if LVGL_VERSION_MAJOR >= 8
+const lv_font_t ui_font_montserrat_light_80 = {
+#else
+lv_font_t ui_font_montserrat_light_80 = {
+#endif
+    .get_glyph_dsc = AssetPack_FontGetGlyphDsc,    /*Function pointer to get glyph's data*/
+    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,    /*Function pointer to get glyph's bitmap*/
+    .line_height = 82,          /*The maximum line height required by the font*/
+    .base_line = 15,             /*Baseline measured from the bottom of the line*/
+#if !(LVGL_VERSION_MAJOR == 6 && LVGL_VERSION_MINOR == 0)
+    .subpx = LV_FONT_SUBPX_NONE,
+#endif
+#if LV_VERSION_CHECK(7, 4, 0) || LVGL_VERSION_MAJOR >= 8
+    .underline_position = -6,
+    .underline_thickness = 4,
+#endif
+    .dsc = &ui_font_montserrat_light_80_dsc,          /*The custom font data. Will be accessed by `get_glyph_bitmap/dsc` */
+#if LV_VERSION_CHECK(8, 2, 0) || LVGL_VERSION_MAJOR >= 9
+    .fallback = &lv_font_montserrat_48,
+#endif
+    .user_data = NULL,
+};
+
+
+
+#endif /*#if UI_FONT_MONTSERRAT_LIGHT_80*/
+
+
+#endif /*USE_ASSET_PACK*/
@@ -0,0 +1,630 @@
+/* Generated by pack_assets.py — do not edit. */
+#ifdef USE_ASSET_PACK
+
+/*******************************************************************************
+ * Size: 100 px
+ * Bpp: 8
+ * Opts: --bpp 8 --size 100 --no-compress --font fonts/Montserrat-Regular.ttf --range 32-127 --format lvgl
+ ******************************************************************************/
+
+#ifdef __has_include
+    #if __has_include("lvgl.h")
+        #ifndef LV_LVGL_H_INCLUDE_SIMPLE
+            #define LV_LVGL_H_INCLUDE_SIMPLE
+        #endif
+    #endif
+#endif
+
+#ifdef LV_LVGL_H_INCLUDE_SIMPLE
+    #include "lvgl.h"
+#else
+    #include "lvgl.h"
+#endif
+#include "../asset_pack_format.h"
+
+#ifndef UI_FONT_MONTSERRAT_NORMAL_100
+#define UI_FONT_MONTSERRAT_NORMAL_100 1
+#endif
+
+#if UI_FONT_MONTSERRAT_NORMAL_100
+
+/*-----------------
+ *    BITMAPS
+ *----------------*/
+
+
+
+
+/*---------------------
+ *  GLYPH DESCRIPTION
+ *--------------------*/
+
+static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
+    {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
+    {.bitmap_index = 0, .adv_w = 419, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 0, .adv_w = 416, .box_w = 12, .box_h = 71, .ofs_x = 7, .ofs_y = -1},
+    {.bitmap_index = 852, .adv_w = 597, .box_w = 25, .box_h = 27, .ofs_x = 6, .ofs_y = 43},
+    {.bitmap_index = 1527, .adv_w = 1114, .box_w = 65, .box_h = 70, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 6077, .adv_w = 984, .box_w = 53, .box_h = 94, .ofs_x = 4, .ofs_y = -12},
+    {.bitmap_index = 11059, .adv_w = 1326, .box_w = 75, .box_h = 72, .ofs_x = 4, .ofs_y = -1},
+    {.bitmap_index = 16459, .adv_w = 1070, .box_w = 62, .box_h = 72, .ofs_x = 4, .ofs_y = -1},
+    {.bitmap_index = 20923, .adv_w = 323, .box_w = 8, .box_h = 27, .ofs_x = 6, .ofs_y = 43},
+    {.bitmap_index = 21139, .adv_w = 526, .box_w = 19, .box_h = 93, .ofs_x = 10, .ofs_y = -19},
+    {.bitmap_index = 22906, .adv_w = 526, .box_w = 19, .box_h = 93, .ofs_x = 4, .ofs_y = -19},
+    {.bitmap_index = 24673, .adv_w = 618, .box_w = 35, .box_h = 37, .ofs_x = 2, .ofs_y = 37},
+    {.bitmap_index = 25968, .adv_w = 920, .box_w = 44, .box_h = 43, .ofs_x = 7, .ofs_y = 14},
+    {.bitmap_index = 27860, .adv_w = 339, .box_w = 11, .box_h = 25, .ofs_x = 5, .ofs_y = -15},
+    {.bitmap_index = 28135, .adv_w = 611, .box_w = 27, .box_h = 7, .ofs_x = 6, .ofs_y = 24},
+    {.bitmap_index = 28324, .adv_w = 339, .box_w = 11, .box_h = 12, .ofs_x = 5, .ofs_y = -1},
+    {.bitmap_index = 28456, .adv_w = 536, .box_w = 40, .box_h = 94, .ofs_x = -3, .ofs_y = -10},
+    {.bitmap_index = 32216, .adv_w = 1059, .box_w = 57, .box_h = 72, .ofs_x = 5, .ofs_y = -1},
+    {.bitmap_index = 36320, .adv_w = 578, .box_w = 25, .box_h = 70, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 38070, .adv_w = 909, .box_w = 52, .box_h = 71, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 41762, .adv_w = 902, .box_w = 52, .box_h = 71, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 45454, .adv_w = 1058, .box_w = 61, .box_h = 70, .ofs_x = 4, .ofs_y = 0},
+    {.bitmap_index = 49724, .adv_w = 906, .box_w = 51, .box_h = 71, .ofs_x = 2, .ofs_y = -1},
+    {.bitmap_index = 53345, .adv_w = 974, .box_w = 53, .box_h = 72, .ofs_x = 5, .ofs_y = -1},
+    {.bitmap_index = 57161, .adv_w = 942, .box_w = 52, .box_h = 70, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 60801, .adv_w = 1021, .box_w = 55, .box_h = 72, .ofs_x = 4, .ofs_y = -1},
+    {.bitmap_index = 64761, .adv_w = 974, .box_w = 53, .box_h = 72, .ofs_x = 3, .ofs_y = -1},
+    {.bitmap_index = 68577, .adv_w = 339, .box_w = 11, .box_h = 54, .ofs_x = 5, .ofs_y = -1},
+    {.bitmap_index = 69171, .adv_w = 339, .box_w = 11, .box_h = 68, .ofs_x = 5, .ofs_y = -15},
+    {.bitmap_index = 69919, .adv_w = 920, .box_w = 44, .box_h = 42, .ofs_x = 7, .ofs_y = 14},
+    {.bitmap_index = 71767, .adv_w = 920, .box_w = 44, .box_h = 29, .ofs_x = 7, .ofs_y = 21},
+    {.bitmap_index = 73043, .adv_w = 920, .box_w = 44, .box_h = 42, .ofs_x = 7, .ofs_y = 14},
+    {.bitmap_index = 74891, .adv_w = 907, .box_w = 49, .box_h = 72, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 78419, .adv_w = 1653, .box_w = 94, .box_h = 91, .ofs_x = 5, .ofs_y = -20},
+    {.bitmap_index = 86973, .adv_w = 1147, .box_w = 72, .box_h = 70, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 92013, .adv_w = 1206, .box_w = 59, .box_h = 70, .ofs_x = 11, .ofs_y = 0},
+    {.bitmap_index = 96143, .adv_w = 1150, .box_w = 63, .box_h = 72, .ofs_x = 5, .ofs_y = -1},
+    {.bitmap_index = 100679, .adv_w = 1322, .box_w = 67, .box_h = 70, .ofs_x = 11, .ofs_y = 0},
+    {.bitmap_index = 105369, .adv_w = 1070, .box_w = 50, .box_h = 70, .ofs_x = 11, .ofs_y = 0},
+    {.bitmap_index = 108869, .adv_w = 1013, .box_w = 49, .box_h = 70, .ofs_x = 11, .ofs_y = 0},
+    {.bitmap_index = 112299, .adv_w = 1237, .box_w = 64, .box_h = 72, .ofs_x = 5, .ofs_y = -1},
+    {.bitmap_index = 116907, .adv_w = 1301, .box_w = 59, .box_h = 70, .ofs_x = 11, .ofs_y = 0},
+    {.bitmap_index = 121037, .adv_w = 483, .box_w = 8, .box_h = 70, .ofs_x = 11, .ofs_y = 0},
+    {.bitmap_index = 121597, .adv_w = 802, .box_w = 41, .box_h = 71, .ofs_x = -1, .ofs_y = -1},
+    {.bitmap_index = 124508, .adv_w = 1138, .box_w = 60, .box_h = 70, .ofs_x = 11, .ofs_y = 0},
+    {.bitmap_index = 128708, .adv_w = 942, .box_w = 47, .box_h = 70, .ofs_x = 11, .ofs_y = 0},
+    {.bitmap_index = 131998, .adv_w = 1528, .box_w = 74, .box_h = 70, .ofs_x = 11, .ofs_y = 0},
+    {.bitmap_index = 137178, .adv_w = 1301, .box_w = 59, .box_h = 70, .ofs_x = 11, .ofs_y = 0},
+    {.bitmap_index = 141308, .adv_w = 1342, .box_w = 74, .box_h = 72, .ofs_x = 5, .ofs_y = -1},
+    {.bitmap_index = 146636, .adv_w = 1149, .box_w = 56, .box_h = 70, .ofs_x = 11, .ofs_y = 0},
+    {.bitmap_index = 150556, .adv_w = 1342, .box_w = 77, .box_h = 85, .ofs_x = 5, .ofs_y = -14},
+    {.bitmap_index = 157101, .adv_w = 1157, .box_w = 57, .box_h = 70, .ofs_x = 11, .ofs_y = 0},
+    {.bitmap_index = 161091, .adv_w = 984, .box_w = 53, .box_h = 72, .ofs_x = 4, .ofs_y = -1},
+    {.bitmap_index = 164907, .adv_w = 918, .box_w = 57, .box_h = 70, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 168897, .adv_w = 1267, .box_w = 59, .box_h = 71, .ofs_x = 10, .ofs_y = -1},
+    {.bitmap_index = 173086, .adv_w = 1117, .box_w = 70, .box_h = 70, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 177986, .adv_w = 1778, .box_w = 105, .box_h = 70, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 185336, .adv_w = 1050, .box_w = 63, .box_h = 70, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 189746, .adv_w = 1016, .box_w = 64, .box_h = 70, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 194226, .adv_w = 1042, .box_w = 58, .box_h = 70, .ofs_x = 4, .ofs_y = 0},
+    {.bitmap_index = 198286, .adv_w = 509, .box_w = 19, .box_h = 93, .ofs_x = 11, .ofs_y = -19},
+    {.bitmap_index = 200053, .adv_w = 536, .box_w = 40, .box_h = 94, .ofs_x = -4, .ofs_y = -10},
+    {.bitmap_index = 203813, .adv_w = 509, .box_w = 19, .box_h = 93, .ofs_x = 2, .ofs_y = -19},
+    {.bitmap_index = 205580, .adv_w = 922, .box_w = 42, .box_h = 42, .ofs_x = 8, .ofs_y = 14},
+    {.bitmap_index = 207344, .adv_w = 800, .box_w = 50, .box_h = 5, .ofs_x = 0, .ofs_y = -5},
+    {.bitmap_index = 207594, .adv_w = 960, .box_w = 24, .box_h = 13, .ofs_x = 13, .ofs_y = 61},
+    {.bitmap_index = 207906, .adv_w = 944, .box_w = 45, .box_h = 54, .ofs_x = 5, .ofs_y = -1},
+    {.bitmap_index = 210336, .adv_w = 1085, .box_w = 55, .box_h = 75, .ofs_x = 9, .ofs_y = -1},
+    {.bitmap_index = 214461, .adv_w = 901, .box_w = 49, .box_h = 54, .ofs_x = 4, .ofs_y = -1},
+    {.bitmap_index = 217107, .adv_w = 1085, .box_w = 54, .box_h = 75, .ofs_x = 4, .ofs_y = -1},
+    {.bitmap_index = 221157, .adv_w = 966, .box_w = 52, .box_h = 54, .ofs_x = 4, .ofs_y = -1},
+    {.bitmap_index = 223965, .adv_w = 542, .box_w = 37, .box_h = 74, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 226703, .adv_w = 1098, .box_w = 55, .box_h = 73, .ofs_x = 4, .ofs_y = -20},
+    {.bitmap_index = 230718, .adv_w = 1083, .box_w = 50, .box_h = 74, .ofs_x = 9, .ofs_y = 0},
+    {.bitmap_index = 234418, .adv_w = 430, .box_w = 11, .box_h = 74, .ofs_x = 8, .ofs_y = 0},
+    {.bitmap_index = 235232, .adv_w = 438, .box_w = 29, .box_h = 94, .ofs_x = -9, .ofs_y = -20},
+    {.bitmap_index = 237958, .adv_w = 962, .box_w = 51, .box_h = 74, .ofs_x = 9, .ofs_y = 0},
+    {.bitmap_index = 241732, .adv_w = 430, .box_w = 8, .box_h = 74, .ofs_x = 9, .ofs_y = 0},
+    {.bitmap_index = 242324, .adv_w = 1698, .box_w = 88, .box_h = 53, .ofs_x = 9, .ofs_y = 0},
+    {.bitmap_index = 246988, .adv_w = 1083, .box_w = 50, .box_h = 53, .ofs_x = 9, .ofs_y = 0},
+    {.bitmap_index = 249638, .adv_w = 1003, .box_w = 55, .box_h = 54, .ofs_x = 4, .ofs_y = -1},
+    {.bitmap_index = 252608, .adv_w = 1085, .box_w = 55, .box_h = 72, .ofs_x = 9, .ofs_y = -19},
+    {.bitmap_index = 256568, .adv_w = 1085, .box_w = 54, .box_h = 72, .ofs_x = 4, .ofs_y = -19},
+    {.bitmap_index = 260456, .adv_w = 642, .box_w = 28, .box_h = 53, .ofs_x = 9, .ofs_y = 0},
+    {.bitmap_index = 261940, .adv_w = 782, .box_w = 44, .box_h = 54, .ofs_x = 2, .ofs_y = -1},
+    {.bitmap_index = 264316, .adv_w = 650, .box_w = 37, .box_h = 65, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 266721, .adv_w = 1077, .box_w = 49, .box_h = 54, .ofs_x = 9, .ofs_y = -1},
+    {.bitmap_index = 269367, .adv_w = 867, .box_w = 55, .box_h = 53, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 272282, .adv_w = 1406, .box_w = 88, .box_h = 53, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 276946, .adv_w = 854, .box_w = 51, .box_h = 53, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 279649, .adv_w = 867, .box_w = 58, .box_h = 73, .ofs_x = -3, .ofs_y = -20},
+    {.bitmap_index = 283883, .adv_w = 818, .box_w = 43, .box_h = 53, .ofs_x = 4, .ofs_y = 0},
+    {.bitmap_index = 286162, .adv_w = 534, .box_w = 26, .box_h = 93, .ofs_x = 6, .ofs_y = -19},
+    {.bitmap_index = 288580, .adv_w = 472, .box_w = 7, .box_h = 93, .ofs_x = 11, .ofs_y = -19},
+    {.bitmap_index = 289231, .adv_w = 534, .box_w = 26, .box_h = 93, .ofs_x = 2, .ofs_y = -19},
+    {.bitmap_index = 291649, .adv_w = 920, .box_w = 46, .box_h = 16, .ofs_x = 6, .ofs_y = 27}
+};
+
+/*---------------------
+ *  CHARACTER MAPPING
+ *--------------------*/
+
+
+
+/*Collect the unicode lists and glyph_id offsets*/
+static const lv_font_fmt_txt_cmap_t cmaps[] =
+{
+    {
+        .range_start = 32, .range_length = 95, .glyph_id_start = 1,
+        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
+    }
+};
+
+/*-----------------
+ *    KERNING
+ *----------------*/
+
+
+/*Map glyph_ids to kern left classes*/
+static const uint8_t kern_left_class_mapping[] =
+{
+    0, 0, 1, 2, 0, 3, 4, 5,
+    2, 6, 7, 8, 9, 10, 9, 10,
+    11, 12, 0, 13, 14, 15, 16, 17,
+    18, 19, 12, 20, 20, 0, 0, 0,
+    21, 22, 23, 24, 25, 22, 26, 27,
+    28, 29, 29, 30, 31, 32, 29, 29,
+    22, 33, 34, 35, 3, 36, 30, 37,
+    37, 38, 39, 40, 41, 42, 43, 0,
+    44, 0, 45, 46, 47, 48, 49, 50,
+    51, 45, 52, 52, 53, 48, 45, 45,
+    46, 46, 54, 55, 56, 57, 51, 58,
+    58, 59, 58, 60, 41, 0, 0, 9
+};
+
+/*Map glyph_ids to kern right classes*/
+static const uint8_t kern_right_class_mapping[] =
+{
+    0, 0, 1, 2, 0, 3, 4, 5,
+    2, 6, 7, 8, 9, 10, 9, 10,
+    11, 12, 13, 14, 15, 16, 17, 12,
+    18, 19, 20, 21, 21, 0, 0, 0,
+    22, 23, 24, 25, 23, 25, 25, 25,
+    23, 25, 25, 26, 25, 25, 25, 25,
+    23, 25, 23, 25, 3, 27, 28, 29,
+    29, 30, 31, 32, 33, 34, 35, 0,
+    36, 0, 37, 38, 39, 39, 39, 0,
+    39, 38, 40, 41, 38, 38, 42, 42,
+    39, 42, 39, 42, 43, 44, 45, 46,
+    46, 47, 46, 48, 0, 0, 35, 9
+};
+
+/*Kern values between classes*/
+static const int8_t kern_class_values[] =
+{
+    0, 2, 0, 0, 0, 0, 0, 0,
+    0, 2, 0, 0, 9, 0, 0, 0,
+    0, 7, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 2, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    2, 38, 0, 24, -21, 0, 0, 0,
+    0, -47, -51, 7, 41, 21, 15, -34,
+    7, 45, 3, 38, 9, 30, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 51, 4, -7, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, -26, 0, 0, 0, 0, 0, -17,
+    15, 17, 0, 0, -9, 0, -7, 9,
+    0, -9, 0, -9, -4, -17, 0, 0,
+    0, 0, -9, 0, 0, -12, -13, 0,
+    0, -9, 0, -17, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -9, -9, 0,
+    0, -24, 0, -102, 0, 0, -17, 0,
+    17, 26, 1, 0, -17, 9, 9, 29,
+    17, -15, 17, 0, 0, -49, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, -32, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    -9, -45, 0, -34, -7, 0, 0, 0,
+    0, 4, 37, 0, -26, -4, -2, 2,
+    0, -15, 0, 0, -5, -67, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, -68, -4, 38, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 27, 0, 9, 0, 0, -17,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 30, 4, 2, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -32, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    5, 17, 9, 26, -9, 0, 0, 17,
+    -9, -27, -119, 7, 24, 17, 3, -12,
+    0, 34, 0, 30, 0, 30, 0, -79,
+    0, -9, 26, 0, 29, -9, 17, 9,
+    0, 0, 2, -9, 0, 0, -15, 68,
+    0, 68, 0, 26, 0, 38, 10, 15,
+    0, 0, 0, -32, 0, 0, 0, 0,
+    2, -5, 0, 7, -15, -10, -17, 7,
+    0, -9, 0, 0, 0, -34, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, -55, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    2, -47, 0, -53, 0, 0, 0, 0,
+    -5, 0, 88, -9, -10, 9, 9, -11,
+    0, -10, 9, 0, 0, -44, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, -84, 0, 9, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 51, 0, 0, -32, 0, 27, 0,
+    -57, -84, -55, -17, 26, 0, 0, -58,
+    0, 13, -19, 0, -13, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 26, 26, -107, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 7, 0, 0, 0, 0, 0, 7,
+    7, -9, -17, 0, -2, -2, -9, 0,
+    0, -7, 0, 0, 0, -17, 0, -6,
+    0, -19, -17, 0, -21, -27, -27, -18,
+    0, -17, 0, -17, 0, 0, 0, 0,
+    -7, 0, 0, 9, 0, 7, -9, 0,
+    0, 0, 0, 9, -7, 0, 0, 0,
+    -7, 9, 9, -3, 0, 0, 0, -20,
+    0, -3, 0, 0, 0, 0, 0, 2,
+    0, 10, -7, 0, -9, 0, -14, 0,
+    0, -7, 0, 26, 0, 0, -9, 0,
+    0, 0, 0, 0, -3, 3, -7, -7,
+    0, -9, 0, -9, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -4, -4, 0,
+    -9, -11, 0, 0, 0, 0, 0, 3,
+    0, 0, -5, 0, -9, -9, -9, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    -5, 0, 0, 0, 0, -5, -10, 0,
+    0, -26, -7, -26, 17, 0, 0, -17,
+    9, 17, 24, 0, -21, -3, -13, 0,
+    -3, -43, 9, -7, 5, -44, 9, 0,
+    0, 2, -44, 0, -44, -6, -73, -7,
+    0, -43, 0, 17, 25, 0, 10, 0,
+    0, 0, 0, 1, 0, -13, -10, 0,
+    0, 0, 0, -9, 0, 0, 0, -9,
+    0, 0, 0, 0, 0, -4, -4, 0,
+    -4, -12, 0, 0, 0, 0, 0, 0,
+    0, -9, -9, 0, -5, -9, -8, 0,
+    0, -9, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -6, -6, 0,
+    0, -7, 0, -17, 9, 0, 0, -13,
+    4, 9, 9, 0, 0, 0, 0, 0,
+    0, -7, 0, 0, 0, 0, 0, 7,
+    0, 0, -9, 0, -9, -7, -13, 0,
+    0, 0, 0, 0, 0, 0, 8, 0,
+    -7, 0, 0, 0, 0, -8, -13, 0,
+    0, 26, -7, 2, -30, 0, 0, 24,
+    -43, -45, -37, -17, 9, 0, -8, -55,
+    -16, 0, -16, 0, -17, 13, -16, -56,
+    0, -24, 0, 0, 4, -3, 6, -7,
+    0, 9, -3, -26, -33, 0, -43, -22,
+    -18, -22, -26, -13, -24, -4, -20, -26,
+    0, 3, 0, -9, 0, 0, 0, 7,
+    0, 9, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -9, 0, -4,
+    0, -3, -9, 0, -14, -18, -18, -3,
+    0, -26, 0, 0, 0, 0, 0, 0,
+    -7, 0, 0, 0, 0, 5, -3, 0,
+    0, 9, 0, 0, 0, 0, 0, 0,
+    0, 0, 38, 0, 0, 0, 0, 0,
+    0, 7, 0, 0, 0, -9, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, -15, 0, 9, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    -7, 0, 0, 0, -20, 0, 0, 0,
+    0, -43, -26, 0, 0, 0, -13, -43,
+    0, 0, -9, 9, 0, -27, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    -16, 0, 0, -18, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, -16, 0, 0, 0, 0, 13, 0,
+    7, -17, -17, 0, -9, -9, -9, 0,
+    0, 0, 0, 0, 0, -26, 0, -9,
+    0, -13, -9, 0, -18, -21, -26, -8,
+    0, -17, 0, -26, 0, 0, 0, 0,
+    68, 0, 0, 4, 0, 0, -10, 0,
+    0, -38, 0, 0, 0, 0, 0, -79,
+    -13, 29, 26, -6, -35, 0, 9, -13,
+    0, -43, -4, -12, 9, -60, -9, 8,
+    0, 13, -30, -13, -31, -27, -35, 0,
+    0, -51, 0, 49, 0, 0, -4, 0,
+    0, 0, -4, -4, -9, -22, -27, -1,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 2, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -9, 0, -4, -9, -13, 0,
+    0, -17, 0, -9, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -3, 0, -17, 0, 0, 17,
+    -2, 12, 0, -20, 9, -7, -3, -26,
+    -9, 0, -12, -9, -5, 0, -13, -15,
+    0, 0, -8, -2, -7, -15, -13, 0,
+    0, -9, 0, 9, -7, 0, -20, 0,
+    0, 0, -17, 0, -15, 0, -15, -15,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    -17, 9, 0, -14, 0, -7, -13, -32,
+    -7, -7, -7, -3, -7, -13, -3, 0,
+    0, 0, 0, 0, -9, -8, -8, 0,
+    0, 0, 0, 13, -7, 0, -7, 0,
+    0, 0, -7, -13, -7, -9, -13, -9,
+    4, 34, -3, 0, -26, 0, -7, 17,
+    0, -9, -37, -12, 13, -1, 0, -43,
+    -15, 9, -15, 5, 0, -10, -8, -28,
+    0, -13, 4, 0, 0, -15, 0, 0,
+    0, 9, 9, -17, -18, 0, -15, -9,
+    -13, -9, -9, 0, -15, 4, -18, -15,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 9, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, -15, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -7, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, -8, -9, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, -13,
+    0, 0, -12, 0, 0, -9, -9, 0,
+    0, 0, 0, -9, 0, 0, 0, 0,
+    -4, 0, 0, 0, 0, 0, -7, 0,
+    0, 0, -13, 0, -17, 0, 0, 0,
+    -27, 0, 7, -18, 17, 1, -7, -41,
+    0, 0, -18, -9, 0, -34, -21, -23,
+    0, 0, -34, -9, -34, -32, -40, 0,
+    -26, 0, 4, 58, -12, 0, -20, -9,
+    -3, -9, -15, -24, -16, -31, -33, -19,
+    0, 0, -7, 0, 2, 0, 0, -60,
+    -11, 26, 21, -21, -32, 0, 2, -32,
+    0, -43, -7, -9, 17, -81, -12, 2,
+    0, 0, -55, -11, -45, -9, -63, 0,
+    0, -60, 0, 54, 2, 0, -7, 0,
+    0, 0, 0, -4, -7, -33, -7, 0,
+    0, 0, 0, 0, -28, 0, -9, 0,
+    -2, -25, -41, 0, 0, -4, -13, -26,
+    -9, 0, -5, 0, 0, 0, 0, -38,
+    -9, -29, -28, -4, -14, -21, -9, -15,
+    0, -17, -9, -27, -13, 0, -11, -20,
+    -9, -20, 0, 4, 0, -7, -29, 0,
+    0, -16, 0, 0, 0, 0, 13, 0,
+    7, -17, 32, 0, -9, -9, -9, 0,
+    0, 0, 0, 0, 0, -26, 0, -9,
+    0, -13, -9, 0, -18, -21, -26, -8,
+    0, -17, 4, 34, 0, 0, 0, 0,
+    68, 0, 0, 4, 0, 0, -10, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    -1, 0, 0, 0, 0, 0, -7, -17,
+    0, 0, 0, 0, 0, -4, 0, 0,
+    0, -9, -9, 0, 0, -17, -9, 0,
+    0, -17, 0, 15, -4, 0, 0, 0,
+    0, 0, 0, 4, 0, 0, 0, 0,
+    17, 4, -9, 0, -30, -16, 0, 26,
+    -27, -26, -17, -17, 34, 13, 9, -75,
+    -5, 17, -9, 0, -9, 6, -9, -30,
+    0, -9, 9, -12, -4, -26, -4, 0,
+    0, 26, 17, 0, -25, 0, -47, -12,
+    19, -12, -33, 2, -12, -29, -29, -9,
+    9, 0, -13, 0, -24, 0, 4, 29,
+    -19, -31, -34, -21, 26, 0, 2, -61,
+    -6, 9, -14, -5, -19, 0, -18, -31,
+    -13, -13, -4, 0, 0, -19, -16, -9,
+    0, 26, 19, -9, -47, 0, -47, -15,
+    0, -30, -49, -2, -26, -14, -29, -23,
+    0, 0, -12, 0, -17, -9, 0, -9,
+    -15, 0, 15, -27, 9, 0, 0, -44,
+    0, -9, -18, -14, -5, -26, -21, -27,
+    -20, 0, -26, -9, -19, -20, -26, -9,
+    0, 0, 2, 41, -14, 0, -26, -9,
+    0, -9, -17, -19, -22, -21, -30, -10,
+    17, 0, -13, 0, -43, -13, 3, 17,
+    -26, -31, -17, -27, 27, -9, 4, -79,
+    -15, 17, -18, -14, -31, 0, -26, -35,
+    -13, -9, -4, -9, -16, -26, -2, 0,
+    0, 26, 21, -7, -55, 0, -51, -25,
+    17, -33, -57, -17, -30, -35, -43, -27,
+    0, 0, 0, 0, -13, 0, 0, 9,
+    -13, 17, 7, -18, 17, 0, 0, -32,
+    -3, 0, -3, 0, 2, 2, -8, 0,
+    0, 0, 0, 0, 0, -9, 0, 0,
+    0, 0, 4, 26, 1, 0, -13, 0,
+    0, 0, 0, -7, -7, -13, 0, 0,
+    2, 4, 0, 0, 0, 0, 4, 0,
+    -9, 0, 30, 0, 13, 2, 2, -10,
+    0, 17, 0, 0, 0, 4, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 26, 0, 21, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, -51, 0, -9, 15, 0, 26, 0,
+    0, 88, 13, -17, -17, 9, 9, -7,
+    2, -43, 0, 0, 38, -51, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, -55, 30, 119, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -16, 0, 0, -20, -9, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, -7, 0, -24, 0, 0, 2, 0,
+    0, 9, 113, -17, -8, 30, 24, -24,
+    9, 0, 0, 9, 9, -9, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, -111, 21, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -25, 0, 0, 0, -24,
+    0, 0, 0, 0, -20, -4, 0, 0,
+    0, -20, 0, -13, 0, -41, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, -58, 0, 0, 0, 0, 2, 0,
+    0, 0, 0, 0, 0, -9, 0, 0,
+    0, -13, 0, -24, 0, 0, 0, -15,
+    9, -13, 0, 0, -24, -9, -20, 0,
+    0, -24, 0, -9, 0, -41, 0, -6,
+    0, 0, -72, -20, -34, -6, -29, 0,
+    0, -58, 0, -24, -3, 0, 0, 0,
+    0, 0, 0, 0, 0, -13, -16, -8,
+    0, 0, 0, 0, -21, 0, -18, 10,
+    -6, 17, 0, -7, -20, -7, -15, -20,
+    0, -13, -4, -7, 5, -24, -2, 0,
+    0, 0, -81, -4, -9, 0, -13, 0,
+    -7, -41, -9, 0, 0, -7, -8, 0,
+    0, 0, 0, 5, 0, -7, -15, -7,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 2, 0, 0, 0, 0,
+    0, -21, 0, -7, 0, 0, 0, -17,
+    9, 0, 0, 0, -24, -9, -17, 0,
+    0, -25, 0, -9, 0, -41, 0, 0,
+    0, 0, -84, 0, -17, -31, -43, 0,
+    0, -58, 0, -5, -13, 0, 0, 0,
+    0, 0, 0, 0, 0, -9, -13, -4,
+    2, 0, 0, 15, -10, 0, 23, 45,
+    -9, -9, -26, 13, 45, 15, 21, -24,
+    13, 38, 13, 26, 21, 24, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 55, 41, -13, -9, 0, -8, 68,
+    36, 68, 0, 0, 0, 9, 0, 0,
+    0, 0, -16, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -7, 0, 0, 0,
+    0, 0, 0, 0, 0, 9, 0, 0,
+    0, 0, -79, -13, -4, -38, -45, 0,
+    0, -58, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -16, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -7, 0, 0, 0,
+    0, 0, 0, 0, 0, 9, 0, 0,
+    0, 0, -79, -13, -4, -38, -45, 0,
+    0, -43, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -4, 0, 0, 0,
+    -19, 9, 0, -9, 4, 13, 9, -26,
+    0, -4, -6, 9, 0, 4, 0, 0,
+    0, 0, -26, 0, -9, -7, -17, 0,
+    -9, -34, 0, 55, -9, 0, -18, -7,
+    0, -7, -14, 0, -9, -23, -17, -9,
+    0, 0, -16, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -7, 0, 0, 0,
+    0, 0, 0, 0, 0, 9, 0, 0,
+    0, 0, -79, -13, -4, -38, -45, 0,
+    0, -58, 0, 0, 0, 0, 0, 0,
+    43, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -16, 0, -30, -13, -9, 26,
+    -9, -9, -34, 2, -9, 2, -7, -26,
+    1, 18, 1, 4, 2, 4, -22, -32,
+    -13, 0, -38, -20, -24, -37, -35, 0,
+    -16, -17, -13, -10, -8, -7, -11, -7,
+    0, -7, -3, 13, 0, 13, -7, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -7, -9, -9, 0,
+    0, -24, 0, -4, 0, -15, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, -51, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -9, -9, 0,
+    0, 0, 0, 0, -8, 0, 0, -15,
+    -9, 9, 0, -15, -18, -7, 0, -28,
+    -7, -21, -5, -13, 0, -15, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, -58, 0, 30, 0, 0, -16, 0,
+    0, 0, 0, -12, 0, -9, 0, 0,
+    0, 0, -7, 0, -19, 0, 0, 38,
+    -10, -29, -25, 7, 6, 6, -4, -21,
+    7, 13, 7, 26, 7, 27, -7, -22,
+    0, 0, -43, 0, 0, -26, -24, 0,
+    0, -17, 0, -10, -14, 0, -13, 0,
+    -13, 0, -5, 13, 0, -4, -26, -9,
+    0, 0, -9, 0, -17, 0, 0, 10,
+    -19, 0, 9, -9, 4, -3, 0, -27,
+    0, -7, -2, 0, -9, 6, -4, 0,
+    0, 0, -42, -13, -18, 0, -26, 0,
+    0, -41, 0, 32, -9, 0, -16, 0,
+    -2, 0, -9, 0, -9, -26, 0, -9,
+    0, 0, 0, 0, -7, 0, 0, 9,
+    -12, 2, 0, 0, -13, -7, 0, -13,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, -55, 0, 21, 0, 0, -8, 0,
+    0, 0, 0, 1, 0, -9, -9, 0
+};
+
+
+/*Collect the kern class' data in one place*/
+static const lv_font_fmt_txt_kern_classes_t kern_classes =
+{
+    .class_pair_values   = kern_class_values,
+    .left_class_mapping  = kern_left_class_mapping,
+    .right_class_mapping = kern_right_class_mapping,
+    .left_class_cnt      = 60,
+    .right_class_cnt     = 48,
+};
+
+/*--------------------
+ *  ALL CUSTOM DATA
+ *--------------------*/
+
+#if LVGL_VERSION_MAJOR == 8
+/*Store all the custom data of the font*/
+static  lv_font_fmt_txt_glyph_cache_t cache;
+#endif
+
+lv_font_fmt_txt_dsc_t ui_font_montserrat_normal_100_dsc = {
+    .glyph_bitmap = NULL,        /*Bound by AssetPack::begin()*/
+    .glyph_dsc = glyph_dsc,
+    .cmaps = cmaps,
+    .kern_dsc = &kern_classes,
+    .kern_scale = 30,
+    .cmap_num = 1,
+    .bpp = 8,
+    .kern_classes = 1,
+    .bitmap_format = 0,
+#if LVGL_VERSION_MAJOR == 8
+    .cache = &cache
+#endif
+};
+
+
+
+/*-----------------
+ *  PUBLIC FONT
+ *----------------*/
+
+/*Initialize a public general font descriptor*/
+#if LVGL_VERSION_MAJOR >= 8
+const lv_font_t ui_font_montserrat_normal_100 = {
+#else
+lv_font_t ui_font_montserrat_normal_100 = {
+#endif
+    .get_glyph_dsc = AssetPack_FontGetGlyphDsc,    /*Function pointer to get glyph's data*/
+    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,    /*Function pointer to get glyph's bitmap*/
+    .line_height = 104,          /*The maximum line height required by the font*/
+    .base_line = 20,             /*Baseline measured from the bottom of the line*/
+#if !(LVGL_VERSION_MAJOR == 6 && LVGL_VERSION_MINOR == 0)
+    .subpx = LV_FONT_SUBPX_NONE,
+#endif
+#if LV_VERSION_CHECK(7, 4, 0) || LVGL_VERSION_MAJOR >= 8
+    .underline_position = -7,
+    .underline_thickness = 5,
+#endif
+    .dsc = &ui_font_montserrat_normal_100_dsc,          /*The custom font data. Will be accessed by `get_glyph_bitmap/dsc` */
+#if LV_VERSION_CHECK(8, 2, 0) || LVGL_VERSION_MAJOR >= 9
+    .fallback = &lv_font_montserrat_48,
+#endif
+    .user_data = NULL,
+};
+
+
+
+#endif /*#if UI_FONT_MONTSERRAT_NORMAL_100*/
+
+
+#endif /*USE_ASSET_PACK*/
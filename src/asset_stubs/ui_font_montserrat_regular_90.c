@@ -0,0 +1,630 @@
+/* Generated by pack_assets.py — do not edit. */
+#ifdef USE_ASSET_PACK
+
+/*******************************************************************************
+ * Size: 90 px
+ * Bpp: 8
+ * Opts: --bpp 8 --size 90 --no-compress --font fonts/Montserrat-Regular.ttf --range 32-127 --format lvgl
+ ******************************************************************************/
+
+#ifdef __has_include
+    #if __has_include("lvgl.h")
+        #ifndef LV_LVGL_H_INCLUDE_SIMPLE
+            #define LV_LVGL_H_INCLUDE_SIMPLE
+        #endif
+    #endif
+#endif
+
+#ifdef LV_LVGL_H_INCLUDE_SIMPLE
+    #include "lvgl.h"
+#else
+    #include "lvgl.h"
+#endif
+#include "../asset_pack_format.h"
+
+#ifndef UI_FONT_MONTSERRAT_REGULAR_90
+#define UI_FONT_MONTSERRAT_REGULAR_90 1
+#endif
+
+#if UI_FONT_MONTSERRAT_REGULAR_90
+
+/*-----------------
+ *    BITMAPS
+ *----------------*/
+
+
+
+
+/*---------------------
+ *  GLYPH DESCRIPTION
+ *--------------------*/
+
+static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
+    {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
+    {.bitmap_index = 0, .adv_w = 377, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 0, .adv_w = 374, .box_w = 11, .box_h = 63, .ofs_x = 6, .ofs_y = 0},
+    {.bitmap_index = 693, .adv_w = 537, .box_w = 22, .box_h = 24, .ofs_x = 6, .ofs_y = 39},
+    {.bitmap_index = 1221, .adv_w = 1002, .box_w = 58, .box_h = 63, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 4875, .adv_w = 886, .box_w = 48, .box_h = 86, .ofs_x = 4, .ofs_y = -11},
+    {.bitmap_index = 9003, .adv_w = 1194, .box_w = 68, .box_h = 64, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 13355, .adv_w = 963, .box_w = 56, .box_h = 65, .ofs_x = 4, .ofs_y = -1},
+    {.bitmap_index = 16995, .adv_w = 291, .box_w = 6, .box_h = 24, .ofs_x = 6, .ofs_y = 39},
+    {.bitmap_index = 17139, .adv_w = 474, .box_w = 17, .box_h = 85, .ofs_x = 9, .ofs_y = -18},
+    {.bitmap_index = 18584, .adv_w = 474, .box_w = 18, .box_h = 85, .ofs_x = 3, .ofs_y = -18},
+    {.bitmap_index = 20114, .adv_w = 556, .box_w = 32, .box_h = 33, .ofs_x = 1, .ofs_y = 34},
+    {.bitmap_index = 21170, .adv_w = 828, .box_w = 40, .box_h = 39, .ofs_x = 6, .ofs_y = 13},
+    {.bitmap_index = 22730, .adv_w = 305, .box_w = 11, .box_h = 23, .ofs_x = 4, .ofs_y = -13},
+    {.bitmap_index = 22983, .adv_w = 550, .box_w = 24, .box_h = 6, .ofs_x = 5, .ofs_y = 22},
+    {.bitmap_index = 23127, .adv_w = 305, .box_w = 11, .box_h = 10, .ofs_x = 4, .ofs_y = 0},
+    {.bitmap_index = 23237, .adv_w = 482, .box_w = 37, .box_h = 86, .ofs_x = -3, .ofs_y = -9},
+    {.bitmap_index = 26419, .adv_w = 953, .box_w = 51, .box_h = 65, .ofs_x = 4, .ofs_y = -1},
+    {.bitmap_index = 29734, .adv_w = 520, .box_w = 23, .box_h = 63, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 31183, .adv_w = 818, .box_w = 47, .box_h = 64, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 34191, .adv_w = 812, .box_w = 47, .box_h = 64, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 37199, .adv_w = 952, .box_w = 56, .box_h = 63, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 40727, .adv_w = 815, .box_w = 47, .box_h = 64, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 43735, .adv_w = 877, .box_w = 49, .box_h = 65, .ofs_x = 4, .ofs_y = -1},
+    {.bitmap_index = 46920, .adv_w = 848, .box_w = 48, .box_h = 63, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 49944, .adv_w = 919, .box_w = 50, .box_h = 65, .ofs_x = 4, .ofs_y = -1},
+    {.bitmap_index = 53194, .adv_w = 877, .box_w = 49, .box_h = 65, .ofs_x = 2, .ofs_y = -1},
+    {.bitmap_index = 56379, .adv_w = 305, .box_w = 11, .box_h = 48, .ofs_x = 4, .ofs_y = 0},
+    {.bitmap_index = 56907, .adv_w = 305, .box_w = 11, .box_h = 61, .ofs_x = 4, .ofs_y = -13},
+    {.bitmap_index = 57578, .adv_w = 828, .box_w = 40, .box_h = 39, .ofs_x = 6, .ofs_y = 12},
+    {.bitmap_index = 59138, .adv_w = 828, .box_w = 40, .box_h = 27, .ofs_x = 6, .ofs_y = 19},
+    {.bitmap_index = 60218, .adv_w = 828, .box_w = 40, .box_h = 39, .ofs_x = 6, .ofs_y = 12},
+    {.bitmap_index = 61778, .adv_w = 816, .box_w = 44, .box_h = 64, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 64594, .adv_w = 1488, .box_w = 85, .box_h = 82, .ofs_x = 4, .ofs_y = -18},
+    {.bitmap_index = 71564, .adv_w = 1032, .box_w = 65, .box_h = 63, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 75659, .adv_w = 1086, .box_w = 53, .box_h = 63, .ofs_x = 10, .ofs_y = 0},
+    {.bitmap_index = 78998, .adv_w = 1035, .box_w = 57, .box_h = 65, .ofs_x = 4, .ofs_y = -1},
+    {.bitmap_index = 82703, .adv_w = 1189, .box_w = 60, .box_h = 63, .ofs_x = 10, .ofs_y = 0},
+    {.bitmap_index = 86483, .adv_w = 963, .box_w = 45, .box_h = 63, .ofs_x = 10, .ofs_y = 0},
+    {.bitmap_index = 89318, .adv_w = 912, .box_w = 44, .box_h = 63, .ofs_x = 10, .ofs_y = 0},
+    {.bitmap_index = 92090, .adv_w = 1113, .box_w = 58, .box_h = 65, .ofs_x = 4, .ofs_y = -1},
+    {.bitmap_index = 95860, .adv_w = 1171, .box_w = 53, .box_h = 63, .ofs_x = 10, .ofs_y = 0},
+    {.bitmap_index = 99199, .adv_w = 435, .box_w = 7, .box_h = 63, .ofs_x = 10, .ofs_y = 0},
+    {.bitmap_index = 99640, .adv_w = 721, .box_w = 37, .box_h = 64, .ofs_x = -1, .ofs_y = -1},
+    {.bitmap_index = 102008, .adv_w = 1024, .box_w = 54, .box_h = 63, .ofs_x = 10, .ofs_y = 0},
+    {.bitmap_index = 105410, .adv_w = 848, .box_w = 43, .box_h = 63, .ofs_x = 10, .ofs_y = 0},
+    {.bitmap_index = 108119, .adv_w = 1375, .box_w = 66, .box_h = 63, .ofs_x = 10, .ofs_y = 0},
+    {.bitmap_index = 112277, .adv_w = 1171, .box_w = 53, .box_h = 63, .ofs_x = 10, .ofs_y = 0},
+    {.bitmap_index = 115616, .adv_w = 1208, .box_w = 67, .box_h = 65, .ofs_x = 4, .ofs_y = -1},
+    {.bitmap_index = 119971, .adv_w = 1034, .box_w = 50, .box_h = 63, .ofs_x = 10, .ofs_y = 0},
+    {.bitmap_index = 123121, .adv_w = 1208, .box_w = 70, .box_h = 76, .ofs_x = 4, .ofs_y = -12},
+    {.bitmap_index = 128441, .adv_w = 1041, .box_w = 51, .box_h = 63, .ofs_x = 10, .ofs_y = 0},
+    {.bitmap_index = 131654, .adv_w = 886, .box_w = 48, .box_h = 65, .ofs_x = 4, .ofs_y = -1},
+    {.bitmap_index = 134774, .adv_w = 827, .box_w = 52, .box_h = 63, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 138050, .adv_w = 1140, .box_w = 53, .box_h = 64, .ofs_x = 9, .ofs_y = -1},
+    {.bitmap_index = 141442, .adv_w = 1005, .box_w = 63, .box_h = 63, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 145411, .adv_w = 1600, .box_w = 94, .box_h = 63, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 151333, .adv_w = 945, .box_w = 57, .box_h = 63, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 154924, .adv_w = 914, .box_w = 58, .box_h = 63, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 158578, .adv_w = 937, .box_w = 52, .box_h = 63, .ofs_x = 4, .ofs_y = 0},
+    {.bitmap_index = 161854, .adv_w = 458, .box_w = 17, .box_h = 85, .ofs_x = 10, .ofs_y = -18},
+    {.bitmap_index = 163299, .adv_w = 482, .box_w = 37, .box_h = 86, .ofs_x = -4, .ofs_y = -9},
+    {.bitmap_index = 166481, .adv_w = 458, .box_w = 18, .box_h = 85, .ofs_x = 1, .ofs_y = -18},
+    {.bitmap_index = 168011, .adv_w = 829, .box_w = 38, .box_h = 38, .ofs_x = 7, .ofs_y = 13},
+    {.bitmap_index = 169455, .adv_w = 720, .box_w = 45, .box_h = 5, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 169680, .adv_w = 864, .box_w = 22, .box_h = 11, .ofs_x = 11, .ofs_y = 55},
+    {.bitmap_index = 169922, .adv_w = 850, .box_w = 41, .box_h = 48, .ofs_x = 4, .ofs_y = 0},
+    {.bitmap_index = 171890, .adv_w = 976, .box_w = 49, .box_h = 67, .ofs_x = 8, .ofs_y = 0},
+    {.bitmap_index = 175173, .adv_w = 811, .box_w = 44, .box_h = 48, .ofs_x = 4, .ofs_y = 0},
+    {.bitmap_index = 177285, .adv_w = 976, .box_w = 49, .box_h = 67, .ofs_x = 4, .ofs_y = 0},
+    {.bitmap_index = 180568, .adv_w = 870, .box_w = 47, .box_h = 48, .ofs_x = 4, .ofs_y = 0},
+    {.bitmap_index = 182824, .adv_w = 488, .box_w = 33, .box_h = 67, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 185035, .adv_w = 988, .box_w = 49, .box_h = 66, .ofs_x = 4, .ofs_y = -18},
+    {.bitmap_index = 188269, .adv_w = 975, .box_w = 45, .box_h = 67, .ofs_x = 8, .ofs_y = 0},
+    {.bitmap_index = 191284, .adv_w = 387, .box_w = 10, .box_h = 67, .ofs_x = 7, .ofs_y = 0},
+    {.bitmap_index = 191954, .adv_w = 395, .box_w = 27, .box_h = 85, .ofs_x = -9, .ofs_y = -18},
+    {.bitmap_index = 194249, .adv_w = 865, .box_w = 46, .box_h = 67, .ofs_x = 8, .ofs_y = 0},
+    {.bitmap_index = 197331, .adv_w = 387, .box_w = 8, .box_h = 67, .ofs_x = 8, .ofs_y = 0},
+    {.bitmap_index = 197867, .adv_w = 1528, .box_w = 80, .box_h = 48, .ofs_x = 8, .ofs_y = 0},
+    {.bitmap_index = 201707, .adv_w = 975, .box_w = 45, .box_h = 48, .ofs_x = 8, .ofs_y = 0},
+    {.bitmap_index = 203867, .adv_w = 903, .box_w = 49, .box_h = 48, .ofs_x = 4, .ofs_y = 0},
+    {.bitmap_index = 206219, .adv_w = 976, .box_w = 49, .box_h = 66, .ofs_x = 8, .ofs_y = -18},
+    {.bitmap_index = 209453, .adv_w = 976, .box_w = 49, .box_h = 66, .ofs_x = 4, .ofs_y = -18},
+    {.bitmap_index = 212687, .adv_w = 577, .box_w = 25, .box_h = 48, .ofs_x = 8, .ofs_y = 0},
+    {.bitmap_index = 213887, .adv_w = 704, .box_w = 40, .box_h = 48, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 215807, .adv_w = 585, .box_w = 33, .box_h = 59, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 217754, .adv_w = 969, .box_w = 44, .box_h = 48, .ofs_x = 8, .ofs_y = 0},
+    {.bitmap_index = 219866, .adv_w = 780, .box_w = 49, .box_h = 48, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 222218, .adv_w = 1266, .box_w = 79, .box_h = 48, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 226010, .adv_w = 769, .box_w = 46, .box_h = 48, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 228218, .adv_w = 780, .box_w = 52, .box_h = 66, .ofs_x = -3, .ofs_y = -18},
+    {.bitmap_index = 231650, .adv_w = 736, .box_w = 40, .box_h = 48, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 233570, .adv_w = 481, .box_w = 24, .box_h = 85, .ofs_x = 5, .ofs_y = -18},
+    {.bitmap_index = 235610, .adv_w = 425, .box_w = 7, .box_h = 85, .ofs_x = 10, .ofs_y = -18},
+    {.bitmap_index = 236205, .adv_w = 481, .box_w = 24, .box_h = 85, .ofs_x = 1, .ofs_y = -18},
+    {.bitmap_index = 238245, .adv_w = 828, .box_w = 42, .box_h = 15, .ofs_x = 5, .ofs_y = 25}
+};
+
+/*---------------------
+ *  CHARACTER MAPPING
+ *--------------------*/
+
+
+
+/*Collect the unicode lists and glyph_id offsets*/
+static const lv_font_fmt_txt_cmap_t cmaps[] =
+{
+    {
+        .range_start = 32, .range_length = 95, .glyph_id_start = 1,
+        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
+    }
+};
+
+/*-----------------
+ *    KERNING
+ *----------------*/
+
+
+/*Map glyph_ids to kern left classes*/
+static const uint8_t kern_left_class_mapping[] =
+{
+    0, 0, 1, 2, 0, 3, 4, 5,
+    2, 6, 7, 8, 9, 10, 9, 10,
+    11, 12, 0, 13, 14, 15, 16, 17,
+    18, 19, 12, 20, 20, 0, 0, 0,
+    21, 22, 23, 24, 25, 22, 26, 27,
+    28, 29, 29, 30, 31, 32, 29, 29,
+    22, 33, 34, 35, 3, 36, 30, 37,
+    37, 38, 39, 40, 41, 42, 43, 0,
+    44, 0, 45, 46, 47, 48, 49, 50,
+    51, 45, 52, 52, 53, 48, 45, 45,
+    46, 46, 54, 55, 56, 57, 51, 58,
+    58, 59, 58, 60, 41, 0, 0, 9
+};
+
+/*Map glyph_ids to kern right classes*/
+static const uint8_t kern_right_class_mapping[] =
+{
+    0, 0, 1, 2, 0, 3, 4, 5,
+    2, 6, 7, 8, 9, 10, 9, 10,
+    11, 12, 13, 14, 15, 16, 17, 12,
+    18, 19, 20, 21, 21, 0, 0, 0,
+    22, 23, 24, 25, 23, 25, 25, 25,
+    23, 25, 25, 26, 25, 25, 25, 25,
+    23, 25, 23, 25, 3, 27, 28, 29,
+    29, 30, 31, 32, 33, 34, 35, 0,
+    36, 0, 37, 38, 39, 39, 39, 0,
+    39, 38, 40, 41, 38, 38, 42, 42,
+    39, 42, 39, 42, 43, 44, 45, 46,
+    46, 47, 46, 48, 0, 0, 35, 9
+};
+
+/*Kern values between classes*/
+static const int8_t kern_class_values[] =
+{
+    0, 2, 0, 0, 0, 0, 0, 0,
+    0, 2, 0, 0, 9, 0, 0, 0,
+    0, 7, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 2, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    2, 38, 0, 24, -21, 0, 0, 0,
+    0, -47, -51, 7, 41, 21, 15, -34,
+    7, 45, 3, 38, 9, 30, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 51, 4, -7, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, -26, 0, 0, 0, 0, 0, -17,
+    15, 17, 0, 0, -9, 0, -7, 9,
+    0, -9, 0, -9, -4, -17, 0, 0,
+    0, 0, -9, 0, 0, -12, -13, 0,
+    0, -9, 0, -17, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -9, -9, 0,
+    0, -24, 0, -102, 0, 0, -17, 0,
+    17, 26, 1, 0, -17, 9, 9, 29,
+    17, -15, 17, 0, 0, -49, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, -32, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    -9, -45, 0, -34, -7, 0, 0, 0,
+    0, 4, 37, 0, -26, -4, -2, 2,
+    0, -15, 0, 0, -5, -67, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, -68, -4, 38, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 27, 0, 9, 0, 0, -17,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 30, 4, 2, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -32, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    5, 17, 9, 26, -9, 0, 0, 17,
+    -9, -27, -119, 7, 24, 17, 3, -12,
+    0, 34, 0, 30, 0, 30, 0, -79,
+    0, -9, 26, 0, 29, -9, 17, 9,
+    0, 0, 2, -9, 0, 0, -15, 68,
+    0, 68, 0, 26, 0, 38, 10, 15,
+    0, 0, 0, -32, 0, 0, 0, 0,
+    2, -5, 0, 7, -15, -10, -17, 7,
+    0, -9, 0, 0, 0, -34, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, -55, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    2, -47, 0, -53, 0, 0, 0, 0,
+    -5, 0, 88, -9, -10, 9, 9, -11,
+    0, -10, 9, 0, 0, -44, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, -84, 0, 9, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 51, 0, 0, -32, 0, 27, 0,
+    -57, -84, -55, -17, 26, 0, 0, -58,
+    0, 13, -19, 0, -13, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 26, 26, -107, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 7, 0, 0, 0, 0, 0, 7,
+    7, -9, -17, 0, -2, -2, -9, 0,
+    0, -7, 0, 0, 0, -17, 0, -6,
+    0, -19, -17, 0, -21, -27, -27, -18,
+    0, -17, 0, -17, 0, 0, 0, 0,
+    -7, 0, 0, 9, 0, 7, -9, 0,
+    0, 0, 0, 9, -7, 0, 0, 0,
+    -7, 9, 9, -3, 0, 0, 0, -20,
+    0, -3, 0, 0, 0, 0, 0, 2,
+    0, 10, -7, 0, -9, 0, -14, 0,
+    0, -7, 0, 26, 0, 0, -9, 0,
+    0, 0, 0, 0, -3, 3, -7, -7,
+    0, -9, 0, -9, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -4, -4, 0,
+    -9, -11, 0, 0, 0, 0, 0, 3,
+    0, 0, -5, 0, -9, -9, -9, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    -5, 0, 0, 0, 0, -5, -10, 0,
+    0, -26, -7, -26, 17, 0, 0, -17,
+    9, 17, 24, 0, -21, -3, -13, 0,
+    -3, -43, 9, -7, 5, -44, 9, 0,
+    0, 2, -44, 0, -44, -6, -73, -7,
+    0, -43, 0, 17, 25, 0, 10, 0,
+    0, 0, 0, 1, 0, -13, -10, 0,
+    0, 0, 0, -9, 0, 0, 0, -9,
+    0, 0, 0, 0, 0, -4, -4, 0,
+    -4, -12, 0, 0, 0, 0, 0, 0,
+    0, -9, -9, 0, -5, -9, -8, 0,
+    0, -9, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -6, -6, 0,
+    0, -7, 0, -17, 9, 0, 0, -13,
+    4, 9, 9, 0, 0, 0, 0, 0,
+    0, -7, 0, 0, 0, 0, 0, 7,
+    0, 0, -9, 0, -9, -7, -13, 0,
+    0, 0, 0, 0, 0, 0, 8, 0,
+    -7, 0, 0, 0, 0, -8, -13, 0,
+    0, 26, -7, 2, -30, 0, 0, 24,
+    -43, -45, -37, -17, 9, 0, -8, -55,
+    -16, 0, -16, 0, -17, 13, -16, -56,
+    0, -24, 0, 0, 4, -3, 6, -7,
+    0, 9, -3, -26, -33, 0, -43, -22,
+    -18, -22, -26, -13, -24, -4, -20, -26,
+    0, 3, 0, -9, 0, 0, 0, 7,
+    0, 9, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -9, 0, -4,
+    0, -3, -9, 0, -14, -18, -18, -3,
+    0, -26, 0, 0, 0, 0, 0, 0,
+    -7, 0, 0, 0, 0, 5, -3, 0,
+    0, 9, 0, 0, 0, 0, 0, 0,
+    0, 0, 38, 0, 0, 0, 0, 0,
+    0, 7, 0, 0, 0, -9, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, -15, 0, 9, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    -7, 0, 0, 0, -20, 0, 0, 0,
+    0, -43, -26, 0, 0, 0, -13, -43,
+    0, 0, -9, 9, 0, -27, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    -16, 0, 0, -18, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, -16, 0, 0, 0, 0, 13, 0,
+    7, -17, -17, 0, -9, -9, -9, 0,
+    0, 0, 0, 0, 0, -26, 0, -9,
+    0, -13, -9, 0, -18, -21, -26, -8,
+    0, -17, 0, -26, 0, 0, 0, 0,
+    68, 0, 0, 4, 0, 0, -10, 0,
+    0, -38, 0, 0, 0, 0, 0, -79,
+    -13, 29, 26, -6, -35, 0, 9, -13,
+    0, -43, -4, -12, 9, -60, -9, 8,
+    0, 13, -30, -13, -31, -27, -35, 0,
+    0, -51, 0, 49, 0, 0, -4, 0,
+    0, 0, -4, -4, -9, -22, -27, -1,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 2, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -9, 0, -4, -9, -13, 0,
+    0, -17, 0, -9, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -3, 0, -17, 0, 0, 17,
+    -2, 12, 0, -20, 9, -7, -3, -26,
+    -9, 0, -12, -9, -5, 0, -13, -15,
+    0, 0, -8, -2, -7, -15, -13, 0,
+    0, -9, 0, 9, -7, 0, -20, 0,
+    0, 0, -17, 0, -15, 0, -15, -15,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    -17, 9, 0, -14, 0, -7, -13, -32,
+    -7, -7, -7, -3, -7, -13, -3, 0,
+    0, 0, 0, 0, -9, -8, -8, 0,
+    0, 0, 0, 13, -7, 0, -7, 0,
+    0, 0, -7, -13, -7, -9, -13, -9,
+    4, 34, -3, 0, -26, 0, -7, 17,
+    0, -9, -37, -12, 13, -1, 0, -43,
+    -15, 9, -15, 5, 0, -10, -8, -28,
+    0, -13, 4, 0, 0, -15, 0, 0,
+    0, 9, 9, -17, -18, 0, -15, -9,
+    -13, -9, -9, 0, -15, 4, -18, -15,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 9, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, -15, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -7, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, -8, -9, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, -13,
+    0, 0, -12, 0, 0, -9, -9, 0,
+    0, 0, 0, -9, 0, 0, 0, 0,
+    -4, 0, 0, 0, 0, 0, -7, 0,
+    0, 0, -13, 0, -17, 0, 0, 0,
+    -27, 0, 7, -18, 17, 1, -7, -41,
+    0, 0, -18, -9, 0, -34, -21, -23,
+    0, 0, -34, -9, -34, -32, -40, 0,
+    -26, 0, 4, 58, -12, 0, -20, -9,
+    -3, -9, -15, -24, -16, -31, -33, -19,
+    0, 0, -7, 0, 2, 0, 0, -60,
+    -11, 26, 21, -21, -32, 0, 2, -32,
+    0, -43, -7, -9, 17, -81, -12, 2,
+    0, 0, -55, -11, -45, -9, -63, 0,
+    0, -60, 0, 54, 2, 0, -7, 0,
+    0, 0, 0, -4, -7, -33, -7, 0,
+    0, 0, 0, 0, -28, 0, -9, 0,
+    -2, -25, -41, 0, 0, -4, -13, -26,
+    -9, 0, -5, 0, 0, 0, 0, -38,
+    -9, -29, -28, -4, -14, -21, -9, -15,
+    0, -17, -9, -27, -13, 0, -11, -20,
+    -9, -20, 0, 4, 0, -7, -29, 0,
+    0, -16, 0, 0, 0, 0, 13, 0,
+    7, -17, 32, 0, -9, -9, -9, 0,
+    0, 0, 0, 0, 0, -26, 0, -9,
+    0, -13, -9, 0, -18, -21, -26, -8,
+    0, -17, 4, 34, 0, 0, 0, 0,
+    68, 0, 0, 4, 0, 0, -10, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    -1, 0, 0, 0, 0, 0, -7, -17,
+    0, 0, 0, 0, 0, -4, 0, 0,
+    0, -9, -9, 0, 0, -17, -9, 0,
+    0, -17, 0, 15, -4, 0, 0, 0,
+    0, 0, 0, 4, 0, 0, 0, 0,
+    17, 4, -9, 0, -30, -16, 0, 26,
+    -27, -26, -17, -17, 34, 13, 9, -75,
+    -5, 17, -9, 0, -9, 6, -9, -30,
+    0, -9, 9, -12, -4, -26, -4, 0,
+    0, 26, 17, 0, -25, 0, -47, -12,
+    19, -12, -33, 2, -12, -29, -29, -9,
+    9, 0, -13, 0, -24, 0, 4, 29,
+    -19, -31, -34, -21, 26, 0, 2, -61,
+    -6, 9, -14, -5, -19, 0, -18, -31,
+    -13, -13, -4, 0, 0, -19, -16, -9,
+    0, 26, 19, -9, -47, 0, -47, -15,
+    0, -30, -49, -2, -26, -14, -29, -23,
+    0, 0, -12, 0, -17, -9, 0, -9,
+    -15, 0, 15, -27, 9, 0, 0, -44,
+    0, -9, -18, -14, -5, -26, -21, -27,
+    -20, 0, -26, -9, -19, -20, -26, -9,
+    0, 0, 2, 41, -14, 0, -26, -9,
+    0, -9, -17, -19, -22, -21, -30, -10,
+    17, 0, -13, 0, -43, -13, 3, 17,
+    -26, -31, -17, -27, 27, -9, 4, -79,
+    -15, 17, -18, -14, -31, 0, -26, -35,
+    -13, -9, -4, -9, -16, -26, -2, 0,
+    0, 26, 21, -7, -55, 0, -51, -25,
+    17, -33, -57, -17, -30, -35, -43, -27,
+    0, 0, 0, 0, -13, 0, 0, 9,
+    -13, 17, 7, -18, 17, 0, 0, -32,
+    -3, 0, -3, 0, 2, 2, -8, 0,
+    0, 0, 0, 0, 0, -9, 0, 0,
+    0, 0, 4, 26, 1, 0, -13, 0,
+    0, 0, 0, -7, -7, -13, 0, 0,
+    2, 4, 0, 0, 0, 0, 4, 0,
+    -9, 0, 30, 0, 13, 2, 2, -10,
+    0, 17, 0, 0, 0, 4, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 26, 0, 21, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, -51, 0, -9, 15, 0, 26, 0,
+    0, 88, 13, -17, -17, 9, 9, -7,
+    2, -43, 0, 0, 38, -51, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, -55, 30, 119, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -16, 0, 0, -20, -9, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, -7, 0, -24, 0, 0, 2, 0,
+    0, 9, 113, -17, -8, 30, 24, -24,
+    9, 0, 0, 9, 9, -9, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, -111, 21, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -25, 0, 0, 0, -24,
+    0, 0, 0, 0, -20, -4, 0, 0,
+    0, -20, 0, -13, 0, -41, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, -58, 0, 0, 0, 0, 2, 0,
+    0, 0, 0, 0, 0, -9, 0, 0,
+    0, -13, 0, -24, 0, 0, 0, -15,
+    9, -13, 0, 0, -24, -9, -20, 0,
+    0, -24, 0, -9, 0, -41, 0, -6,
+    0, 0, -72, -20, -34, -6, -29, 0,
+    0, -58, 0, -24, -3, 0, 0, 0,
+    0, 0, 0, 0, 0, -13, -16, -8,
+    0, 0, 0, 0, -21, 0, -18, 10,
+    -6, 17, 0, -7, -20, -7, -15, -20,
+    0, -13, -4, -7, 5, -24, -2, 0,
+    0, 0, -81, -4, -9, 0, -13, 0,
+    -7, -41, -9, 0, 0, -7, -8, 0,
+    0, 0, 0, 5, 0, -7, -15, -7,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 2, 0, 0, 0, 0,
+    0, -21, 0, -7, 0, 0, 0, -17,
+    9, 0, 0, 0, -24, -9, -17, 0,
+    0, -25, 0, -9, 0, -41, 0, 0,
+    0, 0, -84, 0, -17, -31, -43, 0,
+    0, -58, 0, -5, -13, 0, 0, 0,
+    0, 0, 0, 0, 0, -9, -13, -4,
+    2, 0, 0, 15, -10, 0, 23, 45,
+    -9, -9, -26, 13, 45, 15, 21, -24,
+    13, 38, 13, 26, 21, 24, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 55, 41, -13, -9, 0, -8, 68,
+    36, 68, 0, 0, 0, 9, 0, 0,
+    0, 0, -16, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -7, 0, 0, 0,
+    0, 0, 0, 0, 0, 9, 0, 0,
+    0, 0, -79, -13, -4, -38, -45, 0,
+    0, -58, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -16, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -7, 0, 0, 0,
+    0, 0, 0, 0, 0, 9, 0, 0,
+    0, 0, -79, -13, -4, -38, -45, 0,
+    0, -43, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -4, 0, 0, 0,
+    -19, 9, 0, -9, 4, 13, 9, -26,
+    0, -4, -6, 9, 0, 4, 0, 0,
+    0, 0, -26, 0, -9, -7, -17, 0,
+    -9, -34, 0, 55, -9, 0, -18, -7,
+    0, -7, -14, 0, -9, -23, -17, -9,
+    0, 0, -16, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -7, 0, 0, 0,
+    0, 0, 0, 0, 0, 9, 0, 0,
+    0, 0, -79, -13, -4, -38, -45, 0,
+    0, -58, 0, 0, 0, 0, 0, 0,
+    43, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -16, 0, -30, -13, -9, 26,
+    -9, -9, -34, 2, -9, 2, -7, -26,
+    1, 18, 1, 4, 2, 4, -22, -32,
+    -13, 0, -38, -20, -24, -37, -35, 0,
+    -16, -17, -13, -10, -8, -7, -11, -7,
+    0, -7, -3, 13, 0, 13, -7, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -7, -9, -9, 0,
+    0, -24, 0, -4, 0, -15, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, -51, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -9, -9, 0,
+    0, 0, 0, 0, -8, 0, 0, -15,
+    -9, 9, 0, -15, -18, -7, 0, -28,
+    -7, -21, -5, -13, 0, -15, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, -58, 0, 30, 0, 0, -16, 0,
+    0, 0, 0, -12, 0, -9, 0, 0,
+    0, 0, -7, 0, -19, 0, 0, 38,
+    -10, -29, -25, 7, 6, 6, -4, -21,
+    7, 13, 7, 26, 7, 27, -7, -22,
+    0, 0, -43, 0, 0, -26, -24, 0,
+    0, -17, 0, -10, -14, 0, -13, 0,
+    -13, 0, -5, 13, 0, -4, -26, -9,
+    0, 0, -9, 0, -17, 0, 0, 10,
+    -19, 0, 9, -9, 4, -3, 0, -27,
+    0, -7, -2, 0, -9, 6, -4, 0,
+    0, 0, -42, -13, -18, 0, -26, 0,
+    0, -41, 0, 32, -9, 0, -16, 0,
+    -2, 0, -9, 0, -9, -26, 0, -9,
+    0, 0, 0, 0, -7, 0, 0, 9,
+    -12, 2, 0, 0, -13, -7, 0, -13,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, -55, 0, 21, 0, 0, -8, 0,
+    0, 0, 0, 1, 0, -9, -9, 0
+};
+
+
+/*Collect the kern class' data in one place*/
+static const lv_font_fmt_txt_kern_classes_t kern_classes =
+{
+    .class_pair_values   = kern_class_values,
+    .left_class_mapping  = kern_left_class_mapping,
+    .right_class_mapping = kern_right_class_mapping,
+    .left_class_cnt      = 60,
+    .right_class_cnt     = 48,
+};
+
+/*--------------------
+ *  ALL CUSTOM DATA
+ *--------------------*/
+
+#if LVGL_VERSION_MAJOR == 8
+/*Store all the custom data of the font*/
+static  lv_font_fmt_txt_glyph_cache_t cache;
+#endif
+
+lv_font_fmt_txt_dsc_t ui_font_montserrat_regular_90_dsc = {
+    .glyph_bitmap = NULL,        /*Bound by AssetPack::begin()*/
+    .glyph_dsc = glyph_dsc,
+    .cmaps = cmaps,
+    .kern_dsc = &kern_classes,
+    .kern_scale = 27,
+    .cmap_num = 1,
+    .bpp = 8,
+    .kern_classes = 1,
+    .bitmap_format = 0,
+#if LVGL_VERSION_MAJOR == 8
+    .cache = &cache
+#endif
+};
+
+
+
+/*-----------------
+ *  PUBLIC FONT
+ *----------------*/
+
+/*Initialize a public general font descriptor*/
+#if LVGL_VERSION_MAJOR >= 8
+const lv_font_t ui_font_montserrat_regular_90 = {
+#else
+lv_font_t ui_font_montserrat_regular_90 = {
+#endif
+    .get_glyph_dsc = AssetPack_FontGetGlyphDsc,    /*Function pointer to get glyph's data*/
+    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,    /*Function pointer to get glyph's bitmap*/
+    .line_height = 95,          /*The maximum line height required by the font*/
+    .base_line = 18,             /*Baseline measured from the bottom of the line*/
+#if !(LVGL_VERSION_MAJOR == 6 && LVGL_VERSION_MINOR == 0)
+    .subpx = LV_FONT_SUBPX_NONE,
+#endif
+#if LV_VERSION_CHECK(7, 4, 0) || LVGL_VERSION_MAJOR >= 8
+    .underline_position = -7,
+    .underline_thickness = 5,
+#endif
+    .dsc = &ui_font_montserrat_regular_90_dsc,          /*The custom font data. Will be accessed by `get_glyph_bitmap/dsc` */
+#if LV_VERSION_CHECK(8, 2, 0) || LVGL_VERSION_MAJOR >= 9
+    .fallback = &lv_font_montserrat_48,
+#endif
+    .user_data = NULL,
+};
+
+
+
+#endif /*#if UI_FONT_MONTSERRAT_REGULAR_90*/
+
+
+#endif /*USE_ASSET_PACK*/
@@ -0,0 +1,233 @@
+#include "audio_mixer.h"
+#include "esp_cpu.h"
+
+static inline int16_t clamp16(int32_t v) {
+  return v > INT16_MAX ? INT16_MAX : (v < INT16_MIN ? INT16_MIN : (int16_t)v);
+}
+
+bool AudioMixer::play(const int16_t *pcm, uint32_t frames, uint8_t channels, uint32_t sampleRate,
+                      AudioPriority priority, uint16_t gain) {
+  if (!pcm || frames == 0 || channels < 1 || channels > 2 || sampleRate == 0) return false;
+
+  taskENTER_CRITICAL(&lock);
+  int slot = -1;
+  for (int i = 0; i < AUDIO_MIXER_VOICES && slot < 0; i++) {
+    if (voices[i].pcm == pcm) slot = i;
+  }
+  for (int i = 0; i < AUDIO_MIXER_VOICES && slot < 0; i++) {
+    if (!voices[i].pcm) slot = i;
+  }
+  if (slot < 0) {
+    for (int i = 0; i < AUDIO_MIXER_VOICES; i++) {
+      const Voice &v = voices[i];
+      if (v.priority > priority) continue;
+      if (slot < 0 || v.priority < voices[slot].priority ||
+          (v.priority == voices[slot].priority && (int32_t)(v.serial - voices[slot].serial) < 0)) {
+        slot = i;
+      }
+    }
+    if (slot < 0) {
+      rejected++;
+      taskEXIT_CRITICAL(&lock);
+      return false;
+    }
+    if (voices[slot].pcm != pcm) stolen++;
+  }
+
+  Voice &v = voices[slot];
+  uint32_t generation = v.generation + 1;
+  v = {};
+  v.pcm = pcm;
+  v.frames = frames;
+  v.sampleRate = sampleRate;
+  v.serial = nextSerial++;
+  v.generation = generation;
+  v.gain = gain;
+  v.level = gain;               // no fade-in: keep the attack of short sounds
+  v.channels = channels;
+  v.priority = priority;
+
+  uint8_t count = 0;
+  for (int i = 0; i < AUDIO_MIXER_VOICES; i++) count += voices[i].pcm != nullptr;
+  voiceCount = count;
+  if (count > peakVoices) peakVoices = count;
+  started++;
+  taskEXIT_CRITICAL(&lock);
+  return true;
+}
+
+void AudioMixer::stop(const int16_t *pcm) {
+  taskENTER_CRITICAL(&lock);
+  uint8_t count = 0;
+  for (int i = 0; i < AUDIO_MIXER_VOICES; i++) {
+    if (voices[i].pcm && (pcm == nullptr || voices[i].pcm == pcm)) {
+      voices[i].pcm = nullptr;
+      voices[i].generation++;
+    }
+    count += voices[i].pcm != nullptr;
+  }
+  voiceCount = count;
+  taskEXIT_CRITICAL(&lock);
+}
+
+bool AudioMixer::isPlaying(const int16_t *pcm) {
+  bool playing = false;
+  taskENTER_CRITICAL(&lock);
+  for (int i = 0; i < AUDIO_MIXER_VOICES; i++) {
+    if (pcm == nullptr) {
+      playing |= voices[i].pcm != nullptr || inFlight[i] != nullptr;
+    } else {
+      playing |= voices[i].pcm == pcm || inFlight[i] == pcm;
+    }
+  }
+  taskEXIT_CRITICAL(&lock);
+  return playing;
+}
+
+uint32_t AudioMixer::preferredRate() {
+  uint32_t rate = AUDIO_MIXER_DEFAULT_RATE;
+  int top = -1;
+  taskENTER_CRITICAL(&lock);
+  for (int i = 0; i < AUDIO_MIXER_VOICES; i++) {
+    if (voices[i].pcm && voices[i].priority > top) {
+      top = voices[i].priority;
+      rate = voices[i].sampleRate;
+    }
+  }
+  taskEXIT_CRITICAL(&lock);
+  return rate;
+}
+
+uint16_t AudioMixer::rampToward(uint16_t level, uint16_t target) {
+  if (level < target) return target - level > AUDIO_MIXER_RAMP_STEP ? level + AUDIO_MIXER_RAMP_STEP : target;
+  return level - target > AUDIO_MIXER_RAMP_STEP ? level - AUDIO_MIXER_RAMP_STEP : target;
+}
+
+// Adds one block of `voice` to mix[], resampling with linear interpolation
+// when its rate differs from the output.  Clears voice.pcm when it ends.
+void AudioMixer::mixVoice(Voice &voice, uint16_t target, uint32_t outRate) {
+  const int32_t from = voice.level;
+  const int32_t delta = (int32_t)rampToward(voice.level, target) - from;
+  const uint32_t step = (uint32_t)(((uint64_t)voice.sampleRate << 16) / outRate);
+  const uint8_t ch = voice.channels;
+  const uint32_t last = voice.frames - 1;
+  const int16_t *pcm = voice.pcm;
+  uint32_t pos = voice.pos;
+  uint32_t phase = voice.phase;
+  int32_t *out = mix;
+
+  for (int32_t i = 0; i < AUDIO_MIXER_BLOCK_FRAMES; i++) {
+    const int32_t gain = from + ((delta * i) >> AUDIO_MIXER_BLOCK_SHIFT);
+    const int16_t *f = pcm + pos * ch;
+    int32_t l = f[0];
+    int32_t r = f[ch - 1];
+    if (phase != 0 && pos < last) {
+      const int16_t *n = f + ch;
+      const int32_t frac = phase >> 2;   // Q14 keeps the product in 32 bits
+      l += ((n[0] - l) * frac) >> 14;
+      r += ((n[ch - 1] - r) * frac) >> 14;
+    }
+    out[0] += (l * gain) >> 15;
+    out[1] += (r * gain) >> 15;
+    out += 2;
+
+    phase += step;
+    pos += phase >> 16;
+    phase &= 0xffff;
+    if (pos > last) {
+      pcm = nullptr;
+      break;
+    }
+  }
+
+  voice.pcm = pcm;
+  voice.pos = pos;
+  voice.phase = phase;
+  voice.level = from + delta;
+}
+
+void AudioMixer::render(uint32_t outRate) {
+  uint32_t startCycles = esp_cpu_get_cycle_count();
+  Voice snapshot[AUDIO_MIXER_VOICES];
+
+  // Work on a copy so play()/stop() never wait for a block to render;
+  // inFlight[] keeps the buffers alive for isPlaying() meanwhile.
+  taskENTER_CRITICAL(&lock);
+  memcpy(snapshot, voices, sizeof(snapshot));
+  for (int i = 0; i < AUDIO_MIXER_VOICES; i++) inFlight[i] = voices[i].pcm;
+  taskEXIT_CRITICAL(&lock);
+
+  int top = -1;
+  for (int i = 0; i < AUDIO_MIXER_VOICES; i++) {
+    if (snapshot[i].pcm && snapshot[i].priority >= AUDIO_MIXER_DUCK_FROM && snapshot[i].priority > top) {
+      top = snapshot[i].priority;
+    }
+  }
+
+  memset(mix, 0, sizeof(mix));
+  for (int i = 0; i < AUDIO_MIXER_VOICES; i++) {
+    Voice &v = snapshot[i];
+    if (!v.pcm) continue;
+    uint16_t target = v.priority < top ? (uint16_t)(((uint32_t)v.gain * AUDIO_MIXER_DUCK_GAIN) >> 15) : v.gain;
+    mixVoice(v, target, outRate);
+  }
+  for (int i = 0; i < AUDIO_MIXER_BLOCK_FRAMES * 2; i++) block[i] = clamp16(mix[i]);
+
+  streamFrom = streamTo;
+  streamTo = rampToward(streamTo, top >= 0 ? AUDIO_MIXER_DUCK_GAIN : AUDIO_MIXER_UNITY);
+
+  taskENTER_CRITICAL(&lock);
+  uint8_t count = 0;
+  for (int i = 0; i < AUDIO_MIXER_VOICES; i++) {
+    Voice &v = voices[i];
+    if (v.pcm && v.generation == snapshot[i].generation) {
+      v.pcm = snapshot[i].pcm;
+      v.pos = snapshot[i].pos;
+      v.phase = snapshot[i].phase;
+      v.level = snapshot[i].level;
+    }
+    inFlight[i] = nullptr;
+    count += v.pcm != nullptr;
+  }
+  voiceCount = count;
+  taskEXIT_CRITICAL(&lock);
+
+  renderCycles += esp_cpu_get_cycle_count() - startCycles;
+  renderedFrames += AUDIO_MIXER_BLOCK_FRAMES;
+}
+
+void AudioMixer::mixFrame(int16_t sample[2], uint32_t outRate) {
+  if (blockPos >= AUDIO_MIXER_BLOCK_FRAMES) {
+    // Nothing left to add and the stream is back at full level.
+    if (!voiceCount && streamTo == AUDIO_MIXER_UNITY && streamFrom == AUDIO_MIXER_UNITY) return;
+    render(outRate ? outRate : AUDIO_MIXER_DEFAULT_RATE);
+    blockPos = 0;
+  }
+
+  const int32_t gain = streamFrom + ((((int32_t)streamTo - streamFrom) * (int32_t)blockPos) >> AUDIO_MIXER_BLOCK_SHIFT);
+  sample[0] = clamp16(((sample[0] * gain) >> 15) + block[blockPos * 2]);
+  sample[1] = clamp16(((sample[1] * gain) >> 15) + block[blockPos * 2 + 1]);
+  blockPos++;
+}
+
+void AudioMixer::logStats() {
+  if (started || renderedFrames) {
+    // Cycles per output frame hardly depend on the clock, so the load is
+    // projected for both PM operating points at 44.1kHz.
+    uint32_t cycles = renderedFrames ? (uint32_t)(renderCycles / renderedFrames) : 0;
+    uint32_t load240 = cycles * AUDIO_MIXER_DEFAULT_RATE / 240000;   // per mille
+    uint32_t load80 = cycles * AUDIO_MIXER_DEFAULT_RATE / 80000;
+    Serial.printf("[Mixer] started=%lu stolen=%lu rejected=%lu peak=%u cycles/frame=%lu cpu@240=%lu.%lu%% cpu@80=%lu.%lu%% busy=%lums\n",
+                  (unsigned long)started, (unsigned long)stolen, (unsigned long)rejected, peakVoices,
+                  (unsigned long)cycles,
+                  (unsigned long)(load240 / 10), (unsigned long)(load240 % 10),
+                  (unsigned long)(load80 / 10), (unsigned long)(load80 % 10),
+                  (unsigned long)(renderedFrames * 1000ULL / AUDIO_MIXER_DEFAULT_RATE));
+  }
+  renderCycles = 0;
+  renderedFrames = 0;
+  started = 0;
+  stolen = 0;
+  rejected = 0;
+  peakVoices = voiceCount;
+}
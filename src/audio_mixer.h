@@ -0,0 +1,117 @@
+#pragma once
+
+#ifndef AUDIO_MIXER_H
+#define AUDIO_MIXER_H
+
+#include <Arduino.h>
+
+// Fixed-point mixer for resident PCM voices (alarm/timer tones, UI sounds).
+//
+// Voices are rendered in blocks on the audio pump and added to every frame
+// the Audio library writes (audio_mix_sample hook), so they play over a media
+// stream, or over silence written by the pump when nothing is streaming.
+// Gains are Q15.  While an alert-level voice plays, the stream and any
+// lower-priority voices are ducked; a full mixer steals the oldest voice of
+// the lowest priority that does not outrank the newcomer.
+#define AUDIO_MIXER_VOICES        4
+#define AUDIO_MIXER_BLOCK_SHIFT   7
+#define AUDIO_MIXER_BLOCK_FRAMES  (1 << AUDIO_MIXER_BLOCK_SHIFT)   // 2.9ms at 44.1kHz
+#define AUDIO_MIXER_UNITY         32768                            // Q15 1.0
+#define AUDIO_MIXER_DUCK_GAIN     (AUDIO_MIXER_UNITY / 4)          // -12dB
+#define AUDIO_MIXER_RAMP_STEP     4096                             // Q15 per block, ~23ms full swing
+#define AUDIO_MIXER_DEFAULT_RATE  44100
+
+enum AudioPriority {
+  AUDIO_PRIORITY_UI = 0,
+  AUDIO_PRIORITY_TIMER,
+  AUDIO_PRIORITY_ALARM
+};
+
+// Voices at or above this priority duck everything below them.
+#define AUDIO_MIXER_DUCK_FROM     AUDIO_PRIORITY_TIMER
+
+class AudioMixer {
+  public:
+    // Starts `pcm` (16-bit, 1 or 2 channels, interleaved).  Restarts the voice
+    // if the buffer is already playing.  False if every voice outranks it.
+    bool play(const int16_t *pcm, uint32_t frames, uint8_t channels, uint32_t sampleRate,
+              AudioPriority priority, uint16_t gain = AUDIO_MIXER_UNITY);
+    void stop(const int16_t *pcm);   // NULL: all voices
+
+    bool isActive() { return voiceCount != 0; }
+    // True until the pump no longer reads the buffer (NULL: any voice).
+    bool isPlaying(const int16_t *pcm);
+    // I2S rate to use when no stream sets one: that of the top voice.
+    uint32_t preferredRate();
+
+    // Audio pump only: mixes the voices into one output frame.
+    void mixFrame(int16_t sample[2], uint32_t outRate);
+    // Audio pump only: one pass over `stream` (the Audio library, or anything
+    // with its calls).  A running stream is decoded and the voices ride along;
+    // otherwise they are written over `frames` of `silence` at their own rate.
+    // The decoder programs I2S once per stream, so the format the voices
+    // displaced from a paused stream is put back before it plays on.
+    template <class Stream> void pump(Stream &stream, const int16_t *silence, uint32_t frames);
+
+    void logStats();
+
+  private:
+    struct Voice {
+      const int16_t *pcm;        // NULL: free
+      uint32_t frames;
+      uint32_t pos;
+      uint32_t phase;            // Q16 fraction of a source frame
+      uint32_t sampleRate;
+      uint32_t serial;           // start order, for stealing
+      uint32_t generation;
+      uint16_t gain;
+      uint16_t level;            // current gain after ducking/ramps
+      uint8_t channels;
+      uint8_t priority;
+    };
+
+    void render(uint32_t outRate);
+    void mixVoice(Voice &voice, uint16_t target, uint32_t outRate);
+    static uint16_t rampToward(uint16_t level, uint16_t target);
+
+    portMUX_TYPE lock = portMUX_INITIALIZER_UNLOCKED;   // guards voices[] and inFlight[]
+    Voice voices[AUDIO_MIXER_VOICES] = {};
+    const int16_t *inFlight[AUDIO_MIXER_VOICES] = {};   // buffers being rendered
+    volatile uint8_t voiceCount = 0;
+    uint32_t nextSerial = 0;
+
+    // Pump-side state.
+    int32_t mix[AUDIO_MIXER_BLOCK_FRAMES * 2];
+    int16_t block[AUDIO_MIXER_BLOCK_FRAMES * 2];
+    uint32_t blockPos = AUDIO_MIXER_BLOCK_FRAMES;
+    uint16_t streamFrom = AUDIO_MIXER_UNITY;
+    uint16_t streamTo = AUDIO_MIXER_UNITY;
+    uint32_t displacedRate = 0;                         // 0: the stream's format is on I2S
+    uint8_t displacedBits = 16;
+
+    uint64_t renderCycles = 0;
+    uint32_t renderedFrames = 0;
+    uint32_t started = 0;
+    uint32_t stolen = 0;
+    uint32_t rejected = 0;
+    uint8_t peakVoices = 0;
+};
+
+template <class Stream> void AudioMixer::pump(Stream &stream, const int16_t *silence, uint32_t frames) {
+  if (stream.isRunning()) {
+    if (displacedRate) {
+      stream.setSampleRate(displacedRate);
+      stream.setBitsPerSample(displacedBits);
+      displacedRate = 0;
+    }
+    stream.loop();
+    return;
+  }
+  if (!displacedRate) {
+    displacedRate = stream.getSampleRate();
+    displacedBits = stream.getBitsPerSample();
+  }
+  stream.writePCM(silence, frames, 1, preferredRate());
+}
+
+#endif /* audio_mixer.h */
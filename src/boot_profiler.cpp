@@ -0,0 +1,62 @@
+#include "boot_profiler.h"
+#include "esp_timer.h"
+
+// esp_timer counts from the start of the application, so offsets include the
+// ROM/bootloader handoff before setup() ran.
+
+void BootProfiler::mark(const char *stage) {
+  if (finished || stageCount >= BOOT_PROFILER_MAX_STAGES) return;
+  stages[stageCount++] = { stage, esp_timer_get_time() };
+}
+
+void BootProfiler::event(const char *name) {
+  Stage event = { name, esp_timer_get_time() };
+  bool report = false;
+
+  taskENTER_CRITICAL(&lock);
+  if (finished) {
+    report = true;
+  } else if (eventCount < BOOT_PROFILER_MAX_EVENTS) {
+    events[eventCount++] = event;
+  }
+  taskEXIT_CRITICAL(&lock);
+
+  if (report) printEvent(event);
+}
+
+void BootProfiler::printEvent(const Stage &event) {
+  Serial.printf("[Boot] @%5lums  %s\n", (unsigned long)(event.startUs / 1000), event.name);
+}
+
+void BootProfiler::finish() {
+  endUs = esp_timer_get_time();
+  if (stageCount == 0) return;
+
+  const int64_t originUs = stages[0].startUs;
+  const int64_t totalUs = endUs - originUs > 0 ? endUs - originUs : 1;
+
+  Serial.printf("[Boot] setup() took %lums (app start +%lums)\n",
+                (unsigned long)(totalUs / 1000), (unsigned long)(originUs / 1000));
+  for (uint8_t i = 0; i < stageCount; i++) {
+    int64_t startUs = stages[i].startUs - originUs;
+    int64_t durationUs = (i + 1 < stageCount ? stages[i + 1].startUs : endUs) - stages[i].startUs;
+
+    char bar[BOOT_PROFILER_BAR_WIDTH + 1];
+    int from = (int)(startUs * BOOT_PROFILER_BAR_WIDTH / totalUs);
+    int width = (int)(durationUs * BOOT_PROFILER_BAR_WIDTH / totalUs);
+    if (width == 0) width = 1;
+    for (int c = 0; c < BOOT_PROFILER_BAR_WIDTH; c++) {
+      bar[c] = c >= from && c < from + width ? '#' : '.';
+    }
+    bar[BOOT_PROFILER_BAR_WIDTH] = '\0';
+
+    Serial.printf("[Boot] %-14s %5lums %5lums |%s|\n", stages[i].name,
+                  (unsigned long)(startUs / 1000), (unsigned long)(durationUs / 1000), bar);
+  }
+
+  taskENTER_CRITICAL(&lock);
+  finished = true;
+  uint8_t count = eventCount;
+  taskEXIT_CRITICAL(&lock);
+  for (uint8_t i = 0; i < count; i++) printEvent(events[i]);
+}
@@ -0,0 +1,41 @@
+#pragma once
+
+#ifndef BOOT_PROFILER_H
+#define BOOT_PROFILER_H
+
+#include <Arduino.h>
+
+// Timestamps the init stages of setup() and prints them as a waterfall once
+// setup() is done.  Milestones that land after setup() (first frame, WiFi
+// connected) are reported against the same boot clock as they happen.
+#define BOOT_PROFILER_MAX_STAGES  24
+#define BOOT_PROFILER_MAX_EVENTS  8
+#define BOOT_PROFILER_BAR_WIDTH   40
+
+class BootProfiler {
+  public:
+    // Ends the running stage and starts `stage` (a string literal).
+    void mark(const char *stage);
+    // One-off milestone; safe from any task.
+    void event(const char *name);
+    // Ends the last stage and prints the waterfall.
+    void finish();
+
+  private:
+    struct Stage {
+      const char *name;
+      int64_t startUs;
+    };
+
+    void printEvent(const Stage &event);
+
+    Stage stages[BOOT_PROFILER_MAX_STAGES] = {};
+    Stage events[BOOT_PROFILER_MAX_EVENTS] = {};
+    uint8_t stageCount = 0;
+    uint8_t eventCount = 0;
+    int64_t endUs = 0;
+    bool finished = false;
+    portMUX_TYPE lock = portMUX_INITIALIZER_UNLOCKED;
+};
+
+#endif /* boot_profiler.h */
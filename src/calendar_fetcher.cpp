@@ -5,12 +5,16 @@
 #include "src/vars.h"
 #include "src/screens.h"
 #include <esp_heap_caps.h> 
+#include <esp_timer.h>
 #include "wifi_client.h"
 #include "Audio_PCM5101.h"
+#include "recurrence.h"
+#include "civil_time.h"
 
 CalendarFetcher calendarFetcher;
 extern WiFi_Client wifiClient;
 extern Audio audio;
+extern TimeZone timeZone;
 
 void action_calendar_date_changed(lv_event_t* e) {
   int monthIndex = eez::flow::getGlobalVariable(FLOW_GLOBAL_VARIABLE_CALENDAR_PICKER_MONTH).getInt();
@@ -23,7 +27,7 @@ void action_calendar_date_changed(lv_event_t* e) {
 
   Serial.println("Date entered: " + String(year) + "-" + String(month) + "-" + String(day));
   calendarFetcher.setDate(year, month, day);
-  calendarFetcher.requestFetch();
+  calendarFetcher.requestDay();
 }
 
 void action_calendar_picker_update_days(lv_event_t* e) {
@@ -51,25 +55,25 @@ void action_calendar_picker_update_days(lv_event_t* e) {
 void action_calendar_prev_day(lv_event_t* e) {
   Serial.println("Previous day button pressed");
   calendarFetcher.prevDay();
-  calendarFetcher.requestFetch();
+  calendarFetcher.requestDay();
 }
 
 void action_calendar_next_day(lv_event_t* e) {
   Serial.println("Next day button pressed");
   calendarFetcher.nextDay();
-  calendarFetcher.requestFetch();
+  calendarFetcher.requestDay();
 }
 
 void action_calendar_today(lv_event_t* e) {
   Serial.println("Today button pressed");
   calendarFetcher.goToToday();
-  calendarFetcher.requestFetch();
+  calendarFetcher.requestDay();
 }
 
 void action_calendar_refresh(lv_event_t* e) {
   Serial.println("Loading calendar screen...");
   calendarFetcher.goToToday();
-  calendarFetcher.requestFetch();
+  calendarFetcher.requestDay();
 }
 
 CalendarFetcher::CalendarFetcher() {
@@ -137,16 +141,29 @@ void CalendarFetcher::updateCalendarDisplay() {
   // setDateLabel(dateStr);
 
   // Snapshot the events vector under the mutex so Core 0 can't free/modify
-  // it while we're iterating below (the LVGL calls that follow can be slow).
-  std::vector<CalendarEvent> snapshot;
+  // it while the list binds rows from it (on later scrolls too).
   xSemaphoreTake(eventsMutex, portMAX_DELAY);
-  snapshot = events;  // struct copy — char arrays copied by value
+  // A refetch that changed nothing on this day leaves the list as it is;
+  // rebinding the visible rows keeps their past/now colours current.
+  if (eventsDigest == shownDigest && currentDate == shownDate &&
+      eventList.attachedTo(objects.calender_events_container)) {
+    xSemaphoreGive(eventsMutex);
+    eventList.refresh();
+    refreshSkips++;
+    eez::flow::setGlobalVariable(FLOW_GLOBAL_VARIABLE_CALENDAR_SHOW_SPINNER,
+                                 eez::BooleanValue(false));
+    return;
+  }
+  shown = events;  // struct copy — char arrays copied by value
+  shownDigest = eventsDigest;
+  shownDate = currentDate;
   xSemaphoreGive(eventsMutex);
 
-  int eventCount = snapshot.size();
+  int eventCount = shown.size();
 
   if (eventCount == 0) {
     Serial.println("No events today");
+    if (eventList.attachedTo(objects.calender_events_container)) eventList.setCount(0);
     eez::flow::setGlobalVariable(FLOW_GLOBAL_VARIABLE_CALENDAR_NO_EVENTS_SHOWN,
                                  eez::BooleanValue(true));
   } else {
@@ -158,139 +175,29 @@ void CalendarFetcher::updateCalendarDisplay() {
     eez::flow::setGlobalVariable(FLOW_GLOBAL_VARIABLE_CALENDAR_DATE,
                                  eez::StringValue(dateStr.c_str()));
 
-    // Get the parent container where items will be added
-    // Container: calendar_events_container
-    lv_obj_t* parent_list = objects.calender_events_container;
-
-    // Clear any previous rows before rebuilding
-    lv_obj_clean(parent_list);
+    // The first in-progress or future event, for auto-scroll
+    int scrollTarget = -1;
 
-    // Track the first in-progress or future event for auto-scroll
-    lv_obj_t* scroll_target = NULL;
-
-    // Display each event
     for (int i = 0; i < eventCount; i++) {
-      CalendarEvent event = snapshot[i];
-
-      // Show time range if end time exists
-      char timeDisplay[80];
-      strncpy(timeDisplay, event.startTime, sizeof(timeDisplay) - 1);
-      timeDisplay[sizeof(timeDisplay) - 1] = '\0';
-      if (event.endTime[0] != '\0' && strcmp(event.endTime, event.startTime) != 0) {
-        strncat(timeDisplay, " - ", sizeof(timeDisplay) - strlen(timeDisplay) - 1);
-        strncat(timeDisplay, event.endTime, sizeof(timeDisplay) - strlen(timeDisplay) - 1);
-      }
+      const CalendarEvent &event = shown[i];
+      if (scrollTarget < 0 && event.endTimestamp > now) scrollTarget = i;
 
       // Debug: Show timestamp for sorting verification
       struct tm eventTimeBuf;
       struct tm* eventTime = localtime_r(&event.startTimestamp, &eventTimeBuf);
       if (eventTime != NULL) {
-        Serial.print("[");
-        Serial.print(i);
-        Serial.print("] ");
-        Serial.printf("%02d:%02d", eventTime->tm_hour, eventTime->tm_min);
-        Serial.print(" (timestamp: ");
-        Serial.print(event.startTimestamp);
-        Serial.print(") - ");
-        Serial.print(timeDisplay);
-        Serial.print(" - ");
-        Serial.println(event.title);
+        Serial.printf("[%d] %02d:%02d (timestamp: %ld) - %s - %s - %s\n", i, eventTime->tm_hour,
+                      eventTime->tm_min, (long)event.startTimestamp, event.startTime, event.endTime, event.title);
       } else {
-        Serial.print("[");
-        Serial.print(i);
-        Serial.print("] INVALID_TIME (timestamp: ");
-        Serial.print(event.startTimestamp);
-        Serial.print(") - ");
-        Serial.print(timeDisplay);
-        Serial.print(" - ");
-        Serial.println(event.title);
-      }
-
-      // Container: list row
-      lv_obj_t* list_row_container = lv_obj_create(parent_list);
-      lv_obj_set_pos(list_row_container, 0, 0);
-      lv_obj_set_size(list_row_container, 315, LV_SIZE_CONTENT);
-      lv_obj_set_style_pad_left(list_row_container, 0, LV_PART_MAIN);
-      lv_obj_set_style_pad_top(list_row_container, 0, LV_PART_MAIN);
-      lv_obj_set_style_pad_right(list_row_container, 0, LV_PART_MAIN);
-      lv_obj_set_style_pad_bottom(list_row_container, 0, LV_PART_MAIN);
-      lv_obj_set_style_bg_opa(list_row_container, 0, LV_PART_MAIN);
-      lv_obj_add_flag(list_row_container, LV_OBJ_FLAG_EVENT_BUBBLE | LV_OBJ_FLAG_CLICKABLE);
-      lv_obj_set_style_layout(list_row_container, LV_LAYOUT_FLEX, LV_PART_MAIN);
-      lv_obj_set_style_flex_flow(list_row_container, LV_FLEX_FLOW_ROW, LV_PART_MAIN);
-      lv_obj_set_style_flex_track_place(list_row_container, LV_FLEX_ALIGN_SPACE_BETWEEN, LV_PART_MAIN);
-      lv_obj_set_style_flex_cross_place(list_row_container, LV_FLEX_ALIGN_CENTER, LV_PART_MAIN);
-      lv_obj_set_style_flex_main_place(list_row_container, LV_FLEX_ALIGN_SPACE_BETWEEN, LV_PART_MAIN);
-      lv_obj_set_style_radius(list_row_container, 2, LV_PART_MAIN);
-      lv_obj_set_style_border_color(list_row_container, lv_color_hex(0xff2a2a2a), LV_PART_MAIN);
-      lv_obj_set_style_border_opa(list_row_container, 102, LV_PART_MAIN);
-      lv_obj_set_style_border_width(list_row_container, 1, LV_PART_MAIN);
-      lv_obj_set_style_border_side(list_row_container, LV_BORDER_SIDE_BOTTOM, LV_PART_MAIN);
-
-      // Color bar
-      lv_obj_t* line_obj = lv_obj_create(list_row_container);
-      lv_obj_set_pos(line_obj, 0, 0);
-      lv_obj_set_size(line_obj, 4, 32);
-
-      if (event.endTimestamp <= now) {
-        lv_obj_set_style_bg_color(line_obj, lv_color_hex(0xff888888), LV_PART_MAIN);
-      } else if (event.startTimestamp <= now && event.endTimestamp >= now) {
-        lv_obj_set_style_bg_color(line_obj, lv_color_hex(0xffff2222), LV_PART_MAIN);
-        if (scroll_target == NULL) scroll_target = list_row_container;
-      } else if (event.startTimestamp >= now) {
-        lv_obj_set_style_bg_color(line_obj, lv_color_hex(0xff1e88ff), LV_PART_MAIN);
-        if (scroll_target == NULL) scroll_target = list_row_container;
+        Serial.printf("[%d] INVALID_TIME (timestamp: %ld) - %s\n", i, (long)event.startTimestamp, event.title);
       }
-
-      lv_obj_set_style_bg_opa(line_obj, LV_OPA_COVER, LV_PART_MAIN);
-      lv_obj_set_style_radius(line_obj, 2, LV_PART_MAIN);
-      lv_obj_set_style_border_width(line_obj, 0, LV_PART_MAIN);
-      lv_obj_set_style_pad_all(line_obj, 0, LV_PART_MAIN);
-
-      // Container: event name and time
-      lv_obj_t* event_name_time_container = lv_obj_create(list_row_container);
-      lv_obj_set_pos(event_name_time_container, 0, 0);
-      lv_obj_set_size(event_name_time_container, 300, 50);
-      lv_obj_set_style_pad_left(event_name_time_container, 0, LV_PART_MAIN);
-      lv_obj_set_style_pad_top(event_name_time_container, 0, LV_PART_MAIN);
-      lv_obj_set_style_pad_right(event_name_time_container, 0, LV_PART_MAIN);
-      lv_obj_set_style_pad_bottom(event_name_time_container, 0, LV_PART_MAIN);
-      lv_obj_set_style_bg_opa(event_name_time_container, 0, LV_PART_MAIN);
-      lv_obj_set_style_border_width(event_name_time_container, 0, LV_PART_MAIN);
-      lv_obj_set_style_radius(event_name_time_container, 0, LV_PART_MAIN);
-      lv_obj_add_flag(event_name_time_container, LV_OBJ_FLAG_EVENT_BUBBLE | LV_OBJ_FLAG_CLICKABLE);
-      lv_obj_set_style_layout(event_name_time_container, LV_LAYOUT_FLEX, LV_PART_MAIN);
-      lv_obj_set_style_flex_flow(event_name_time_container, LV_FLEX_FLOW_COLUMN, LV_PART_MAIN);
-      lv_obj_set_style_flex_main_place(event_name_time_container, LV_FLEX_ALIGN_CENTER, LV_PART_MAIN);
-      lv_obj_set_style_flex_cross_place(event_name_time_container, LV_FLEX_ALIGN_CENTER, LV_PART_MAIN);
-      lv_obj_set_style_flex_track_place(event_name_time_container, LV_FLEX_ALIGN_CENTER, LV_PART_MAIN);
-
-
-      // Label: event name
-      lv_obj_t* event_name_label = lv_label_create(event_name_time_container);
-      lv_obj_set_pos(event_name_label, 0, 0);
-      lv_obj_set_size(event_name_label, 290, 20);
-      lv_label_set_long_mode(event_name_label, LV_LABEL_LONG_DOT);
-      lv_obj_set_style_text_font(event_name_label, &lv_font_montserrat_18, LV_PART_MAIN);
-      lv_obj_set_style_pad_top(event_name_label, 4, LV_PART_MAIN);
-      lv_obj_set_style_text_color(event_name_label, lv_color_hex(0xffe0e0e0), LV_PART_MAIN);
-      lv_label_set_text_fmt(event_name_label, "%s", event.title);
-
-      // Label: event time
-      lv_obj_t* event_time_label = lv_label_create(event_name_time_container);
-      lv_obj_set_pos(event_time_label, 0, 0);
-      lv_obj_set_size(event_time_label, 290, 20);
-      lv_obj_set_style_text_color(event_time_label, lv_color_hex(0xffb0b0b0), LV_PART_MAIN);
-      lv_obj_set_style_pad_bottom(event_time_label, 4, LV_PART_MAIN);
-      lv_obj_set_style_text_opa(event_time_label, 215, LV_PART_MAIN);
-      lv_obj_set_style_text_font(event_time_label, &lv_font_montserrat_16, LV_PART_MAIN);
-      lv_label_set_text_fmt(event_time_label, "%s", timeDisplay);
     }
 
-    // Auto-scroll to the first in-progress or upcoming event
-    if (scroll_target != NULL) {
-      lv_obj_update_layout(parent_list);  // Force layout so positions are calculated
-      lv_obj_scroll_to_view(scroll_target, LV_ANIM_ON);
+    if (attachEventList()) {
+      int64_t started = esp_timer_get_time();
+      eventList.setCount(eventCount);
+      if (scrollTarget >= 0) eventList.scrollToView(scrollTarget, LV_ANIM_ON);
+      listBindUs = esp_timer_get_time() - started;
     }
 
     eez::flow::setGlobalVariable(FLOW_GLOBAL_VARIABLE_CALENDAR_NO_EVENTS_SHOWN,
@@ -301,6 +208,278 @@ void CalendarFetcher::updateCalendarDisplay() {
                                eez::BooleanValue(false));
 }
 
+// Event rows share these styles; a bind only swaps the bar colour and sets
+// the two label texts.  Positions reproduce the old flex rows: a 4 px bar
+// centred on the left and the two labels centred in the 300 px to its right.
+#define EVENT_ROW_WIDTH     315
+#define EVENT_ROW_HEIGHT    50
+
+static lv_style_t styleEventRow;
+static lv_style_t styleEventBar;
+static lv_style_t styleEventPast;
+static lv_style_t styleEventNow;
+static lv_style_t styleEventFuture;
+static lv_style_t styleEventName;
+static lv_style_t styleEventTime;
+
+static void initEventStyles() {
+  static bool initialised = false;
+  if (initialised) return;
+  initialised = true;
+
+  lv_style_init(&styleEventRow);
+  lv_style_set_width(&styleEventRow, EVENT_ROW_WIDTH);
+  lv_style_set_radius(&styleEventRow, 2);
+  lv_style_set_border_color(&styleEventRow, lv_color_hex(0xff2a2a2a));
+  lv_style_set_border_opa(&styleEventRow, 102);
+  lv_style_set_border_width(&styleEventRow, 1);
+  lv_style_set_border_side(&styleEventRow, LV_BORDER_SIDE_BOTTOM);
+
+  lv_style_init(&styleEventBar);
+  lv_style_set_x(&styleEventBar, 0);
+  lv_style_set_y(&styleEventBar, (EVENT_ROW_HEIGHT - 32) / 2);
+  lv_style_set_width(&styleEventBar, 4);
+  lv_style_set_height(&styleEventBar, 32);
+  lv_style_set_bg_opa(&styleEventBar, LV_OPA_COVER);
+  lv_style_set_radius(&styleEventBar, 2);
+
+  lv_style_init(&styleEventPast);
+  lv_style_set_bg_color(&styleEventPast, lv_color_hex(0xff888888));
+  lv_style_init(&styleEventNow);
+  lv_style_set_bg_color(&styleEventNow, lv_color_hex(0xffff2222));
+  lv_style_init(&styleEventFuture);
+  lv_style_set_bg_color(&styleEventFuture, lv_color_hex(0xff1e88ff));
+
+  lv_style_init(&styleEventName);
+  lv_style_set_x(&styleEventName, 20);
+  lv_style_set_y(&styleEventName, 5);
+  lv_style_set_width(&styleEventName, 290);
+  lv_style_set_height(&styleEventName, 20);
+  lv_style_set_pad_top(&styleEventName, 4);
+  lv_style_set_text_font(&styleEventName, &lv_font_montserrat_18);
+  lv_style_set_text_color(&styleEventName, lv_color_hex(0xffe0e0e0));
+
+  lv_style_init(&styleEventTime);
+  lv_style_set_x(&styleEventTime, 20);
+  lv_style_set_y(&styleEventTime, 25);
+  lv_style_set_width(&styleEventTime, 290);
+  lv_style_set_height(&styleEventTime, 20);
+  lv_style_set_pad_bottom(&styleEventTime, 4);
+  lv_style_set_text_font(&styleEventTime, &lv_font_montserrat_16);
+  lv_style_set_text_color(&styleEventTime, lv_color_hex(0xffb0b0b0));
+  lv_style_set_text_opa(&styleEventTime, 215);
+}
+
+// Children: 0 bar, 1 name, 2 time.  The bar's user data is its colour style.
+void CalendarFetcher::createEventRow(lv_obj_t *row, void *ctx) {
+  lv_obj_add_flag(row, LV_OBJ_FLAG_EVENT_BUBBLE | LV_OBJ_FLAG_CLICKABLE);
+
+  lv_obj_t *bar = lv_obj_create(row);
+  lv_obj_remove_style_all(bar);
+  lv_obj_add_style(bar, &styleEventBar, LV_PART_MAIN);
+  lv_obj_clear_flag(bar, LV_OBJ_FLAG_CLICKABLE);
+
+  lv_obj_t *name = lv_label_create(row);
+  lv_obj_remove_style_all(name);
+  lv_obj_add_style(name, &styleEventName, LV_PART_MAIN);
+  lv_label_set_long_mode(name, LV_LABEL_LONG_DOT);
+
+  lv_obj_t *timeLabel = lv_label_create(row);
+  lv_obj_remove_style_all(timeLabel);
+  lv_obj_add_style(timeLabel, &styleEventTime, LV_PART_MAIN);
+  lv_label_set_long_mode(timeLabel, LV_LABEL_LONG_CLIP);
+}
+
+void CalendarFetcher::bindEventRow(lv_obj_t *row, uint32_t index, void *ctx) {
+  CalendarFetcher *fetcher = (CalendarFetcher *)ctx;
+  const CalendarEvent &event = fetcher->shown[index];
+  time_t now = time(0);
+
+  lv_obj_t *bar = lv_obj_get_child(row, 0);
+  lv_style_t *colour = event.endTimestamp <= now ? &styleEventPast
+                     : event.startTimestamp <= now ? &styleEventNow
+                     : &styleEventFuture;
+  lv_style_t *previous = (lv_style_t *)lv_obj_get_user_data(bar);
+  if (previous != colour) {
+    if (previous) lv_obj_remove_style(bar, previous, LV_PART_MAIN);
+    lv_obj_add_style(bar, colour, LV_PART_MAIN);
+    lv_obj_set_user_data(bar, colour);
+  }
+
+  // Show time range if end time exists
+  char timeDisplay[80];
+  if (event.endTime[0] != '\0' && strcmp(event.endTime, event.startTime) != 0) {
+    snprintf(timeDisplay, sizeof(timeDisplay), "%s - %s", event.startTime, event.endTime);
+  } else {
+    snprintf(timeDisplay, sizeof(timeDisplay), "%s", event.startTime);
+  }
+
+  lv_label_set_text(lv_obj_get_child(row, 1), event.title);
+  lv_label_set_text(lv_obj_get_child(row, 2), timeDisplay);
+}
+
+// (Re)builds the row pool the first time the calendar screen is shown and
+// after the screen has been freed and recreated.
+bool CalendarFetcher::attachEventList() {
+  lv_obj_t *container = objects.calender_events_container;
+  if (!container) return false;
+  if (eventList.attachedTo(container)) return true;
+  initEventStyles();
+  lv_coord_t gap = lv_obj_get_style_pad_row(container, LV_PART_MAIN);
+  return eventList.attach(container, EVENT_ROW_HEIGHT, gap, &styleEventRow,
+                          createEventRow, bindEventRow, this);
+}
+
+// The list as it was before VirtualList, kept for calbench only: a flex
+// column rebuilt from scratch, five objects per event with local styles.
+static lv_obj_t *buildLegacyList(lv_obj_t *like, const std::vector<CalendarEvent> &events, time_t now) {
+  lv_obj_t *list = lv_obj_create(lv_obj_get_parent(like));
+  lv_obj_add_flag(list, LV_OBJ_FLAG_HIDDEN);
+  lv_obj_set_size(list, lv_obj_get_width(like), lv_obj_get_height(like));
+  lv_obj_set_style_layout(list, LV_LAYOUT_FLEX, LV_PART_MAIN);
+  lv_obj_set_style_flex_flow(list, LV_FLEX_FLOW_COLUMN, LV_PART_MAIN);
+  lv_obj_set_style_pad_row(list, lv_obj_get_style_pad_row(like, LV_PART_MAIN), LV_PART_MAIN);
+
+  for (const CalendarEvent &event : events) {
+    char timeDisplay[80];
+    if (event.endTime[0] != '\0' && strcmp(event.endTime, event.startTime) != 0) {
+      snprintf(timeDisplay, sizeof(timeDisplay), "%s - %s", event.startTime, event.endTime);
+    } else {
+      snprintf(timeDisplay, sizeof(timeDisplay), "%s", event.startTime);
+    }
+
+    lv_obj_t *row = lv_obj_create(list);
+    lv_obj_set_size(row, EVENT_ROW_WIDTH, LV_SIZE_CONTENT);
+    lv_obj_set_style_pad_all(row, 0, LV_PART_MAIN);
+    lv_obj_set_style_bg_opa(row, 0, LV_PART_MAIN);
+    lv_obj_add_flag(row, LV_OBJ_FLAG_EVENT_BUBBLE | LV_OBJ_FLAG_CLICKABLE);
+    lv_obj_set_style_layout(row, LV_LAYOUT_FLEX, LV_PART_MAIN);
+    lv_obj_set_style_flex_flow(row, LV_FLEX_FLOW_ROW, LV_PART_MAIN);
+    lv_obj_set_style_flex_track_place(row, LV_FLEX_ALIGN_SPACE_BETWEEN, LV_PART_MAIN);
+    lv_obj_set_style_flex_cross_place(row, LV_FLEX_ALIGN_CENTER, LV_PART_MAIN);
+    lv_obj_set_style_flex_main_place(row, LV_FLEX_ALIGN_SPACE_BETWEEN, LV_PART_MAIN);
+    lv_obj_set_style_radius(row, 2, LV_PART_MAIN);
+    lv_obj_set_style_border_color(row, lv_color_hex(0xff2a2a2a), LV_PART_MAIN);
+    lv_obj_set_style_border_opa(row, 102, LV_PART_MAIN);
+    lv_obj_set_style_border_width(row, 1, LV_PART_MAIN);
+    lv_obj_set_style_border_side(row, LV_BORDER_SIDE_BOTTOM, LV_PART_MAIN);
+
+    lv_obj_t *bar = lv_obj_create(row);
+    lv_obj_set_size(bar, 4, 32);
+    lv_obj_set_style_bg_color(bar, lv_color_hex(event.endTimestamp <= now ? 0xff888888
+                                                : event.startTimestamp <= now ? 0xffff2222 : 0xff1e88ff), LV_PART_MAIN);
+    lv_obj_set_style_bg_opa(bar, LV_OPA_COVER, LV_PART_MAIN);
+    lv_obj_set_style_radius(bar, 2, LV_PART_MAIN);
+    lv_obj_set_style_border_width(bar, 0, LV_PART_MAIN);
+    lv_obj_set_style_pad_all(bar, 0, LV_PART_MAIN);
+
+    lv_obj_t *text = lv_obj_create(row);
+    lv_obj_set_size(text, 300, EVENT_ROW_HEIGHT);
+    lv_obj_set_style_pad_all(text, 0, LV_PART_MAIN);
+    lv_obj_set_style_bg_opa(text, 0, LV_PART_MAIN);
+    lv_obj_set_style_border_width(text, 0, LV_PART_MAIN);
+    lv_obj_set_style_radius(text, 0, LV_PART_MAIN);
+    lv_obj_add_flag(text, LV_OBJ_FLAG_EVENT_BUBBLE | LV_OBJ_FLAG_CLICKABLE);
+    lv_obj_set_style_layout(text, LV_LAYOUT_FLEX, LV_PART_MAIN);
+    lv_obj_set_style_flex_flow(text, LV_FLEX_FLOW_COLUMN, LV_PART_MAIN);
+    lv_obj_set_style_flex_main_place(text, LV_FLEX_ALIGN_CENTER, LV_PART_MAIN);
+    lv_obj_set_style_flex_cross_place(text, LV_FLEX_ALIGN_CENTER, LV_PART_MAIN);
+    lv_obj_set_style_flex_track_place(text, LV_FLEX_ALIGN_CENTER, LV_PART_MAIN);
+
+    lv_obj_t *name = lv_label_create(text);
+    lv_obj_set_size(name, 290, 20);
+    lv_label_set_long_mode(name, LV_LABEL_LONG_DOT);
+    lv_obj_set_style_text_font(name, &lv_font_montserrat_18, LV_PART_MAIN);
+    lv_obj_set_style_pad_top(name, 4, LV_PART_MAIN);
+    lv_obj_set_style_text_color(name, lv_color_hex(0xffe0e0e0), LV_PART_MAIN);
+    lv_label_set_text(name, event.title);
+
+    lv_obj_t *timeLabel = lv_label_create(text);
+    lv_obj_set_size(timeLabel, 290, 20);
+    lv_obj_set_style_text_color(timeLabel, lv_color_hex(0xffb0b0b0), LV_PART_MAIN);
+    lv_obj_set_style_pad_bottom(timeLabel, 4, LV_PART_MAIN);
+    lv_obj_set_style_text_opa(timeLabel, 215, LV_PART_MAIN);
+    lv_obj_set_style_text_font(timeLabel, &lv_font_montserrat_16, LV_PART_MAIN);
+    lv_label_set_text(timeLabel, timeDisplay);
+  }
+  return list;
+}
+
+// Scrolls to the end a few pixels at a time, as a drag would.
+static uint32_t dragToEnd(lv_obj_t *container) {
+  lv_obj_update_layout(container);
+  lv_coord_t end = lv_obj_get_scroll_bottom(container);
+  uint32_t steps = 0;
+  while (end > 0) {
+    lv_coord_t step = end < 8 ? end : 8;
+    lv_obj_scroll_by(container, 0, -step, LV_ANIM_OFF);
+    end -= step;
+    steps++;
+  }
+  return steps;
+}
+
+void CalendarFetcher::benchmarkList(uint16_t count) {
+  if (!attachEventList()) {
+    Serial.println("[Calendar] bench: open the calendar screen first");
+    return;
+  }
+
+  std::vector<CalendarEvent> real;
+  real.swap(shown);
+  time_t now = time(nullptr);
+  time_t start = timeZone.startOfDay(now);
+  shown.resize(count);
+  for (uint16_t i = 0; i < count; i++) {
+    CalendarEvent &event = shown[i];
+    event.startTimestamp = start + (time_t)i * 86400 / (count + 1);
+    event.endTimestamp = event.startTimestamp + 30 * 60;
+    snprintf(event.title, sizeof(event.title), "Benchmark event %u with a title long enough to clip", i);
+    strlcpy(event.startTime, formatTime(event.startTimestamp).c_str(), sizeof(event.startTime));
+    strlcpy(event.endTime, formatTime(event.endTimestamp).c_str(), sizeof(event.endTime));
+  }
+  lv_obj_t *container = objects.calender_events_container;
+
+  // Old: rebuild, lay out, drag through, free.  LVGL allocates from PSRAM.
+  size_t heapBefore = heap_caps_get_free_size(MALLOC_CAP_SPIRAM);
+  int64_t t0 = esp_timer_get_time();
+  lv_obj_t *legacy = buildLegacyList(container, shown, now);
+  lv_obj_update_layout(legacy);
+  int64_t t1 = esp_timer_get_time();
+  size_t legacyHeap = heapBefore - heap_caps_get_free_size(MALLOC_CAP_SPIRAM);
+  uint32_t legacySteps = dragToEnd(legacy);
+  int64_t t2 = esp_timer_get_time();
+  lv_obj_del(legacy);
+  int64_t t3 = esp_timer_get_time();
+
+  Serial.printf("[Calendar] bench %u events old: objects=%u build=%luus heap=%luB "
+                "scroll %lu steps=%luus (%.1fus/step) free=%luus\n",
+                count, 1 + count * 5, (unsigned long)(t1 - t0), (unsigned long)legacyHeap,
+                (unsigned long)legacySteps, (unsigned long)(t2 - t1),
+                legacySteps ? (double)(t2 - t1) / legacySteps : 0.0, (unsigned long)(t3 - t2));
+
+  // New: the pool is already built, so this is setCount() and binds only.
+  heapBefore = heap_caps_get_free_size(MALLOC_CAP_SPIRAM);
+  eventList.takeBinds();
+  t0 = esp_timer_get_time();
+  eventList.setCount(count);
+  t1 = esp_timer_get_time();
+  size_t listHeap = heapBefore - heap_caps_get_free_size(MALLOC_CAP_SPIRAM);
+  uint32_t setBinds = eventList.takeBinds();
+  uint32_t steps = dragToEnd(container);
+  t2 = esp_timer_get_time();
+  uint32_t scrollBinds = eventList.takeBinds();
+
+  Serial.printf("[Calendar] bench %u events new: objects=%u setCount=%luus (%lu binds) heap=%ldB "
+                "scroll %lu steps=%luus (%lu binds, %.1fus/step)\n",
+                count, 1 + eventList.poolSize() * 4, (unsigned long)(t1 - t0), (unsigned long)setBinds,
+                (long)listHeap, (unsigned long)steps, (unsigned long)(t2 - t1), (unsigned long)scrollBinds,
+                steps ? (double)(t2 - t1) / steps : 0.0);
+
+  shown.swap(real);
+  eventList.setCount(shown.size());
+}
+
 String CalendarFetcher::urlEncode(String str) {
   String encoded = "";
   char c;
@@ -411,59 +590,20 @@ time_t CalendarFetcher::parseICalDateTime(String dtString) {
     second = dtString.substring(13, 15).toInt();
   }
 
-  struct tm timeinfo = { 0 };
-  timeinfo.tm_year = year - 1900;
-  timeinfo.tm_mon = month - 1;
-  timeinfo.tm_mday = day;
-  timeinfo.tm_hour = hour;
-  timeinfo.tm_min = minute;
-  timeinfo.tm_sec = second;
-  timeinfo.tm_isdst = -1;  // Let the system determine DST
-
-  if (isUTC) {
-    // mktime() interprets its input as local time, but we have UTC values.
-    // Temporarily switch to UTC so mktime produces the correct epoch, then restore.
-    // IMPORTANT: We must copy the TZ string because setenv may invalidate the pointer.
-    char origTZ[64] = { 0 };
-    bool hadTZ = false;
-    const char* tz = getenv("TZ");
-    if (tz) {
-      hadTZ = true;
-      strncpy(origTZ, tz, sizeof(origTZ) - 1);
-    }
-
-    setenv("TZ", "UTC0", 1);
-    tzset();
-
-    timeinfo.tm_isdst = 0;  // No DST in UTC
-    time_t result = mktime(&timeinfo);
+  CivilTime civil = { (int16_t)year, (uint8_t)month, (uint8_t)day, (uint8_t)hour, (uint8_t)minute, (uint8_t)second };
 
-    // Restore original timezone
-    if (hadTZ) {
-      setenv("TZ", origTZ, 1);
-    } else {
-      unsetenv("TZ");
-    }
-    tzset();
-
-    return result;
-  }
-
-  return mktime(&timeinfo);
+  // UTC needs no zone at all; local times go through the compiled zone
+  // rather than flipping TZ under the other tasks' feet.
+  return isUTC ? civilToUtc(civil) : timeZone.fromLocal(civil);
 }
 
 String CalendarFetcher::formatTime(time_t timestamp) {
-  struct tm timeinfoBuf;
-  struct tm* timeinfo = localtime_r(&timestamp, &timeinfoBuf);
-
-  // Check if localtime failed
-  if (timeinfo == NULL) {
-    return "Invalid Time";
-  }
+  CivilTime timeinfo;
+  timeZone.toLocal(timestamp, timeinfo);
 
   char buffer[20];
 
-  int hour = timeinfo->tm_hour;
+  int hour = timeinfo.hour;
   String ampm = "AM";
 
   if (hour == 0) {
@@ -475,79 +615,65 @@ String CalendarFetcher::formatTime(time_t timestamp) {
     ampm = "PM";
   }
 
-  sprintf(buffer, "%d:%02d %s", hour, timeinfo->tm_min, ampm.c_str());
+  sprintf(buffer, "%d:%02d %s", hour, timeinfo.minute, ampm.c_str());
   return String(buffer);
 }
 
-bool CalendarFetcher::eventOccursOnDate(time_t eventStart, String rrule, time_t targetDate) {
-  // Get just the date parts (ignore time)
-  struct tm eventTmBuf, targetTmBuf;
-  localtime_r(&eventStart, &eventTmBuf);
-  localtime_r(&targetDate, &targetTmBuf);
-  struct tm* eventTm = &eventTmBuf;
-  struct tm* targetTm = &targetTmBuf;
-
-  // Check if localtime failed
-  if (eventTm == NULL || targetTm == NULL) {
-    Serial.println("ERROR: localtime failed in eventOccursOnDate");
-    return false;
-  }
-
-  // Create date-only timestamps (midnight)
-  struct tm eventDateOnly = *eventTm;
-  eventDateOnly.tm_hour = 0;
-  eventDateOnly.tm_min = 0;
-  eventDateOnly.tm_sec = 0;
-  time_t eventDateStart = mktime(&eventDateOnly);
-
-  struct tm targetDateOnly = *targetTm;
-  targetDateOnly.tm_hour = 0;
-  targetDateOnly.tm_min = 0;
-  targetDateOnly.tm_sec = 0;
-  time_t targetDateStart = mktime(&targetDateOnly);
-
-  // If no RRULE, just check if dates match
-  if (rrule.length() == 0) {
-    return eventDateStart == targetDateStart;
+// Value of the first `name` property at or after `from` (name at the start of
+// a line, followed by parameters or the value), or -1.  Sets *lineEnd.
+static int findProperty(const String &data, const char *name, int from, int *lineEnd = nullptr) {
+  String key = String("\n") + name;
+  int pos = from;
+  while ((pos = data.indexOf(key, pos)) != -1) {
+    char next = data.charAt(pos + key.length());
+    if (next == ':' || next == ';') {
+      int valueStart = data.indexOf(':', pos + 1) + 1;
+      int end = data.indexOf('\n', valueStart);
+      if (end == -1) end = data.length();
+      if (lineEnd) *lineEnd = end;
+      return valueStart;
+    }
+    pos += key.length();
   }
+  return -1;
+}
 
-  // Check if target date is before event starts
-  if (targetDateStart < eventDateStart) {
-    return false;
-  }
-
-  // Parse RRULE for UNTIL date
-  time_t untilDate = 0;
-  int untilPos = rrule.indexOf("UNTIL=");
-  if (untilPos != -1) {
-    int untilEnd = rrule.indexOf(";", untilPos);
-    if (untilEnd == -1) untilEnd = rrule.length();
-    String untilStr = rrule.substring(untilPos + 6, untilEnd);
-    untilDate = parseICalDateTime(untilStr);
-
-    // Check if target date is after UNTIL date
-    if (targetDateStart > untilDate) {
-      return false;
-    }
+// First pass over a feed: remember which instances of recurring events have
+// been moved or cancelled by a separate VEVENT carrying RECURRENCE-ID.
+void CalendarFetcher::collectOverrides(const char *payload) {
+  overrides.collect(payload);
+  if (overrides.size()) {
+    Serial.printf("Calendar: %u recurrence overrides\n", (unsigned)overrides.size());
   }
+}
 
-  // Check frequency
-  if (rrule.indexOf("FREQ=DAILY") != -1) {
-    // Daily recurring event - occurs every day within range
-    return true;
-  } else if (rrule.indexOf("FREQ=WEEKLY") != -1) {
-    // Weekly recurring - check if same day of week
-    return eventTm->tm_wday == targetTm->tm_wday;
+void CalendarFetcher::addOccurrence(const CalendarEvent &base, time_t start, time_t duration, bool allDay) {
+  CalendarEvent event = base;
+  event.startTimestamp = start;
+  event.endTimestamp = start + duration;
+  if (!event.instance) event.instance = start;
+  if (!allDay) {
+    String t = formatTime(event.startTimestamp);
+    strncpy(event.startTime, t.c_str(), sizeof(event.startTime) - 1);
+    event.startTime[sizeof(event.startTime) - 1] = '\0';
+    t = formatTime(event.endTimestamp);
+    strncpy(event.endTime, t.c_str(), sizeof(event.endTime) - 1);
+    event.endTime[sizeof(event.endTime) - 1] = '\0';
   }
 
-  // Default: event doesn't recur on this date
-  return false;
+  fetched.push_back(event);
 }
 
-void CalendarFetcher::parseVEvent(String eventData) {
+void CalendarFetcher::parseVEvent(String eventData, time_t windowStart, time_t windowEnd) {
   CalendarEvent event = {};
   bool allDay = false;
-  String rrule = "";
+
+  // Unfold continuation lines (RFC 5545 3.1) so long titles and EXDATE lists
+  // parse whole.
+  eventData.replace("\r\n ", "");
+  eventData.replace("\r\n\t", "");
+  eventData.replace("\n ", "");
+  eventData.replace("\n\t", "");
 
   // Find SUMMARY (title)
   int summaryStart = eventData.indexOf("SUMMARY:");
@@ -559,109 +685,90 @@ void CalendarFetcher::parseVEvent(String eventData) {
     strncpy(event.title, titleStr.c_str(), sizeof(event.title) - 1);
     event.title[sizeof(event.title) - 1] = '\0';
   }
+  if (event.title[0] == '\0') return;
 
-  // Find DTSTART (start time)
-  int dtStartPos = eventData.indexOf("DTSTART");
-  if (dtStartPos != -1) {
-    int valueStart = eventData.indexOf(":", dtStartPos) + 1;
-    int valueEnd = eventData.indexOf("\n", valueStart);
-    String dtStart = eventData.substring(valueStart, valueEnd);
-    dtStart.trim();
-
-    // Check if it's an all-day event (no time component)
-    if (dtStart.length() == 8) {
-      allDay = true;
-    }
+  int lineEnd;
+  int statusPos = findProperty(eventData, "STATUS", 0, &lineEnd);
+  if (statusPos != -1 && eventData.substring(statusPos, lineEnd).indexOf("CANCELLED") != -1) return;
 
-    event.startTimestamp = parseICalDateTime(dtStart);
-    if (allDay) {
-      strncpy(event.startTime, "All Day", sizeof(event.startTime) - 1);
-      event.startTime[sizeof(event.startTime) - 1] = '\0';
-    } else {
-      String t = formatTime(event.startTimestamp);
-      strncpy(event.startTime, t.c_str(), sizeof(event.startTime) - 1);
-      event.startTime[sizeof(event.startTime) - 1] = '\0';
-    }
+  // Find DTSTART (start time)
+  CivilTime startCivil = {};
+  int dtStartPos = findProperty(eventData, "DTSTART", 0, &lineEnd);
+  if (dtStartPos == -1) return;
+  String dtStart = eventData.substring(dtStartPos, lineEnd);
+  dtStart.trim();
+  if (!parseICalCivil(dtStart.c_str(), startCivil, nullptr, &allDay)) return;
+  event.startTimestamp = parseICalDateTime(dtStart);
+  if (allDay) {
+    strncpy(event.startTime, "All Day", sizeof(event.startTime) - 1);
+    event.startTime[sizeof(event.startTime) - 1] = '\0';
   }
 
-  // Find DTEND (end time)
-  int dtEndPos = eventData.indexOf("DTEND");
+  // Find DTEND (end time).  Without one, an all-day event lasts the day and
+  // a timed event is a point in time.
+  time_t duration = allDay ? 86400 : 0;
+  int dtEndPos = findProperty(eventData, "DTEND", 0, &lineEnd);
   if (dtEndPos != -1) {
-    int valueStart = eventData.indexOf(":", dtEndPos) + 1;
-    int valueEnd = eventData.indexOf("\n", valueStart);
-    String dtEnd = eventData.substring(valueStart, valueEnd);
+    String dtEnd = eventData.substring(dtEndPos, lineEnd);
     dtEnd.trim();
-
-    event.endTimestamp = parseICalDateTime(dtEnd);
-    if (allDay) {
-      event.endTime[0] = '\0';
-    } else {
-      String t = formatTime(event.endTimestamp);
-      strncpy(event.endTime, t.c_str(), sizeof(event.endTime) - 1);
-      event.endTime[sizeof(event.endTime) - 1] = '\0';
-    }
+    time_t endTimestamp = parseICalDateTime(dtEnd);
+    if (endTimestamp > event.startTimestamp) duration = endTimestamp - event.startTimestamp;
   }
 
-  // Find RRULE (recurrence rule)
-  int rrulePos = eventData.indexOf("RRULE:");
-  if (rrulePos != -1) {
-    int rruleStart = rrulePos + 6;
-    int rruleEnd = eventData.indexOf("\n", rruleStart);
-    rrule = eventData.substring(rruleStart, rruleEnd);
-    rrule.trim();
-  }
-
-  // Only add if we have a title AND the event occurs on the current viewing date
-  if (event.title[0] != '\0' && eventOccursOnDate(event.startTimestamp, rrule, currentDate)) {
-    // Adjust timestamps to current viewing date (preserving time-of-day) for proper sorting and color logic
-    // We must rebase BOTH start and end, otherwise endTimestamp stays on the original occurrence date
-    // and the color comparison (endTimestamp <= now) incorrectly marks future recurring events as past.
-    time_t duration = event.endTimestamp - event.startTimestamp;
-
-    struct tm eventTmBuf;
-    localtime_r(&event.startTimestamp, &eventTmBuf);
-    struct tm currentDateBuf;
-    localtime_r(&currentDate, &currentDateBuf);
-
-    // Combine current viewing date with event's time-of-day
-    currentDateBuf.tm_hour = eventTmBuf.tm_hour;
-    currentDateBuf.tm_min = eventTmBuf.tm_min;
-    currentDateBuf.tm_sec = eventTmBuf.tm_sec;
-    event.startTimestamp = mktime(&currentDateBuf);
-    event.endTimestamp = event.startTimestamp + duration;
-
-    // Check for duplicates (same title and overlapping time)
-    bool isDuplicate = false;
-    for (int i = 0; i < events.size(); i++) {
-      if (strcmp(events[i].title, event.title) == 0) {
-        // Check if times overlap or are very close (within same hour)
-        struct tm existingTmBuf, newTmBuf;
-        localtime_r(&events[i].startTimestamp, &existingTmBuf);
-        localtime_r(&event.startTimestamp, &newTmBuf);
-        struct tm* existingTm = &existingTmBuf;
-        struct tm* newTm = &newTmBuf;
-
-        if (existingTm != NULL && newTm != NULL && existingTm->tm_hour == newTm->tm_hour) {
-          isDuplicate = true;
-          break;
-        }
-      }
+  // An instance that counts if it overlaps the window (multi-day events show
+  // on every day they cover).
+  auto overlaps = [&](time_t start) {
+    return start < windowEnd && (start >= windowStart || start + duration > windowStart);
+  };
+
+  int uidPos = findProperty(eventData, "UID", 0);
+  event.uidHash = uidPos != -1 ? hashICalUid(eventData.c_str() + uidPos) : 0;
+
+  // Moved instances (RECURRENCE-ID) and plain events are single occurrences.
+  // A moved instance keeps the start it replaces as its identity.
+  int recurrenceIdPos = findProperty(eventData, "RECURRENCE-ID", 0, &lineEnd);
+  if (recurrenceIdPos != -1) {
+    String recurrenceId = eventData.substring(recurrenceIdPos, lineEnd);
+    recurrenceId.trim();
+    event.instance = parseICalDateTime(recurrenceId);
+  }
+  int rrulePos = findProperty(eventData, "RRULE", 0, &lineEnd);
+  RecurrenceRule rule;
+  bool recurring = rrulePos != -1 && recurrenceIdPos == -1;
+  if (recurring) {
+    String rruleStr = eventData.substring(rrulePos, lineEnd);
+    rruleStr.trim();
+    if (!rule.parse(rruleStr.c_str())) {
+      Serial.println("Calendar: unsupported RRULE, showing first instance only: " + rruleStr);
+      recurring = false;
     }
+  }
+  if (!recurring) {
+    if (overlaps(event.startTimestamp)) addOccurrence(event, event.startTimestamp, duration, allDay);
+    return;
+  }
 
-    if (!isDuplicate) {
-      events.push_back(event);
-    }
+  RecurrenceExpansion expansion;
+  if (!expansion.begin(rule, dtStart.c_str(), duration, event.uidHash)) return;
+  int exdatePos = 0;
+  while ((exdatePos = findProperty(eventData, "EXDATE", exdatePos, &lineEnd)) != -1) {
+    expansion.exclude(eventData.substring(exdatePos, lineEnd).c_str());
+    exdatePos = lineEnd;
   }
+
+  std::vector<time_t> starts;
+  expansion.expand(windowStart, windowEnd, &overrides, starts);
+  for (time_t start : starts) addOccurrence(event, start, duration, allDay);
 }
 
-bool CalendarFetcher::fetchCalendar(String url) {
+bool CalendarFetcher::fetchCalendar(String url, time_t windowStart, time_t windowEnd) {
   if (WiFi.status() != WL_CONNECTED) {
     Serial.println("WiFi not connected");
     return false;
   }
 
   // Format dates for URL
-  time_t startDate = currentDate;
+  time_t startDate = windowStart;
   struct tm startDateBuf;
   struct tm* startDateStruct = localtime_r(&startDate, &startDateBuf);
   if (startDateStruct == NULL) {
@@ -674,10 +781,9 @@ bool CalendarFetcher::fetchCalendar(String url) {
           startDateStruct->tm_mon + 1,
           startDateStruct->tm_mday);
 
-  // End date is same day (we only fetch one day at a time)
-  time_t endDate = currentDate + 86400;
+  time_t endDate = windowEnd;
   struct tm endDateBuf;
-  struct tm* endDateStruct = localtime_r(&endDate, &endDateBuf);  // Add one day in seconds
+  struct tm* endDateStruct = localtime_r(&endDate, &endDateBuf);
   if (endDateStruct == NULL) {
     Serial.println("ERROR: localtime failed for endDate");
     return false;
@@ -750,6 +856,9 @@ bool CalendarFetcher::fetchCalendar(String url) {
 
     Serial.printf("Read %d bytes of calendar data to PSRAM\n", totalRead);
 
+    fetched.clear();
+    collectOverrides(payload);
+
     // Parse iCal data using C-string functions to avoid copying back to internal heap
     char* searchPos = payload;
     while (true) {
@@ -765,7 +874,7 @@ bool CalendarFetcher::fetchCalendar(String url) {
         for (size_t i = 0; i < eventLen; i++) {
           eventData += eventStart[i];
         }
-        parseVEvent(eventData);
+        parseVEvent(eventData, windowStart, windowEnd);
         searchPos = eventEnd + 10;  // Skip past "END:VEVENT"
       } else {
         break;
@@ -774,7 +883,7 @@ bool CalendarFetcher::fetchCalendar(String url) {
 
     heap_caps_free(payload);
     http.end();
-    Serial.println("Fetched " + String(events.size()) + " events so far");
+    Serial.println("Fetched " + String(fetched.size()) + " occurrences");
     return true;
   } else {
     String errorMsg = "HTTP error: " + String(httpCode);
@@ -789,14 +898,21 @@ bool CalendarFetcher::fetchCalendar(String url) {
   }
 }
 
-bool CalendarFetcher::fetchCalendarWithRetry(int maxRetries) {
-
-  // Hold the mutex for the entire fetch: clear → populate → sort.
-  // This prevents Core 1 from reading a partially-built or freed events vector.
-  xSemaphoreTake(eventsMutex, portMAX_DELAY);
+// Next local midnight after the midnight `day`.
+static time_t nextDayStart(time_t day) {
+  return timeZone.startOfDay(day, 1);
+}
 
-  // Clear all events once before fetching any URLs
-  clearEvents();
+bool CalendarFetcher::fetchCalendarWithRetry(int maxRetries) {
+  unsigned long fetchStart = millis();
+
+  // The store window follows today, unless the viewed date lies outside it.
+  time_t windowStart, windowEnd;
+  time_t today = time(nullptr);
+  CalendarStore::windowFor(today, windowStart, windowEnd);
+  if (currentDate < windowStart || currentDate >= windowEnd) {
+    CalendarStore::windowFor(currentDate, windowStart, windowEnd);
+  }
 
   bool anySuccess = false;
 
@@ -804,6 +920,11 @@ bool CalendarFetcher::fetchCalendarWithRetry(int maxRetries) {
     String url = icalUrls[i];
     bool urlSuccess = false;
 
+    if (i >= CALENDAR_STORE_MAX_FEEDS) {
+      Serial.println("Calendar " + String(i + 1) + " skipped, store holds " + String(CALENDAR_STORE_MAX_FEEDS) + " feeds");
+      break;
+    }
+
     for (int attempt = 0; attempt <= maxRetries; attempt++) {
       if (attempt > 0) {
         Serial.println("Retry attempt " + String(attempt) + " of " + String(maxRetries) + " for calendar " + String(i + 1));
@@ -824,7 +945,7 @@ bool CalendarFetcher::fetchCalendarWithRetry(int maxRetries) {
         Serial.println("Calendar fetch: WiFi reconnect successful");
       }
 
-      if (fetchCalendar(url)) {
+      if (fetchCalendar(url, windowStart, windowEnd)) {
         urlSuccess = true;
         anySuccess = true;
         break;  // Success — move on to next URL
@@ -835,24 +956,45 @@ bool CalendarFetcher::fetchCalendarWithRetry(int maxRetries) {
       }
     }
 
-    if (!urlSuccess) {
-      Serial.println("Failed to fetch calendar " + String(i + 1) + " after " + String(maxRetries + 1) + " attempts, continuing...");
+    if (urlSuccess) {
+      // Parsing ran without the mutex; only the swap holds it.
+      xSemaphoreTake(eventsMutex, portMAX_DELAY);
+      store.replaceFeed(i, CalendarStore::hashUrl(url.c_str()), windowStart, windowEnd, fetched, time(nullptr));
+      xSemaphoreGive(eventsMutex);
+    } else {
+      Serial.println("Failed to fetch calendar " + String(i + 1) + " after " + String(maxRetries + 1) + " attempts, keeping cached events");
     }
   }
+  fetched.clear();
+  fetched.shrink_to_fit();
+
+  xSemaphoreTake(eventsMutex, portMAX_DELAY);
+  store.setFeedCount(icalUrls.size());
+  selectDay();
+  xSemaphoreGive(eventsMutex);
 
-  // Sort merged events from all calendars by start time
   if (anySuccess) {
-    std::sort(events.begin(), events.end(),
-              [](const CalendarEvent& a, const CalendarEvent& b) {
-                return a.startTimestamp < b.startTimestamp;
-              });
-    Serial.println("Total merged events: " + String(events.size()));
+    Serial.println("Calendar store: " + String(store.size()) + " events");
+    if (!store.save()) Serial.println("Calendar store: SD write failed");
   }
 
-  xSemaphoreGive(eventsMutex);
+  fetches++;
+  fetchMsTotal += millis() - fetchStart;
   return anySuccess;
 }
 
+void CalendarFetcher::selectDay() {
+  store.query(currentDate, nextDayStart(currentDate), events);
+  eventsDigest = CalendarStore::digest(events);
+}
+
+void CalendarFetcher::begin() {
+  xSemaphoreTake(eventsMutex, portMAX_DELAY);
+  store.load(icalUrls);
+  selectDay();
+  xSemaphoreGive(eventsMutex);
+}
+
 // --- Async fetch support ---
 // Static task function — runs fetchCalendarWithRetry on its own stack, then self-deletes.
 void CalendarFetcher::fetchTask(void* param) {
@@ -901,6 +1043,31 @@ void CalendarFetcher::requestFetch() {
   );
 }
 
+// Called from UI action handlers (Core 1).
+void CalendarFetcher::requestDay() {
+  xSemaphoreTake(eventsMutex, portMAX_DELAY);
+  bool covered = store.covers(currentDate, nextDayStart(currentDate));
+  bool fresh = covered && store.fresh(time(nullptr));
+  if (covered) selectDay();
+  xSemaphoreGive(eventsMutex);
+
+  if (fresh) {
+    // Roughly what the fetch would have cost: the fetch itself, plus the
+    // idle tail before WiFi drops (30 s, wifi_client.cpp) if it had to connect.
+    // An estimate; test_week_of_day_views simulates a week of views for the
+    // fetches and radio time actually avoided.
+    dayHits++;
+    radioSavedMs += (fetches ? fetchMsTotal / fetches : 0) + (WiFi.status() == WL_CONNECTED ? 0 : 30000);
+    displayUpdateNeeded = true;
+    return;
+  }
+
+  // Stale or missing days refetch; a stale day goes on screen meanwhile.
+  dayMisses++;
+  requestFetch();
+  if (covered) displayUpdateNeeded = true;
+}
+
 // Called from UI_Loop_Task (Core 1) every loop iteration.
 // Returns true if display was updated.
 bool CalendarFetcher::checkDisplayUpdate() {
@@ -911,11 +1078,11 @@ bool CalendarFetcher::checkDisplayUpdate() {
 }
 
 void CalendarFetcher::nextDay() {
-  currentDate += 86400;  // Add one day in seconds
+  currentDate = timeZone.startOfDay(currentDate, 1);  // 23 or 25 hours across a DST change
 }
 
 void CalendarFetcher::prevDay() {
-  currentDate -= 86400;  // Subtract one day in seconds
+  currentDate = timeZone.startOfDay(currentDate, -1);
 }
 
 void CalendarFetcher::goToToday() {
@@ -992,9 +1159,22 @@ CalendarEvent CalendarFetcher::getEvent(int index) {
   return CalendarEvent{};
 }
 
-void CalendarFetcher::clearEvents() {
-  // Caller must already hold eventsMutex before calling this.
-  events.clear();
+void CalendarFetcher::logStats() {
+  xSemaphoreTake(eventsMutex, portMAX_DELAY);
+  size_t stored = store.size();
+  size_t duplicates = store.duplicates();
+  uint32_t mergeUs = store.mergeMicros();
+  uint8_t feeds = store.feeds();
+  xSemaphoreGive(eventsMutex);
+  Serial.printf("[Calendar] store=%u events (%u merged away in %luus) feeds=%u days: memory=%lu fetched=%lu "
+                "fetches=%lu (avg %lums) radio saved ~%lus unchanged refreshes=%lu\n",
+                (unsigned)stored, (unsigned)duplicates, (unsigned long)mergeUs, feeds,
+                (unsigned long)dayHits, (unsigned long)dayMisses,
+                (unsigned long)fetches, (unsigned long)(fetches ? fetchMsTotal / fetches : 0),
+                (unsigned long)(radioSavedMs / 1000), (unsigned long)refreshSkips);
+  Serial.printf("[Calendar] list: %lu events on %u rows, last bind %luus, %lu row binds\n",
+                (unsigned long)eventList.count(), eventList.poolSize(), (unsigned long)listBindUs,
+                (unsigned long)eventList.takeBinds());
 }
 
 void CalendarFetcher::serializeConfig(JsonDocument &doc) {
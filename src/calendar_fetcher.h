@@ -8,20 +8,18 @@
 #include <vector>
 #include <algorithm>
 #include <serializable_config.h>
-
-struct CalendarEvent {
-  char title[128];
-  char startTime[32];
-  char endTime[32];
-  time_t startTimestamp;
-  time_t endTimestamp;
-};
+#include "calendar_store.h"
+#include "recurrence.h"
+#include "virtual_list.h"
 
 class CalendarFetcher : public SerializableConfig {
 
 public:
   CalendarFetcher();
 
+  // Reads the SD copy of the event store.  Call after the config is read.
+  void begin();
+
   // Fetch calendar data with retry logic (blocking — used internally by the one-shot task)
   bool fetchCalendarWithRetry(int maxRetries = 2);
 
@@ -34,6 +32,11 @@ public:
   bool checkDisplayUpdate();
   bool isFetchInProgress() const { return fetchTaskHandle != NULL; }
 
+  // Shows the current date from the event store when it covers it, and
+  // fetches when it does not or when the store has gone stale.  Use this for
+  // navigation; requestFetch() always refetches the whole store window.
+  void requestDay();
+
   // Date navigation
   void nextDay();
   void prevDay();
@@ -49,13 +52,22 @@ public:
   // Update display with current events
   void updateCalendarDisplay();
 
+  void logStats();
+
+  // Times the old rebuild-everything list and the virtual list on `count`
+  // synthetic events (build or bind, a drag to the end, heap), then puts the
+  // real events back.  Serial command "calbench".
+  void benchmarkList(uint16_t count);
+
 public:
   void serializeConfig(JsonDocument &doc) override;
   void deserializeConfig(JsonDocument &doc) override;
 
 private:
   time_t currentDate;
-  std::vector<CalendarEvent> events;
+  std::vector<CalendarEvent> events;       // the current date, copied out of the store
+  CalendarStore store;
+  std::vector<CalendarEvent> fetched;      // feed being parsed (fetch task only)
   std::vector<String> icalUrls;
 
   // One-shot fetch task
@@ -63,22 +75,48 @@ private:
   TaskHandle_t fetchTaskHandle = NULL;
   static void fetchTask(void* param);
 
-  // Protects the events vector against concurrent access between
-  // Core 0 (fetch task clearing/populating events) and
+  // Protects the events vector and the store against concurrent access between
+  // Core 0 (fetch task swapping feeds into the store) and
   // Core 1 (UI loop reading events in updateCalendarDisplay).
   SemaphoreHandle_t eventsMutex = NULL;
 
+  // Copies the current date out of the store.  Caller holds eventsMutex.
+  void selectDay();
+  uint32_t eventsDigest = 0;               // CalendarStore::digest(events)
+
+  uint32_t dayHits = 0;                    // days shown from a fresh store
+  uint32_t dayMisses = 0;
+  uint32_t fetches = 0;
+  uint32_t fetchMsTotal = 0;
+  uint32_t radioSavedMs = 0;
+
+  // Event list: a fixed pool of rows recycled over `shown` (UI task only).
+  VirtualList eventList;
+  std::vector<CalendarEvent> shown;
+  uint32_t shownDigest = 0;
+  time_t shownDate = 0;
+  uint32_t refreshSkips = 0;               // updates that found the list current
+  uint32_t listBindUs = 0;                 // last setCount() and scroll-to-now
+  static void createEventRow(lv_obj_t *row, void *ctx);
+  static void bindEventRow(lv_obj_t *row, uint32_t index, void *ctx);
+  bool attachEventList();
+
   // Fetching and parsing
   bool isLeapYear(int year);
-  bool fetchCalendar(String url);
-  void parseVEvent(String eventData);
+  bool fetchCalendar(String url, time_t windowStart, time_t windowEnd);
+  // Adds every instance of the event that overlaps [windowStart, windowEnd).
+  void parseVEvent(String eventData, time_t windowStart, time_t windowEnd);
+  void addOccurrence(const CalendarEvent &base, time_t start, time_t duration, bool allDay);
   time_t parseICalDateTime(String dtString);
   String formatTime(time_t timestamp);
   String decodeICalString(String str);
   String urlEncode(String str);
   void updateDatePickerDefaults();
-  bool eventOccursOnDate(time_t eventStart, String rrule, time_t targetDate);
-  void clearEvents();
+
+  // Instances of recurring events replaced by their own VEVENT (RECURRENCE-ID),
+  // collected per feed before the events are expanded.
+  RecurrenceOverrides overrides;
+  void collectOverrides(const char *payload);
 };
 
 #endif
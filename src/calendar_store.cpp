@@ -0,0 +1,262 @@
+#include "calendar_store.h"
+#include "SD_Card.h"
+#include "civil_time.h"
+#include <esp_timer.h>
+#include <algorithm>
+#include <ctype.h>
+
+extern TimeZone timeZone;
+
+// FNV-1a
+uint32_t CalendarStore::hashUrl(const char *url) {
+  uint32_t hash = 2166136261u;
+  while (*url) {
+    hash ^= (uint8_t)*url++;
+    hash *= 16777619u;
+  }
+  return hash;
+}
+
+// Whole local days, so DST-length days stay on midnight.
+void CalendarStore::windowFor(time_t anchor, time_t &start, time_t &end) {
+  start = timeZone.startOfDay(anchor, -CALENDAR_STORE_DAYS_BEFORE);
+  end = timeZone.startOfDay(anchor, CALENDAR_STORE_DAYS_AFTER + 1);
+}
+
+void CalendarStore::reindex() {
+  std::stable_sort(entries.begin(), entries.end(), [](const Entry &a, const Entry &b) {
+    return a.event.startTimestamp < b.event.startTimestamp;
+  });
+  maxDuration = 0;
+  for (const Entry &entry : entries) {
+    time_t duration = entry.event.endTimestamp - entry.event.startTimestamp;
+    if (duration > maxDuration) maxDuration = duration;
+  }
+  merge();
+}
+
+// murmur3 finaliser
+static inline uint32_t mix(uint32_t h) {
+  h ^= h >> 16;
+  h *= 0x85ebca6b;
+  h ^= h >> 13;
+  h *= 0xc2b2ae35;
+  h ^= h >> 16;
+  return h;
+}
+
+static uint32_t identityKey(const CalendarEvent &event) {
+  uint64_t instance = (uint64_t)event.instance;
+  return mix(event.uidHash ^ mix((uint32_t)instance ^ mix((uint32_t)(instance >> 32))));
+}
+
+// Title compared case-blind with runs of spaces collapsed, plus the local
+// start hour.
+static uint32_t contentKey(const CalendarEvent &event) {
+  uint32_t hash = 2166136261u;
+  bool gap = false, started = false;
+  for (const char *c = event.title; *c; c++) {
+    if (isspace((uint8_t)*c)) {
+      gap = started;
+      continue;
+    }
+    if (gap) hash = (hash ^ ' ') * 16777619u;
+    hash = (hash ^ (uint8_t)tolower((uint8_t)*c)) * 16777619u;
+    gap = false;
+    started = true;
+  }
+  uint32_t hour = (uint32_t)(timeZone.utcToLocal(event.startTimestamp) / 3600);
+  return mix(hash ^ mix(hour ^ 0x5bd1e995));
+}
+
+struct MergeSlot {
+  uint32_t key;
+  uint32_t entry;                          // winning entry + 1, 0: empty
+};
+
+// Linear probing; `same(entry)` confirms a key match.
+template <typename Same>
+static MergeSlot &findSlot(std::vector<MergeSlot> &table, uint32_t key, Same same) {
+  size_t mask = table.size() - 1;
+  for (size_t i = key & mask;; i = (i + 1) & mask) {
+    MergeSlot &slot = table[i];
+    if (!slot.entry || (slot.key == key && same(slot.entry - 1))) return slot;
+  }
+}
+
+// One pass in start order.  An entry loses to an earlier one of the same
+// event in the same or a lower feed, and displaces one from a higher feed.
+void CalendarStore::merge() {
+  int64_t started = esp_timer_get_time();
+  size_t size = 4;
+  while (size < entries.size() * 4) size <<= 1;    // two keys per entry, half full
+  std::vector<MergeSlot> table(size);
+  std::vector<uint32_t> contentKeys(entries.size());
+
+  for (uint32_t i = 0; i < entries.size(); i++) {
+    Entry &entry = entries[i];
+    const CalendarEvent &event = entry.event;
+    entry.duplicate = false;
+    contentKeys[i] = contentKey(event);
+
+    auto sameIdentity = [&](uint32_t other) {
+      const CalendarEvent &o = entries[other].event;
+      return o.uidHash == event.uidHash && o.instance == event.instance;
+    };
+    auto sameContent = [&](uint32_t other) { return contentKeys[other] == contentKeys[i]; };
+
+    uint32_t idKey = event.uidHash ? identityKey(event) : 0;
+    MergeSlot *idSlot = event.uidHash ? &findSlot(table, idKey, sameIdentity) : nullptr;
+    MergeSlot *contentSlot = &findSlot(table, contentKeys[i], sameContent);
+
+    if (idSlot && idSlot->entry && entries[idSlot->entry - 1].feed <= entry.feed) entry.duplicate = true;
+    if (contentSlot->entry && entries[contentSlot->entry - 1].feed <= entry.feed) entry.duplicate = true;
+
+    // A winner takes both keys over; a loser only claims keys nobody holds.
+    if (idSlot && (!idSlot->entry || !entry.duplicate)) {
+      if (idSlot->entry) entries[idSlot->entry - 1].duplicate = true;
+      *idSlot = { idKey, i + 1 };
+      // Both lookups may have picked the same empty slot.
+      if (contentSlot == idSlot) contentSlot = &findSlot(table, contentKeys[i], sameContent);
+    }
+    if (!contentSlot->entry || !entry.duplicate) {
+      if (contentSlot->entry && contentSlot->entry != i + 1) entries[contentSlot->entry - 1].duplicate = true;
+      *contentSlot = { contentKeys[i], i + 1 };
+    }
+  }
+
+  duplicateCount = 0;
+  for (const Entry &entry : entries) duplicateCount += entry.duplicate;
+  mergeUs = esp_timer_get_time() - started;
+}
+
+void CalendarStore::replaceFeed(uint8_t feed, uint32_t urlHash, time_t start, time_t end,
+                                const std::vector<CalendarEvent> &fetched, time_t now) {
+  if (feed >= CALENDAR_STORE_MAX_FEEDS) return;
+  entries.erase(std::remove_if(entries.begin(), entries.end(),
+                               [feed](const Entry &entry) { return entry.feed == feed; }),
+                entries.end());
+  entries.reserve(entries.size() + fetched.size());
+  for (const CalendarEvent &event : fetched) entries.push_back({ event, feed, false });
+  reindex();
+
+  feedInfo[feed] = { urlHash, (int64_t)now, (int64_t)start, (int64_t)end };
+  if (feed >= feedCount) feedCount = feed + 1;
+}
+
+void CalendarStore::setFeedCount(uint8_t count) {
+  if (count > CALENDAR_STORE_MAX_FEEDS) count = CALENDAR_STORE_MAX_FEEDS;
+  if (count >= feedCount) {
+    feedCount = count;
+    return;
+  }
+  entries.erase(std::remove_if(entries.begin(), entries.end(),
+                               [count](const Entry &entry) { return entry.feed >= count; }),
+                entries.end());
+  for (uint8_t f = count; f < CALENDAR_STORE_MAX_FEEDS; f++) feedInfo[f] = {};
+  feedCount = count;
+  reindex();
+}
+
+bool CalendarStore::covers(time_t dayStart, time_t dayEnd) {
+  for (uint8_t f = 0; f < feedCount; f++) {
+    const Feed &feed = feedInfo[f];
+    if (!feed.fetchedAt || dayStart < feed.start || dayEnd > feed.end) return false;
+  }
+  return true;
+}
+
+bool CalendarStore::fresh(time_t now) {
+  for (uint8_t f = 0; f < feedCount; f++) {
+    if (now - feedInfo[f].fetchedAt >= CALENDAR_STORE_MAX_AGE_S) return false;
+  }
+  return true;
+}
+
+void CalendarStore::query(time_t dayStart, time_t dayEnd, std::vector<CalendarEvent> &out) {
+  out.clear();
+  time_t from = dayStart - maxDuration;
+  auto it = std::lower_bound(entries.begin(), entries.end(), from, [](const Entry &entry, time_t t) {
+    return entry.event.startTimestamp < t;
+  });
+
+  for (; it != entries.end() && it->event.startTimestamp < dayEnd; ++it) {
+    const CalendarEvent &event = it->event;
+    // Zero-length events count when they start inside the day.
+    if (event.startTimestamp < dayStart && event.endTimestamp <= dayStart) continue;
+    if (!it->duplicate) out.push_back(event);
+  }
+}
+
+// FNV-1a over what a row shows.
+uint32_t CalendarStore::digest(const std::vector<CalendarEvent> &events) {
+  uint32_t hash = 2166136261u;
+  auto add = [&hash](const void *data, size_t length) {
+    const uint8_t *bytes = (const uint8_t *)data;
+    for (size_t i = 0; i < length; i++) hash = (hash ^ bytes[i]) * 16777619u;
+  };
+  for (const CalendarEvent &event : events) {
+    add(event.title, strlen(event.title) + 1);
+    add(event.startTime, strlen(event.startTime) + 1);
+    add(event.endTime, strlen(event.endTime) + 1);
+    add(&event.startTimestamp, sizeof(event.startTimestamp));
+    add(&event.endTimestamp, sizeof(event.endTimestamp));
+  }
+  return hash;
+}
+
+bool CalendarStore::load(const std::vector<String> &urls) {
+  File file = SD_MMC.open(CALENDAR_STORE_PATH);
+  if (!file) return false;
+
+  header_t header;
+  bool ok = file.read((uint8_t *)&header, sizeof(header)) == sizeof(header) &&
+            header.magic == CALENDAR_STORE_MAGIC && header.version == CALENDAR_STORE_VERSION &&
+            header.entrySize == sizeof(Entry) && header.feedCount <= CALENDAR_STORE_MAX_FEEDS &&
+            file.size() == sizeof(header) + header.feedCount * sizeof(Feed) + header.count * sizeof(Entry);
+  Feed stored[CALENDAR_STORE_MAX_FEEDS] = {};
+  std::vector<Entry> loaded;
+  if (ok) {
+    loaded.resize(header.count);
+    size_t feedsSize = header.feedCount * sizeof(Feed);
+    size_t entriesSize = header.count * sizeof(Entry);
+    ok = file.read((uint8_t *)stored, feedsSize) == feedsSize &&
+         file.read((uint8_t *)loaded.data(), entriesSize) == entriesSize;
+  }
+  file.close();
+  if (!ok) return false;
+
+  // Keep only feeds still configured at the same position.
+  uint8_t count = urls.size() < header.feedCount ? urls.size() : header.feedCount;
+  bool keep[CALENDAR_STORE_MAX_FEEDS] = {};
+  for (uint8_t f = 0; f < count; f++) {
+    keep[f] = stored[f].urlHash == hashUrl(urls[f].c_str());
+    feedInfo[f] = keep[f] ? stored[f] : Feed{};
+  }
+  loaded.erase(std::remove_if(loaded.begin(), loaded.end(),
+                              [&keep](const Entry &entry) {
+                                return entry.feed >= CALENDAR_STORE_MAX_FEEDS || !keep[entry.feed];
+                              }),
+               loaded.end());
+  entries.swap(loaded);
+  feedCount = count;
+  reindex();
+  Serial.printf("Calendar: loaded %u cached events for %u feeds\n", (unsigned)entries.size(), count);
+  return true;
+}
+
+bool CalendarStore::save() {
+  File file = SD_MMC.open(CALENDAR_STORE_PATH, FILE_WRITE);
+  if (!file) return false;
+
+  header_t header = { CALENDAR_STORE_MAGIC, CALENDAR_STORE_VERSION, feedCount, 0,
+                      (uint32_t)entries.size(), sizeof(Entry) };
+  size_t feedsSize = feedCount * sizeof(Feed);
+  size_t entriesSize = entries.size() * sizeof(Entry);
+  bool ok = file.write((const uint8_t *)&header, sizeof(header)) == sizeof(header) &&
+            file.write((const uint8_t *)feedInfo, feedsSize) == feedsSize &&
+            file.write((const uint8_t *)entries.data(), entriesSize) == entriesSize;
+  file.close();
+  if (!ok) SD_MMC.remove(CALENDAR_STORE_PATH);
+  return ok;
+}
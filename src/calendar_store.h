@@ -0,0 +1,114 @@
+#pragma once
+
+#ifndef CALENDAR_STORE_H
+#define CALENDAR_STORE_H
+
+#include <Arduino.h>
+#include <time.h>
+#include <vector>
+
+struct CalendarEvent {
+  char title[128];
+  char startTime[32];
+  char endTime[32];
+  time_t startTimestamp;
+  time_t endTimestamp;
+  uint32_t uidHash;                        // 0: the VEVENT had no UID
+  time_t instance;                         // RECURRENCE-ID, else the original start
+};
+
+// Rolling store of expanded calendar events for a window of days around
+// today, so day navigation is answered from memory instead of a WiFi fetch.
+//
+// Events are kept sorted by start time.  Together with the longest event
+// duration seen, that is the interval index: a day query binary-searches to
+// (day start - longest duration) and scans forward until the day ends.
+//
+// Each feed is replaced as a whole when it is fetched and carries its own
+// freshness stamp and covered window, so one failing feed keeps its previous
+// events instead of emptying the day.  The store is mirrored to the SD card
+// after every fetch and read back at boot; a stale store keeps answering
+// while the caller refetches.
+//
+// Feeds are merged in one hash-table pass whenever the store changes.  Two
+// entries are the same event when they share UID and instance (the same
+// occurrence reached through two subscriptions), or a normalised title and
+// local start hour (a copy shared into another calendar under a new UID).
+// The lower feed index wins, so the first configured calendar is the one
+// shown; within a feed the earlier entry wins.
+#define CALENDAR_STORE_DAYS_BEFORE  1
+#define CALENDAR_STORE_DAYS_AFTER   14
+#define CALENDAR_STORE_MAX_FEEDS    8
+#define CALENDAR_STORE_MAX_AGE_S    (3 * 60 * 60)   // older feeds are refetched when a day is shown
+#define CALENDAR_STORE_PATH         "/calendar_cache.bin"
+#define CALENDAR_STORE_MAGIC        0x53434143      // "CACS"
+#define CALENDAR_STORE_VERSION      2
+
+class CalendarStore {
+  public:
+    // Reads the SD copy.  Feeds whose URL no longer matches are dropped.
+    bool load(const std::vector<String> &urls);
+    bool save();
+
+    // [start, end) of the store window around the local midnight `anchor`.
+    static void windowFor(time_t anchor, time_t &start, time_t &end);
+    static uint32_t hashUrl(const char *url);
+
+    // Swaps in a feed fetched at `now` covering [start, end).
+    void replaceFeed(uint8_t feed, uint32_t urlHash, time_t start, time_t end,
+                     const std::vector<CalendarEvent> &fetched, time_t now);
+    // Drops feeds at and above `count` (a URL was removed).
+    void setFeedCount(uint8_t count);
+
+    // True when every feed has been fetched over a window containing the day.
+    bool covers(time_t dayStart, time_t dayEnd);
+    // True when every feed was fetched within CALENDAR_STORE_MAX_AGE_S.
+    bool fresh(time_t now);
+
+    // Events overlapping [dayStart, dayEnd), by start time, duplicates across
+    // feeds removed.
+    void query(time_t dayStart, time_t dayEnd, std::vector<CalendarEvent> &out);
+
+    // Changes whenever anything the event list shows changes.
+    static uint32_t digest(const std::vector<CalendarEvent> &events);
+
+    size_t size() { return entries.size(); }
+    uint8_t feeds() { return feedCount; }
+    size_t duplicates() { return duplicateCount; }
+    uint32_t mergeMicros() { return mergeUs; }
+
+  private:
+    struct Entry {
+      CalendarEvent event;
+      uint8_t feed;
+      bool duplicate;                      // set by merge()
+    };
+
+    struct Feed {
+      uint32_t urlHash;
+      int64_t fetchedAt;                   // 0: never fetched
+      int64_t start;
+      int64_t end;
+    };
+
+    typedef struct __attribute__((packed)) {
+      uint32_t magic;
+      uint16_t version;
+      uint8_t feedCount;
+      uint8_t reserved;
+      uint32_t count;
+      uint32_t entrySize;                  // sizeof(Entry), catches layout changes
+    } header_t;
+
+    void reindex();
+    void merge();
+
+    std::vector<Entry> entries;            // sorted by event.startTimestamp
+    size_t duplicateCount = 0;
+    uint32_t mergeUs = 0;
+    time_t maxDuration = 0;
+    Feed feedInfo[CALENDAR_STORE_MAX_FEEDS] = {};
+    uint8_t feedCount = 0;
+};
+
+#endif /* calendar_store.h */
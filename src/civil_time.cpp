@@ -0,0 +1,318 @@
+#include "civil_time.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Howard Hinnant's days_from_civil / civil_from_days.
+int32_t civilToDays(int year, int month, int day) {
+  year -= month <= 2;
+  const int era = (year >= 0 ? year : year - 399) / 400;
+  const unsigned yoe = (unsigned)(year - era * 400);
+  const unsigned doy = (153 * (month + (month > 2 ? -3 : 9)) + 2) / 5 + day - 1;
+  const unsigned doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+  return era * 146097 + (int32_t)doe - 719468;
+}
+
+void civilFromDays(int32_t days, CivilTime &out) {
+  days += 719468;
+  const int32_t era = (days >= 0 ? days : days - 146096) / 146097;
+  const unsigned doe = (unsigned)(days - era * 146097);
+  const unsigned yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+  const unsigned doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+  const unsigned mp = (5 * doy + 2) / 153;
+  const unsigned month = mp < 10 ? mp + 3 : mp - 9;
+  out.year = (int16_t)(yoe + era * 400 + (month <= 2));
+  out.month = (uint8_t)month;
+  out.day = (uint8_t)(doy - (153 * mp + 2) / 5 + 1);
+}
+
+uint8_t civilWeekday(int32_t days) {
+  return (uint8_t)(days >= -4 ? (days + 4) % 7 : (days + 5) % 7 + 6);
+}
+
+static bool isLeap(int year) {
+  return (year % 4 == 0 && year % 100 != 0) || year % 400 == 0;
+}
+
+int civilDaysInMonth(int year, int month) {
+  static const uint8_t days[12] = { 31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31 };
+  return month == 2 && isLeap(year) ? 29 : days[month - 1];
+}
+
+int civilDaysInYear(int year) {
+  return isLeap(year) ? 366 : 365;
+}
+
+time_t civilToUtc(const CivilTime &civil) {
+  return (time_t)civilToDays(civil.year, civil.month, civil.day) * 86400 +
+         civil.hour * 3600 + civil.minute * 60 + civil.second;
+}
+
+static int32_t floorDays(time_t t) {
+  return (int32_t)(t >= 0 ? t / 86400 : (t - 86399) / 86400);
+}
+
+void civilFromUtc(time_t utc, CivilTime &out) {
+  int32_t days = floorDays(utc);
+  int32_t seconds = (int32_t)(utc - (time_t)days * 86400);
+  civilFromDays(days, out);
+  out.hour = seconds / 3600;
+  out.minute = seconds / 60 % 60;
+  out.second = seconds % 60;
+}
+
+// --- TimeZone ---
+
+// <quoted> or at least three letters.
+static const char *parseName(const char *p) {
+  if (*p == '<') {
+    const char *close = strchr(p, '>');
+    return close ? close + 1 : nullptr;
+  }
+  const char *start = p;
+  while ((*p >= 'A' && *p <= 'Z') || (*p >= 'a' && *p <= 'z')) p++;
+  return p - start >= 3 ? p : nullptr;
+}
+
+static bool parseNumber(const char *&p, int &value) {
+  if (*p < '0' || *p > '9') return false;
+  value = 0;
+  while (*p >= '0' && *p <= '9' && value < 1000) value = value * 10 + (*p++ - '0');
+  return true;
+}
+
+// [+-]hh[:mm[:ss]], in seconds with the sign as written.
+bool TimeZone::parseOffset(const char *&p, int32_t &seconds, int maxHours) {
+  int sign = 1;
+  if (*p == '+' || *p == '-') {
+    if (*p == '-') sign = -1;
+    p++;
+  }
+  int parts[3] = { 0, 0, 0 };
+  if (!parseNumber(p, parts[0])) return false;
+  for (int i = 1; i < 3 && *p == ':'; i++) {
+    p++;
+    if (!parseNumber(p, parts[i])) return false;
+  }
+  if (parts[0] > maxHours || parts[1] > 59 || parts[2] > 59) return false;
+  seconds = sign * (parts[0] * 3600 + parts[1] * 60 + parts[2]);
+  return true;
+}
+
+// Jn, n or Mm.w.d, then an optional /time.
+bool TimeZone::parseRule(const char *&p, Rule &rule) {
+  int a, b, c;
+  rule = {};
+  rule.time = 2 * 3600;
+  if (*p == 'M') {
+    p++;
+    if (!parseNumber(p, a) || *p++ != '.' || !parseNumber(p, b) || *p++ != '.' || !parseNumber(p, c)) return false;
+    if (a < 1 || a > 12 || b < 1 || b > 5 || c > 6) return false;
+    rule.kind = 'M';
+    rule.month = a;
+    rule.week = b;
+    rule.weekday = c;
+  } else if (*p == 'J') {
+    p++;
+    if (!parseNumber(p, a) || a < 1 || a > 365) return false;
+    rule.kind = 'J';
+    rule.day = a;
+  } else {
+    if (!parseNumber(p, a) || a > 365) return false;
+    rule.kind = 'D';
+    rule.day = a;
+  }
+  if (*p == '/') {
+    p++;
+    return parseOffset(p, rule.time, 167);
+  }
+  return true;
+}
+
+bool TimeZone::set(const char *posix) {
+  Rules parsed = {};
+  const char *p = posix ? posix : "";
+  if (*p) {
+    // POSIX offsets count hours west of Greenwich.
+    if (!(p = parseName(p)) || !parseOffset(p, parsed.stdOffset, 24)) return false;
+    parsed.stdOffset = -parsed.stdOffset;
+    if (*p) {
+      if (!(p = parseName(p))) return false;
+      parsed.hasDst = true;
+      parsed.dstOffset = parsed.stdOffset + 3600;
+      if (*p && *p != ',') {
+        if (!parseOffset(p, parsed.dstOffset, 24)) return false;
+        parsed.dstOffset = -parsed.dstOffset;
+      }
+      if (*p == ',') {
+        p++;
+        if (!parseRule(p, parsed.start) || *p++ != ',' || !parseRule(p, parsed.end)) return false;
+      } else {
+        parsed.start = { 'M', 3, 2, 0, 0, 2 * 3600 };
+        parsed.end = { 'M', 11, 1, 0, 0, 2 * 3600 };
+      }
+      if (*p) return false;
+    }
+  }
+
+  uint8_t next = generation.load(std::memory_order_relaxed) + 1;
+  rules[next & 1] = parsed;
+  for (std::atomic<uint32_t> &slot : dayCache) slot.store(0, std::memory_order_relaxed);
+  generation.store(next, std::memory_order_release);
+  return true;
+}
+
+// UTC instant of a transition in `year`, given in the local time in effect
+// before it.
+time_t TimeZone::transition(const Rule &rule, int year, int32_t offsetBefore) {
+  int32_t days;
+  if (rule.kind == 'J') {
+    days = civilToDays(year, 1, 1) + rule.day - 1;
+    if (rule.day >= 60 && civilDaysInYear(year) == 366) days++;
+  } else if (rule.kind == 'D') {
+    days = civilToDays(year, 1, 1) + rule.day;
+  } else {
+    int32_t first = civilToDays(year, rule.month, 1);
+    int32_t monthEnd = first + civilDaysInMonth(year, rule.month);
+    days = first + (rule.weekday - civilWeekday(first) + 7) % 7 + (rule.week - 1) * 7;
+    while (days >= monthEnd) days -= 7;
+  }
+  return (time_t)days * 86400 + rule.time - offsetBefore;
+}
+
+int32_t TimeZone::computeOffset(const Rules &r, time_t utc, bool *dst) {
+  bool inDst = false;
+  if (r.hasDst) {
+    // Transitions of the UTC year, as newlib and glibc pick them.
+    CivilTime civil;
+    civilFromUtc(utc, civil);
+    time_t start = transition(r.start, civil.year, r.stdOffset);
+    time_t end = transition(r.end, civil.year, r.dstOffset);
+    // Southern zones start DST late in the year and end it early the next.
+    inDst = start < end ? (utc >= start && utc < end) : (utc < end || utc >= start);
+  }
+  if (dst) *dst = inDst;
+  return inDst ? r.dstOffset : r.stdOffset;
+}
+
+int32_t TimeZone::offsetAt(time_t utc, bool *dst) {
+  uint8_t gen = generation.load(std::memory_order_acquire);
+  const Rules &r = rules[gen & 1];
+  if (!r.hasDst) {
+    if (dst) *dst = false;
+    return r.stdOffset;
+  }
+
+  int32_t day = floorDays(utc);
+  if (day >= 0 && day < 0xFFFF) {
+    std::atomic<uint32_t> &slot = dayCache[day % TIME_ZONE_DAY_CACHE];
+    uint32_t entry = slot.load(std::memory_order_relaxed);
+    if ((entry >> 16) == (uint32_t)day + 1 && (entry & 0x7F) == (gen & 0x7Fu)) {
+      if (dst) *dst = entry & 0x80;
+      return (int8_t)(entry >> 8) * 900;
+    }
+
+    // Cache the day only if one offset covers all of it.
+    bool startDst, endDst;
+    time_t dayStart = (time_t)day * 86400;
+    int32_t offset = computeOffset(r, dayStart, &startDst);
+    if (computeOffset(r, dayStart + 86399, &endDst) == offset && startDst == endDst && offset % 900 == 0) {
+      slot.store((uint32_t)(day + 1) << 16 | (uint32_t)(uint8_t)(int8_t)(offset / 900) << 8 |
+                 (startDst ? 0x80u : 0u) | (gen & 0x7Fu), std::memory_order_relaxed);
+      if (dst) *dst = startDst;
+      return offset;
+    }
+  }
+  return computeOffset(r, utc, dst);
+}
+
+time_t TimeZone::localToUtc(time_t local) {
+  const Rules &r = rules[generation.load(std::memory_order_acquire) & 1];
+  time_t asStd = local - r.stdOffset;
+  if (!r.hasDst) return asStd;
+
+  // The DST reading wins when it is valid (times that happen twice); in the
+  // spring-forward gap neither is, and the standard reading is used.
+  time_t asDst = local - r.dstOffset;
+  bool dst;
+  offsetAt(asDst, &dst);
+  return dst ? asDst : asStd;
+}
+
+void TimeZone::toLocal(time_t utc, CivilTime &out) {
+  civilFromUtc(utcToLocal(utc), out);
+}
+
+void TimeZone::toLocal(time_t utc, struct tm &out) {
+  bool dst;
+  time_t local = utc + offsetAt(utc, &dst);
+  int32_t days = floorDays(local);
+  CivilTime civil;
+  civilFromUtc(local, civil);
+  out = {};
+  out.tm_year = civil.year - 1900;
+  out.tm_mon = civil.month - 1;
+  out.tm_mday = civil.day;
+  out.tm_hour = civil.hour;
+  out.tm_min = civil.minute;
+  out.tm_sec = civil.second;
+  out.tm_wday = civilWeekday(days);
+  out.tm_yday = days - civilToDays(civil.year, 1, 1);
+  out.tm_isdst = dst;
+}
+
+time_t TimeZone::startOfDay(time_t utc, int days) {
+  return localToUtc((time_t)(floorDays(utcToLocal(utc)) + days) * 86400);
+}
+
+// POSIX zone names are letters only; numeric abbreviations ("+0545") go in <>.
+static int appendZoneName(char *out, size_t len, const char *name) {
+  bool alpha = name[0] != '\0';
+  for (const char *c = name; *c; c++) {
+    if (!((*c >= 'A' && *c <= 'Z') || (*c >= 'a' && *c <= 'z'))) alpha = false;
+  }
+  return snprintf(out, len, alpha ? "%s" : "<%s>", name);
+}
+
+// ",Mm.w.d[/h[:mm]]" for a transition at `utc`, in the local time in
+// effect before it.
+static int appendRule(char *out, size_t len, time_t utc, int32_t offsetBefore) {
+  CivilTime local;
+  civilFromUtc(utc + offsetBefore, local);
+  int32_t days = civilToDays(local.year, local.month, local.day);
+  int week = local.day + 7 > civilDaysInMonth(local.year, local.month) ? 5 : (local.day - 1) / 7 + 1;
+  int n = snprintf(out, len, ",M%u.%d.%u", local.month, week, civilWeekday(days));
+  if (local.hour != 2 || local.minute || local.second) {
+    n += snprintf(out + n, len > (size_t)n ? len - n : 0, "/%u", local.hour);
+    if (local.minute) n += snprintf(out + n, len > (size_t)n ? len - n : 0, ":%02u", local.minute);
+  }
+  return n;
+}
+
+int posixZoneString(char *out, size_t len, const char *abbr, int32_t gmtOffset, bool dst,
+                    const char *nextAbbr, time_t zoneStart, time_t zoneEnd) {
+  // Zones without DST have no (or the same) next abbreviation.  When DST is
+  // in effect the service reports the DST name and offset.
+  bool hasDst = nextAbbr && nextAbbr[0] && strcmp(nextAbbr, abbr) != 0;
+  if (!hasDst) dst = false;
+  const char *stdAbbr = dst ? nextAbbr : abbr;
+  const char *dstAbbr = dst ? abbr : nextAbbr;
+  int32_t stdOffset = dst ? gmtOffset - 3600 : gmtOffset;
+  int32_t dstOffset = stdOffset + 3600;
+  int posixMinutes = -stdOffset / 60;      // POSIX counts west of Greenwich
+
+  #define REST(n) (len > (size_t)(n) ? len - (n) : 0)
+  int n = appendZoneName(out, len, stdAbbr);   // CST6CDT, IST-5:30
+  n += snprintf(out + n, REST(n), "%d", posixMinutes / 60);
+  if (posixMinutes % 60) n += snprintf(out + n, REST(n), ":%02d", abs(posixMinutes % 60));
+  if (!hasDst) return n;
+  n += appendZoneName(out + n, REST(n), dstAbbr);
+  if (zoneStart > 0 && zoneEnd > zoneStart) {
+    time_t dstStart = dst ? zoneStart : zoneEnd;
+    time_t dstEnd = dst ? zoneEnd : zoneStart;
+    n += appendRule(out + n, REST(n), dstStart, stdOffset);
+    n += appendRule(out + n, REST(n), dstEnd, dstOffset);
+  }
+  #undef REST
+  return n;
+}
@@ -0,0 +1,106 @@
+#pragma once
+
+#ifndef CIVIL_TIME_H
+#define CIVIL_TIME_H
+
+#include <stdint.h>
+#include <time.h>
+#include <atomic>
+
+// Proleptic Gregorian date arithmetic, and the local time zone compiled from
+// its POSIX TZ string.  Nothing here reads or writes the TZ environment
+// variable or newlib's time zone state, so any task may call it at any time.
+
+struct CivilTime {
+  int16_t year;
+  uint8_t month;     // 1-12
+  uint8_t day;       // 1-31
+  uint8_t hour;
+  uint8_t minute;
+  uint8_t second;
+};
+
+// Days since 1970-01-01 and back.  `day` may run past the end of the month.
+int32_t civilToDays(int year, int month, int day);
+void civilFromDays(int32_t days, CivilTime &out);
+// 0 = Sunday, matching struct tm.
+uint8_t civilWeekday(int32_t days);
+int civilDaysInMonth(int year, int month);
+int civilDaysInYear(int year);
+
+// Seconds since the epoch for a civil time read as UTC, and back.
+time_t civilToUtc(const CivilTime &civil);
+void civilFromUtc(time_t utc, CivilTime &out);
+
+#define TIME_ZONE_DAY_CACHE     16      // per-day offsets remembered, direct mapped
+
+// The watch's local time zone, as set by TimeClient ("CST6CDT",
+// "AEST-10AEDT,M10.1.0,M4.1.0/3", "<+0545>-5:45" ...).  Like newlib, a zone
+// with DST but no rule part switches on M3.2.0 and off on M11.1.0 at 02:00.
+// A local time in the spring-forward gap reads as standard time (02:30
+// becomes 03:30 DST) and one that happens twice reads as DST, which is what
+// mktime() with tm_isdst = -1 gives.  Until set() succeeds the zone is UTC.
+//
+// Offsets are cached per UTC day, one atomic word per entry; days with a
+// transition in them are always computed.  set() compiles into the spare
+// rule slot and then bumps the generation that selects it, so a reader sees
+// the old zone or the new one, never a mix.
+class TimeZone {
+  public:
+    // False (zone unchanged) when the string does not parse.
+    bool set(const char *posix);
+
+    // Seconds east of UTC in effect at `utc`.
+    int32_t offsetAt(time_t utc, bool *dst = nullptr);
+
+    // Local wall-clock time as seconds since a local 1970-01-01, and back.
+    time_t utcToLocal(time_t utc) { return utc + offsetAt(utc); }
+    time_t localToUtc(time_t local);
+
+    // localtime_r() and mktime(tm_isdst = -1) without the TZ machinery.
+    void toLocal(time_t utc, struct tm &out);
+    void toLocal(time_t utc, CivilTime &out);
+    time_t fromLocal(const CivilTime &local) { return localToUtc(civilToUtc(local)); }
+
+    // Local midnight `days` days after the start of the local day holding `utc`.
+    time_t startOfDay(time_t utc, int days = 0);
+
+  private:
+    struct Rule {
+      char kind;                           // 'J' (1-365, no Feb 29), 'D' (0-365) or 'M'
+      uint8_t month, week, weekday;        // 'M': week 5 is the last
+      uint16_t day;                        // 'J' and 'D'
+      int32_t time;                        // seconds after local midnight, may be negative or > 24 h
+    };
+
+    struct Rules {
+      int32_t stdOffset;                   // seconds east of UTC
+      int32_t dstOffset;
+      bool hasDst;
+      Rule start, end;
+    };
+
+    static bool parseOffset(const char *&p, int32_t &seconds, int maxHours);
+    static bool parseRule(const char *&p, Rule &rule);
+    static time_t transition(const Rule &rule, int year, int32_t offsetBefore);
+    static int32_t computeOffset(const Rules &rules, time_t utc, bool *dst);
+
+    Rules rules[2] = {};                   // rules[generation & 1] is live
+    std::atomic<uint8_t> generation{0};
+    // (day + 1) << 16 | offset in quarter hours << 8 | dst << 7 | generation & 0x7f.
+    std::atomic<uint32_t> dayCache[TIME_ZONE_DAY_CACHE] = {};
+};
+
+// POSIX TZ string for a zone as timezone services describe it (timezonedb's
+// get-time-zone): the abbreviation and UTC offset in effect, whether that is
+// DST, the other abbreviation, and the UTC instants the current period began
+// and ends.  The DST rules are read off those two transitions, so the string
+// reproduces both exactly ("AEST-10AEDT,M10.1.0,M4.1.0/3"); a transition in
+// the last seven days of its month becomes a last-weekday rule.  Without
+// both instants the rules are left out and the M3.2.0/M11.1.0 defaults
+// apply.  Like the POSIX default, DST is taken as standard time plus an
+// hour.  Returns the length snprintf() would have written.
+int posixZoneString(char *out, size_t len, const char *abbr, int32_t gmtOffset, bool dst,
+                    const char *nextAbbr, time_t zoneStart, time_t zoneEnd);
+
+#endif /* civil_time.h */
@@ -0,0 +1,209 @@
+#include "frame_profiler.h"
+#include "SD_Card.h"
+#include "esp_heap_caps.h"
+#include "esp_timer.h"
+
+static const char *stageNames[FRAME_STAGE_COUNT] = { "render", "rotate", "swap", "transfer", "total" };
+
+bool FrameProfiler::begin() {
+  if (!recent) recent = (Frame *)heap_caps_calloc(FRAME_PROFILER_RECENT, sizeof(Frame), MALLOC_CAP_SPIRAM);
+  windowStart = millis();
+#ifdef FRAME_PROFILER_OVERLAY
+  setOverlay(true);
+#endif
+  return recent != nullptr;
+}
+
+void FrameProfiler::frameStart() {
+  settle();
+  building = {};
+  building.startUs = esp_timer_get_time();
+}
+
+void FrameProfiler::flushStart() {
+  if (!building.startUs || building.flushUs) return;
+  settle();
+  // Single draw buffer: LVGL waited for the last transfer before flushing
+  // again, so anything still parked here never got its done interrupt.
+  sent = {};
+  building.flushUs = esp_timer_get_time();
+  building.stageUs[FRAME_STAGE_RENDER] = (uint32_t)(building.flushUs - building.startUs);
+  flushDoneUs = 0;
+  dmaStartUs = building.flushUs;
+}
+
+void FrameProfiler::addStage(FrameStage stage, uint32_t us) {
+  if (building.flushUs) building.stageUs[stage] += us;
+}
+
+// A 32-bit store, so the UI task never sees half of it.
+void FrameProfiler::flushDoneFromISR() {
+  int64_t from = dmaStartUs;
+  if (!from) return;
+  uint32_t us = (uint32_t)(esp_timer_get_time() - from);
+  flushDoneUs = us ? us : 1;
+}
+
+void FrameProfiler::tick() {
+  settle();
+  if (overlay && millis() - overlayUpdated >= FRAME_PROFILER_OVERLAY_MS) updateOverlay();
+}
+
+// Every hook runs after the previous flush callback has returned, so a
+// flushed frame in `building` is out and moves to `sent`; `sent` commits
+// once its DMA is done, whichever hook comes first.
+void FrameProfiler::settle() {
+  if (building.flushUs) {
+    sent = building;
+    building = {};
+  }
+  uint32_t flushTotal = flushDoneUs;
+  if (sent.flushUs && flushTotal) {
+    commit(sent, flushTotal);
+    sent = {};
+    dmaStartUs = 0;
+    flushDoneUs = 0;
+  }
+}
+
+void FrameProfiler::commit(Pending &frame, uint32_t flushTotal) {
+  uint32_t *stageUs = frame.stageUs;
+  uint32_t cpu = stageUs[FRAME_STAGE_ROTATE] + stageUs[FRAME_STAGE_SWAP];
+  stageUs[FRAME_STAGE_TRANSFER] = flushTotal > cpu ? flushTotal - cpu : 0;
+  stageUs[FRAME_STAGE_TOTAL] = stageUs[FRAME_STAGE_RENDER] + flushTotal;
+
+  for (uint8_t s = 0; s < FRAME_STAGE_COUNT; s++) {
+    uint32_t us = stageUs[s];
+    uint32_t bucket = us / FRAME_PROFILER_BUCKET_US;
+    if (bucket >= FRAME_PROFILER_BUCKETS) bucket = FRAME_PROFILER_BUCKETS - 1;
+    if (stats[s].buckets[bucket] < UINT16_MAX) stats[s].buckets[bucket]++;
+    stats[s].sumUs += us;
+    if (us > stats[s].maxUs) stats[s].maxUs = us;
+    overlaySumUs[s] += us;
+  }
+  frames++;
+  overlayFrames++;
+
+  if (recent) {
+    Frame &entry = recent[recentHead];
+    entry.startMs = (uint32_t)(frame.startUs / 1000);
+    memcpy(entry.stageUs, stageUs, sizeof(entry.stageUs));
+    recentHead = (recentHead + 1) % FRAME_PROFILER_RECENT;
+    if (recentCount < FRAME_PROFILER_RECENT) recentCount++;
+  }
+}
+
+// Upper edge of the bucket holding the pct-th percentile.
+uint32_t FrameProfiler::percentile(const StageStats &stageStats, uint32_t count, uint8_t pct) {
+  if (count == 0) return 0;
+  uint32_t target = (count * pct + 99) / 100;
+  uint32_t seen = 0;
+  for (uint8_t b = 0; b < FRAME_PROFILER_BUCKETS; b++) {
+    seen += stageStats.buckets[b];
+    if (seen >= target) return b == FRAME_PROFILER_BUCKETS - 1 ? stageStats.maxUs : (b + 1) * FRAME_PROFILER_BUCKET_US;
+  }
+  return stageStats.maxUs;
+}
+
+void FrameProfiler::setOverlay(bool show) {
+  if (show == (overlay != nullptr)) return;
+  if (!show) {
+    lv_obj_del(overlay);
+    overlay = nullptr;
+    return;
+  }
+  overlay = lv_label_create(lv_layer_sys());
+  lv_obj_set_style_text_font(overlay, &lv_font_montserrat_12, 0);
+  lv_obj_set_style_text_color(overlay, lv_color_white(), 0);
+  lv_obj_set_style_bg_color(overlay, lv_color_black(), 0);
+  lv_obj_set_style_bg_opa(overlay, LV_OPA_60, 0);
+  lv_obj_set_style_pad_hor(overlay, 4, 0);
+  lv_obj_align(overlay, LV_ALIGN_TOP_MID, 0, 40);   // clear of the round bezel
+  overlayFrames = 0;
+  memset(overlaySumUs, 0, sizeof(overlaySumUs));
+  overlayUpdated = 0;
+  updateOverlay();
+}
+
+void FrameProfiler::updateOverlay() {
+  unsigned long now = millis();
+  uint32_t elapsed = overlayUpdated ? now - overlayUpdated : FRAME_PROFILER_OVERLAY_MS;
+  uint32_t n = overlayFrames ? overlayFrames : 1;
+  // Milliseconds with one decimal, averaged over the overlay period.
+  #define OVERLAY_MS(s) (unsigned)(overlaySumUs[s] / n / 1000), (unsigned)(overlaySumUs[s] / n / 100 % 10)
+  lv_label_set_text_fmt(overlay, "%lu fps  r%u.%u o%u.%u s%u.%u t%u.%u = %u.%u ms",
+                        (unsigned long)(overlayFrames * 1000 / (elapsed ? elapsed : 1)),
+                        OVERLAY_MS(FRAME_STAGE_RENDER), OVERLAY_MS(FRAME_STAGE_ROTATE), OVERLAY_MS(FRAME_STAGE_SWAP),
+                        OVERLAY_MS(FRAME_STAGE_TRANSFER), OVERLAY_MS(FRAME_STAGE_TOTAL));
+  #undef OVERLAY_MS
+  overlayFrames = 0;
+  memset(overlaySumUs, 0, sizeof(overlaySumUs));
+  overlayUpdated = now;
+}
+
+void FrameProfiler::dump(bool toSd) {
+  if (!toSd) {
+    Serial.printf("[Frame] --- %lu frames in window, histogram ms:count, %uus buckets ---\n",
+                  (unsigned long)frames, FRAME_PROFILER_BUCKET_US);
+    for (uint8_t s = 0; s < FRAME_STAGE_COUNT; s++) {
+      Serial.printf("[Frame] %-8s", stageNames[s]);
+      for (uint8_t b = 0; b < FRAME_PROFILER_BUCKETS; b++) {
+        uint32_t fromUs = b * FRAME_PROFILER_BUCKET_US;
+        if (stats[s].buckets[b]) Serial.printf(" %lu.%lu:%u", (unsigned long)(fromUs / 1000), (unsigned long)(fromUs / 100 % 10), stats[s].buckets[b]);
+      }
+      Serial.println();
+    }
+    Serial.printf("[Frame] --- last %u frames (us): t_ms,render,rotate,swap,transfer,total ---\n", recentCount);
+  }
+
+  File file;
+  if (toSd) {
+    file = SD_MMC.open(FRAME_PROFILER_CSV_PATH, FILE_WRITE);
+    if (!file) {
+      Serial.println("[Frame] Failed to open " FRAME_PROFILER_CSV_PATH);
+      return;
+    }
+    file.println("t_ms,render_us,rotate_us,swap_us,transfer_us,total_us");
+  }
+
+  uint16_t first = (recentHead + FRAME_PROFILER_RECENT - recentCount) % FRAME_PROFILER_RECENT;
+  for (uint16_t i = 0; i < recentCount; i++) {
+    const Frame &frame = recent[(first + i) % FRAME_PROFILER_RECENT];
+    char line[80];
+    snprintf(line, sizeof(line), "%lu,%lu,%lu,%lu,%lu,%lu", (unsigned long)frame.startMs,
+             (unsigned long)frame.stageUs[FRAME_STAGE_RENDER], (unsigned long)frame.stageUs[FRAME_STAGE_ROTATE],
+             (unsigned long)frame.stageUs[FRAME_STAGE_SWAP], (unsigned long)frame.stageUs[FRAME_STAGE_TRANSFER],
+             (unsigned long)frame.stageUs[FRAME_STAGE_TOTAL]);
+    if (toSd) {
+      file.println(line);
+    } else {
+      Serial.printf("[Frame] %s\n", line);
+    }
+  }
+
+  if (toSd) {
+    file.close();
+    Serial.printf("[Frame] Wrote %u frames to " FRAME_PROFILER_CSV_PATH "\n", recentCount);
+  }
+}
+
+void FrameProfiler::logStats() {
+  unsigned long now = millis();
+  if (frames > 0) {
+    uint32_t windowMs = now - windowStart;
+    Serial.printf("[Frame] frames=%lu fps=%lu.%lu\n", (unsigned long)frames,
+                  (unsigned long)(frames * 1000UL / (windowMs ? windowMs : 1)),
+                  (unsigned long)(frames * 10000UL / (windowMs ? windowMs : 1) % 10));
+    for (uint8_t s = 0; s < FRAME_STAGE_COUNT; s++) {
+      Serial.printf("[Frame] %-8s avg=%lu p50<=%lu p95<=%lu p99<=%lu max=%lu us\n", stageNames[s],
+                    (unsigned long)(stats[s].sumUs / frames),
+                    (unsigned long)percentile(stats[s], frames, 50),
+                    (unsigned long)percentile(stats[s], frames, 95),
+                    (unsigned long)percentile(stats[s], frames, 99),
+                    (unsigned long)stats[s].maxUs);
+    }
+  }
+  memset(stats, 0, sizeof(stats));
+  frames = 0;
+  windowStart = now;
+}
@@ -0,0 +1,112 @@
+#pragma once
+
+#ifndef FRAME_PROFILER_H
+#define FRAME_PROFILER_H
+
+#include <Arduino.h>
+#include <lvgl.h>
+
+// Splits every displayed frame into its stages and keeps rolling
+// histograms of each:
+//
+//   render    LVGL render_start_cb -> flush callback
+//   rotate    90-degree rotation into rot_buf (Lvgl_Display_LCD)
+//   swap      RGB565 byte swap into the DMA staging buffer (LCD_addWindow)
+//   transfer  the rest of the flush: QSPI DMA until the last chunk is done
+//   total     render start -> DMA done
+//
+// With full_refresh and a full-screen draw buffer LVGL flushes once per
+// frame, so a frame is one render_start_cb .. flush-ready pair.  The draw
+// buffer is single, so LVGL may start rendering the next frame while the
+// last one is still on the wire; a flushed frame is parked until its DMA
+// is done and committed from the next hook on the UI task.  Frames that
+// are not sent to the panel (display asleep) are dropped.
+//
+// Stats go out with the other 60 s [..] lines; dump() prints the current
+// histograms and the most recent frames, to serial or as CSV on the SD card.
+// The overlay draws FPS and per-stage milliseconds on the system layer; it
+// forces a redraw of its own every refresh, so leave it off when measuring
+// idle screens.  Build with -DFRAME_PROFILER_OVERLAY to show it from boot.
+#define FRAME_PROFILER_BUCKET_US      500     // histogram resolution
+#define FRAME_PROFILER_BUCKETS        64      // last bucket collects everything >= 31.5 ms
+#define FRAME_PROFILER_RECENT         128     // frames kept for dump()
+#define FRAME_PROFILER_OVERLAY_MS     500
+#define FRAME_PROFILER_CSV_PATH       "/frame_profile.csv"
+
+enum FrameStage : uint8_t {
+  FRAME_STAGE_RENDER = 0,
+  FRAME_STAGE_ROTATE,
+  FRAME_STAGE_SWAP,
+  FRAME_STAGE_TRANSFER,
+  FRAME_STAGE_TOTAL,
+  FRAME_STAGE_COUNT
+};
+
+class FrameProfiler {
+  public:
+    // Allocates the recent-frame ring (PSRAM).
+    bool begin();
+
+    // Display pipeline hooks.  All run on the UI task except
+    // flushDoneFromISR(), which the panel IO transfer-done ISR calls.
+    void frameStart();
+    void flushStart();
+    void addStage(FrameStage stage, uint32_t us);
+    void flushDoneFromISR();
+
+    // Call after Lvgl_Loop(): commits a finished frame and refreshes the
+    // overlay.
+    void tick();
+
+    void setOverlay(bool show);
+    bool overlayShown() { return overlay != nullptr; }
+
+    // Histograms plus the last FRAME_PROFILER_RECENT frames.
+    void dump(bool toSd);
+    // One line per stage for the window, then starts a new window.
+    void logStats();
+
+  private:
+    struct StageStats {
+      uint64_t sumUs;
+      uint32_t maxUs;
+      uint16_t buckets[FRAME_PROFILER_BUCKETS];
+    };
+
+    struct Frame {
+      uint32_t startMs;
+      uint32_t stageUs[FRAME_STAGE_COUNT];
+    };
+
+    struct Pending {
+      int64_t startUs;
+      int64_t flushUs;                     // 0 until the flush callback starts
+      uint32_t stageUs[FRAME_STAGE_COUNT];
+    };
+
+    void settle();
+    void commit(Pending &frame, uint32_t flushTotal);
+    uint32_t percentile(const StageStats &stats, uint32_t count, uint8_t pct);
+    void updateOverlay();
+
+    Pending building = {};                 // being rendered / flushed
+    Pending sent = {};                     // flushed, DMA may still be running
+    // Only one flush is ever on the wire; the ISR times it from dmaStartUs.
+    volatile int64_t dmaStartUs = 0;
+    volatile uint32_t flushDoneUs = 0;     // flush start -> DMA done; 0 while in flight
+
+    StageStats stats[FRAME_STAGE_COUNT] = {};
+    uint32_t frames = 0;
+    unsigned long windowStart = 0;
+
+    Frame *recent = nullptr;
+    uint16_t recentHead = 0;
+    uint16_t recentCount = 0;
+
+    lv_obj_t *overlay = nullptr;
+    uint32_t overlayFrames = 0;
+    uint32_t overlaySumUs[FRAME_STAGE_COUNT] = {};
+    unsigned long overlayUpdated = 0;
+};
+
+#endif /* frame_profiler.h */
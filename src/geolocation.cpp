@@ -36,8 +36,6 @@ bool GeoLocation::didIpChange() {
 
   bool ipChanged = false;
 
-  static char lastIp[16] = { 0 };
-
   NetworkClientSecure *client = new NetworkClientSecure;
   if (client) {
     client->setCACert(we1RootCACert);
@@ -119,6 +117,16 @@ bool GeoLocation::didIpChange() {
   return ipChanged;
 }
 
+// The public IP the restored location goes with is not known, so the next
+// loadUsingIp() looks up rather than trusting an unchanged IP.
+void GeoLocation::restore(const char *city, const char *state, const char *latitude, const char *longitude) {
+  strlcpy(this->city, city, sizeof(this->city));
+  strlcpy(this->state, state, sizeof(this->state));
+  strlcpy(this->latitude, latitude, sizeof(this->latitude));
+  strlcpy(this->longitude, longitude, sizeof(this->longitude));
+  lastIp[0] = '\0';
+}
+
 bool GeoLocation::loadUsingIp() {
   // Skip if not connected to WiFi
   if (!WiFi.isConnected()) {
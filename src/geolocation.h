@@ -11,6 +11,8 @@ public:
   GeoLocation(const char *zipcode);
   GeoLocation(const char *zipcode, const char *city, const char *state, const char *latitude, const char *longitude);
   bool loadUsingIp();
+  // Takes a location remembered for this network instead of looking it up.
+  void restore(const char *city, const char *state, const char *latitude, const char *longitude);
 
   const char *getLatitude() {
     return latitude;
@@ -39,6 +41,8 @@ private:
   bool didIpChange();
   char *readResponseToPsram(HTTPClient &http, size_t maxSize = 4096);
 
+  char lastIp[16] = { 0 };  // public IP the coordinates were looked up for
+
 protected:
   char city[50] = { 0 };
   char state[10] = { 0 };
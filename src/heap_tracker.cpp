@@ -0,0 +1,334 @@
+#include "heap_tracker.h"
+
+#ifdef HEAP_TRACKER
+
+#include "esp_heap_caps.h"
+#include "esp_memory_utils.h"
+
+extern HeapTracker heapTracker;
+
+#define HEAP_TRACKER_NO_TASK   0xff
+#define HEAP_TRACKER_ISR_TASK  0xfe
+#define HEAP_TRACKER_OTHER_PC  1          // site that absorbs a full site table
+
+static const uint32_t regionCaps[HEAP_REGION_COUNT] = {
+  MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT,
+  MALLOC_CAP_DMA,
+  MALLOC_CAP_SPIRAM,
+};
+static const char regionNames[HEAP_REGION_COUNT][9] = { "internal", "dma", "psram" };
+
+// free() lands in heap_caps_free() across objects, so wrapping that one
+// catches both; malloc()/calloc()/realloc() use the *_default variants
+// inside heap_caps.c and need wrapping themselves.
+extern "C" {
+void *__real_heap_caps_malloc(size_t size, uint32_t caps);
+void *__real_heap_caps_calloc(size_t n, size_t size, uint32_t caps);
+void *__real_heap_caps_realloc(void *ptr, size_t size, uint32_t caps);
+void __real_heap_caps_free(void *ptr);
+void *__real_malloc(size_t size);
+void *__real_calloc(size_t n, size_t size);
+void *__real_realloc(void *ptr, size_t size);
+
+void *__wrap_heap_caps_malloc(size_t size, uint32_t caps) {
+  return heapTracker.track(__real_heap_caps_malloc(size, caps), size, __builtin_return_address(0));
+}
+
+void *__wrap_heap_caps_calloc(size_t n, size_t size, uint32_t caps) {
+  return heapTracker.track(__real_heap_caps_calloc(n, size, caps), n * size, __builtin_return_address(0));
+}
+
+void *__wrap_heap_caps_realloc(void *ptr, size_t size, uint32_t caps) {
+  void *moved = __real_heap_caps_realloc(ptr, size, caps);
+  if (moved || size == 0) heapTracker.untrack(ptr);   // on failure the old block stays
+  return heapTracker.track(moved, size, __builtin_return_address(0));
+}
+
+void __wrap_heap_caps_free(void *ptr) {
+  heapTracker.untrack(ptr);
+  __real_heap_caps_free(ptr);
+}
+
+void *__wrap_malloc(size_t size) {
+  return heapTracker.track(__real_malloc(size), size, __builtin_return_address(0));
+}
+
+void *__wrap_calloc(size_t n, size_t size) {
+  return heapTracker.track(__real_calloc(n, size), n * size, __builtin_return_address(0));
+}
+
+void *__wrap_realloc(void *ptr, size_t size) {
+  void *moved = __real_realloc(ptr, size);
+  if (moved || size == 0) heapTracker.untrack(ptr);
+  return heapTracker.track(moved, size, __builtin_return_address(0));
+}
+}
+
+void *heap_tracker_caps_malloc(size_t size, uint32_t caps, void *site) {
+  return heapTracker.track(__real_heap_caps_malloc(size, caps), size, site);
+}
+
+// Windowed-ABI return addresses carry the call size in the top two bits;
+// restore the code address and step back onto the call instruction.
+static inline uint32_t callSitePc(void *returnAddress) {
+  uint32_t pc = (uint32_t)returnAddress;
+  if (pc & 0x80000000) pc = (pc & 0x3fffffff) | 0x40000000;
+  return pc - 3;
+}
+
+static inline uint32_t hashWord(uint32_t value) {
+  value *= 2654435761u;
+  return value ^ (value >> 16);
+}
+
+static inline uint8_t regionOf(const void *ptr) {
+  if (esp_ptr_external_ram(ptr)) return HEAP_REGION_PSRAM;
+  if (esp_ptr_dma_capable(ptr)) return HEAP_REGION_DMA;
+  return HEAP_REGION_INTERNAL;
+}
+
+void HeapTracker::begin() {
+  if (allocations) return;
+  Allocation *table = (Allocation *)__real_heap_caps_calloc(HEAP_TRACKER_MAX_ALLOCATIONS, sizeof(Allocation), MALLOC_CAP_SPIRAM);
+  Site *siteTable = (Site *)__real_heap_caps_calloc(HEAP_TRACKER_MAX_SITES, sizeof(Site), MALLOC_CAP_SPIRAM);
+  if (!table || !siteTable) {
+    __real_heap_caps_free(table);
+    __real_heap_caps_free(siteTable);
+    Serial.println("[HeapTrack] Failed to allocate tracking tables");
+    return;
+  }
+
+  for (int r = 0; r < HEAP_REGION_COUNT; r++) regions[r].minLargestBlock = UINT32_MAX;
+
+  taskENTER_CRITICAL(&lock);
+  sites = siteTable;
+  allocations = table;
+  taskEXIT_CRITICAL(&lock);
+
+  lastDiff = millis();
+  Serial.printf("[HeapTrack] Tracking up to %u allocations / %u sites (%u bytes PSRAM)\n",
+                HEAP_TRACKER_MAX_ALLOCATIONS, HEAP_TRACKER_MAX_SITES,
+                (unsigned)(HEAP_TRACKER_MAX_ALLOCATIONS * sizeof(Allocation) + HEAP_TRACKER_MAX_SITES * sizeof(Site)));
+}
+
+// Caller holds the lock.
+uint8_t HeapTracker::taskIndex() {
+  if (xPortInIsrContext()) return HEAP_TRACKER_ISR_TASK;
+  TaskHandle_t task = xTaskGetCurrentTaskHandle();
+  for (uint8_t i = 0; i < taskCount; i++) {
+    if (tasks[i] == task) return i;
+  }
+  if (taskCount >= HEAP_TRACKER_MAX_TASKS) return HEAP_TRACKER_NO_TASK;
+  tasks[taskCount] = task;
+  strncpy(taskNames[taskCount], pcTaskGetName(task), configMAX_TASK_NAME_LEN - 1);
+  return taskCount++;
+}
+
+// Caller holds the lock.  Sites are never removed.
+uint16_t HeapTracker::siteFor(uint32_t pc) {
+  const uint32_t mask = HEAP_TRACKER_MAX_SITES - 1;
+  for (;;) {
+    uint32_t i = hashWord(pc) & mask;
+    while (sites[i].pc) {
+      if (sites[i].pc == pc) return i;
+      i = (i + 1) & mask;
+    }
+    if (siteCount < HEAP_TRACKER_MAX_SITES * 3 / 4 || pc == HEAP_TRACKER_OTHER_PC) {
+      sites[i].pc = pc;
+      siteCount++;
+      return i;
+    }
+    pc = HEAP_TRACKER_OTHER_PC;
+  }
+}
+
+void *HeapTracker::track(void *ptr, size_t size, void *site) {
+  if (!ptr || !allocations) return ptr;
+  const uint32_t mask = HEAP_TRACKER_MAX_ALLOCATIONS - 1;
+  const uint8_t region = regionOf(ptr);
+
+  taskENTER_CRITICAL(&lock);
+  if (liveCount >= HEAP_TRACKER_MAX_ALLOCATIONS * 3 / 4) {
+    untracked++;
+    taskEXIT_CRITICAL(&lock);
+    return ptr;
+  }
+
+  uint32_t i = hashWord((uint32_t)ptr) & mask;
+  while (allocations[i].ptr) i = (i + 1) & mask;
+
+  uint16_t s = siteFor(callSitePc(site));
+  uint8_t task = taskIndex();
+  allocations[i] = { (uint32_t)ptr, (uint32_t)size, s, task, region };
+  liveCount++;
+  liveBytes[region] += size;
+
+  Site &entry = sites[s];
+  entry.liveBytes += size;
+  entry.liveCount++;
+  entry.allocs++;
+  entry.task = task;
+  entry.regions |= 1 << region;
+  if (entry.liveBytes > entry.peakBytes) entry.peakBytes = entry.liveBytes;
+  taskEXIT_CRITICAL(&lock);
+  return ptr;
+}
+
+void HeapTracker::untrack(void *ptr) {
+  if (!ptr || !allocations) return;
+  const uint32_t mask = HEAP_TRACKER_MAX_ALLOCATIONS - 1;
+
+  taskENTER_CRITICAL(&lock);
+  uint32_t i = hashWord((uint32_t)ptr) & mask;
+  while (allocations[i].ptr && allocations[i].ptr != (uint32_t)ptr) i = (i + 1) & mask;
+  if (!allocations[i].ptr) {
+    unknownFrees++;
+    taskEXIT_CRITICAL(&lock);
+    return;
+  }
+
+  const Allocation &gone = allocations[i];
+  Site &entry = sites[gone.site];
+  entry.liveBytes -= gone.size;
+  entry.liveCount--;
+  liveBytes[gone.region] -= gone.size;
+  liveCount--;
+
+  // Backward-shift deletion keeps every probe chain unbroken without tombstones.
+  for (;;) {
+    allocations[i].ptr = 0;
+    uint32_t j = i;
+    for (;;) {
+      j = (j + 1) & mask;
+      if (!allocations[j].ptr) {
+        taskEXIT_CRITICAL(&lock);
+        return;
+      }
+      uint32_t home = hashWord(allocations[j].ptr) & mask;
+      bool stays = i <= j ? (i < home && home <= j) : (i < home || home <= j);
+      if (!stays) break;
+    }
+    allocations[i] = allocations[j];
+    i = j;
+  }
+}
+
+void HeapTracker::snapshot() {
+  if (!sites) return;
+  taskENTER_CRITICAL(&lock);
+  for (int i = 0; i < HEAP_TRACKER_MAX_SITES; i++) sites[i].snapshotBytes = sites[i].liveBytes;
+  taskEXIT_CRITICAL(&lock);
+}
+
+void HeapTracker::printSite(const Site &site, int32_t delta) {
+  char regionList[HEAP_REGION_COUNT * 9 + 1] = "";
+  for (int r = 0; r < HEAP_REGION_COUNT; r++) {
+    if (!(site.regions & (1 << r))) continue;
+    if (regionList[0]) strcat(regionList, "+");
+    strcat(regionList, regionNames[r]);
+  }
+  const char *task = site.task == HEAP_TRACKER_ISR_TASK ? "isr" :
+                     site.task < taskCount ? taskNames[site.task] : "?";
+  char pc[11];
+  if (site.pc == HEAP_TRACKER_OTHER_PC) {
+    strcpy(pc, "other");
+  } else {
+    snprintf(pc, sizeof(pc), "0x%08lx", (unsigned long)site.pc);
+  }
+  Serial.printf("[HeapTrack] site=%s live=%lu count=%lu peak=%lu allocs=%lu delta=%+ld region=%s task=%s\n",
+                pc, (unsigned long)site.liveBytes, (unsigned long)site.liveCount, (unsigned long)site.peakBytes,
+                (unsigned long)site.allocs, (long)delta, regionList, task);
+}
+
+void HeapTracker::dump(uint8_t top) {
+  if (!sites) return;
+  if (top > HEAP_TRACKER_TOP_SITES) top = HEAP_TRACKER_TOP_SITES;
+  Site best[HEAP_TRACKER_TOP_SITES];
+  uint8_t count = 0;
+
+  // Copy out under the lock; printing allocates.
+  taskENTER_CRITICAL(&lock);
+  for (int i = 0; i < HEAP_TRACKER_MAX_SITES; i++) {
+    const Site &site = sites[i];
+    if (!site.pc || !site.liveBytes) continue;
+    int pos = count;
+    while (pos > 0 && best[pos - 1].liveBytes < site.liveBytes) pos--;
+    if (pos >= top) continue;
+    if (count < top) count++;
+    memmove(&best[pos + 1], &best[pos], (count - pos - 1) * sizeof(Site));
+    best[pos] = site;
+  }
+  uint32_t total = 0;
+  for (int r = 0; r < HEAP_REGION_COUNT; r++) total += liveBytes[r];
+  uint32_t live = liveCount;
+  taskEXIT_CRITICAL(&lock);
+
+  Serial.printf("[HeapTrack] --- top %u sites by live bytes (%lu allocations, %lu bytes) ---\n",
+                count, (unsigned long)live, (unsigned long)total);
+  for (uint8_t i = 0; i < count; i++) printSite(best[i], (int32_t)(best[i].liveBytes - best[i].snapshotBytes));
+}
+
+void HeapTracker::diff(uint8_t top) {
+  if (!sites) return;
+  if (top > HEAP_TRACKER_TOP_SITES) top = HEAP_TRACKER_TOP_SITES;
+  Site best[HEAP_TRACKER_TOP_SITES];
+  int32_t growth[HEAP_TRACKER_TOP_SITES];
+  uint8_t count = 0;
+
+  taskENTER_CRITICAL(&lock);
+  for (int i = 0; i < HEAP_TRACKER_MAX_SITES; i++) {
+    const Site &site = sites[i];
+    int32_t delta = (int32_t)(site.liveBytes - site.snapshotBytes);
+    if (!site.pc || delta <= 0) continue;
+    int pos = count;
+    while (pos > 0 && growth[pos - 1] < delta) pos--;
+    if (pos >= top) continue;
+    if (count < top) count++;
+    memmove(&best[pos + 1], &best[pos], (count - pos - 1) * sizeof(Site));
+    memmove(&growth[pos + 1], &growth[pos], (count - pos - 1) * sizeof(int32_t));
+    best[pos] = site;
+    growth[pos] = delta;
+  }
+  taskEXIT_CRITICAL(&lock);
+
+  Serial.printf("[HeapTrack] --- %u sites grew since snapshot ---\n", count);
+  for (uint8_t i = 0; i < count; i++) printSite(best[i], growth[i]);
+}
+
+void HeapTracker::sampleRegions() {
+  for (int r = 0; r < HEAP_REGION_COUNT; r++) {
+    size_t free = heap_caps_get_free_size(regionCaps[r]);
+    size_t largest = heap_caps_get_largest_free_block(regionCaps[r]);
+    uint32_t fragmentation = free ? 1000 - (uint32_t)((uint64_t)largest * 1000 / free) : 0;
+    if (largest < regions[r].minLargestBlock) regions[r].minLargestBlock = largest;
+    if (fragmentation > regions[r].maxFragmentation) regions[r].maxFragmentation = fragmentation;
+
+    Serial.printf("[HeapTrack] %-8s free=%u largest=%u (min %lu) frag=%lu.%lu%% (max %lu.%lu%%) tracked=%lu\n",
+                  regionNames[r], (unsigned)free, (unsigned)largest, (unsigned long)regions[r].minLargestBlock,
+                  (unsigned long)(fragmentation / 10), (unsigned long)(fragmentation % 10),
+                  (unsigned long)(regions[r].maxFragmentation / 10), (unsigned long)(regions[r].maxFragmentation % 10),
+                  (unsigned long)liveBytes[r]);
+  }
+}
+
+void HeapTracker::logStats() {
+  if (!allocations) return;
+  sampleRegions();
+  Serial.printf("[HeapTrack] live=%lu sites=%u untracked=%lu unknown_frees=%lu tasks=%u\n",
+                (unsigned long)liveCount, siteCount, (unsigned long)untracked, (unsigned long)unknownFrees, taskCount);
+
+  if (millis() - lastDiff >= HEAP_TRACKER_DIFF_MS) {
+    lastDiff = millis();
+    diff();
+    snapshot();
+  }
+}
+
+void HeapTracker::onMemoryPressure(int level) {
+  if (!allocations || level == 0) return;
+  sampleRegions();
+  dump();
+  diff();
+}
+
+#endif /* HEAP_TRACKER */
@@ -0,0 +1,107 @@
+#pragma once
+
+#ifndef HEAP_TRACKER_H
+#define HEAP_TRACKER_H
+
+#include <Arduino.h>
+
+// Opt-in allocation tracker, built by the waveshare_s3_146_heaptrack env
+// (-DHEAP_TRACKER plus -Wl,--wrap for the heap_caps_* and malloc families).
+//
+// Every live allocation is kept in a PSRAM hash table with its size, the
+// address of the call site, the calling task and the region it landed in
+// (internal, DMA-capable internal, PSRAM).  Per-site totals can be dumped
+// over serial, snapshotted and diffed later to show what grew, and the
+// largest free block / fragmentation of each region is tracked alongside.
+// Feed the [HeapTrack] lines to symbolize_heap.py to resolve call sites.
+//
+// Allocations made before begin() and from inside IDF's own heap layer
+// (malloc() -> heap_caps_malloc_default()) are attributed to their outer
+// call only.  LVGL allocations all show up as lv_mem_alloc() callers.
+#define HEAP_TRACKER_MAX_ALLOCATIONS  16384   // live allocations, power of two
+#define HEAP_TRACKER_MAX_SITES        1024    // power of two
+#define HEAP_TRACKER_MAX_TASKS        32
+#define HEAP_TRACKER_TOP_SITES        16
+#define HEAP_TRACKER_DIFF_MS          (10 * 60 * 1000)
+
+enum HeapRegion : uint8_t {
+  HEAP_REGION_INTERNAL = 0,
+  HEAP_REGION_DMA,
+  HEAP_REGION_PSRAM,
+  HEAP_REGION_COUNT
+};
+
+class HeapTracker {
+  public:
+    // Allocates the tables; allocations before this are not tracked.
+    void begin();
+    bool isRunning() { return allocations != nullptr; }
+
+    // Allocator hooks.  `site` is the caller's return address.
+    void *track(void *ptr, size_t size, void *site);
+    void untrack(void *ptr);
+
+    // Remembers the per-site live bytes for a later diff().
+    void snapshot();
+    // Sites by live bytes, and by growth since the last snapshot().
+    void dump(uint8_t top = HEAP_TRACKER_TOP_SITES);
+    void diff(uint8_t top = HEAP_TRACKER_TOP_SITES);
+
+    // Free/largest block/fragmentation per region, plus table health.
+    void logStats();
+    // monitor_heap() pressure change: full report while it is fresh.
+    void onMemoryPressure(int level);
+
+  private:
+    struct Allocation {
+      uint32_t ptr;                // 0: empty
+      uint32_t size;
+      uint16_t site;               // index into sites[]
+      uint8_t task;
+      uint8_t region;
+    };
+
+    struct Site {
+      uint32_t pc;                 // 0: empty
+      uint32_t liveBytes;
+      uint32_t peakBytes;
+      uint32_t snapshotBytes;
+      uint32_t liveCount;
+      uint32_t allocs;
+      uint8_t task;                // last allocating task
+      uint8_t regions;             // bit per HeapRegion
+    };
+
+    struct RegionStats {
+      uint32_t minLargestBlock;
+      uint32_t maxFragmentation;   // per mille
+    };
+
+    uint16_t siteFor(uint32_t pc);
+    uint8_t taskIndex();
+    void sampleRegions();
+    void printSite(const Site &site, int32_t delta);
+
+    Allocation *allocations = nullptr;     // PSRAM, open addressing
+    Site *sites = nullptr;                 // PSRAM, open addressing
+    TaskHandle_t tasks[HEAP_TRACKER_MAX_TASKS] = {};
+    char taskNames[HEAP_TRACKER_MAX_TASKS][configMAX_TASK_NAME_LEN] = {};
+    uint8_t taskCount = 0;
+    portMUX_TYPE lock = portMUX_INITIALIZER_UNLOCKED;
+
+    uint32_t liveCount = 0;
+    uint16_t siteCount = 0;
+    uint32_t liveBytes[HEAP_REGION_COUNT] = {};
+    uint32_t untracked = 0;                // table full
+    uint32_t unknownFrees = 0;             // allocated before begin()
+    RegionStats regions[HEAP_REGION_COUNT] = {};
+    unsigned long lastDiff = 0;
+};
+
+#ifdef HEAP_TRACKER
+// For allocators that wrap heap_caps_malloc() themselves (operator new), so
+// the allocation is charged to their caller rather than to them.
+void *heap_tracker_caps_malloc(size_t size, uint32_t caps, void *site);
+#endif
+
+#endif /* heap_tracker.h */
@@ -0,0 +1,160 @@
+#include "location_cache.h"
+#include "SD_Card.h"
+#include <esp_rom_crc.h>
+#include <stddef.h>
+
+// FNV-1a
+uint32_t LocationCache::hashSsid(const char *ssid) {
+  uint32_t hash = 2166136261u;
+  while (*ssid) {
+    hash ^= (uint8_t)*ssid++;
+    hash *= 16777619u;
+  }
+  return hash;
+}
+
+bool LocationCache::cacheable(const network_fingerprint_t &network) {
+  static const uint8_t none[6] = {};
+  return network.ssidHash != hashSsid("") && memcmp(network.bssid, none, 6) != 0 && !(network.bssid[0] & 0x02);
+}
+
+bool LocationCache::hasGateway(const uint8_t *gateway) {
+  static const uint8_t none[6] = {};
+  return memcmp(gateway, none, 6) != 0;
+}
+
+uint32_t LocationCache::checksum(const location_cache_t &cache) {
+  const size_t from = offsetof(location_cache_t, crc) + sizeof(cache.crc);
+  return esp_rom_crc32_le(0, (const uint8_t *)&cache + from, sizeof(cache) - from);
+}
+
+bool LocationCache::load() {
+  File file = SD_MMC.open(LOCATION_CACHE_PATH);
+  if (!file) return false;
+  location_cache_t loaded;
+  bool ok = file.size() == sizeof(loaded) &&
+            file.read((uint8_t *)&loaded, sizeof(loaded)) == sizeof(loaded);
+  file.close();
+
+  ok = ok && loaded.magic == LOCATION_CACHE_MAGIC && loaded.version == LOCATION_CACHE_VERSION &&
+       loaded.size == sizeof(loaded) && loaded.crc == checksum(loaded);
+  if (!ok) {
+    Serial.println("Location cache unreadable, ignoring it");
+    return false;
+  }
+  table = loaded;
+  return true;
+}
+
+bool LocationCache::save() {
+  table.magic = LOCATION_CACHE_MAGIC;
+  table.version = LOCATION_CACHE_VERSION;
+  table.size = sizeof(table);
+  table.crc = checksum(table);
+
+  File file = SD_MMC.open(LOCATION_CACHE_PATH, FILE_WRITE);
+  if (!file) return false;
+  bool ok = file.write((const uint8_t *)&table, sizeof(table)) == sizeof(table);
+  file.close();
+  if (!ok) SD_MMC.remove(LOCATION_CACHE_PATH);
+  return ok;
+}
+
+// Same SSID, and a known access point or the same gateway.
+location_entry_t *LocationCache::match(const network_fingerprint_t &network) {
+  for (int i = 0; i < LOCATION_CACHE_ENTRIES; i++) {
+    location_entry_t &entry = table.entries[i];
+    if (!entry.resolvedAt || entry.ssidHash != network.ssidHash) continue;
+    for (int b = 0; b < entry.bssidCount && b < LOCATION_CACHE_BSSIDS; b++) {
+      if (memcmp(entry.bssids[b], network.bssid, 6) == 0) return &entry;
+    }
+    if (hasGateway(network.gateway) && memcmp(entry.gateway, network.gateway, 6) == 0) return &entry;
+  }
+  return nullptr;
+}
+
+// Returns true when the set changed.  A full set drops its oldest.
+bool LocationCache::learnBssid(location_entry_t &entry, const uint8_t *bssid) {
+  uint8_t count = min(entry.bssidCount, (uint8_t)LOCATION_CACHE_BSSIDS);
+  for (int b = 0; b < count; b++) {
+    if (memcmp(entry.bssids[b], bssid, 6) == 0) return false;
+  }
+  if (count == LOCATION_CACHE_BSSIDS) {
+    memmove(entry.bssids[0], entry.bssids[1], (LOCATION_CACHE_BSSIDS - 1) * 6);
+    count--;
+  }
+  memcpy(entry.bssids[count], bssid, 6);
+  entry.bssidCount = count + 1;
+  return true;
+}
+
+const location_entry_t *LocationCache::find(const network_fingerprint_t &network, time_t now) {
+  if (!cacheable(network)) {
+    uncacheable++;
+    return nullptr;
+  }
+  location_entry_t *entry = match(network);
+  if (!entry) {
+    misses++;
+    return nullptr;
+  }
+  if (now < entry->resolvedAt || now - entry->resolvedAt > LOCATION_CACHE_MAX_AGE_S) {
+    expired++;
+    return nullptr;
+  }
+
+  bool changed = learnBssid(*entry, network.bssid);
+  if (!hasGateway(entry->gateway) && hasGateway(network.gateway)) {
+    memcpy(entry->gateway, network.gateway, 6);
+    changed = true;
+  }
+  if (changed && !save()) Serial.println("Location cache: could not write it");
+  hits++;
+  return entry;
+}
+
+void LocationCache::store(const network_fingerprint_t &network, time_t now, const char *city, const char *state,
+                          const char *latitude, const char *longitude, const char *timezone,
+                          const char *timezoneName) {
+  if (!cacheable(network) || !latitude[0] || !longitude[0] || !timezone[0]) return;
+
+  location_entry_t *entry = match(network);
+  if (!entry) {
+    entry = &table.entries[0];
+    for (int i = 1; i < LOCATION_CACHE_ENTRIES && entry->resolvedAt; i++) {
+      if (table.entries[i].resolvedAt < entry->resolvedAt) entry = &table.entries[i];
+    }
+    *entry = {};
+    entry->ssidHash = network.ssidHash;
+  }
+  entry->resolvedAt = now;
+  if (hasGateway(network.gateway)) memcpy(entry->gateway, network.gateway, 6);
+  learnBssid(*entry, network.bssid);
+  strlcpy(entry->city, city, sizeof(entry->city));
+  strlcpy(entry->state, state, sizeof(entry->state));
+  strlcpy(entry->latitude, latitude, sizeof(entry->latitude));
+  strlcpy(entry->longitude, longitude, sizeof(entry->longitude));
+  strlcpy(entry->timezone, timezone, sizeof(entry->timezone));
+  strlcpy(entry->timezoneName, timezoneName, sizeof(entry->timezoneName));
+  stores++;
+  if (!save()) Serial.println("Location cache: could not write it");
+}
+
+void LocationCache::rememberZone(const char *timezone, const char *timezoneName) {
+  if (!timezone[0] || (strcmp(table.lastTimezone, timezone) == 0 && strcmp(table.lastTimezoneName, timezoneName) == 0)) {
+    return;
+  }
+  strlcpy(table.lastTimezone, timezone, sizeof(table.lastTimezone));
+  strlcpy(table.lastTimezoneName, timezoneName, sizeof(table.lastTimezoneName));
+  if (!save()) Serial.println("Location cache: could not write it");
+}
+
+void LocationCache::logStats() {
+  uint8_t used = 0;
+  for (int i = 0; i < LOCATION_CACHE_ENTRIES; i++) {
+    if (table.entries[i].resolvedAt) used++;
+  }
+  Serial.printf("[Location] networks=%u lookups avoided=%lu, unknown=%lu expired=%lu uncacheable=%lu, stored=%lu\n",
+                used, (unsigned long)hits, (unsigned long)misses, (unsigned long)expired,
+                (unsigned long)uncacheable, (unsigned long)stores);
+}
@@ -0,0 +1,101 @@
+#pragma once
+
+#ifndef LOCATION_CACHE_H
+#define LOCATION_CACHE_H
+
+#include <Arduino.h>
+#include <time.h>
+
+// Where the watch is and which timezone it keeps, remembered per WiFi
+// network so reconnecting to a known one needs none of the IP, geolocation
+// and timezone services.
+//
+// A network is its SSID plus what identifies the place behind it: the access
+// points (BSSIDs) seen for it and the MAC of its gateway.  A connection
+// matches an entry with the same SSID when either its access point is one the
+// entry has seen or its gateway is the entry's; a new access point on a known
+// gateway (roaming inside the house) is learned.  A chain's shared SSID on
+// other hardware does not match.  Access points with a locally administered
+// BSSID are phone hotspots and travel routers more often than not, and they
+// move, so they are never cached.
+//
+// Entries expire after LOCATION_CACHE_MAX_AGE_S and the oldest is replaced
+// when the table is full.  The record also keeps the zone last applied on
+// any network, hotspots included, so boot can show local time before WiFi.
+// The table is one CRC'd record on the SD card.
+#define LOCATION_CACHE_PATH       "/location_cache.bin"
+#define LOCATION_CACHE_MAGIC      0x434C5746      // "FWLC"
+#define LOCATION_CACHE_VERSION    3               // 2: TZ strings carry DST rules, 3: last zone
+#define LOCATION_CACHE_ENTRIES    8
+#define LOCATION_CACHE_BSSIDS     4               // access points remembered per network
+#define LOCATION_CACHE_MAX_AGE_S  (7 * 24 * 60 * 60)
+
+// The network the watch is connected to.  An all-zero gateway is unknown.
+typedef struct {
+  uint32_t ssidHash;                     // LocationCache::hashSsid()
+  uint8_t bssid[6];
+  uint8_t gateway[6];
+} network_fingerprint_t;
+
+typedef struct __attribute__((packed)) {
+  int64_t resolvedAt;                    // 0: empty slot
+  uint32_t ssidHash;
+  uint8_t gateway[6];
+  uint8_t bssids[LOCATION_CACHE_BSSIDS][6];
+  uint8_t bssidCount;
+
+  char city[50];
+  char state[10];
+  char latitude[10];
+  char longitude[10];
+  char timezone[48];                     // POSIX TZ
+  char timezoneName[30];                 // IANA
+} location_entry_t;
+
+typedef struct __attribute__((packed)) {
+  uint32_t magic;
+  uint16_t version;
+  uint16_t size;                         // sizeof(location_cache_t)
+  uint32_t crc;                          // CRC-32 of everything after this field
+  char lastTimezone[48];                 // POSIX TZ, "" until a zone is known
+  char lastTimezoneName[30];
+  location_entry_t entries[LOCATION_CACHE_ENTRIES];
+} location_cache_t;
+
+class LocationCache {
+  public:
+    bool load();
+
+    // The entry for this network, or null when it is unknown, expired or not
+    // worth caching.
+    const location_entry_t *find(const network_fingerprint_t &network, time_t now);
+    void store(const network_fingerprint_t &network, time_t now, const char *city, const char *state,
+               const char *latitude, const char *longitude, const char *timezone, const char *timezoneName);
+
+    // The zone in effect, written through when it changes.
+    void rememberZone(const char *timezone, const char *timezoneName);
+    const char *lastZone() const { return table.lastTimezone; }
+    const char *lastZoneName() const { return table.lastTimezoneName; }
+
+    static uint32_t hashSsid(const char *ssid);
+    static bool cacheable(const network_fingerprint_t &network);
+
+    void logStats();
+
+  private:
+    location_entry_t *match(const network_fingerprint_t &network);
+    static bool learnBssid(location_entry_t &entry, const uint8_t *bssid);
+    static bool hasGateway(const uint8_t *gateway);
+    static uint32_t checksum(const location_cache_t &cache);
+    bool save();
+
+    location_cache_t table = {};
+
+    uint32_t hits = 0;                   // connects resolved without a service call
+    uint32_t misses = 0;
+    uint32_t expired = 0;
+    uint32_t uncacheable = 0;
+    uint32_t stores = 0;
+};
+
+#endif /* location_cache.h */
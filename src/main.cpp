@@ -13,7 +13,9 @@
 #include "src/screens.h"
 #include "WiFi.h"
 #include "time_client.h"
+#include "civil_time.h"
 #include "geolocation.h"
+#include "location_cache.h"
 #include "alarm_timer.h"
 #include "weather.h"
 #include "weather_locations.h"
@@ -26,6 +28,16 @@
 #include "settings.h"
 #include "media_controls.h"
 #include "calendar_fetcher.h"
+#include "periodic_scheduler.h"
+#include "asset_pack.h"
+#include "sound_bank.h"
+#include "sd_index.h"
+#include "screen_manager.h"
+#include "boot_profiler.h"
+#include "ui_async.h"
+#include "heap_tracker.h"
+#include "task_monitor.h"
+#include "frame_profiler.h"
 #include "esp_core_dump.h"
 #include "esp_pm.h"
 #include "esp_sleep.h"
@@ -41,7 +53,9 @@ extern void onWifiConnected();
 Settings settings;
 NotificationStore notificationStore;
 GeoLocation ipLocation;
+LocationCache locationCache;
 TimeClient timeClient;
+TimeZone timeZone;
 Weather weather;
 WeatherLocations weatherLocations;
 AlarmTimer alarmTimer;
@@ -49,60 +63,86 @@ SerializableConfigs serializableConfigs;
 BLE ble;
 WiFi_Client wifiClient;
 MediaControls mediaControls;
+AssetPack assetPack;
+SoundBank soundBank;
+SdIndex sdIndex;
+ScreenManager screenManager;
+BootProfiler bootProfiler;
+UiAsync uiAsync;
+TaskMonitor taskMonitor;
+FrameProfiler frameProfiler;
+#ifdef HEAP_TRACKER
+HeapTracker heapTracker;
+#endif
 
 volatile bool locationDataReady = false;
+volatile bool weatherOnlySync = false;  // next connection refreshes only the weather
+
+// Driver_Loop periodic work.  Periods/slack are per display state; the
+// scheduler coalesces jobs whose deadlines fall inside their slack so the task
+// wakes as rarely as possible while the display is off.
+static PeriodicScheduler driverScheduler;
+
+static void Driver_ImuJob() {
+  // The step detector's cadence: every 100 ms while awake, once a second
+  // asleep, as the fixed 100 ms / 1 s loop ran it before the scheduler.
+  QMI8658_Loop();
+}
+
+static void Driver_SlowJob() {
+  // RTC/battery/time refresh does not need 10 Hz; reduce background wakeups.
+  PCF85063_Loop();
+  BAT_Get_Volts();
+  timeClient.refresh();
+}
+
+static void Driver_TaskMonitorJob() {
+  // Stack high-water marks and CPU load of every task, for sizing the stacks below.
+  taskMonitor.sample();
+}
+
+#ifdef STATS_LOG
+static void Driver_SchedStatsJob() {
+  driverScheduler.logStats(millis());
+  I2C_LogStats();
+  taskMonitor.logReport();
+}
+#endif
 
 void Driver_Loop(void *parameter) {
-  unsigned long lastImuRead = 0;
-  unsigned long lastSlowRead = 0;
+  // PWR_Loop drives the display wake/sleep state machine, so it has no slack:
+  // 100 ms when awake for responsive UI, 1 s when asleep to give the automatic
+  // PM/tickless-idle path long uninterrupted windows to enter light sleep.
+  driverScheduler.addJob("pwr", PWR_Loop, { 100, 0 }, { 1000, 0 });
+  // Every other job rides along with PWR_Loop: its slack, either side of its
+  // deadline, is at most half a PWR_Loop period, so it lands on one poll.
+  driverScheduler.addJob("imu", Driver_ImuJob, { 100, 10 }, { 1000, 250 });
+  driverScheduler.addJob("slow", Driver_SlowJob, { 500, 50 }, { 2000, 500 });
+  driverScheduler.addJob("tasks", Driver_TaskMonitorJob, { 5000, 50 }, { 30000, 500 });
+#ifdef STATS_LOG
+  driverScheduler.addJob("stats", Driver_SchedStatsJob, { 600000, 50 }, { 600000, 500 });
+#endif
 
   while (1) {
-    // PWR_Loop always runs at 100ms — it drives the display wake/sleep state machine.
-    PWR_Loop();
+    uint32_t waitMs = driverScheduler.runDue(millis());
 
+    // PWR_Loop may have just woken or blanked the display; re-evaluate the
+    // deadlines against the new profile before going back to sleep.  The
+    // scheduler counts wakeups on sleeps, so the re-run is not one.
     bool awake = PWR_IsDisplayAwake();
-    unsigned long now = millis();
-
-    // Higher IMU cadence helps catch shorter wrist-motion peaks used by the
-    // software step detector, especially during light walking.
-    unsigned long imuInterval = awake ? 50UL : 75UL;
-    if (now - lastImuRead >= imuInterval) {
-      lastImuRead = now;
-      QMI8658_Loop();
-    }
-
-    // RTC/battery/time refresh does not need 10 Hz; reduce background wakeups.
-    unsigned long slowInterval = awake ? 500UL : 2000UL;
-    if (now - lastSlowRead >= slowInterval) {
-      lastSlowRead = now;
-      PCF85063_Loop();
-      BAT_Get_Volts();
-      timeClient.refresh();
+    if (awake != driverScheduler.isAwake()) {
+      driverScheduler.setAwake(awake, millis());
+      continue;
     }
 
-    // Monitor stack usage — kept at 8KB for safety, but measure for future optimization
-    static unsigned long lastStackCheck = 0;
-    if (millis() - lastStackCheck > 30000) {
-      UBaseType_t stackRemaining = uxTaskGetStackHighWaterMark(NULL);
-      if (BAT_Is_Charging()) {
-        Serial.printf(">> Driver_Loop stack: %d bytes free\n",
-                      stackRemaining * sizeof(StackType_t));
-      }
-      if (stackRemaining * sizeof(StackType_t) < 1024) {
-        Serial.printf("!! WARNING: Driver_Loop stack low: %d bytes free !!\n",
-                      stackRemaining * sizeof(StackType_t));
-      }
-      lastStackCheck = millis();
+    if (waitMs == 0) {
+      taskYIELD();
+      continue;
     }
 
-    // 100 ms when awake for responsive UI; slower cadence when asleep reduces
-    // background wakeups and gives the automatic PM/tickless-idle path longer
-    // uninterrupted windows to enter light sleep safely.
-    if (awake) {
-      vTaskDelay(pdMS_TO_TICKS(100));
-    } else {
-      vTaskDelay(pdMS_TO_TICKS(1000));
-    }
+    unsigned long sleepStart = millis();
+    vTaskDelay(pdMS_TO_TICKS(waitMs));
+    driverScheduler.recordSleep(millis() - sleepStart);
   }
 }
 
@@ -118,13 +158,28 @@ void Driver_Init() {
   QMI8658_Init();
 }
 
+// Task stacks, in bytes; shared by the xTaskCreate calls in setup() and the
+// task monitor, which warns when a task's free stack drops below its margin.
+static const uint32_t BLE_TASK_STACK = 16384;
+static const uint32_t BACKGROUND_TASK_STACK = 20480;
+static const uint32_t DRIVER_TASK_STACK = 6144;
+static const uint32_t UI_LOOP_TASK_STACK = 16384;
+static const uint32_t TASK_STACK_MARGIN = 2000;
+static const uint32_t DRIVER_TASK_STACK_MARGIN = 1024;
+
 // Periodic data sync interval — how often to reconnect and refresh network data.
 // 120 minutes cuts radio duty cycle roughly in half versus hourly full sync.
 static const unsigned long WIFI_SYNC_INTERVAL_MS = 120UL * 60UL * 1000UL;  // 120 minutes
 
+// How often the system clock's expected drift is slewed out.  The RTC is only
+// read when TimeDiscipline says the drift could have outrun that.
+static const unsigned long CLOCK_STEER_INTERVAL_MS = 60UL * 1000UL;
+
 void Background_Tasks(void *parameters) {
   // Trigger first cycle immediately to cover the WiFi already on from setup().
   unsigned long lastSyncTime = millis() - WIFI_SYNC_INTERVAL_MS;
+  unsigned long lastWeatherSync = 0;
+  unsigned long lastClockSteer = millis() - CLOCK_STEER_INTERVAL_MS;
   unsigned long lastRadioLog = 0;
   unsigned long lastDrainDiag = 0;
   unsigned long lastStateTs = millis();
@@ -148,6 +203,7 @@ void Background_Tasks(void *parameters) {
     if (now - lastSyncTime >= WIFI_SYNC_INTERVAL_MS) {
       lastSyncTime = now;
       Serial.println("WiFi sync: requesting periodic connection");
+      weatherOnlySync = false;
       wifiClient.keepAlive();
 
       // Keep WiFi alive while the calendar fetch is in progress.  Cap at 90 s
@@ -161,8 +217,26 @@ void Background_Tasks(void *parameters) {
       }
       Serial.printf("WiFi sync: calendar wait ended after %lus\n",
                     (millis() - fetchWaitStart) / 1000UL);
+    } else if (!wifiConnected && locationDataReady && weather.refreshDue(now) &&
+               now - lastWeatherSync >= WEATHER_REFRESH_MIN_S * 1000UL && weather.sessionAllowed()) {
+      // The weather refresh policy can fall due between full syncs (rain
+      // about to start); connect for the weather alone.  The session counts
+      // against the fetch budget even if the fetch then fails.
+      lastWeatherSync = now;
+      Serial.println("WiFi sync: weather refresh due");
+      weather.recordSession();
+      weatherOnlySync = true;
+      wifiClient.keepAlive();
+    }
+
+    if (now - lastClockSteer >= CLOCK_STEER_INTERVAL_MS) {
+      lastClockSteer = now;
+      timeClient.steerFromRtc();
     }
 
+    // Between fetches the cached forecast is shown as of each new hour.
+    weather.readForward();
+
     // Single lifecycle call: connects when keepAlive() has been called and WiFi is
     // down; disconnects automatically after 30 seconds of idle.
     wifiClient.processLifecycle();
@@ -196,21 +270,6 @@ void Background_Tasks(void *parameters) {
       wifiDisconnectedMs = 0;
     }
 
-    // Monitor stack
-    static unsigned long lastStackCheck = 0;
-    now = millis();
-    if (now - lastStackCheck > 30000) {
-      UBaseType_t stackRemaining = uxTaskGetStackHighWaterMark(NULL);
-      if (BAT_Is_Charging()) {
-        Serial.printf(">> Background_Tasks stack high-water mark: %d bytes free\n",
-                      stackRemaining * sizeof(StackType_t));
-      }
-      if (stackRemaining * sizeof(StackType_t) < 2000) {
-        Serial.println("!! WARNING: Background_Tasks stack getting low !!");
-      }
-      lastStackCheck = now;
-    }
-
     vTaskDelay(pdMS_TO_TICKS(1000));  // 1 s idle — no need to spin at 10 ms
   }
 }
@@ -221,26 +280,9 @@ TaskHandle_t uiLoopTaskHandle = NULL;
 TaskHandle_t bleTaskHandle = NULL;  // FIX: Dedicated BLE task, isolated from Wi-Fi tasks
 
 void BLE_Task(void *parameter) {
-  unsigned long now;
-
   while (1) {
-    now = millis();
-
     ble.run();
 
-    static unsigned long lastStackCheck = 0;
-    if (now - lastStackCheck > 30000) {
-      UBaseType_t stackRemaining = uxTaskGetStackHighWaterMark(NULL);
-      if (BAT_Is_Charging()) {
-        Serial.printf(">> BLE_Task stack high-water mark: %d bytes free\n",
-                      stackRemaining * sizeof(StackType_t));
-      }
-      if (stackRemaining * sizeof(StackType_t) < 2000) {
-        Serial.println("!! WARNING: BLE_Task stack getting low !!");
-      }
-      lastStackCheck = now;
-    }
-
     // CRITICAL: Yield to IDLE0 so the task watchdog gets fed.
     // Without this, BLE_Task (priority 4) spins continuously and starves
     // IDLE0 (priority 0), causing a watchdog reboot every ~5 seconds when
@@ -260,22 +302,42 @@ void BLE_Task(void *parameter) {
   }
 }
 
+// Diagnostics typed on the serial monitor, one per line:
+//   frames      frame-time histograms and the last frames
+//   frames sd   the last frames as CSV on the SD card
+//   overlay     toggle the frame-time overlay
+//   calbench N  bind N synthetic events into the calendar list (5, 50, 500 ...)
+static void UI_PollSerialCommands() {
+  static char line[32];
+  static uint8_t length = 0;
+  while (Serial.available()) {
+    char c = Serial.read();
+    if (c != '\n' && c != '\r') {
+      if (length < sizeof(line) - 1) line[length++] = c;
+      continue;
+    }
+    if (length == 0) continue;
+    line[length] = '\0';
+    length = 0;
+
+    if (strcmp(line, "frames") == 0) {
+      frameProfiler.dump(false);
+    } else if (strcmp(line, "frames sd") == 0) {
+      frameProfiler.dump(true);
+    } else if (strcmp(line, "overlay") == 0) {
+      frameProfiler.setOverlay(!frameProfiler.overlayShown());
+    } else if (strncmp(line, "calbench", 8) == 0) {
+      int count = atoi(line + 8);
+      calendarFetcher.benchmarkList(count > 0 && count <= 2000 ? count : 50);
+    } else {
+      Serial.printf("Unknown command: %s (frames, frames sd, overlay, calbench N)\n", line);
+    }
+  }
+}
+
 // UI loop task — replaces default loop() with 16KB stack (internal RAM)
 void UI_Loop_Task(void *parameter) {
   while (1) {
-    static unsigned long lastStackCheck = 0;
-    if (millis() - lastStackCheck > 30000) {
-      UBaseType_t stackRemaining = uxTaskGetStackHighWaterMark(NULL);
-      if (BAT_Is_Charging()) {
-        Serial.printf(">> UI loop stack high-water mark: %d bytes free\n",
-                      stackRemaining * sizeof(StackType_t));
-      }
-      if (stackRemaining * sizeof(StackType_t) < 2000) {
-        Serial.println("!! WARNING: UI loop stack getting low !!");
-      }
-      lastStackCheck = millis();
-    }
-
     bool awake = PWR_IsDisplayAwake();
 
     if (awake) {
@@ -299,7 +361,15 @@ void UI_Loop_Task(void *parameter) {
     }
 
     if (awake) {
+      uiAsync.run();  // screen operations deferred by the last pass
       Lvgl_Loop();  // LVGL rendering + input processing
+      frameProfiler.tick();
+      static bool firstFrame = true;
+      if (firstFrame) {
+        firstFrame = false;
+        bootProfiler.event("first frame");
+      }
+      screenManager.tick();
     } else {
       // Display is off and LVGL tick timer is paused.  The SPD2010 touch
       // controller fires phantom/stale interrupts shortly after LCD_Sleep,
@@ -321,6 +391,33 @@ void UI_Loop_Task(void *parameter) {
         weather.applyToUI();
       }
 
+      // Per-module counters, once a minute; build with -DSTATS_LOG
+      // (env:waveshare_s3_146_stats) to get them.
+#if defined(STATS_LOG) || defined(HEAP_TRACKER)
+      static unsigned long lastStatsLog = 0;
+      if (millis() - lastStatsLog > 60000) {
+        lastStatsLog = millis();
+#ifdef STATS_LOG
+        assetPack.logStats();
+        soundBank.logStats();
+        sdIndex.logStats();
+        screenManager.logStats();
+        uiAsync.logStats();
+        notificationStore.logStats();
+        calendarFetcher.logStats();
+        weather.logStats();
+        locationCache.logStats();
+        timeClient.logStats();
+        frameProfiler.logStats();
+#endif
+#ifdef HEAP_TRACKER
+        heapTracker.logStats();
+#endif
+      }
+#endif
+
+      UI_PollSerialCommands();
+
       // Check if calendar fetch completed and update display (must run on UI core)
       calendarFetcher.checkDisplayUpdate();
 
@@ -378,6 +475,8 @@ void setup() {
   // Calibrate the internal fast RC oscillator for better sleep timing
   rtc_clk_fast_freq_set(RTC_FAST_FREQ_8M);
 
+  bootProfiler.mark("drivers");
+
   // Latch power FIRST before any serial delays that would stall battery boot.
   // Driver_Init uses printf() (UART0) internally so it's safe before Serial.begin().
   Driver_Init();
@@ -385,6 +484,7 @@ void setup() {
   // highest CPU frequency before PM locks are configured.
   setCpuFrequencyMhz(240);
 
+  bootProfiler.mark("serial");
   Serial.begin(115200);
   Serial.setTxBufferSize(2048);
   delay(200);
@@ -400,29 +500,58 @@ void setup() {
     }
   }
 
+  bootProfiler.mark("psram+sd");
+#ifdef HEAP_TRACKER
+  heapTracker.begin();
+  heapTracker.snapshot();
+#endif
   int ret = mbedtls_platform_set_calloc_free(psram_calloc, psram_free);
   Serial.printf(">> mbedTLS → PSRAM: %s\n", ret == 0 ? "OK" : "FAILED");
   SD_Init();
+#ifdef SD_SELF_TEST
+  SD_SelfTest();
+#endif
+  sdIndex.begin();
+  bootProfiler.mark("audio");
   Audio_Init();
+  soundBank.begin();  // before serializableConfigs.read() selects the resident tones
+  bootProfiler.mark("lcd+touch");
   LCD_Init();
+  bootProfiler.mark("i2c+imu");
   // Touch init can leave I2C in an invalid state on some boots; re-init bus and IMU
   // after LCD/Touch bring-up so step sensor reads remain valid.
   I2C_Init();
   QMI8658_Init();
   Serial.println(">> Reinitialized I2C + IMU after LCD/Touch init");
+  timeClient.restoreFromRtc();  // before anything below reads the clock
+  bootProfiler.mark("lvgl");
   Lvgl_Init();
+  uiAsync.begin();
+  frameProfiler.begin();
+  assetPack.begin();   // no-op unless built with USE_ASSET_PACK
+  bootProfiler.mark("ui");
   ui_init();
+  screenManager.begin();
 
+  bootProfiler.mark("config");
   serializableConfigs.add(alarmTimer);
   serializableConfigs.add(weatherLocations);
   serializableConfigs.add(settings);
   serializableConfigs.add(wifiClient);
   serializableConfigs.add(calendarFetcher);
   serializableConfigs.read();
+  // The clock came from the RTC above; the zone last used comes from the
+  // location cache, so nothing below lays out local times in UTC.
+  if (locationCache.load() && locationCache.lastZone()[0]) {
+    timeClient.restoreTimezone(locationCache.lastZone(), locationCache.lastZoneName());
+  }
+  calendarFetcher.begin();  // after read(): the SD store is keyed by the feed URLs
+  weather.begin();          // after read(): the cached forecast is for the selected location
 
   // Register callback to reload location/weather after WiFi connects
   wifiClient.setOnConnectedCallback(onWifiConnected);
 
+  bootProfiler.mark("wifi");
   Serial.println("Starting smart WiFi connection...");
   if (!wifiClient.smartConnect(10000)) {
     Serial.println("Failed to auto-connect to WiFi");
@@ -430,16 +559,20 @@ void setup() {
     Serial.println("WiFi auto-connected successfully!");
   }
 
+  bootProfiler.mark("notifications");
   if (!notificationStore.begin()) {
     Serial.println("Failed to initialize notification store!");
   }
 
+  bootProfiler.mark("ble");
 #ifndef DISABLE_BLE_FOR_PM_TEST
   ble.begin();
 #else
   Serial.println(">> BLE DISABLED for light-sleep power test");
 #endif
 
+  bootProfiler.mark("tasks");
+  taskMonitor.begin();
   if (WiFi.isConnected()) {
     locationDataReady = true;
 
@@ -471,13 +604,13 @@ void setup() {
   xTaskCreatePinnedToCoreWithCaps(
     BLE_Task,
     "BLE Task",
-    16384,
+    BLE_TASK_STACK,
     NULL,
     4,                // Higher priority than Background_Tasks (3)
     &bleTaskHandle,
     0,                // Core 0 — same as NimBLE host task
     MALLOC_CAP_SPIRAM);
-  Serial.println(">> BLE task created (Core 0, priority 4, 16KB PSRAM stack)");
+  Serial.printf(">> BLE task created (Core 0, priority 4, %luKB PSRAM stack)\n", (unsigned long)(BLE_TASK_STACK / 1024));
 #endif
 
   // Background_Tasks now also runs calendar fetch directly (no CalFetch one-shot task).
@@ -486,18 +619,18 @@ void setup() {
   xTaskCreatePinnedToCoreWithCaps(
     Background_Tasks,
     "Background Tasks",
-    20480,
+    BACKGROUND_TASK_STACK,
     NULL,
     3,
     &periodTasksHandle,
     0,
     MALLOC_CAP_SPIRAM);
-  Serial.println(">> Background Tasks created (Core 0, priority 3, 20KB PSRAM stack)");    
+  Serial.printf(">> Background Tasks created (Core 0, priority 3, %luKB PSRAM stack)\n", (unsigned long)(BACKGROUND_TASK_STACK / 1024));    
 
   xTaskCreatePinnedToCoreWithCaps(
     Driver_Loop,
     "Driver Task",
-    6144,
+    DRIVER_TASK_STACK,
     NULL,
     3,
     &driverTaskHandle,
@@ -507,7 +640,7 @@ void setup() {
   xTaskCreatePinnedToCoreWithCaps(
     UI_Loop_Task,
     "UI Loop",
-    16384,
+    UI_LOOP_TASK_STACK,
     NULL,
     1,
     &uiLoopTaskHandle,
@@ -515,6 +648,15 @@ void setup() {
     MALLOC_CAP_SPIRAM);
   Serial.printf(">> All tasks created with PSRAM stacks — internal heap preserved\n");
 
+#ifndef DISABLE_BLE_FOR_PM_TEST
+  taskMonitor.watch(bleTaskHandle, BLE_TASK_STACK, TASK_STACK_MARGIN);
+#endif
+  taskMonitor.watch(periodTasksHandle, BACKGROUND_TASK_STACK, TASK_STACK_MARGIN);
+  taskMonitor.watch(driverTaskHandle, DRIVER_TASK_STACK, DRIVER_TASK_STACK_MARGIN);
+  taskMonitor.watch(uiLoopTaskHandle, UI_LOOP_TASK_STACK, TASK_STACK_MARGIN);
+
+  bootProfiler.mark("pm");
+
   // -----------------------------------------------------------------------
   // Automatic light sleep via FreeRTOS tickless idle + BLE modem sleep.
   //
@@ -563,6 +705,8 @@ void setup() {
   esp_pm_dump_locks(stdout);
   fflush(stdout);
   Serial.println("[PMDump] ---end---");
+
+  bootProfiler.finish();
 }
 
 
@@ -7,10 +7,12 @@
 #include "src/screens.h"
 #include "src/vars.h"
 #include "ble.h"
+#include "ui_async.h"
 
 // Global instance
 extern NotificationStore notificationStore;
 extern BLE ble;
+extern UiAsync uiAsync;
 
 char active_call_duration[10] = { 0 };
 time_t callStart;
@@ -50,19 +52,9 @@ time_t callStart;
   } while(0)
 
 // ============================================================================
-// CRITICAL FIX: Helper struct and callbacks for async screen operations
-// All LVGL screen operations MUST use lv_async_call() to run on LVGL thread
+// CRITICAL FIX: All LVGL screen operations are deferred to the UI task through
+// UiAsync (pooled, in post order) instead of running from BLE/event context
 // ============================================================================
-struct ScreenOperation {
-  uint8_t screenId;
-  lv_scr_load_anim_t animType;
-  uint16_t time;
-  uint16_t delay;
-  bool isPush;  // true = push, false = pop
-  bool isQuickNotificationOp;
-  uint32_t quickNotificationGeneration;
-};
-
 static uint32_t s_quickNotificationGeneration = 0;
 static bool s_quickNotificationPushPending = false;
 static bool s_quickNotificationPopPending = false;
@@ -78,43 +70,32 @@ static void clearQuickNotificationFlowVars() {
   eez::flow::setGlobalVariable(FLOW_GLOBAL_VARIABLE_QUICK_NOTIFICATION_IMPORTANT, eez::BooleanValue(false));
 }
 
-// Async callbacks that run on LVGL thread
-static void asyncPushScreen(void* param) {
-  ScreenOperation* op = (ScreenOperation*)param;
-  if (op) {
-    if (op->isQuickNotificationOp) {
-      if (op->quickNotificationGeneration != s_quickNotificationGeneration) {
-        lv_mem_free(op);
-        return;
-      }
-      s_quickNotificationPushPending = false;
-      if (isQuickNotificationScreenOnTop()) {
-        lv_mem_free(op);
-        return;
-      }
+// Deferred callbacks that run on the UI task.  Quick-notification operations
+// are dropped if a later push/dismiss superseded them.
+static void asyncPushScreen(ScreenOperation* op) {
+  if (op->isQuickNotificationOp) {
+    if (op->quickNotificationGeneration != s_quickNotificationGeneration) {
+      return;
+    }
+    s_quickNotificationPushPending = false;
+    if (isQuickNotificationScreenOnTop()) {
+      return;
     }
-    eez_flow_push_screen(op->screenId, op->animType, op->time, op->delay);
-    lv_mem_free(op);
   }
+  eez_flow_push_screen(op->screenId, op->animType, op->time, op->delay);
 }
 
-static void asyncPopScreen(void* param) {
-  ScreenOperation* op = (ScreenOperation*)param;
-  if (op) {
-    if (op->isQuickNotificationOp) {
-      if (op->quickNotificationGeneration != s_quickNotificationGeneration) {
-        lv_mem_free(op);
-        return;
-      }
-      s_quickNotificationPopPending = false;
-      if (!isQuickNotificationScreenOnTop()) {
-        lv_mem_free(op);
-        return;
-      }
+static void asyncPopScreen(ScreenOperation* op) {
+  if (op->isQuickNotificationOp) {
+    if (op->quickNotificationGeneration != s_quickNotificationGeneration) {
+      return;
+    }
+    s_quickNotificationPopPending = false;
+    if (!isQuickNotificationScreenOnTop()) {
+      return;
     }
-    eez_flow_pop_screen(op->animType, op->time, op->delay);
-    lv_mem_free(op);
   }
+  eez_flow_pop_screen(op->animType, op->time, op->delay);
 }
 
 void action_update_call_duration(lv_event_t *e) {
@@ -181,16 +162,7 @@ void action_decline_call(lv_event_t* e) {
   ble.sendAction(uid, false);
 
   // CRITICAL FIX: Use async screen pop
-  ScreenOperation* op = (ScreenOperation*)lv_mem_alloc(sizeof(ScreenOperation));
-  if (op) {
-    op->animType = LV_SCR_LOAD_ANIM_FADE_OUT;
-    op->time = 200;
-    op->delay = 0;
-    op->isPush = false;
-    op->isQuickNotificationOp = false;
-    op->quickNotificationGeneration = 0;
-    lv_async_call(asyncPopScreen, op);
-  }
+  uiAsync.popScreen(LV_SCR_LOAD_ANIM_FADE_OUT, 200, 0);
 }
 
 // Tapping the active-call icon re-opens the call screen.
@@ -282,19 +254,16 @@ void NotificationStore::showQuickNotification(const QuickNotificationData& data)
     s_quickNotificationGeneration++;
     s_quickNotificationPushPending = true;
 
-    // CRITICAL FIX: Use lv_async_call for screen push
-    ScreenOperation* op = (ScreenOperation*)lv_mem_alloc(sizeof(ScreenOperation));
-    if (op) {
-      op->screenId = SCREEN_ID_QUICK_NOTIFICATION;
-      op->animType = LV_SCR_LOAD_ANIM_OVER_BOTTOM;
-      op->time = 150;
-      op->delay = 0;
-      op->isPush = true;
-      op->isQuickNotificationOp = true;
-      op->quickNotificationGeneration = s_quickNotificationGeneration;
-      lv_async_call(asyncPushScreen, op);
-    } else {
-      Serial.println(">> ERROR: Failed to allocate screen operation");
+    // Deferred to the next UI pass; see UiAsync
+    ScreenOperation op = {};
+    op.screenId = SCREEN_ID_QUICK_NOTIFICATION;
+    op.animType = LV_SCR_LOAD_ANIM_OVER_BOTTOM;
+    op.time = 150;
+    op.delay = 0;
+    op.isPush = true;
+    op.isQuickNotificationOp = true;
+    op.quickNotificationGeneration = s_quickNotificationGeneration;
+    if (!uiAsync.post(asyncPushScreen, op)) {
       quickNotificationActive = false;
       s_quickNotificationPushPending = false;
       return;
@@ -372,54 +341,46 @@ void NotificationStore::dismissQuickNotification() {
   s_quickNotificationGeneration++;
   s_quickNotificationPopPending = true;
 
-  // CRITICAL FIX: Use lv_async_call for screen pop
-  ScreenOperation* op = (ScreenOperation*)lv_mem_alloc(sizeof(ScreenOperation));
-  if (op) {
-    op->animType = LV_SCR_LOAD_ANIM_MOVE_BOTTOM;
-    op->time = 150;
-    op->delay = 0;
-    op->isPush = false;
-    op->isQuickNotificationOp = true;
-    op->quickNotificationGeneration = s_quickNotificationGeneration;
-    lv_async_call(asyncPopScreen, op);
-  } else {
-    Serial.println(">> ERROR: Failed to allocate screen operation");
+  // Deferred to the next UI pass; see UiAsync
+  ScreenOperation op = {};
+  op.animType = LV_SCR_LOAD_ANIM_MOVE_BOTTOM;
+  op.time = 150;
+  op.delay = 0;
+  op.isPush = false;
+  op.isQuickNotificationOp = true;
+  op.quickNotificationGeneration = s_quickNotificationGeneration;
+  if (!uiAsync.post(asyncPopScreen, op)) {
     s_quickNotificationPopPending = false;
   }
 }
 
 void NotificationStore::queueQuickNotification(const char* icon, const char* title, const char* subtitle, const char* message, bool important) {
-  if (!quickNotificationQueue) {
-    Serial.println(">> quickNotificationQueue is NULL!");
+  if (!commandQueue) {
+    Serial.println(">> commandQueue is NULL!");
     return;
   }
 
-  QuickNotificationData data;
-  strncpy(data.icon, icon ? icon : "", sizeof(data.icon) - 1);
-  data.icon[sizeof(data.icon) - 1] = '\0';
-  strncpy(data.title, title ? title : "", sizeof(data.title) - 1);
-  data.title[sizeof(data.title) - 1] = '\0';
-  strncpy(data.subtitle, subtitle ? subtitle : "", sizeof(data.subtitle) - 1);
-  data.subtitle[sizeof(data.subtitle) - 1] = '\0';
-  strncpy(data.message, message ? message : "", sizeof(data.message) - 1);
-  data.message[sizeof(data.message) - 1] = '\0';
-  data.important = important;
-
-  if (xQueueSend(quickNotificationQueue, &data, 0) != pdTRUE) {
-    Serial.println(">> Quick notification queue full, skipping");
+  QuickNotificationData* data = quickPool.acquire();
+  if (!data) {
+    Serial.println(">> Quick notification pool exhausted, skipping");
     return;
   }
+  strncpy(data->icon, icon ? icon : "", sizeof(data->icon) - 1);
+  data->icon[sizeof(data->icon) - 1] = '\0';
+  strncpy(data->title, title ? title : "", sizeof(data->title) - 1);
+  data->title[sizeof(data->title) - 1] = '\0';
+  strncpy(data->subtitle, subtitle ? subtitle : "", sizeof(data->subtitle) - 1);
+  data->subtitle[sizeof(data->subtitle) - 1] = '\0';
+  strncpy(data->message, message ? message : "", sizeof(data->message) - 1);
+  data->message[sizeof(data->message) - 1] = '\0';
+  data->important = important;
 
   // Wake the display immediately so the notification is visible when it renders.
   // Safe to call from Core 0 — only writes a volatile timestamp.
   PWR_UpdateActivity();
 
-  // Queue a command to trigger processing
-  NotificationCommandData cmd;
-  cmd.cmd = NotificationCommand::SHOW_QUICK_NOTIFICATION;
-  cmd.uid = 0;
-
-  if (xQueueSend(commandQueue, &cmd, 0) != pdTRUE) {
+  if (!postCommand(NotificationCommand::SHOW_QUICK_NOTIFICATION, 0, data)) {
+    quickPool.release(data);
     Serial.println(">> Failed to queue quick notification command");
   }
 }
@@ -439,56 +400,45 @@ void NotificationStore::queueAddNotification(
   const char* negativeActionLabel) {
   // CRITICAL: Validate queues before attempting to use them
   // This is called from Core 0 (BLE) and must be extra careful
-  VALIDATE_QUEUE(addNotificationQueue, "addNotificationQueue in queueAdd");
   VALIDATE_QUEUE(commandQueue, "commandQueue in queueAdd");
 
-  // CRITICAL FIX: Check queue space BEFORE preparing data
-  UBaseType_t spaces = uxQueueSpacesAvailable(addNotificationQueue);
-  if (spaces == 0) {
-    Serial.println(">> ERROR: Add notification queue FULL! Dropping notification");
+  AddNotificationData* data = addPool.acquire();
+  if (!data) {
+    Serial.println(">> ERROR: Add notification pool exhausted! Dropping notification");
     Serial.printf(">> Dropped notification UID: %u, Title: %s\n", uid, title ? title : "(null)");
     return;
   }
+  uint8_t spaces = addPool.available();
   if (spaces <= 2) {
-    Serial.printf(">> WARNING: Add notification queue low (%d slots remaining)\n", spaces);
-  }
-
-  AddNotificationData data;
-  strncpy(data.appId, appId ? appId : "", sizeof(data.appId) - 1);
-  data.appId[sizeof(data.appId) - 1] = '\0';
-  strncpy(data.title, title ? title : "", sizeof(data.title) - 1);
-  data.title[sizeof(data.title) - 1] = '\0';
-  strncpy(data.subtitle, subtitle ? subtitle : "", sizeof(data.subtitle) - 1);
-  data.subtitle[sizeof(data.subtitle) - 1] = '\0';
-  strncpy(data.message, message ? message : "", sizeof(data.message) - 1);
-  data.message[sizeof(data.message) - 1] = '\0';
-  strncpy(data.dateTime, dateTime ? dateTime : "", sizeof(data.dateTime) - 1);
-  data.dateTime[sizeof(data.dateTime) - 1] = '\0';
-  strncpy(data.positiveActionLabel, positiveActionLabel ? positiveActionLabel : "", sizeof(data.positiveActionLabel) - 1);
-  data.positiveActionLabel[sizeof(data.positiveActionLabel) - 1] = '\0';
-  strncpy(data.negativeActionLabel, negativeActionLabel ? negativeActionLabel : "", sizeof(data.negativeActionLabel) - 1);
-  data.negativeActionLabel[sizeof(data.negativeActionLabel) - 1] = '\0';
-  data.uid = uid;
-  data.categoryId = categoryId;
-  data.important = important;
-  data.hasPositiveAction = hasPositiveAction;
-  data.hasNegativeAction = hasNegativeAction;
-
-  if (xQueueSend(addNotificationQueue, &data, 0) != pdTRUE) {
-    Serial.println(">> ERROR: Failed to queue add notification data (unexpected failure)");
-    return;
-  }
+    Serial.printf(">> WARNING: Add notification pool low (%d slots remaining)\n", spaces);
+  }
+
+  strncpy(data->appId, appId ? appId : "", sizeof(data->appId) - 1);
+  data->appId[sizeof(data->appId) - 1] = '\0';
+  strncpy(data->title, title ? title : "", sizeof(data->title) - 1);
+  data->title[sizeof(data->title) - 1] = '\0';
+  strncpy(data->subtitle, subtitle ? subtitle : "", sizeof(data->subtitle) - 1);
+  data->subtitle[sizeof(data->subtitle) - 1] = '\0';
+  strncpy(data->message, message ? message : "", sizeof(data->message) - 1);
+  data->message[sizeof(data->message) - 1] = '\0';
+  strncpy(data->dateTime, dateTime ? dateTime : "", sizeof(data->dateTime) - 1);
+  data->dateTime[sizeof(data->dateTime) - 1] = '\0';
+  strncpy(data->positiveActionLabel, positiveActionLabel ? positiveActionLabel : "", sizeof(data->positiveActionLabel) - 1);
+  data->positiveActionLabel[sizeof(data->positiveActionLabel) - 1] = '\0';
+  strncpy(data->negativeActionLabel, negativeActionLabel ? negativeActionLabel : "", sizeof(data->negativeActionLabel) - 1);
+  data->negativeActionLabel[sizeof(data->negativeActionLabel) - 1] = '\0';
+  data->uid = uid;
+  data->categoryId = categoryId;
+  data->important = important;
+  data->hasPositiveAction = hasPositiveAction;
+  data->hasNegativeAction = hasNegativeAction;
 
   // Wake the display immediately so the notification is visible when it renders.
   // Safe to call from Core 0 — only writes a volatile timestamp.
   PWR_UpdateActivity();
 
-  // Queue a command to trigger processing
-  NotificationCommandData cmd;
-  cmd.cmd = NotificationCommand::ADD_NOTIFICATION;
-  cmd.uid = uid;
-
-  if (xQueueSend(commandQueue, &cmd, 0) != pdTRUE) {
+  if (!postCommand(NotificationCommand::ADD_NOTIFICATION, uid, data)) {
+    addPool.release(data);
     Serial.println(">> ERROR: Failed to queue add notification command");
   } else {
     Serial.printf(">> Queued ADD_NOTIFICATION for UID %u\n", uid);
@@ -516,13 +466,12 @@ bool NotificationStore::begin() {
   quickNotificationShowTime = 0;
 
   // ----------------------------------------------------------------------
-  // MEMORY OPTIMIZATION: Move Queues to PSRAM
-  // CRITICAL FIX: Increased queue sizes to prevent overflow
+  // MEMORY OPTIMIZATION: Command bus storage in PSRAM
+  // One command queue; adds, quick notifications and calls carry a pointer
+  // into a fixed payload pool instead of going through queues of their own.
   // ----------------------------------------------------------------------
-
-  // 1. Command Queue - INCREASED from 16 to 20
   size_t cmdItemSize = sizeof(NotificationCommandData);
-  size_t cmdQueueLen = 20;  // CRITICAL FIX: Was 16
+  size_t cmdQueueLen = NOTIFICATION_COMMAND_QUEUE_LEN;
   q_command_storage = (uint8_t*)heap_caps_malloc(cmdQueueLen * cmdItemSize, MALLOC_CAP_SPIRAM);
   q_command_struct = (StaticQueue_t*)heap_caps_malloc(sizeof(StaticQueue_t), MALLOC_CAP_INTERNAL);  // Struct in internal RAM is safer
 
@@ -530,68 +479,14 @@ bool NotificationStore::begin() {
     commandQueue = xQueueCreateStatic(cmdQueueLen, cmdItemSize, q_command_storage, q_command_struct);
   }
 
-  if (!commandQueue) {
-    Serial.println(">> FATAL: Failed to create notification command queue!");
+  if (!commandQueue || !addPool.begin() || !quickPool.begin() || !callPool.begin()) {
+    Serial.println(">> FATAL: Failed to create notification command bus!");
     vSemaphoreDelete(notificationsMutex);  // Clean up mutex
     notificationsMutex = nullptr;
     initialized = false;
     return false;
   }
 
-  // 2. Quick Notification Queue (~2.2KB) - INCREASED from 4 to 10
-  size_t quickItemSize = sizeof(QuickNotificationData);
-  size_t quickQueueLen = 10;  // CRITICAL FIX: Was 4
-  q_quick_storage = (uint8_t*)heap_caps_malloc(quickQueueLen * quickItemSize, MALLOC_CAP_SPIRAM);
-  q_quick_struct = (StaticQueue_t*)heap_caps_malloc(sizeof(StaticQueue_t), MALLOC_CAP_INTERNAL);
-
-  if (q_quick_storage && q_quick_struct) {
-    quickNotificationQueue = xQueueCreateStatic(quickQueueLen, quickItemSize, q_quick_storage, q_quick_struct);
-  }
-
-  if (!quickNotificationQueue) {
-    Serial.println(">> FATAL: Failed to create quick notification queue!");
-    vSemaphoreDelete(notificationsMutex);
-    notificationsMutex = nullptr;
-    initialized = false;
-    return false;
-  }
-
-  // 3. Add Notification Queue (~6KB) - INCREASED from 8 to 15
-  size_t addItemSize = sizeof(AddNotificationData);
-  size_t addQueueLen = 15;  // CRITICAL FIX: Was 8
-  q_add_storage = (uint8_t*)heap_caps_malloc(addQueueLen * addItemSize, MALLOC_CAP_SPIRAM);
-  q_add_struct = (StaticQueue_t*)heap_caps_malloc(sizeof(StaticQueue_t), MALLOC_CAP_INTERNAL);
-
-  if (q_add_storage && q_add_struct) {
-    addNotificationQueue = xQueueCreateStatic(addQueueLen, addItemSize, q_add_storage, q_add_struct);
-  }
-
-  if (!addNotificationQueue) {
-    Serial.println(">> FATAL: Failed to create add notification queue!");
-    vSemaphoreDelete(notificationsMutex);
-    notificationsMutex = nullptr;
-    initialized = false;
-    return false;
-  }
-
-  // 4. Incoming Call Queue - INCREASED from 2 to 5
-  size_t callItemSize = sizeof(IncomingCallData);
-  size_t callQueueLen = 5;  // CRITICAL FIX: Was 2
-  q_call_storage = (uint8_t*)heap_caps_malloc(callQueueLen * callItemSize, MALLOC_CAP_SPIRAM);
-  q_call_struct = (StaticQueue_t*)heap_caps_malloc(sizeof(StaticQueue_t), MALLOC_CAP_INTERNAL);
-
-  if (q_call_storage && q_call_struct) {
-    incomingCallQueue = xQueueCreateStatic(callQueueLen, callItemSize, q_call_storage, q_call_struct);
-  }
-
-  if (!incomingCallQueue) {
-    Serial.println(">> FATAL: Failed to create incoming call queue!");
-    vSemaphoreDelete(notificationsMutex);
-    notificationsMutex = nullptr;
-    initialized = false;
-    return false;
-  }
-
   // Allocate notification storage in PSRAM (Already correct in original code)
   notifications = (StoredNotification*)heap_caps_malloc(
       sizeof(StoredNotification) * MAX_NOTIFICATIONS, 
@@ -626,8 +521,8 @@ bool NotificationStore::begin() {
 
   Serial.printf(">> NotificationStore: Allocated %d slots in PSRAM (%d bytes)\n",
                 MAX_NOTIFICATIONS, sizeof(StoredNotification) * MAX_NOTIFICATIONS);
-  Serial.printf(">> Queue sizes - CMD:%d QUICK:%d ADD:%d CALL:%d\n",
-                cmdQueueLen, quickQueueLen, addQueueLen, callQueueLen);
+  Serial.printf(">> Command bus - CMD:%d QUICK:%d ADD:%d CALL:%d\n",
+                cmdQueueLen, NOTIFICATION_QUICK_POOL_SIZE, NOTIFICATION_ADD_POOL_SIZE, NOTIFICATION_CALL_POOL_SIZE);
 
   updateDisplay();
 
@@ -635,13 +530,7 @@ bool NotificationStore::begin() {
 }
 
 void NotificationStore::queueRemove(uint32_t uid) {
-  if (!commandQueue) return;
-
-  NotificationCommandData cmd;
-  cmd.cmd = NotificationCommand::REMOVE;
-  cmd.uid = uid;
-
-  if (xQueueSend(commandQueue, &cmd, 0) != pdTRUE) {
+  if (!postCommand(NotificationCommand::REMOVE, uid)) {
     Serial.println(">> Warning: Command queue full, remove dropped");
   }
 }
@@ -653,9 +542,6 @@ void NotificationStore::processCommands() {
   
   // CRITICAL: Validate all queues before processing
   VALIDATE_QUEUE(commandQueue, "commandQueue");
-  VALIDATE_QUEUE(quickNotificationQueue, "quickNotificationQueue");
-  VALIDATE_QUEUE(addNotificationQueue, "addNotificationQueue");
-  VALIDATE_QUEUE(incomingCallQueue, "incomingCallQueue");
 
   // Use static buffers to avoid stack overflow - these are only accessed from Core 1
   static NotificationCommandData cmd;
@@ -701,31 +587,13 @@ void NotificationStore::processCommands() {
       case NotificationCommand::POP_CALL_SCREEN:
         if (isLvglReady()) {
           Serial.println(">> Queueing async pop of call screen");
-          ScreenOperation* op = (ScreenOperation*)lv_mem_alloc(sizeof(ScreenOperation));
-          if (op) {
-            op->animType = LV_SCR_LOAD_ANIM_FADE_OUT;
-            op->time = 200;
-            op->delay = 0;
-            op->isPush = false;
-            op->isQuickNotificationOp = false;
-            op->quickNotificationGeneration = 0;
-            lv_async_call(asyncPopScreen, op);
-          }
+          uiAsync.popScreen(LV_SCR_LOAD_ANIM_FADE_OUT, 200, 0);
           // FIX: If the call screen was pushed on top of a buried quick notification,
           // pop that stale quick notification screen too so the base screen is restored.
           if (quickNotificationBuriedUnderCall) {
             Serial.println(">> Also popping buried quick notification screen");
             quickNotificationBuriedUnderCall = false;
-            ScreenOperation* op2 = (ScreenOperation*)lv_mem_alloc(sizeof(ScreenOperation));
-            if (op2) {
-              op2->animType = LV_SCR_LOAD_ANIM_NONE;
-              op2->time = 0;
-              op2->delay = 250;  // After the call screen fade-out completes
-              op2->isPush = false;
-              op2->isQuickNotificationOp = false;
-              op2->quickNotificationGeneration = 0;
-              lv_async_call(asyncPopScreen, op2);
-            }
+            uiAsync.popScreen(LV_SCR_LOAD_ANIM_NONE, 0, 250);  // After the call screen fade-out completes
           }
         }
         break;
@@ -733,11 +601,11 @@ void NotificationStore::processCommands() {
       case NotificationCommand::PUSH_CALL_SCREEN:
         {
           Serial.println(">> Received PUSH_CALL_SCREEN command");
-          if (!incomingCallQueue) {
-            Serial.println(">> ERROR: incomingCallQueue is NULL!");
-            break;
-          }
-          if (xQueueReceive(incomingCallQueue, &callData, 0) == pdTRUE) {
+          // Copy out and return the slot at once so every path below can break.
+          IncomingCallData* call = (IncomingCallData*)cmd.payload;
+          if (callPool.owns(call)) {
+            callData = *call;
+            callPool.release(call);
             if (!isLvglReady()) {
               Serial.println(">> Skipping call screen push - LVGL not ready");
               break;
@@ -771,19 +639,9 @@ void NotificationStore::processCommands() {
                                          eez::IntegerValue(callData.uid));
 
             Serial.println(">> Queueing async push of call screen");
-            ScreenOperation* op = (ScreenOperation*)lv_mem_alloc(sizeof(ScreenOperation));
-            if (op) {
-              op->screenId = SCREEN_ID_INCOMING_CALL;
-              op->animType = LV_SCR_LOAD_ANIM_FADE_IN;
-              op->time = 200;
-              op->delay = 0;
-              op->isPush = true;
-              op->isQuickNotificationOp = false;
-              op->quickNotificationGeneration = 0;
-              lv_async_call(asyncPushScreen, op);
-            }
+            uiAsync.pushScreen(SCREEN_ID_INCOMING_CALL, LV_SCR_LOAD_ANIM_FADE_IN, 200, 0);
           } else {
-            Serial.println(">> ERROR: No data in incomingCallQueue!");
+            Serial.println(">> ERROR: PUSH_CALL_SCREEN without call data!");
           }
         }
         break;
@@ -791,15 +649,14 @@ void NotificationStore::processCommands() {
       case NotificationCommand::SHOW_QUICK_NOTIFICATION:
         {
           Serial.println(">> Received SHOW_QUICK_NOTIFICATION command");
-          if (!quickNotificationQueue) {
-            Serial.println(">> ERROR: quickNotificationQueue is NULL!");
-            break;
-          }
-          if (xQueueReceive(quickNotificationQueue, &qnData, 0) == pdTRUE) {
+          QuickNotificationData* quick = (QuickNotificationData*)cmd.payload;
+          if (quickPool.owns(quick)) {
+            qnData = *quick;
+            quickPool.release(quick);
             Serial.printf(">> Got quick notification data: %s\n", qnData.title);
             showQuickNotification(qnData);
           } else {
-            Serial.println(">> ERROR: No data in quickNotificationQueue!");
+            Serial.println(">> ERROR: SHOW_QUICK_NOTIFICATION without data!");
           }
         }
         break;
@@ -807,11 +664,10 @@ void NotificationStore::processCommands() {
       case NotificationCommand::ADD_NOTIFICATION:
         {
           Serial.println(">> Received ADD_NOTIFICATION command");
-          if (!addNotificationQueue) {
-            Serial.println(">> ERROR: addNotificationQueue is NULL!");
-            break;
-          }
-          if (xQueueReceive(addNotificationQueue, &addData, 0) == pdTRUE) {
+          AddNotificationData* add = (AddNotificationData*)cmd.payload;
+          if (addPool.owns(add)) {
+            addData = *add;
+            addPool.release(add);
             Serial.printf(">> Processing queued notification: %s (UID %u)\n", addData.title, addData.uid);
             addNotification(
               addData.appId,
@@ -827,7 +683,7 @@ void NotificationStore::processCommands() {
               addData.positiveActionLabel,
               addData.negativeActionLabel);
           } else {
-            Serial.println(">> ERROR: No data in addNotificationQueue!");
+            Serial.println(">> ERROR: ADD_NOTIFICATION without data!");
           }
         }
         break;
@@ -842,31 +698,13 @@ void NotificationStore::processCommands() {
           activeCallCallerNumber[0] = '\0';
           eez::flow::setGlobalVariable(FLOW_GLOBAL_VARIABLE_ACTIVE_CALL_VISIBLE, eez::BooleanValue(false));
           if (isLvglReady()) {
-            ScreenOperation* op = (ScreenOperation*)lv_mem_alloc(sizeof(ScreenOperation));
-            if (op) {
-              op->animType = LV_SCR_LOAD_ANIM_FADE_OUT;
-              op->time = 300;
-              op->delay = 0;
-              op->isPush = false;
-              op->isQuickNotificationOp = false;
-              op->quickNotificationGeneration = 0;
-              lv_async_call(asyncPopScreen, op);
-            }
+            uiAsync.popScreen(LV_SCR_LOAD_ANIM_FADE_OUT, 300, 0);
             // FIX: If the call screen was pushed on top of a buried quick notification,
             // pop that stale quick notification screen too so the base screen is restored.
             if (quickNotificationBuriedUnderCall) {
               Serial.println(">> Also popping buried quick notification screen after call end");
               quickNotificationBuriedUnderCall = false;
-              ScreenOperation* op2 = (ScreenOperation*)lv_mem_alloc(sizeof(ScreenOperation));
-              if (op2) {
-                op2->animType = LV_SCR_LOAD_ANIM_NONE;
-                op2->time = 0;
-                op2->delay = 350;  // After the call screen fade-out (300ms) completes
-                op2->isPush = false;
-                op2->isQuickNotificationOp = false;
-                op2->quickNotificationGeneration = 0;
-                lv_async_call(asyncPopScreen, op2);
-              }
+              uiAsync.popScreen(LV_SCR_LOAD_ANIM_NONE, 0, 350);  // After the call screen fade-out (300ms) completes
             }
           }
         }
@@ -890,17 +728,7 @@ void NotificationStore::processCommands() {
                                        eez::StringValue(activeCallCallerNumber));
           eez::flow::setGlobalVariable(FLOW_GLOBAL_VARIABLE_INCOMING_CALL_UID,
                                        eez::IntegerValue(activeCallUid));
-          ScreenOperation* op = (ScreenOperation*)lv_mem_alloc(sizeof(ScreenOperation));
-          if (op) {
-            op->screenId = SCREEN_ID_INCOMING_CALL;
-            op->animType = LV_SCR_LOAD_ANIM_FADE_IN;
-            op->time = 200;
-            op->delay = 0;
-            op->isPush = true;
-            op->isQuickNotificationOp = false;
-            op->quickNotificationGeneration = 0;
-            lv_async_call(asyncPushScreen, op);
-          }
+          uiAsync.pushScreen(SCREEN_ID_INCOMING_CALL, LV_SCR_LOAD_ANIM_FADE_IN, 200, 0);
         }
         break;
 
@@ -941,87 +769,84 @@ void NotificationStore::processCommands() {
 }
 
 void NotificationStore::queuePopCallScreen() {
-  if (!commandQueue) return;
-
-  NotificationCommandData cmd;
-  cmd.cmd = NotificationCommand::POP_CALL_SCREEN;
-  cmd.uid = 0;
-
-  if (xQueueSend(commandQueue, &cmd, 0) != pdTRUE) {
+  if (!postCommand(NotificationCommand::POP_CALL_SCREEN, 0)) {
     Serial.println(">> Warning: Command queue full, pop screen dropped");
   }
 }
 
 void NotificationStore::queueClearActiveCall() {
-  if (!commandQueue) return;
-
-  NotificationCommandData cmd;
-  cmd.cmd = NotificationCommand::CLEAR_ACTIVE_CALL;
-  cmd.uid = 0;
-
-  if (xQueueSend(commandQueue, &cmd, 0) != pdTRUE) {
+  if (!postCommand(NotificationCommand::CLEAR_ACTIVE_CALL, 0)) {
     Serial.println(">> Warning: Command queue full, CLEAR_ACTIVE_CALL dropped");
   }
 }
 
 void NotificationStore::queueReturnToCall() {
-  if (!commandQueue) return;
-
-  NotificationCommandData cmd;
-  cmd.cmd = NotificationCommand::RETURN_TO_CALL;
-  cmd.uid = 0;
-
-  if (xQueueSend(commandQueue, &cmd, 0) != pdTRUE) {
+  if (!postCommand(NotificationCommand::RETURN_TO_CALL, 0)) {
     Serial.println(">> Warning: Command queue full, RETURN_TO_CALL dropped");
   }
 }
 
 void NotificationStore::queueSetActiveCallUid(uint32_t uid) {
-  if (!commandQueue) return;
-
-  NotificationCommandData cmd;
-  cmd.cmd = NotificationCommand::SET_ACTIVE_CALL_UID;
-  cmd.uid = uid;
-
-  if (xQueueSend(commandQueue, &cmd, 0) != pdTRUE) {
+  if (!postCommand(NotificationCommand::SET_ACTIVE_CALL_UID, uid)) {
     Serial.println(">> Warning: Command queue full, SET_ACTIVE_CALL_UID dropped");
   }
 }
 
 void NotificationStore::queuePushCallScreen(const char* callerName, const char* callerNumber, uint32_t uid) {
-  if (!incomingCallQueue || !commandQueue) {
+  if (!commandQueue) {
     Serial.println(">> queuePushCallScreen: Queue is NULL!");
     return;
   }
 
-  IncomingCallData data;
-  strncpy(data.callerName, callerName ? callerName : "", sizeof(data.callerName) - 1);
-  data.callerName[sizeof(data.callerName) - 1] = '\0';
-  strncpy(data.callerNumber, callerNumber ? callerNumber : "", sizeof(data.callerNumber) - 1);
-  data.callerNumber[sizeof(data.callerNumber) - 1] = '\0';
-  data.uid = uid;
-
-  if (xQueueSend(incomingCallQueue, &data, 0) != pdTRUE) {
-    Serial.println(">> Incoming call queue full, skipping");
+  IncomingCallData* data = callPool.acquire();
+  if (!data) {
+    Serial.println(">> Incoming call pool exhausted, skipping");
     return;
   }
+  strncpy(data->callerName, callerName ? callerName : "", sizeof(data->callerName) - 1);
+  data->callerName[sizeof(data->callerName) - 1] = '\0';
+  strncpy(data->callerNumber, callerNumber ? callerNumber : "", sizeof(data->callerNumber) - 1);
+  data->callerNumber[sizeof(data->callerNumber) - 1] = '\0';
+  data->uid = uid;
 
   // Wake the display immediately for incoming calls.
   // Safe to call from Core 0 — only writes a volatile timestamp.
   PWR_UpdateActivity();
 
-  // Queue a command to trigger processing
-  NotificationCommandData cmd;
-  cmd.cmd = NotificationCommand::PUSH_CALL_SCREEN;
-  cmd.uid = uid;
-
-  if (xQueueSend(commandQueue, &cmd, 0) != pdTRUE) {
+  if (!postCommand(NotificationCommand::PUSH_CALL_SCREEN, uid, data)) {
+    callPool.release(data);
     Serial.println(">> Failed to queue push call screen command");
   } else {
     Serial.printf(">> Queued PUSH_CALL_SCREEN for UID %u\n", uid);
   }
 }
 
+// Any core.  False when the bus is not up or the queue is full.
+bool NotificationStore::postCommand(NotificationCommand cmd, uint32_t uid, void* payload) {
+  if (!commandQueue) return false;
+
+  NotificationCommandData data;
+  data.cmd = cmd;
+  data.uid = uid;
+  data.payload = payload;
+
+  if (xQueueSend(commandQueue, &data, 0) != pdTRUE) {
+    droppedCommands.fetch_add(1, std::memory_order_relaxed);
+    return false;
+  }
+  return true;
+}
+
+void NotificationStore::logStats() {
+  if (!commandQueue) return;
+  Serial.printf("[NotifyBus] queued=%u/%d dropped=%lu\n", (unsigned)uxQueueMessagesWaiting(commandQueue),
+                NOTIFICATION_COMMAND_QUEUE_LEN,
+                (unsigned long)droppedCommands.exchange(0, std::memory_order_relaxed));
+  addPool.logStats("notify-add");
+  quickPool.logStats("notify-quick");
+  callPool.logStats("notify-call");
+}
+
 void NotificationStore::sanitizeString(char* dest, const char* src, size_t maxLen) {
   // CRITICAL: Check for NULL and poison values
   if (!src || !dest || maxLen == 0 || 
@@ -10,10 +10,18 @@
 #include "freertos/queue.h"
 #include "freertos/semphr.h"  // CRITICAL FIX: Added for mutex support
 #include "lvgl.h"
+#include "object_pool.h"
 
 #define MAX_NOTIFICATIONS 50
 #define QUICK_NOTIFICATION_DURATION_MS 7000  // 7 seconds
 
+// Command bus sizing.  Payload pools bound how many adds/quick notifications/
+// calls can be in flight; the command queue holds one entry per command.
+#define NOTIFICATION_COMMAND_QUEUE_LEN 32
+#define NOTIFICATION_ADD_POOL_SIZE     15
+#define NOTIFICATION_QUICK_POOL_SIZE   10
+#define NOTIFICATION_CALL_POOL_SIZE    5
+
 // Command types for thread-safe operations
 enum class NotificationCommand : uint8_t {
   REMOVE,
@@ -32,6 +40,7 @@ enum class NotificationCommand : uint8_t {
 struct NotificationCommandData {
   NotificationCommand cmd;
   uint32_t uid;  // Used for REMOVE command
+  void* payload; // Pooled data for ADD_NOTIFICATION, SHOW_QUICK_NOTIFICATION, PUSH_CALL_SCREEN
 };
 
 struct StoredNotification {
@@ -156,7 +165,11 @@ public:
 
   void dismissQuickNotification();
 
+  void logStats();
+
 private:
+  bool postCommand(NotificationCommand cmd, uint32_t uid, void* payload = nullptr);
+
   void removeNotification(uint32_t uid);
   void setIconFromAppId(const char* appId, uint8_t categoryId, char* iconId, size_t maxLen);
   void sanitizeString(char* dest, const char* src, size_t maxLen);
@@ -180,31 +193,17 @@ private:
   // CRITICAL FIX: Mutex for protecting notifications array access across cores
   SemaphoreHandle_t notificationsMutex = nullptr;
 
-  // Command queue for thread-safe operations
+  // Command bus: the single queue for thread-safe operations.  Commands that
+  // carry data point into a payload pool; the UI task returns the slot once
+  // the command is handled.
   QueueHandle_t commandQueue = nullptr;
-  
-  // Quick notification queue (separate to hold larger data)
-  QueueHandle_t quickNotificationQueue = nullptr;
-  
-  // Add notification queue (for thread-safe adds from BLE)
-  QueueHandle_t addNotificationQueue = nullptr;
-  
-  // Incoming call queue (for thread-safe call screen push from BLE)
-  QueueHandle_t incomingCallQueue = nullptr;
-  
-  // --- PSRAM Optimization: Static Queue Buffers ---
   uint8_t* q_command_storage = nullptr;
   StaticQueue_t* q_command_struct = nullptr;
 
-  uint8_t* q_quick_storage = nullptr;
-  StaticQueue_t* q_quick_struct = nullptr;
-
-  uint8_t* q_add_storage = nullptr;
-  StaticQueue_t* q_add_struct = nullptr;
-
-  uint8_t* q_call_storage = nullptr;
-  StaticQueue_t* q_call_struct = nullptr;
-  // ------------------------------------------------
+  ObjectPool<AddNotificationData, NOTIFICATION_ADD_POOL_SIZE> addPool;
+  ObjectPool<QuickNotificationData, NOTIFICATION_QUICK_POOL_SIZE> quickPool;
+  ObjectPool<IncomingCallData, NOTIFICATION_CALL_POOL_SIZE> callPool;
+  std::atomic<uint32_t> droppedCommands{0};   // postCommand() runs on either core
 
   // Quick notification timer tracking
   unsigned long quickNotificationShowTime = 0;
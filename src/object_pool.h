@@ -0,0 +1,81 @@
+#pragma once
+
+#ifndef OBJECT_POOL_H
+#define OBJECT_POOL_H
+
+#include <Arduino.h>
+#include <atomic>
+#include "esp_heap_caps.h"
+
+// Fixed-size pool of N objects of type T with a lock-free free-slot bitmap,
+// so producers on either core can take and return slots without a mutex and
+// without touching the LVGL or system heaps after begin().
+//
+// The slots may live in PSRAM (begin(caps)), but the pool object itself must
+// not: the bitmap relies on 32-bit compare-and-swap, which the ESP32-S3 only
+// supports in internal RAM.  Globals and members of globals are fine.
+template <typename T, size_t N>
+class ObjectPool {
+    static_assert(N > 0 && N <= 32, "ObjectPool tracks slots in one 32-bit word");
+
+  public:
+    bool begin(uint32_t caps = MALLOC_CAP_SPIRAM) {
+      if (!slots) slots = (T *)heap_caps_calloc(N, sizeof(T), caps);
+      return slots != nullptr;
+    }
+
+    // NULL when every slot is taken; counted as an exhaustion.
+    T *acquire() {
+      if (!slots) return nullptr;
+      uint32_t used = inUse.load(std::memory_order_relaxed);
+      for (;;) {
+        uint32_t free = ~used & FULL;
+        if (!free) {
+          exhausted.fetch_add(1, std::memory_order_relaxed);
+          return nullptr;
+        }
+        uint32_t bit = free & (0u - free);   // lowest free slot
+        if (inUse.compare_exchange_weak(used, used | bit, std::memory_order_acquire, std::memory_order_relaxed)) {
+          acquired.fetch_add(1, std::memory_order_relaxed);
+          uint8_t count = __builtin_popcount(used | bit);
+          uint8_t high = peak.load(std::memory_order_relaxed);
+          while (count > high && !peak.compare_exchange_weak(high, count, std::memory_order_relaxed)) {}
+          return &slots[__builtin_ctz(bit)];
+        }
+      }
+    }
+
+    void release(T *object) {
+      if (!object || object < slots || object >= slots + N) return;
+      inUse.fetch_and(~(1u << (object - slots)), std::memory_order_release);
+    }
+
+    bool owns(const T *object) const { return slots && object >= slots && object < slots + N; }
+    uint8_t used() const { return __builtin_popcount(inUse.load(std::memory_order_relaxed)); }
+    uint8_t available() const { return N - used(); }
+
+    // Since begin() or the last logStats().
+    uint8_t peakUsed() const { return peak.load(std::memory_order_relaxed); }
+    uint32_t acquisitions() const { return acquired.load(std::memory_order_relaxed); }
+    uint32_t exhaustions() const { return exhausted.load(std::memory_order_relaxed); }
+
+    // "[Pool] name used=../N peak=.. acquired=.. exhausted=.." and resets the window.
+    void logStats(const char *name) {
+      uint8_t high = peak.exchange(used(), std::memory_order_relaxed);
+      uint32_t taken = acquired.exchange(0, std::memory_order_relaxed);
+      uint32_t empty = exhausted.exchange(0, std::memory_order_relaxed);
+      Serial.printf("[Pool] %s used=%u/%u peak=%u acquired=%lu exhausted=%lu\n", name, used(), (unsigned)N,
+                    high, (unsigned long)taken, (unsigned long)empty);
+    }
+
+  private:
+    static constexpr uint32_t FULL = (uint32_t)((1ull << N) - 1);
+
+    T *slots = nullptr;
+    std::atomic<uint32_t> inUse{0};
+    std::atomic<uint32_t> acquired{0};
+    std::atomic<uint32_t> exhausted{0};
+    std::atomic<uint8_t> peak{0};
+};
+
+#endif /* object_pool.h */
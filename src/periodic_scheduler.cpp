@@ -0,0 +1,94 @@
+#include "periodic_scheduler.h"
+
+int PeriodicScheduler::addJob(const char *name, ScheduledJobFn fn,
+                              ScheduledJobProfile awakeProfile, ScheduledJobProfile asleepProfile) {
+  if (jobCount >= SCHEDULER_MAX_JOBS || !fn) {
+    return -1;
+  }
+
+  Job &job = jobs[jobCount];
+  job.name = name;
+  job.fn = fn;
+  job.profiles[0] = asleepProfile;
+  job.profiles[1] = awakeProfile;
+  job.deadline = millis();  // run once on the first pass
+  job.runs = 0;
+  job.coalesced = 0;
+  return jobCount++;
+}
+
+void PeriodicScheduler::setAwake(bool awake, unsigned long now) {
+  if (this->awake == awake) return;
+  this->awake = awake;
+
+  // Pull deadlines in when the new profile is faster (e.g. display wake);
+  // leave them alone when it is slower so work already due is not deferred.
+  for (int i = 0; i < jobCount; i++) {
+    unsigned long latest = now + profileFor(jobs[i]).periodMs;
+    if ((long)(jobs[i].deadline - latest) > 0) {
+      jobs[i].deadline = latest;
+    }
+  }
+}
+
+uint32_t PeriodicScheduler::runDue(unsigned long now) {
+  if (statsStart == 0) statsStart = now;
+  bool ran[SCHEDULER_MAX_JOBS] = {};
+
+  for (int i = 0; i < jobCount; i++) {
+    Job &job = jobs[i];
+    const ScheduledJobProfile &profile = profileFor(job);
+    long untilDeadline = (long)(job.deadline - now);
+
+    // Due now, or close enough that running it in this wakeup is cheaper
+    // than waking again a few ms later.
+    if (untilDeadline > (long)profile.slackMs) continue;
+
+    if (untilDeadline > 0) job.coalesced++;
+    job.runs++;
+    job.fn();
+    ran[i] = true;
+  }
+
+  // Re-arm from the end of the pass rather than the old deadlines: a job that
+  // was coalesced early or ran late should not burst to catch up, and jobs
+  // that ran together stay in phase, so the next pass wakes for all of them.
+  now = millis();
+  for (int i = 0; i < jobCount; i++) {
+    if (ran[i]) jobs[i].deadline = now + profileFor(jobs[i]).periodMs;
+  }
+
+  // Sleep until the first job can wait no longer; one with slack that comes
+  // due first rides along with the next job that wakes within it.
+  long nextWait = LONG_MAX;
+  for (int i = 0; i < jobCount; i++) {
+    long latest = (long)(jobs[i].deadline - now) + (long)profileFor(jobs[i]).slackMs;
+    if (latest < nextWait) nextWait = latest;
+  }
+  if (nextWait == LONG_MAX) return 1000;
+  return nextWait > 0 ? (uint32_t)nextWait : 0;
+}
+
+void PeriodicScheduler::logStats(unsigned long now) {
+  unsigned long elapsed = now - statsStart;
+  if (statsStart == 0 || elapsed < 1000) return;
+
+  uint32_t wakeupsPerHour = (uint32_t)(((uint64_t)wakeups * 3600000ULL) / elapsed);
+  uint32_t sleepPct = (uint32_t)((sleepMs * 100ULL) / elapsed);
+  Serial.printf("[Sched] profile=%s wakeups/h=%lu sleep_residency=%lu%%\n",
+                awake ? "awake" : "asleep",
+                (unsigned long)wakeupsPerHour,
+                (unsigned long)sleepPct);
+  for (int i = 0; i < jobCount; i++) {
+    Serial.printf("[Sched]   %-8s runs=%lu coalesced=%lu\n",
+                  jobs[i].name,
+                  (unsigned long)jobs[i].runs,
+                  (unsigned long)jobs[i].coalesced);
+    jobs[i].runs = 0;
+    jobs[i].coalesced = 0;
+  }
+
+  statsStart = now;
+  wakeups = 0;
+  sleepMs = 0;
+}
@@ -0,0 +1,71 @@
+#pragma once
+
+#ifndef PERIODIC_SCHEDULER_H
+#define PERIODIC_SCHEDULER_H
+
+#include <Arduino.h>
+
+// Deadline-based cooperative scheduler for periodic driver work.
+//
+// Every job has a period and a slack (jitter tolerance) for each display
+// state.  The owning task sleeps until the first deadline that can slip no
+// further; when it wakes, every other job whose deadline falls within its own
+// slack window, before or after, is run in the same wakeup.  Jobs that ran
+// together are re-armed together, so they stay in phase.  Coalescing
+// expirations this way keeps the light-sleep windows between wakeups as long
+// as possible.
+#define SCHEDULER_MAX_JOBS 8
+
+typedef void (*ScheduledJobFn)(void);
+
+struct ScheduledJobProfile {
+  uint32_t periodMs;
+  uint32_t slackMs;  // how far either side of its deadline a job may be coalesced
+};
+
+class PeriodicScheduler {
+  public:
+    // Returns the job index, or -1 when the job table is full.
+    int addJob(const char *name, ScheduledJobFn fn,
+               ScheduledJobProfile awakeProfile, ScheduledJobProfile asleepProfile);
+
+    // Switch every job to its awake/asleep profile.  Deadlines only move
+    // earlier, so a pending job never waits longer than its new period.
+    void setAwake(bool awake, unsigned long now);
+    bool isAwake() { return awake; }
+
+    // Run every due (or coalescable) job and return the number of ms until
+    // the earliest remaining deadline.
+    uint32_t runDue(unsigned long now);
+
+    // Accounting for the caller's sleep between runDue() calls.  Only a pass
+    // after a sleep is a wakeup; one re-run for a profile change is not.
+    void recordSleep(uint32_t sleptMs) {
+      sleepMs += sleptMs;
+      wakeups++;
+    }
+    uint32_t wakeupCount() { return wakeups; }   // since the last logStats()
+    void logStats(unsigned long now);
+
+  private:
+    struct Job {
+      const char *name;
+      ScheduledJobFn fn;
+      ScheduledJobProfile profiles[2];  // [0] asleep, [1] awake
+      unsigned long deadline;
+      uint32_t runs;
+      uint32_t coalesced;
+    };
+
+    const ScheduledJobProfile &profileFor(const Job &job) { return job.profiles[awake ? 1 : 0]; }
+
+    Job jobs[SCHEDULER_MAX_JOBS];
+    int jobCount = 0;
+    bool awake = true;
+
+    unsigned long statsStart = 0;
+    uint32_t wakeups = 0;
+    uint64_t sleepMs = 0;
+};
+
+#endif /* periodic_scheduler.h */
@@ -3,8 +3,14 @@
 #include <Arduino.h>
 #include <notifications.h>
 #include "BAT_Driver.h"
+#include "screen_manager.h"
+#include "heap_tracker.h"
 
 extern NotificationStore notificationStore;
+extern ScreenManager screenManager;
+#ifdef HEAP_TRACKER
+extern HeapTracker heapTracker;
+#endif
 
 
 void *psram_calloc(size_t n, size_t size) {
@@ -20,6 +26,16 @@ void psram_free(void *ptr) {
   heap_caps_free(ptr);  // works for both PSRAM and internal pointers
 }
 
+#ifdef HEAP_TRACKER
+// Charge C++ allocations to the code doing the new, not to operator new.
+void* operator new(size_t size) {
+    return heap_tracker_caps_malloc(size, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT, __builtin_return_address(0));
+}
+
+void* operator new[](size_t size) {
+    return heap_tracker_caps_malloc(size, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT, __builtin_return_address(0));
+}
+#else
 void* operator new(size_t size) {
     return heap_caps_malloc(size, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
 }
@@ -27,6 +43,7 @@ void* operator new(size_t size) {
 void* operator new[](size_t size) {
     return heap_caps_malloc(size, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
 }
+#endif
 
 void operator delete(void* ptr) noexcept {
     heap_caps_free(ptr);
@@ -89,6 +106,12 @@ void monitor_heap() {
       Serial.println(">> Memory pressure relieved - Resuming normal operations");
     }
     Serial.println(F("========================================"));
+
+    // monitor_heap() runs on the UI task, so LVGL objects can be freed here.
+    screenManager.onMemoryPressure((int)currentMemoryPressure);
+#ifdef HEAP_TRACKER
+    heapTracker.onMemoryPressure((int)currentMemoryPressure);
+#endif
   }
 
   // Emergency measures when critically low
@@ -0,0 +1,460 @@
+#include "recurrence.h"
+#include <algorithm>
+#include <stdlib.h>
+#include <string.h>
+
+extern TimeZone timeZone;
+
+static const char *weekdayCodes[7] = { "SU", "MO", "TU", "WE", "TH", "FR", "SA" };
+
+static int digits(const char *text, int count) {
+  int value = 0;
+  for (int i = 0; i < count; i++) {
+    if (text[i] < '0' || text[i] > '9') return -1;
+    value = value * 10 + (text[i] - '0');
+  }
+  return value;
+}
+
+bool parseICalCivil(const char *text, CivilTime &out, bool *utc, bool *dateOnly) {
+  while (*text == ' ') text++;
+  int year = digits(text, 4), month = digits(text + 4, 2), day = digits(text + 6, 2);
+  if (year < 0 || month < 1 || month > 12 || day < 1 || day > civilDaysInMonth(year, month)) return false;
+
+  out = {};
+  out.year = year;
+  out.month = month;
+  out.day = day;
+  bool hasTime = text[8] == 'T';
+  if (hasTime) {
+    int hour = digits(text + 9, 2), minute = digits(text + 11, 2), second = digits(text + 13, 2);
+    if (hour < 0 || minute < 0 || second < 0) return false;
+    out.hour = hour;
+    out.minute = minute;
+    out.second = second;
+  }
+  if (utc) *utc = hasTime && (text[15] == 'Z' || text[15] == 'z');
+  if (dateOnly) *dateOnly = !hasTime;
+  return true;
+}
+
+time_t parseICalTime(const char *text) {
+  CivilTime civil;
+  bool utc = false;
+  if (!parseICalCivil(text, civil, &utc, nullptr)) return 0;
+  return utc ? civilToUtc(civil) : timeZone.fromLocal(civil);
+}
+
+uint32_t hashICalUid(const char *value) {
+  uint32_t hash = 2166136261u;
+  for (const char *c = value; *c; c++) {
+    if (*c == '\r') continue;
+    if (*c == '\n') {
+      if (c[1] == ' ' || c[1] == '\t') {
+        c++;
+        continue;
+      }
+      break;
+    }
+    hash = (hash ^ (uint8_t)*c) * 16777619u;
+  }
+  return hash;
+}
+
+static int weekdayFromCode(const char *code) {
+  for (int i = 0; i < 7; i++) {
+    if (code[0] == weekdayCodes[i][0] && code[1] == weekdayCodes[i][1]) return i;
+  }
+  return -1;
+}
+
+bool RecurrenceRule::parse(const char *text) {
+  *this = RecurrenceRule();
+
+  char buffer[256];
+  strncpy(buffer, text, sizeof(buffer) - 1);
+  buffer[sizeof(buffer) - 1] = '\0';
+
+  char *partSave = nullptr;
+  for (char *part = strtok_r(buffer, ";", &partSave); part; part = strtok_r(nullptr, ";", &partSave)) {
+    char *value = strchr(part, '=');
+    if (!value) return false;
+    *value++ = '\0';
+
+    if (strcmp(part, "FREQ") == 0) {
+      if (strcmp(value, "DAILY") == 0) frequency = DAILY;
+      else if (strcmp(value, "WEEKLY") == 0) frequency = WEEKLY;
+      else if (strcmp(value, "MONTHLY") == 0) frequency = MONTHLY;
+      else if (strcmp(value, "YEARLY") == 0) frequency = YEARLY;
+      else return false;                              // SECONDLY/MINUTELY/HOURLY
+    } else if (strcmp(part, "INTERVAL") == 0) {
+      int n = atoi(value);
+      if (n < 1) return false;
+      interval = n;
+    } else if (strcmp(part, "COUNT") == 0) {
+      int n = atoi(value);
+      if (n < 1) return false;
+      count = n;
+    } else if (strcmp(part, "UNTIL") == 0) {
+      strncpy(until, value, sizeof(until) - 1);
+    } else if (strcmp(part, "WKST") == 0) {
+      int weekday = weekdayFromCode(value);
+      if (weekday < 0) return false;
+      weekStart = weekday;
+    } else if (strcmp(part, "BYWEEKNO") == 0 || strcmp(part, "BYHOUR") == 0 ||
+               strcmp(part, "BYMINUTE") == 0 || strcmp(part, "BYSECOND") == 0) {
+      return false;
+    } else {
+      // Comma-separated lists.
+      char *itemSave = nullptr;
+      for (char *item = strtok_r(value, ",", &itemSave); item; item = strtok_r(nullptr, ",", &itemSave)) {
+        if (strcmp(part, "BYDAY") == 0) {
+          size_t length = strlen(item);
+          if (length < 2 || byDayCount >= RECURRENCE_MAX_BYDAY) return false;
+          int weekday = weekdayFromCode(item + length - 2);
+          if (weekday < 0) return false;
+          item[length - 2] = '\0';
+          int ordinal = item[0] ? atoi(item) : 0;
+          if (ordinal < -53 || ordinal > 53) return false;
+          byDay[byDayCount++] = { (int8_t)ordinal, (uint8_t)weekday };
+        } else if (strcmp(part, "BYMONTHDAY") == 0) {
+          int n = atoi(item);
+          if (n == 0 || n < -31 || n > 31 || byMonthDayCount >= RECURRENCE_MAX_BYMONTHDAY) return false;
+          byMonthDay[byMonthDayCount++] = n;
+        } else if (strcmp(part, "BYMONTH") == 0) {
+          int n = atoi(item);
+          if (n < 1 || n > 12) return false;
+          byMonthMask |= 1 << n;
+        } else if (strcmp(part, "BYYEARDAY") == 0) {
+          int n = atoi(item);
+          if (n == 0 || n < -366 || n > 366 || byYearDayCount >= RECURRENCE_MAX_BYYEARDAY) return false;
+          byYearDay[byYearDayCount++] = n;
+        } else if (strcmp(part, "BYSETPOS") == 0) {
+          int n = atoi(item);
+          if (n == 0 || n < -366 || n > 366 || bySetPosCount >= RECURRENCE_MAX_BYSETPOS) return false;
+          bySetPos[bySetPosCount++] = n;
+        }
+        // Unknown (X-) parts are ignored.
+      }
+    }
+  }
+  return frequency != NONE;
+}
+
+void RecurrenceIterator::begin(const RecurrenceRule &recurrenceRule, const CivilTime &dtstart, const CivilTime *from) {
+  *this = RecurrenceIterator();
+  rule = &recurrenceRule;
+  start = dtstart;
+  startDays = civilToDays(start.year, start.month, start.day);
+  if (!from || rule->count) return;
+
+  // Jump to the period holding `from`; everything before it is history.
+  int32_t steps = 0;
+  int32_t fromDays = civilToDays(from->year, from->month, from->day);
+  switch (rule->frequency) {
+    case RecurrenceRule::DAILY:
+      steps = (fromDays - startDays) / rule->interval;
+      break;
+    case RecurrenceRule::WEEKLY: {
+      int32_t firstWeek = startDays - (civilWeekday(startDays) - rule->weekStart + 7) % 7;
+      steps = (fromDays - firstWeek) / (7 * rule->interval);
+      break;
+    }
+    case RecurrenceRule::MONTHLY:
+      steps = ((from->year - start.year) * 12 + from->month - start.month) / rule->interval;
+      break;
+    case RecurrenceRule::YEARLY:
+      steps = (from->year - start.year) / rule->interval;
+      break;
+    default:
+      break;
+  }
+  if (steps > 0) {
+    period = steps;
+    startEmitted = true;   // DTSTART lies in an earlier period, so before `from`
+  }
+}
+
+static bool monthDayMatches(const RecurrenceRule &rule, int day, int daysInMonth) {
+  for (uint8_t i = 0; i < rule.byMonthDayCount; i++) {
+    int n = rule.byMonthDay[i];
+    if (n > 0 ? n == day : daysInMonth + n + 1 == day) return true;
+  }
+  return false;
+}
+
+static bool yearDayMatches(const RecurrenceRule &rule, int yearDay, int daysInYear) {
+  for (uint8_t i = 0; i < rule.byYearDayCount; i++) {
+    int n = rule.byYearDay[i];
+    if (n > 0 ? n == yearDay : daysInYear + n + 1 == yearDay) return true;
+  }
+  return false;
+}
+
+// `index` is the 1-based position of the day in the scope (month or year)
+// that ordinals such as 2MO or -1FR count within.
+static bool byDayMatches(const RecurrenceRule &rule, uint8_t weekday, int index, int scopeLength, bool useOrdinals) {
+  for (uint8_t i = 0; i < rule.byDayCount; i++) {
+    const RecurrenceRule::ByDay &entry = rule.byDay[i];
+    if (entry.weekday != weekday) continue;
+    if (!useOrdinals || entry.ordinal == 0) return true;
+    if (entry.ordinal > 0 && (index - 1) / 7 + 1 == entry.ordinal) return true;
+    if (entry.ordinal < 0 && (scopeLength - index) / 7 + 1 == -entry.ordinal) return true;
+  }
+  return false;
+}
+
+bool RecurrenceIterator::dayMatches(int32_t days, const CivilTime &date) {
+  const RecurrenceRule &r = *rule;
+  if (r.byMonthMask && !(r.byMonthMask & (1 << date.month))) return false;
+
+  const uint8_t weekday = civilWeekday(days);
+  const int daysInMonth = civilDaysInMonth(date.year, date.month);
+
+  switch (r.frequency) {
+    case RecurrenceRule::DAILY:
+      if (r.byMonthDayCount && !monthDayMatches(r, date.day, daysInMonth)) return false;
+      if (r.byYearDayCount) {
+        int yearDay = days - civilToDays(date.year, 1, 1) + 1;
+        if (!yearDayMatches(r, yearDay, civilDaysInYear(date.year))) return false;
+      }
+      return !r.byDayCount || byDayMatches(r, weekday, 0, 0, false);
+
+    case RecurrenceRule::WEEKLY:
+      return r.byDayCount ? byDayMatches(r, weekday, 0, 0, false) : weekday == civilWeekday(startDays);
+
+    case RecurrenceRule::MONTHLY:
+      if (!r.byMonthDayCount && !r.byDayCount) return date.day == start.day;
+      if (r.byMonthDayCount && !monthDayMatches(r, date.day, daysInMonth)) return false;
+      return !r.byDayCount || byDayMatches(r, weekday, date.day, daysInMonth, true);
+
+    case RecurrenceRule::YEARLY: {
+      if (!r.byYearDayCount && !r.byMonthDayCount && !r.byDayCount) {
+        return date.day == start.day && (r.byMonthMask || date.month == start.month);
+      }
+      const int yearDay = days - civilToDays(date.year, 1, 1) + 1;
+      const int daysInYear = civilDaysInYear(date.year);
+      if (r.byYearDayCount && !yearDayMatches(r, yearDay, daysInYear)) return false;
+      if (r.byMonthDayCount && !monthDayMatches(r, date.day, daysInMonth)) return false;
+      if (!r.byDayCount) return true;
+      // With BYMONTH, 2MO means the second Monday of the month; without it,
+      // of the year.
+      return r.byMonthMask ? byDayMatches(r, weekday, date.day, daysInMonth, true)
+                           : byDayMatches(r, weekday, yearDay, daysInYear, true);
+    }
+
+    default:
+      return false;
+  }
+}
+
+void RecurrenceIterator::applySetPos() {
+  uint16_t positions[366];
+  uint16_t total = 0;
+  for (uint16_t i = 0; i < periodLength; i++) {
+    if (candidates[i / 32] & (1u << (i % 32))) positions[total++] = i;
+  }
+  memset(candidates, 0, sizeof(candidates));
+  for (uint8_t i = 0; i < rule->bySetPosCount; i++) {
+    int n = rule->bySetPos[i];
+    int index = n > 0 ? n - 1 : total + n;
+    if (index >= 0 && index < total) candidates[positions[index] / 32] |= 1u << (positions[index] % 32);
+  }
+}
+
+bool RecurrenceIterator::fillPeriod() {
+  const RecurrenceRule &r = *rule;
+  int16_t firstYear = 0;
+  for (uint32_t empty = 0;; empty++, period++) {
+    switch (r.frequency) {
+      case RecurrenceRule::DAILY:
+        periodStart = startDays + period * r.interval;
+        periodLength = 1;
+        break;
+      case RecurrenceRule::WEEKLY:
+        periodStart = startDays - (civilWeekday(startDays) - r.weekStart + 7) % 7 + period * 7 * r.interval;
+        periodLength = 7;
+        break;
+      case RecurrenceRule::MONTHLY: {
+        int32_t monthIndex = start.year * 12 + (start.month - 1) + period * r.interval;
+        periodYear = monthIndex / 12;
+        periodMonth = monthIndex % 12 + 1;
+        periodStart = civilToDays(periodYear, periodMonth, 1);
+        periodLength = civilDaysInMonth(periodYear, periodMonth);
+        break;
+      }
+      case RecurrenceRule::YEARLY:
+        periodYear = start.year + period * r.interval;
+        periodStart = civilToDays(periodYear, 1, 1);
+        periodLength = civilDaysInYear(periodYear);
+        break;
+      default:
+        done = true;
+        return false;
+    }
+    periods++;
+
+    CivilTime date;
+    civilFromDays(periodStart, date);
+    if (date.year > 9999) break;
+    if (empty == 0) {
+      firstYear = date.year;
+    } else if (date.year - firstYear > RECURRENCE_MAX_EMPTY_YEARS * r.interval) {
+      break;
+    }
+
+    memset(candidates, 0, sizeof(candidates));
+    bool any = false;
+    for (uint16_t i = 0; i < periodLength; i++) {
+      int32_t days = periodStart + i;
+      if (i > 0) civilFromDays(days, date);
+      if (dayMatches(days, date)) {
+        candidates[i / 32] |= 1u << (i % 32);
+        any = true;
+      }
+    }
+    if (!any) continue;
+    if (r.bySetPosCount) applySetPos();
+
+    // DTSTART itself was already returned; nothing before it counts.
+    for (uint16_t i = 0; i < periodLength && periodStart + i <= startDays; i++) {
+      candidates[i / 32] &= ~(1u << (i % 32));
+    }
+    for (uint8_t w = 0; w < 12; w++) {
+      if (candidates[w]) {
+        cursor = 0;
+        havePeriod = true;
+        return true;
+      }
+    }
+  }
+  done = true;
+  return false;
+}
+
+bool RecurrenceIterator::next(CivilTime &out) {
+  if (done || !rule) return false;
+  if (rule->count && emitted >= rule->count) {
+    done = true;
+    return false;
+  }
+  if (!startEmitted) {
+    startEmitted = true;
+    emitted++;
+    out = start;
+    return true;
+  }
+
+  while (true) {
+    if (!havePeriod && !fillPeriod()) return false;
+    for (; cursor < periodLength; cursor++) {
+      if (!(candidates[cursor / 32] & (1u << (cursor % 32)))) continue;
+      civilFromDays(periodStart + cursor, out);
+      out.hour = start.hour;
+      out.minute = start.minute;
+      out.second = start.second;
+      cursor++;
+      emitted++;
+      return true;
+    }
+    havePeriod = false;
+    period++;
+  }
+}
+
+void RecurrenceOverrides::collect(const char *payload) {
+  ids.clear();
+  const char *searchPos = payload;
+  while (const char *eventStart = strstr(searchPos, "BEGIN:VEVENT")) {
+    const char *eventEnd = strstr(eventStart, "END:VEVENT");
+    if (!eventEnd) break;
+    searchPos = eventEnd + 10;
+
+    const char *recurrenceId = strstr(eventStart, "\nRECURRENCE-ID");
+    const char *uid = strstr(eventStart, "\nUID:");
+    if (!recurrenceId || recurrenceId > eventEnd || !uid || uid > eventEnd) continue;
+
+    const char *value = strchr(recurrenceId, ':');
+    if (!value || value > eventEnd) continue;
+    add(hashICalUid(uid + 5), parseICalTime(value + 1));
+  }
+}
+
+bool RecurrenceOverrides::contains(uint32_t uidHash, time_t instance) const {
+  for (const Override &o : ids) {
+    if (o.uidHash == uidHash && o.recurrenceId == instance) return true;
+  }
+  return false;
+}
+
+bool RecurrenceExpansion::begin(const RecurrenceRule &rule, const char *dtstart, time_t duration, uint32_t uidHash) {
+  this->rule = rule;
+  this->duration = duration;
+  this->uidHash = uidHash;
+  exdates.clear();
+  return parseICalCivil(dtstart, start, &utc, nullptr);
+}
+
+void RecurrenceExpansion::exclude(const char *list) {
+  for (const char *item = list; *item; item++) {
+    time_t t = parseICalTime(item);
+    if (t) exdates.push_back(t);
+    item = strchr(item, ',');
+    if (!item) break;
+  }
+}
+
+void RecurrenceExpansion::civilAt(time_t t, CivilTime &out) const {
+  if (utc) {
+    civilFromUtc(t, out);
+  } else {
+    timeZone.toLocal(t, out);
+  }
+}
+
+void RecurrenceExpansion::expand(time_t windowStart, time_t windowEnd, const RecurrenceOverrides *overrides,
+                                 std::vector<time_t> &starts) const {
+  // Walk the rule in DTSTART's own civil time and compare against civil
+  // bounds, so only instances near the window are converted to time_t.
+  CivilTime fromCivil, endCivil;
+  civilAt(windowStart - duration - 86400, fromCivil);
+  civilAt(windowEnd, endCivil);
+  const time_t fromKey = civilToUtc(fromCivil);
+  const time_t endKey = civilToUtc(endCivil) + 86400;
+
+  // UNTIL is inclusive; a date covers its whole day, and a date-time in the
+  // other frame from DTSTART is converted into DTSTART's.
+  time_t untilKey = 0;
+  if (rule.until[0]) {
+    CivilTime untilCivil;
+    bool untilUtc = false, untilDateOnly = false;
+    if (parseICalCivil(rule.until, untilCivil, &untilUtc, &untilDateOnly)) {
+      if (untilDateOnly) {
+        untilKey = civilToUtc(untilCivil) + 86399;
+      } else if (untilUtc == utc) {
+        untilKey = civilToUtc(untilCivil);
+      } else {
+        civilAt(parseICalTime(rule.until), untilCivil);
+        untilKey = civilToUtc(untilCivil);
+      }
+    }
+  }
+
+  RecurrenceIterator it;
+  it.begin(rule, start, &fromCivil);
+  CivilTime occurrence;
+  while (it.next(occurrence)) {
+    time_t key = civilToUtc(occurrence);
+    if (untilKey && key > untilKey) break;
+    if (key > endKey) break;
+    if (key < fromKey) continue;
+
+    // Counts if it overlaps the window (multi-day events show on every day
+    // they cover).
+    time_t instance = utc ? key : timeZone.fromLocal(occurrence);
+    if (instance >= windowEnd || (instance < windowStart && instance + duration <= windowStart)) continue;
+    if (std::find(exdates.begin(), exdates.end(), instance) != exdates.end()) continue;
+    if (overrides && overrides->contains(uidHash, instance)) continue;
+    starts.push_back(instance);
+  }
+}
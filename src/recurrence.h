@@ -0,0 +1,157 @@
+#pragma once
+
+#ifndef RECURRENCE_H
+#define RECURRENCE_H
+
+#include <stdint.h>
+#include <time.h>
+#include <vector>
+#include "civil_time.h"
+
+// RFC 5545 RRULE expansion for calendar events.
+//
+// Occurrences are generated in the civil (wall-clock) time of DTSTART, one
+// FREQ period at a time, so nothing here depends on the system time zone;
+// the caller converts each occurrence to a time_t in the event's own frame.
+// Without COUNT the iterator jumps straight to the period holding a window
+// start, so expanding a query window costs O(occurrences in the window)
+// rather than O(history).  With COUNT every instance from DTSTART has to be
+// counted, but COUNT also bounds the walk.
+//
+// Supported: FREQ=DAILY/WEEKLY/MONTHLY/YEARLY, INTERVAL, COUNT, UNTIL
+// (passed through for the caller), BYDAY with ordinals, BYMONTHDAY,
+// BYMONTH, BYYEARDAY, BYSETPOS and WKST.  Sub-daily frequencies, BYWEEKNO
+// and BYHOUR/BYMINUTE/BYSECOND make parse() fail, and the caller treats the
+// event as a single instance.
+//
+// RecurrenceExpansion puts a VEVENT's rule to a query window: UNTIL, EXDATE
+// and the instances a RECURRENCE-ID VEVENT moved or cancelled
+// (RecurrenceOverrides, collected from the whole feed) are taken out.
+// Floating and TZID times are read in the watch's zone (timeZone).
+#define RECURRENCE_MAX_BYDAY        16
+#define RECURRENCE_MAX_BYMONTHDAY   31
+#define RECURRENCE_MAX_BYYEARDAY    16
+#define RECURRENCE_MAX_BYSETPOS     8
+// A rule gives up after this many INTERVALs' worth of years without an
+// instance.  Feb 29 can be 8 years away (2096 -> 2104), and a yearly rule
+// with INTERVAL=n only lands on a leap year every 4n years; scaling by
+// INTERVAL caps a hopeless rule at about 3300 DAILY, 470 WEEKLY or 110
+// MONTHLY periods whatever the interval.
+#define RECURRENCE_MAX_EMPTY_YEARS  8
+
+// YYYYMMDD or YYYYMMDDTHHMMSS[Z] as written in DTSTART/EXDATE/UNTIL.
+bool parseICalCivil(const char *text, CivilTime &out, bool *utc, bool *dateOnly);
+// The same as a time_t: UTC as written, anything else in timeZone.  0 when
+// the text does not parse.
+time_t parseICalTime(const char *text);
+// FNV-1a over a UID value up to the end of its line, skipping folded line
+// breaks, so raw feed text and unfolded events hash alike.
+uint32_t hashICalUid(const char *value);
+
+class RecurrenceRule {
+  public:
+    enum Frequency : uint8_t { NONE = 0, DAILY, WEEKLY, MONTHLY, YEARLY };
+
+    // The part after "RRULE:".  False for malformed or unsupported rules.
+    bool parse(const char *text);
+
+    Frequency frequency = NONE;
+    uint16_t interval = 1;
+    uint32_t count = 0;                  // 0: unbounded
+    char until[20] = "";                 // raw UNTIL value, "" when absent
+    uint8_t weekStart = 1;               // WKST, 0 = Sunday; RFC default MO
+
+    struct ByDay {
+      int8_t ordinal;                    // 0: every such weekday
+      uint8_t weekday;                   // 0 = Sunday
+    };
+    ByDay byDay[RECURRENCE_MAX_BYDAY];
+    uint8_t byDayCount = 0;
+    int8_t byMonthDay[RECURRENCE_MAX_BYMONTHDAY];
+    uint8_t byMonthDayCount = 0;
+    int16_t byYearDay[RECURRENCE_MAX_BYYEARDAY];
+    uint8_t byYearDayCount = 0;
+    int16_t bySetPos[RECURRENCE_MAX_BYSETPOS];
+    uint8_t bySetPosCount = 0;
+    uint16_t byMonthMask = 0;            // bit n set for month n (1-12)
+};
+
+// Ascending occurrences of `rule` starting at `start`.  DTSTART is always
+// the first instance (RFC 5545 3.3.10), whether or not it matches the rule.
+class RecurrenceIterator {
+  public:
+    // `from`, when given and the rule has no COUNT, lets the iterator skip
+    // every period that ends before it.  Instances before `from` may still
+    // be returned from the first period; the caller filters them.
+    void begin(const RecurrenceRule &rule, const CivilTime &start, const CivilTime *from = nullptr);
+
+    // False once the rule is exhausted (COUNT reached or no more instances).
+    bool next(CivilTime &out);
+
+    uint32_t periodsVisited() const { return periods; }
+
+  private:
+    bool fillPeriod();
+    bool dayMatches(int32_t days, const CivilTime &date);
+    void applySetPos();
+
+    const RecurrenceRule *rule = nullptr;
+    CivilTime start = {};
+    int32_t startDays = 0;
+
+    int32_t period = 0;                  // index of the current period, in INTERVAL steps
+    int32_t periodStart = 0;             // days
+    uint16_t periodLength = 0;
+    int16_t periodYear = 0;              // for MONTHLY/YEARLY periods
+    uint8_t periodMonth = 0;
+
+    uint32_t candidates[12] = {};        // bit per day of the period (<= 366 days)
+    uint16_t cursor = 0;
+    bool havePeriod = false;
+    bool startEmitted = false;
+    bool done = false;
+    uint32_t emitted = 0;
+    uint32_t periods = 0;
+};
+
+// Instances of recurring events replaced by their own VEVENT (RECURRENCE-ID).
+class RecurrenceOverrides {
+  public:
+    // Every VEVENT in `payload` carrying both RECURRENCE-ID and UID.
+    void collect(const char *payload);
+    void add(uint32_t uidHash, time_t recurrenceId) { ids.push_back({ uidHash, recurrenceId }); }
+    bool contains(uint32_t uidHash, time_t instance) const;
+    size_t size() const { return ids.size(); }
+
+  private:
+    struct Override {
+      uint32_t uidHash;
+      time_t recurrenceId;
+    };
+    std::vector<Override> ids;
+};
+
+// One recurring VEVENT over a query window.
+class RecurrenceExpansion {
+  public:
+    // DTSTART as written; `duration` in seconds.  False when it does not parse.
+    bool begin(const RecurrenceRule &rule, const char *dtstart, time_t duration, uint32_t uidHash = 0);
+    // One EXDATE value: a comma-separated list.
+    void exclude(const char *list);
+
+    // Starts of the instances overlapping [windowStart, windowEnd), ascending.
+    void expand(time_t windowStart, time_t windowEnd, const RecurrenceOverrides *overrides,
+                std::vector<time_t> &starts) const;
+
+  private:
+    void civilAt(time_t t, CivilTime &out) const;
+
+    RecurrenceRule rule;
+    CivilTime start = {};
+    bool utc = false;
+    time_t duration = 0;
+    uint32_t uidHash = 0;
+    std::vector<time_t> exdates;
+};
+
+#endif /* recurrence.h */
@@ -0,0 +1,141 @@
+#include "screen_manager.h"
+#include "src/eez-flow.h"
+#include "src/screens.h"
+#include "esp_heap_caps.h"
+#include "esp_timer.h"
+#include <lvgl.h>
+
+extern ScreenManager screenManager;
+
+// Screens whose first navigation should not pay for their construction,
+// most urgent first.  They arrive unprompted (alarm, call, notification) or
+// sit one tap away from the watch face.
+static const int16_t prewarmScreens[] = {
+  SCREEN_ID_ALARM_TRIGGERED,
+  SCREEN_ID_INCOMING_CALL,
+  SCREEN_ID_QUICK_NOTIFICATION,
+  SCREEN_ID_APPLICATIONS,
+  SCREEN_ID_NOTIFICATIONS,
+};
+
+// Screens that are cheap to rebuild and keep nothing worth losing in their
+// flow state.  Screens the app writes into through objects.* (settings, wifi
+// list, media, calendar) or that hold running state (timer, stopwatch,
+// alarm, calculator input) are never freed.
+static const int16_t freeableScreens[] = {
+  SCREEN_ID_WIFI_CREDENTIALS,
+  SCREEN_ID_WEATHER_SETTINGS,
+  SCREEN_ID_ALARM_SOUND_PICKER,
+  SCREEN_ID_TIMER_SOUND_PICKER,
+  SCREEN_ID_WEATHER_FORECAST_DAILY,
+  SCREEN_ID_WEATHER_FORECAST_HOURLY,
+};
+
+static void (*originalReplacePageHook)(int16_t pageId, uint32_t animType, uint32_t speed, uint32_t delay) = nullptr;
+
+static void trackingReplacePageHook(int16_t pageId, uint32_t animType, uint32_t speed, uint32_t delay) {
+  screenManager.noteShown(pageId);
+  if (originalReplacePageHook) {
+    originalReplacePageHook(pageId, animType, speed, delay);
+  }
+}
+
+void ScreenManager::begin() {
+  if (!originalReplacePageHook) {
+    originalReplacePageHook = eez::flow::replacePageHook;
+    eez::flow::replacePageHook = trackingReplacePageHook;
+  }
+  noteShown(eez_flow_get_current_screen());
+}
+
+void ScreenManager::noteShown(int16_t screenId) {
+  if (screenId > 0 && screenId <= SCREEN_MANAGER_MAX_SCREENS) {
+    lastShown[screenId] = millis();
+  }
+}
+
+void ScreenManager::tick() {
+  unsigned long now = millis();
+
+  // Running low on PSRAM without the internal heap tripping monitor_heap():
+  // LVGL objects live in PSRAM, so give back what is stale.
+  static unsigned long lastPsramCheck = 0;
+  if (now - lastPsramCheck > 10000) {
+    lastPsramCheck = now;
+    if (heap_caps_get_free_size(MALLOC_CAP_SPIRAM) < SCREEN_MANAGER_MIN_FREE_PSRAM) {
+      freeScreens(SCREEN_MANAGER_STALE_MS);
+    }
+  }
+
+  if (prewarmDone || pressure != 0) return;
+  if (now - lastPrewarm < SCREEN_MANAGER_PREWARM_GAP_MS) return;
+  if (lv_disp_get_inactive_time(NULL) < SCREEN_MANAGER_IDLE_MS) return;
+  if (heap_caps_get_free_size(MALLOC_CAP_SPIRAM) < SCREEN_MANAGER_MIN_FREE_PSRAM) return;
+
+  lastPrewarm = now;
+  prewarmDone = !prewarmNext();
+}
+
+// Creates the first missing pre-warm screen.  False once all exist.
+bool ScreenManager::prewarmNext() {
+  for (size_t i = 0; i < sizeof(prewarmScreens) / sizeof(prewarmScreens[0]); i++) {
+    int16_t screenId = prewarmScreens[i];
+    if (eez_flow_is_screen_created(screenId)) continue;
+
+    int64_t start = esp_timer_get_time();
+    eez_flow_create_screen(screenId);
+    lastPrewarmUs = (uint32_t)(esp_timer_get_time() - start);
+    prewarmed++;
+#ifdef STATS_LOG
+    Serial.printf("[Screens] Pre-warmed screen %d in %lums\n", screenId, (unsigned long)(lastPrewarmUs / 1000));
+#endif
+    return true;
+  }
+  return false;
+}
+
+// Deletes freeable screens not shown for `unusedForMs`.  Returns the count.
+uint8_t ScreenManager::freeScreens(uint32_t unusedForMs) {
+  uint32_t now = millis();
+  int16_t current = eez_flow_get_current_screen();
+  uint8_t count = 0;
+
+  for (size_t i = 0; i < sizeof(freeableScreens) / sizeof(freeableScreens[0]); i++) {
+    int16_t screenId = freeableScreens[i];
+    if (screenId == current || !eez_flow_is_screen_created(screenId)) continue;
+    // Covers the outgoing screen of a load animation still in progress.
+    uint32_t idle = now - lastShown[screenId];
+    if (lastShown[screenId] && (idle < SCREEN_MANAGER_RECENT_MS || idle < unusedForMs)) continue;
+
+    eez_flow_delete_screen(screenId);
+    count++;
+  }
+
+  if (count) {
+    freed += count;
+    Serial.printf("[Screens] Freed %u screens (free PSRAM %u bytes)\n",
+                  count, (unsigned)heap_caps_get_free_size(MALLOC_CAP_SPIRAM));
+  }
+  return count;
+}
+
+void ScreenManager::onMemoryPressure(int level) {
+  pressure = level;
+  if (level == 1) {
+    freeScreens(SCREEN_MANAGER_STALE_MS);
+  } else if (level >= 2) {
+    freeScreens(0);
+  } else {
+    prewarmDone = false;  // pre-warmed screens may have been freed meanwhile
+  }
+}
+
+void ScreenManager::logStats() {
+  uint8_t created = 0;
+  for (int16_t id = 1; id <= SCREEN_MANAGER_MAX_SCREENS; id++) {
+    created += eez_flow_is_screen_created(id);
+  }
+  Serial.printf("[Screens] created=%u/%u prewarmed=%lu freed=%lu last_prewarm=%lums current=%d\n",
+                created, SCREEN_MANAGER_MAX_SCREENS, (unsigned long)prewarmed, (unsigned long)freed,
+                (unsigned long)(lastPrewarmUs / 1000), eez_flow_get_current_screen());
+}
@@ -0,0 +1,50 @@
+#pragma once
+
+#ifndef SCREEN_MANAGER_H
+#define SCREEN_MANAGER_H
+
+#include <Arduino.h>
+
+// Lifetime of the EEZ screens beyond what the generated code does.
+//
+// create_screens() only builds the watch face, media and calendar screens at
+// boot; every other screen is created by the flow on its first navigation.
+// This module pre-warms the screens whose first appearance must not stall
+// (alarm, incoming call, quick notification, app launcher) one at a time
+// while the UI is idle, and deletes rarely used stateless screens under the
+// monitor_heap() pressure levels so the flow rebuilds them on next use.
+#define SCREEN_MANAGER_IDLE_MS        2000    // no input for this long before pre-warming
+#define SCREEN_MANAGER_PREWARM_GAP_MS 250     // at most one screen per gap
+#define SCREEN_MANAGER_RECENT_MS      5000    // never free a screen shown this recently
+#define SCREEN_MANAGER_STALE_MS       (5 * 60 * 1000)
+#define SCREEN_MANAGER_MIN_FREE_PSRAM (1024 * 1024)
+#define SCREEN_MANAGER_MAX_SCREENS    20
+
+class ScreenManager {
+  public:
+    // Must run after ui_init(): wraps the EEZ page hook.
+    void begin();
+
+    // UI task, while the display is awake.
+    void tick();
+    // Mirrors monitor_heap() MemoryPressure: 0 = OK, 1 = LOW, 2 = CRITICAL.
+    void onMemoryPressure(int level);
+
+    void noteShown(int16_t screenId);
+    void logStats();
+
+  private:
+    bool prewarmNext();
+    uint8_t freeScreens(uint32_t unusedForMs);
+
+    uint32_t lastShown[SCREEN_MANAGER_MAX_SCREENS + 1] = {};   // indexed by ScreensEnum
+    unsigned long lastPrewarm = 0;
+    int pressure = 0;
+    bool prewarmDone = false;
+
+    uint32_t prewarmed = 0;
+    uint32_t freed = 0;
+    uint32_t lastPrewarmUs = 0;
+};
+
+#endif /* screen_manager.h */
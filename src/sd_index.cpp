@@ -0,0 +1,359 @@
+#include "sd_index.h"
+#include "SD_Card.h"
+#include "esp_heap_caps.h"
+
+// FNV-1a
+uint32_t SdIndex::hashName(const char *name) {
+  uint32_t hash = 2166136261u;
+  while (*name) {
+    hash ^= (uint8_t)*name++;
+    hash *= 16777619u;
+  }
+  return hash;
+}
+
+void SdIndex::begin() {
+  mutex = xSemaphoreCreateMutex();
+  xTaskCreatePinnedToCoreWithCaps(
+    refreshTask,
+    "SD Index",
+    4096,
+    this,
+    1,
+    &refresher,
+    0,
+    MALLOC_CAP_SPIRAM);
+}
+
+void SdIndex::manifestPath(const char *directory, char *path, size_t len) {
+  if (strcmp(directory, "/") == 0) {
+    snprintf(path, len, "/%s", SD_INDEX_MANIFEST);
+  } else {
+    snprintf(path, len, "%s/%s", directory, SD_INDEX_MANIFEST);
+  }
+}
+
+void SdIndex::release(Dir &dir) {
+  heap_caps_free(dir.entries);
+  heap_caps_free(dir.names);
+  heap_caps_free(dir.table);
+  dir = {};
+}
+
+bool SdIndex::buildTable(Dir &dir) {
+  uint32_t size = 16;
+  while (size < dir.count * 2) size <<= 1;
+  heap_caps_free(dir.table);
+  dir.table = (uint16_t *)heap_caps_calloc(size, sizeof(uint16_t), MALLOC_CAP_SPIRAM);
+  if (!dir.table) return false;
+  dir.tableMask = size - 1;
+
+  for (uint32_t i = 0; i < dir.count; i++) {
+    uint32_t slot = dir.entries[i].hash & dir.tableMask;
+    while (dir.table[slot]) slot = (slot + 1) & dir.tableMask;
+    dir.table[slot] = i + 1;
+  }
+  return true;
+}
+
+bool SdIndex::readManifest(const char *directory, Dir &dir) {
+  char path[SD_INDEX_PATH_LEN + 16];
+  manifestPath(directory, path, sizeof(path));
+  File file = SD_MMC.open(path);
+  if (!file) return false;
+
+  sd_index_header_t header;
+  bool ok = file.read((uint8_t *)&header, sizeof(header)) == sizeof(header) &&
+            header.magic == SD_INDEX_MAGIC && header.version == SD_INDEX_VERSION &&
+            header.count <= SD_INDEX_MAX_ENTRIES &&
+            file.size() == sizeof(header) + header.count * sizeof(sd_index_entry_t) + header.namesSize;
+  if (ok) {
+    size_t entriesSize = header.count * sizeof(sd_index_entry_t);
+    dir.entries = (sd_index_entry_t *)heap_caps_malloc(entriesSize ? entriesSize : 1, MALLOC_CAP_SPIRAM);
+    dir.names = (char *)heap_caps_malloc(header.namesSize ? header.namesSize : 1, MALLOC_CAP_SPIRAM);
+    ok = dir.entries && dir.names &&
+         file.read((uint8_t *)dir.entries, entriesSize) == entriesSize &&
+         file.read((uint8_t *)dir.names, header.namesSize) == header.namesSize;
+  }
+  file.close();
+
+  if (ok) {
+    dir.count = header.count;
+    dir.namesSize = header.namesSize;
+    for (uint32_t i = 0; i < dir.count && ok; i++) {
+      ok = dir.entries[i].nameOffset < dir.namesSize;
+    }
+    ok = ok && (dir.namesSize == 0 || dir.names[dir.namesSize - 1] == '\0') && buildTable(dir);
+  }
+  if (!ok) release(dir);
+  return ok;
+}
+
+bool SdIndex::writeManifest(const Dir &dir) {
+  char path[SD_INDEX_PATH_LEN + 16];
+  manifestPath(dir.path, path, sizeof(path));
+  File file = SD_MMC.open(path, FILE_WRITE);
+  if (!file) return false;
+
+  sd_index_header_t header = { SD_INDEX_MAGIC, SD_INDEX_VERSION, 0, dir.count, dir.namesSize };
+  size_t entriesSize = dir.count * sizeof(sd_index_entry_t);
+  bool ok = file.write((const uint8_t *)&header, sizeof(header)) == sizeof(header) &&
+            file.write((const uint8_t *)dir.entries, entriesSize) == entriesSize &&
+            file.write((const uint8_t *)dir.names, dir.namesSize) == dir.namesSize;
+  file.close();
+  if (!ok) SD_MMC.remove(path);
+  return ok;
+}
+
+bool SdIndex::walk(const char *directory, Dir &dir) {
+  File root = SD_MMC.open(directory);
+  if (!root || !root.isDirectory()) return false;
+
+  uint32_t entryCap = 64, namesCap = 2048;
+  dir.entries = (sd_index_entry_t *)heap_caps_malloc(entryCap * sizeof(sd_index_entry_t), MALLOC_CAP_SPIRAM);
+  dir.names = (char *)heap_caps_malloc(namesCap, MALLOC_CAP_SPIRAM);
+  bool ok = dir.entries && dir.names;
+
+  File file = root.openNextFile();
+  while (ok && file && dir.count < SD_INDEX_MAX_ENTRIES) {
+    const char *name = file.name();
+    if (strcmp(name, SD_INDEX_MANIFEST) != 0) {
+      uint32_t len = strlen(name) + 1;
+      if (dir.count == entryCap) {
+        entryCap *= 2;
+        void *grown = heap_caps_realloc(dir.entries, entryCap * sizeof(sd_index_entry_t), MALLOC_CAP_SPIRAM);
+        if (grown) dir.entries = (sd_index_entry_t *)grown;
+        ok = grown != nullptr;
+      }
+      while (ok && dir.namesSize + len > namesCap) {
+        namesCap *= 2;
+        void *grown = heap_caps_realloc(dir.names, namesCap, MALLOC_CAP_SPIRAM);
+        if (grown) dir.names = (char *)grown;
+        ok = grown != nullptr;
+      }
+      if (ok) {
+        sd_index_entry_t &entry = dir.entries[dir.count++];
+        entry.hash = hashName(name);
+        entry.size = (uint32_t)file.size();
+        entry.mtime = (uint32_t)file.getLastWrite();
+        entry.nameOffset = dir.namesSize;
+        entry.isDir = file.isDirectory();
+        memcpy(dir.names + dir.namesSize, name, len);
+        dir.namesSize += len;
+      }
+    }
+    file = root.openNextFile();
+  }
+  root.close();
+
+  ok = ok && buildTable(dir);
+  if (!ok) release(dir);
+  return ok;
+}
+
+bool SdIndex::sameContents(const Dir &a, const Dir &b) {
+  return a.count == b.count && a.namesSize == b.namesSize &&
+         memcmp(a.entries, b.entries, a.count * sizeof(sd_index_entry_t)) == 0 &&
+         memcmp(a.names, b.names, a.namesSize) == 0;
+}
+
+SdIndex::Dir *SdIndex::find(const char *directory) {
+  for (int i = 0; i < SD_INDEX_MAX_DIRS; i++) {
+    if (dirs[i].entries && strcmp(dirs[i].path, directory) == 0) return &dirs[i];
+  }
+  return nullptr;
+}
+
+// Caller holds the mutex.  It is released while the card is read, so a
+// directory loading for the first time does not hold up lookups elsewhere.
+SdIndex::Dir *SdIndex::acquire(const char *directory) {
+  Dir *dir = find(directory);
+  if (dir) {
+    dir->lastUse = millis();
+    return dir;
+  }
+  if (strlen(directory) >= SD_INDEX_PATH_LEN) return nullptr;
+
+  xSemaphoreGive(mutex);
+  Dir fresh = {};
+  unsigned long start = millis();
+  bool ok = true;
+  if (readManifest(directory, fresh)) {
+    manifestLoads++;
+    lastLoadMs = millis() - start;
+    strcpy(fresh.path, directory);
+    fresh.stale = true;           // verified by a background walk
+  } else if (walk(directory, fresh)) {
+    walks++;
+    lastWalkMs = millis() - start;
+    strcpy(fresh.path, directory);
+    if (writeManifest(fresh)) rewrites++;
+  } else {
+    printf("Path: <%s> does not exist\r\n", directory);
+    ok = false;
+  }
+  xSemaphoreTake(mutex, portMAX_DELAY);
+  if (!ok) return nullptr;
+
+  // Another caller may have loaded it meanwhile.
+  dir = find(directory);
+  if (dir) {
+    release(fresh);
+    dir->lastUse = millis();
+    return dir;
+  }
+  fresh.lastUse = millis();
+
+  // Reuse a free slot, else drop the least recently used directory.
+  Dir *slot = &dirs[0];
+  for (int i = 0; i < SD_INDEX_MAX_DIRS; i++) {
+    if (!dirs[i].entries) {
+      slot = &dirs[i];
+      break;
+    }
+    if ((int32_t)(dirs[i].lastUse - slot->lastUse) < 0) slot = &dirs[i];
+  }
+  release(*slot);
+  *slot = fresh;
+
+  if (slot->stale && refresher) xTaskNotifyGive(refresher);
+  return slot;
+}
+
+bool SdIndex::load(const char *directory) {
+  if (!mutex) return false;
+  xSemaphoreTake(mutex, portMAX_DELAY);
+  bool ok = acquire(directory) != nullptr;
+  xSemaphoreGive(mutex);
+  return ok;
+}
+
+void SdIndex::invalidate(const char *directory) {
+  if (!mutex) return;
+  xSemaphoreTake(mutex, portMAX_DELAY);
+  Dir *dir = find(directory);
+  if (dir) dir->stale = true;
+  xSemaphoreGive(mutex);
+  if (dir && refresher) xTaskNotifyGive(refresher);
+}
+
+bool SdIndex::contains(const char *directory, const char *fileName) {
+  if (!mutex) return false;
+  uint32_t hash = hashName(fileName);
+  bool found = false;
+
+  xSemaphoreTake(mutex, portMAX_DELAY);
+  lookups++;
+  Dir *dir = acquire(directory);
+  if (dir) {
+    uint32_t slot = hash & dir->tableMask;
+    while (dir->table[slot] && !found) {
+      const sd_index_entry_t &entry = dir->entries[dir->table[slot] - 1];
+      found = entry.hash == hash && strcmp(dir->names + entry.nameOffset, fileName) == 0;
+      slot = (slot + 1) & dir->tableMask;
+    }
+  }
+  xSemaphoreGive(mutex);
+  return found;
+}
+
+uint16_t SdIndex::forEach(const char *directory, const char *extension,
+                          void (*fn)(const char *name, uint32_t size, void *ctx), void *ctx) {
+  if (!mutex) return 0;
+  uint16_t matched = 0;
+
+  xSemaphoreTake(mutex, portMAX_DELAY);
+  lookups++;
+  Dir *dir = acquire(directory);
+  for (uint32_t i = 0; dir && i < dir->count; i++) {
+    const sd_index_entry_t &entry = dir->entries[i];
+    const char *name = dir->names + entry.nameOffset;
+    if (entry.isDir || (extension && !strstr(name, extension))) continue;
+    if (fn) fn(name, entry.size, ctx);
+    matched++;
+  }
+  xSemaphoreGive(mutex);
+  return matched;
+}
+
+uint16_t SdIndex::list(const char *directory, const char *extension, char names[][100], uint16_t maxFiles) {
+  struct Sink {
+    char (*names)[100];
+    uint16_t max;
+    uint16_t count;
+  } sink = { names, maxFiles, 0 };
+
+  forEach(directory, extension, [](const char *name, uint32_t size, void *ctx) {
+    Sink *sink = (Sink *)ctx;
+    if (sink->count >= sink->max) return;
+    strncpy(sink->names[sink->count], name, 99);
+    sink->names[sink->count][99] = '\0';
+    sink->count++;
+  }, &sink);
+  return sink.count;
+}
+
+// Re-walks stale directories without holding the mutex, then swaps the result
+// in.  Unchanged directories cost a walk but no manifest write.
+void SdIndex::refresh() {
+  for (int i = 0; i < SD_INDEX_MAX_DIRS; i++) {
+    char path[SD_INDEX_PATH_LEN];
+    xSemaphoreTake(mutex, portMAX_DELAY);
+    bool stale = dirs[i].entries && dirs[i].stale;
+    strcpy(path, dirs[i].path);
+    xSemaphoreGive(mutex);
+    if (!stale) continue;
+
+    Dir fresh = {};
+    unsigned long start = millis();
+    if (!walk(path, fresh)) continue;
+    lastWalkMs = millis() - start;
+    walks++;
+    strcpy(fresh.path, path);
+
+    xSemaphoreTake(mutex, portMAX_DELAY);
+    Dir *dir = find(path);
+    bool changed = dir && !sameContents(*dir, fresh);
+    if (dir && !changed) dir->stale = false;
+    xSemaphoreGive(mutex);
+
+    if (changed) {
+      if (writeManifest(fresh)) rewrites++;
+      xSemaphoreTake(mutex, portMAX_DELAY);
+      dir = find(path);
+      if (dir) {
+        fresh.lastUse = dir->lastUse;
+        release(*dir);
+        *dir = fresh;
+        fresh = {};
+      }
+      xSemaphoreGive(mutex);
+      printf("SD index: <%s> rebuilt\r\n", path);
+    }
+    release(fresh);
+  }
+}
+
+void SdIndex::refreshTask(void *parameter) {
+  SdIndex *index = (SdIndex *)parameter;
+  for (;;) {
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    index->refresh();
+  }
+}
+
+void SdIndex::logStats() {
+  if (!mutex) return;
+  uint32_t loaded = 0, entries = 0;
+  xSemaphoreTake(mutex, portMAX_DELAY);
+  for (int i = 0; i < SD_INDEX_MAX_DIRS; i++) {
+    if (!dirs[i].entries) continue;
+    loaded++;
+    entries += dirs[i].count;
+  }
+  xSemaphoreGive(mutex);
+  Serial.printf("[SdIndex] dirs=%lu entries=%lu lookups=%lu manifest=%lu (last %lums) walks=%lu (last %lums) rewrites=%lu\n",
+                (unsigned long)loaded, (unsigned long)entries, (unsigned long)lookups,
+                (unsigned long)manifestLoads, (unsigned long)lastLoadMs,
+                (unsigned long)walks, (unsigned long)lastWalkMs, (unsigned long)rewrites);
+}
@@ -0,0 +1,100 @@
+#pragma once
+
+#ifndef SD_INDEX_H
+#define SD_INDEX_H
+
+#include <Arduino.h>
+
+// In-memory index of SD card directories, persisted per directory as a
+// compact manifest (SD_INDEX_MANIFEST) so File_Search() / Folder_retrieval()
+// and the sound pickers never walk a directory on the caller's path.
+//
+// FAT gives no cheap way to tell whether a directory changed: FatFs never
+// bumps a directory's mtime, and a PC adding files does not reliably either.
+// So a manifest only answers until this mount has checked it: the first load
+// of a directory after boot serves the manifest and queues a background walk,
+// which compares entry count, names, sizes and mtimes and swaps the new index
+// in (rewriting the manifest) only if something changed.  Anything on the
+// watch that writes into an indexed directory calls invalidate() for the same
+// re-walk.  The card is only read or walked with the mutex released.
+#define SD_INDEX_MANIFEST       ".dirindex"
+#define SD_INDEX_MAGIC          0x58494453     // "SDIX"
+#define SD_INDEX_VERSION        2
+#define SD_INDEX_MAX_DIRS       8
+#define SD_INDEX_MAX_ENTRIES    4096
+#define SD_INDEX_PATH_LEN       64
+
+typedef struct __attribute__((packed)) {
+  uint32_t magic;
+  uint16_t version;
+  uint16_t reserved;
+  uint32_t count;
+  uint32_t namesSize;
+} sd_index_header_t;
+
+typedef struct __attribute__((packed)) {
+  uint32_t hash;               // SdIndex::hashName()
+  uint32_t size;
+  uint32_t mtime;
+  uint32_t nameOffset;         // into the names blob, NUL terminated
+  uint8_t isDir;
+} sd_index_entry_t;
+
+class SdIndex {
+  public:
+    // Starts the refresh task.  Call after SD_Init().
+    void begin();
+
+    // Indexes `directory` now unless it already is (manifest, else a walk).
+    bool load(const char *directory);
+    // Queue a background rebuild, e.g. after writing into the directory.
+    void invalidate(const char *directory);
+
+    bool contains(const char *directory, const char *fileName);
+    // Files (not directories) whose name contains `extension`, in card order.
+    uint16_t list(const char *directory, const char *extension, char names[][100], uint16_t maxFiles);
+    uint16_t forEach(const char *directory, const char *extension,
+                     void (*fn)(const char *name, uint32_t size, void *ctx), void *ctx);
+
+    static uint32_t hashName(const char *name);
+
+    void logStats();
+
+  private:
+    struct Dir {
+      char path[SD_INDEX_PATH_LEN];
+      uint32_t count;
+      sd_index_entry_t *entries;   // PSRAM
+      char *names;                 // PSRAM
+      uint32_t namesSize;
+      uint16_t *table;             // open addressing, entry index + 1 (0: empty)
+      uint32_t tableMask;
+      uint32_t lastUse;
+      bool stale;                  // not yet checked against the card this mount
+    };
+
+    static void refreshTask(void *parameter);
+    void refresh();
+    Dir *find(const char *directory);
+    Dir *acquire(const char *directory);
+    bool readManifest(const char *directory, Dir &dir);
+    bool writeManifest(const Dir &dir);
+    bool walk(const char *directory, Dir &dir);
+    bool buildTable(Dir &dir);
+    static bool sameContents(const Dir &a, const Dir &b);
+    static void manifestPath(const char *directory, char *path, size_t len);
+    static void release(Dir &dir);
+
+    Dir dirs[SD_INDEX_MAX_DIRS] = {};
+    SemaphoreHandle_t mutex = nullptr;     // guards dirs[]
+    TaskHandle_t refresher = nullptr;
+
+    uint32_t lookups = 0;
+    uint32_t manifestLoads = 0;
+    uint32_t walks = 0;
+    uint32_t rewrites = 0;
+    uint32_t lastLoadMs = 0;
+    uint32_t lastWalkMs = 0;
+};
+
+#endif /* sd_index.h */
@@ -0,0 +1,309 @@
+#include "sound_bank.h"
+#include "Audio_PCM5101.h"
+#include "SD_Card.h"
+#include "esp_heap_caps.h"
+#include "sd_index.h"
+
+#define SOUND_BANK_READ_CHUNK  4096
+
+extern SdIndex sdIndex;
+
+// FNV-1a
+uint32_t SoundBank::hashName(const char *name) {
+  uint32_t hash = 2166136261u;
+  while (*name) {
+    hash ^= (uint8_t)*name++;
+    hash *= 16777619u;
+  }
+  return hash ? hash : 1;  // 0 marks an empty slot
+}
+
+void SoundBank::begin() {
+  mutex = xSemaphoreCreateMutex();
+
+  unsigned long start = millis();
+  sdIndex.forEach(SOUND_BANK_DIR, ".wav", [](const char *name, uint32_t size, void *ctx) {
+    SoundBank *bank = (SoundBank *)ctx;
+    if (bank->indexed >= SOUND_BANK_INDEX_SIZE - 1) return;
+    uint32_t hash = hashName(name);
+    uint32_t i = hash & (SOUND_BANK_INDEX_SIZE - 1);
+    while (bank->index[i].hash) i = (i + 1) & (SOUND_BANK_INDEX_SIZE - 1);
+
+    char *copy = (char *)heap_caps_malloc(strlen(name) + 1, MALLOC_CAP_SPIRAM);
+    if (copy) {
+      strcpy(copy, name);
+      bank->index[i] = { hash, copy, size };
+      bank->indexed++;
+    }
+  }, this);
+  Serial.printf("[SoundBank] Indexed %u tones in %lums\n", indexed, millis() - start);
+
+  xTaskCreatePinnedToCoreWithCaps(
+    loaderTask,
+    "Sound Bank",
+    4096,
+    this,
+    1,
+    &loader,
+    0,
+    MALLOC_CAP_SPIRAM);
+}
+
+const SoundBank::IndexEntry *SoundBank::lookup(const char *fileName) {
+  if (!fileName || !*fileName) return nullptr;
+  uint32_t hash = hashName(fileName);
+  uint32_t i = hash & (SOUND_BANK_INDEX_SIZE - 1);
+  while (index[i].hash) {
+    if (index[i].hash == hash && strcmp(index[i].name, fileName) == 0) return &index[i];
+    i = (i + 1) & (SOUND_BANK_INDEX_SIZE - 1);
+  }
+  return nullptr;
+}
+
+bool SoundBank::contains(const char *fileName) {
+  return lookup(fileName) != nullptr;
+}
+
+void SoundBank::select(SoundBankSlot slot, const char *fileName) {
+  const IndexEntry *entry = lookup(fileName);
+  if (fileName && *fileName && !entry) {
+    Serial.printf("[SoundBank] %s not in %s\n", fileName, SOUND_BANK_DIR);
+  }
+  if (!mutex) return;
+
+  xSemaphoreTake(mutex, portMAX_DELAY);
+  wanted[slot] = entry ? entry->name : nullptr;
+  xSemaphoreGive(mutex);
+  if (loader) xTaskNotifyGive(loader);
+}
+
+bool SoundBank::play(const char *fileName, AudioPriority priority) {
+#ifndef SOUND_BANK_STREAMED
+  uint32_t hash = hashName(fileName);
+
+  if (mutex) {
+    xSemaphoreTake(mutex, portMAX_DELAY);
+    for (int i = 0; i < SOUND_BANK_SLOT_COUNT; i++) {
+      if (tones[i].pcm && tones[i].hash == hash) {
+        Audio_MarkLatencyStart("bank");
+        bool ok = Audio_PlayClip(tones[i].pcm, tones[i].frames, 1, tones[i].sampleRate, priority);
+        if (ok) residentPlays++;
+        xSemaphoreGive(mutex);
+        return ok;
+      }
+    }
+    xSemaphoreGive(mutex);
+  }
+#endif
+
+  if (!lookup(fileName)) {
+    Serial.printf("[SoundBank] %s file not found\n", fileName);
+    return false;
+  }
+  char filePath[100];
+  snprintf(filePath, sizeof(filePath), "%s/%s", SOUND_BANK_DIR, fileName);
+  Audio_MarkLatencyStart("sd");
+  if (!Play_File(filePath)) return false;
+  streamedPlays++;
+  return true;
+}
+
+// A tone can be both resident and streaming when it was loaded while its SD
+// stream played, so both paths are checked.  Media streams are left alone.
+void SoundBank::stop(const char *fileName) {
+  if (!fileName) return;
+  const int16_t *pcm = nullptr;
+  if (mutex) {
+    uint32_t hash = hashName(fileName);
+    xSemaphoreTake(mutex, portMAX_DELAY);
+    for (int i = 0; i < SOUND_BANK_SLOT_COUNT; i++) {
+      if (tones[i].pcm && tones[i].hash == hash) pcm = tones[i].pcm;
+    }
+    xSemaphoreGive(mutex);
+  }
+  if (pcm) Audio_StopClip(pcm);
+
+  char filePath[100];
+  snprintf(filePath, sizeof(filePath), "%s/%s", SOUND_BANK_DIR, fileName);
+  Audio_StopStream(filePath);
+}
+
+// Parses the RIFF header and decodes 16-bit PCM data to mono.
+bool SoundBank::load(Tone &tone, const char *fileName) {
+  char filePath[100];
+  snprintf(filePath, sizeof(filePath), "%s/%s", SOUND_BANK_DIR, fileName);
+  File file = SD_MMC.open(filePath);
+  if (!file) return false;
+
+  uint8_t header[12];
+  if (file.read(header, sizeof(header)) != sizeof(header) ||
+      memcmp(header, "RIFF", 4) != 0 || memcmp(header + 8, "WAVE", 4) != 0) {
+    file.close();
+    return false;
+  }
+
+  uint16_t format = 0, channels = 0, bits = 0;
+  uint32_t sampleRate = 0, dataSize = 0;
+  uint8_t chunk[8];
+  while (file.read(chunk, sizeof(chunk)) == sizeof(chunk)) {
+    uint32_t size = chunk[4] | (chunk[5] << 8) | (chunk[6] << 16) | ((uint32_t)chunk[7] << 24);
+    if (memcmp(chunk, "fmt ", 4) == 0) {
+      uint8_t fmt[16];
+      if (size < sizeof(fmt) || file.read(fmt, sizeof(fmt)) != sizeof(fmt)) break;
+      format = fmt[0] | (fmt[1] << 8);
+      channels = fmt[2] | (fmt[3] << 8);
+      sampleRate = fmt[4] | (fmt[5] << 8) | (fmt[6] << 16) | ((uint32_t)fmt[7] << 24);
+      bits = fmt[14] | (fmt[15] << 8);
+      file.seek(file.position() + size - sizeof(fmt) + (size & 1));
+    } else if (memcmp(chunk, "data", 4) == 0) {
+      dataSize = size;
+      break;
+    } else {
+      file.seek(file.position() + size + (size & 1));
+    }
+  }
+
+  if (format != 1 || bits != 16 || channels < 1 || channels > 2 || dataSize == 0) {
+    Serial.printf("[SoundBank] %s is not 16-bit PCM\n", fileName);
+    file.close();
+    return false;
+  }
+
+  uint32_t frames = dataSize / (2 * channels);
+  uint32_t bytes = frames * sizeof(int16_t);
+  if (bytes > SOUND_BANK_MAX_TONE_BYTES ||
+      heap_caps_get_free_size(MALLOC_CAP_SPIRAM) < bytes + SOUND_BANK_MIN_FREE_PSRAM) {
+    Serial.printf("[SoundBank] %s too large to keep resident (%lu bytes)\n", fileName, (unsigned long)bytes);
+    file.close();
+    return false;
+  }
+
+  int16_t *pcm = (int16_t *)heap_caps_malloc(bytes, MALLOC_CAP_SPIRAM);
+  int16_t *buffer = (int16_t *)heap_caps_malloc(SOUND_BANK_READ_CHUNK, MALLOC_CAP_SPIRAM);
+  if (!pcm || !buffer) {
+    heap_caps_free(pcm);
+    heap_caps_free(buffer);
+    file.close();
+    return false;
+  }
+
+  // Alarm tones go to a single speaker; downmixing halves the footprint.
+  uint32_t done = 0;
+  const uint32_t framesPerChunk = SOUND_BANK_READ_CHUNK / (2 * channels);
+  while (done < frames) {
+    uint32_t want = min(frames - done, framesPerChunk);
+    size_t got = file.read((uint8_t *)buffer, want * 2 * channels) / (2 * channels);
+    if (got == 0) break;
+    for (size_t i = 0; i < got; i++) {
+      pcm[done + i] = channels == 2 ? (int16_t)(((int32_t)buffer[i * 2] + buffer[i * 2 + 1]) / 2) : buffer[i];
+    }
+    done += got;
+  }
+  heap_caps_free(buffer);
+  file.close();
+
+  tone.hash = hashName(fileName);
+  tone.pcm = pcm;
+  tone.frames = done;
+  tone.sampleRate = sampleRate;
+  return done > 0;
+}
+
+// Caller holds the mutex.  Returns false while the tone is still playing.
+bool SoundBank::release(SoundBankSlot slot) {
+  Tone &tone = tones[slot];
+  if (!tone.pcm) return true;
+
+  bool shared = false;
+  for (int i = 0; i < SOUND_BANK_SLOT_COUNT; i++) {
+    if (i != slot && tones[i].pcm == tone.pcm) shared = true;
+  }
+  if (!shared) {
+    if (Audio_IsClipPlaying(tone.pcm)) return false;
+    heap_caps_free(tone.pcm);
+  }
+  tone = {};
+  return true;
+}
+
+void SoundBank::service() {
+  bool deferred = false;
+
+  for (int slot = 0; slot < SOUND_BANK_SLOT_COUNT; slot++) {
+    xSemaphoreTake(mutex, portMAX_DELAY);
+    const char *name = wanted[slot];
+    uint32_t hash = name ? hashName(name) : 0;
+    bool current = tones[slot].hash == hash;
+
+    // Same file already resident in another slot: share it.
+    if (!current && hash) {
+      for (int i = 0; i < SOUND_BANK_SLOT_COUNT; i++) {
+        if (i != slot && tones[i].pcm && tones[i].hash == hash) {
+          if (release((SoundBankSlot)slot)) {
+            tones[slot] = tones[i];
+            current = true;
+          } else {
+            deferred = true;
+          }
+          break;
+        }
+      }
+    }
+    if (current) {
+      xSemaphoreGive(mutex);
+      continue;
+    }
+    if (!release((SoundBankSlot)slot)) {
+      deferred = true;
+      xSemaphoreGive(mutex);
+      continue;
+    }
+    xSemaphoreGive(mutex);
+
+    if (!name) continue;
+
+    // Decode outside the mutex so play() never waits on the SD card.
+    Tone fresh = {};
+    unsigned long start = millis();
+    if (load(fresh, name)) {
+      lastLoadMs = millis() - start;
+      Serial.printf("[SoundBank] %s resident (%luKB, %lums)\n", name,
+                    (unsigned long)(fresh.frames * sizeof(int16_t) / 1024), (unsigned long)lastLoadMs);
+      xSemaphoreTake(mutex, portMAX_DELAY);
+      if (wanted[slot] == name) {
+        tones[slot] = fresh;
+        fresh = {};
+      }
+      xSemaphoreGive(mutex);
+    }
+    heap_caps_free(fresh.pcm);  // superseded while loading
+  }
+
+  // A tone being played can't be freed yet; try again shortly.
+  if (deferred) {
+    vTaskDelay(pdMS_TO_TICKS(1000));
+    xTaskNotifyGive(loader);
+  }
+}
+
+void SoundBank::loaderTask(void *parameter) {
+  SoundBank *bank = (SoundBank *)parameter;
+  for (;;) {
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    bank->service();
+  }
+}
+
+void SoundBank::logStats() {
+  uint32_t resident = 0;
+  xSemaphoreTake(mutex, portMAX_DELAY);
+  for (int i = 0; i < SOUND_BANK_SLOT_COUNT; i++) {
+    bool shared = false;
+    for (int j = 0; j < i; j++) shared |= tones[j].pcm && tones[j].pcm == tones[i].pcm;
+    if (!shared) resident += tones[i].frames * sizeof(int16_t);
+  }
+  xSemaphoreGive(mutex);
+  Serial.printf("[SoundBank] indexed=%u resident=%luKB plays_ram=%lu plays_sd=%lu last_load=%lums\n",
+                indexed, (unsigned long)(resident / 1024), (unsigned long)residentPlays,
+                (unsigned long)streamedPlays, (unsigned long)lastLoadMs);
+}
@@ -0,0 +1,79 @@
+#pragma once
+
+#ifndef SOUND_BANK_H
+#define SOUND_BANK_H
+
+#include <Arduino.h>
+#include "audio_mixer.h"
+
+// RAM-resident alarm and timer tones.
+//
+// The alarm directory is indexed once into a hashed table, and the tones
+// selected for the alarm and the timer are decoded to mono PCM in PSRAM by a
+// low-priority loader task.  play() hands resident tones straight to the audio
+// pump; anything else streams from SD via the index (no directory scan).
+// -DSOUND_BANK_STREAMED streams every tone, as before the bank, so the
+// [Audio] first sample (bank) and (sd) figures can be compared.
+#define SOUND_BANK_DIR              "/System/alarms"
+#define SOUND_BANK_INDEX_SIZE       64       // power of two, > files in SOUND_BANK_DIR
+#define SOUND_BANK_MAX_TONE_BYTES   (2 * 1024 * 1024)
+#define SOUND_BANK_MIN_FREE_PSRAM   (1536 * 1024)
+
+enum SoundBankSlot {
+  SOUND_BANK_SLOT_ALARM = 0,
+  SOUND_BANK_SLOT_TIMER,
+  SOUND_BANK_SLOT_COUNT
+};
+
+class SoundBank {
+  public:
+    // Indexes SOUND_BANK_DIR and starts the loader task.  Call after sdIndex.begin().
+    void begin();
+
+    // Make `fileName` resident for `slot` (asynchronous; NULL clears the slot).
+    void select(SoundBankSlot slot, const char *fileName);
+
+    // Mixes the resident copy in at `priority`, otherwise streams from SD
+    // (only if no other stream is playing).
+    bool play(const char *fileName, AudioPriority priority);
+    // Stops only this tone, leaving other voices (and media) playing.
+    void stop(const char *fileName);
+    bool contains(const char *fileName);
+
+    void logStats();
+
+  private:
+    struct IndexEntry {
+      uint32_t hash;
+      char *name;                // PSRAM copy
+      uint32_t size;
+    };
+
+    struct Tone {
+      uint32_t hash;
+      int16_t *pcm;              // mono, PSRAM
+      uint32_t frames;
+      uint32_t sampleRate;
+    };
+
+    static void loaderTask(void *parameter);
+    static uint32_t hashName(const char *name);
+    const IndexEntry *lookup(const char *fileName);
+    void service();
+    bool load(Tone &tone, const char *fileName);
+    bool release(SoundBankSlot slot);
+
+    IndexEntry index[SOUND_BANK_INDEX_SIZE] = {};
+    uint16_t indexed = 0;
+
+    Tone tones[SOUND_BANK_SLOT_COUNT] = {};
+    const char *wanted[SOUND_BANK_SLOT_COUNT] = {};   // points into index names
+    SemaphoreHandle_t mutex = nullptr;                 // guards tones[] and wanted[]
+    TaskHandle_t loader = nullptr;
+
+    uint32_t residentPlays = 0;
+    uint32_t streamedPlays = 0;
+    uint32_t lastLoadMs = 0;
+};
+
+#endif /* sound_bank.h */
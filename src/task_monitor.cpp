@@ -0,0 +1,229 @@
+#include "task_monitor.h"
+#include "esp_heap_caps.h"
+#include "esp_memory_utils.h"
+#include "esp_timer.h"
+
+// uxTaskGetSystemState() returns nothing unless there is room for every task.
+#define TASK_MONITOR_STATUS_SLOTS 48
+
+static void formatLoad(char *out, size_t len, uint8_t halfPercent) {
+  snprintf(out, len, "%u.%u", halfPercent / 2, (halfPercent & 1) * 5);
+}
+
+bool TaskMonitor::begin() {
+  if (records) return true;
+  Record *recordTable = (Record *)heap_caps_calloc(TASK_MONITOR_MAX_TASKS, sizeof(Record), MALLOC_CAP_SPIRAM);
+  TaskStatus_t *statusTable = (TaskStatus_t *)heap_caps_calloc(TASK_MONITOR_STATUS_SLOTS, sizeof(TaskStatus_t), MALLOC_CAP_SPIRAM);
+  if (!recordTable || !statusTable) {
+    heap_caps_free(recordTable);
+    heap_caps_free(statusTable);
+    Serial.println("[TaskMon] Failed to allocate sample buffers");
+    return false;
+  }
+  status = statusTable;
+  records = recordTable;
+  return true;
+}
+
+// Caller holds the lock.  Reuses the slot of a task that has gone away once
+// the table is full; NULL if there is none.
+TaskMonitor::Record *TaskMonitor::recordFor(TaskHandle_t task, const char *name) {
+  Record *reusable = nullptr;
+  for (uint8_t i = 0; i < recordCount; i++) {
+    if (records[i].handle == task) return &records[i];
+    if (!reusable && !records[i].seen) reusable = &records[i];
+  }
+  Record *record = recordCount < TASK_MONITOR_MAX_TASKS ? &records[recordCount++] : reusable;
+  if (!record) return nullptr;
+
+  memset(record, 0, sizeof(Record));
+  record->handle = task;
+  strncpy(record->name, name, sizeof(record->name) - 1);
+  record->minFreeBytes = UINT32_MAX;
+  record->core = -1;
+  record->seen = true;
+  return record;
+}
+
+void TaskMonitor::watch(TaskHandle_t task, uint32_t stackBytes, uint32_t lowWaterBytes) {
+  if (!records || !task) return;
+  taskENTER_CRITICAL(&lock);
+  Record *record = recordFor(task, pcTaskGetName(task));
+  if (record) {
+    record->stackBytes = stackBytes;
+    record->lowWaterBytes = lowWaterBytes;
+  }
+  taskEXIT_CRITICAL(&lock);
+}
+
+void TaskMonitor::sample() {
+  if (!records) return;
+
+  UBaseType_t count = uxTaskGetSystemState(status, TASK_MONITOR_STATUS_SLOTS, nullptr);
+  int64_t nowUs = esp_timer_get_time();
+  if (count == 0) {
+    Serial.printf("[TaskMon] More than %u tasks, sample skipped\n", TASK_MONITOR_STATUS_SLOTS);
+    return;
+  }
+  uint32_t elapsedUs = lastSampleUs ? (uint32_t)(nowUs - lastSampleUs) : 0;
+  lastSampleUs = nowUs;
+  samples++;
+
+  struct LowStack {
+    char name[configMAX_TASK_NAME_LEN];
+    uint32_t freeBytes;
+  } lowStacks[4];
+  uint8_t lowStackCount = 0;
+
+  taskENTER_CRITICAL(&lock);
+  // Mark survivors first so a new task can only take over the slot of one
+  // that has really gone.
+  for (uint8_t i = 0; i < recordCount; i++) {
+    records[i].seen = false;
+    for (UBaseType_t t = 0; t < count; t++) {
+      if (status[t].xHandle == records[i].handle) {
+        records[i].seen = true;
+        break;
+      }
+    }
+  }
+
+  for (UBaseType_t t = 0; t < count; t++) {
+    const TaskStatus_t &task = status[t];
+    Record *record = recordFor(task.xHandle, task.pcTaskName);
+    if (!record) continue;
+
+    record->priority = task.uxBasePriority;
+    record->core = task.xCoreID == tskNO_AFFINITY ? -1 : task.xCoreID;
+    record->psramStack = esp_ptr_external_ram(task.pxStackBase);
+
+    uint32_t freeBytes = task.usStackHighWaterMark * sizeof(StackType_t);
+    if (freeBytes < record->minFreeBytes) {
+      record->minFreeBytes = freeBytes;
+      if (freeBytes < record->lowWaterBytes && lowStackCount < 4) {
+        strcpy(lowStacks[lowStackCount].name, record->name);
+        lowStacks[lowStackCount++].freeBytes = freeBytes;
+      }
+    }
+
+    if (record->primed && elapsedUs) {
+      uint32_t ranUs = task.ulRunTimeCounter - record->lastRunTime;   // wraps at 2^32 us
+      uint32_t load = (uint32_t)((uint64_t)ranUs * 200 / elapsedUs);
+      record->load[record->loadHead] = load > 200 ? 200 : load;
+      record->loadHead = (record->loadHead + 1) % TASK_MONITOR_HISTORY;
+      if (record->loadCount < TASK_MONITOR_HISTORY) record->loadCount++;
+    }
+    record->lastRunTime = task.ulRunTimeCounter;
+    record->primed = true;
+  }
+  taskEXIT_CRITICAL(&lock);
+
+  for (uint8_t i = 0; i < lowStackCount; i++) {
+    Serial.printf("!! WARNING: %s stack low: %lu bytes free !!\n",
+                  lowStacks[i].name, (unsigned long)lowStacks[i].freeBytes);
+  }
+}
+
+TaskMonitor::LoadSummary TaskMonitor::summarize(const Record &record) {
+  LoadSummary summary = {};
+  uint8_t n = record.loadCount;
+  if (n == 0) return summary;
+
+  uint8_t sorted[TASK_MONITOR_HISTORY];
+  memcpy(sorted, record.load, n);   // the ring is only partly filled until it wraps, from slot 0
+  for (uint8_t i = 1; i < n; i++) {
+    uint8_t value = sorted[i];
+    int j = i - 1;
+    while (j >= 0 && sorted[j] > value) {
+      sorted[j + 1] = sorted[j];
+      j--;
+    }
+    sorted[j + 1] = value;
+  }
+  summary.min = sorted[0];
+  summary.p50 = sorted[(n - 1) * 50 / 100];
+  summary.p95 = sorted[(n - 1) * 95 / 100];
+  summary.max = sorted[n - 1];
+  return summary;
+}
+
+// Peak use plus a quarter and a fixed margin for paths we have not hit yet,
+// rounded up to 512 bytes.  0 when the configured size is unknown.
+uint32_t TaskMonitor::recommendedStack(const Record &record) {
+  if (record.stackBytes == 0 || record.minFreeBytes == UINT32_MAX) return 0;
+  uint32_t used = record.minFreeBytes < record.stackBytes ? record.stackBytes - record.minFreeBytes : 0;
+  uint32_t recommended = used * 5 / 4 + TASK_MONITOR_STACK_MARGIN;
+  return (recommended + 511) & ~511u;
+}
+
+// A task that keeps its core busy should not sit above lighter tasks we run
+// on the same core: drop it to the lowest of their priorities so it shares
+// time with them instead of starving them.
+uint8_t TaskMonitor::recommendedPriority(const Record &record, const LoadSummary &load) {
+  if (record.stackBytes == 0 || load.p95 < TASK_MONITOR_HEAVY_LOAD * 2) return record.priority;
+  uint8_t priority = record.priority;
+  for (uint8_t i = 0; i < recordCount; i++) {
+    const Record &peer = records[i];
+    if (&peer == &record || !peer.seen || peer.stackBytes == 0) continue;
+    if (peer.core != record.core && peer.core != -1 && record.core != -1) continue;
+    if (peer.priority < priority) priority = peer.priority;
+  }
+  return priority;
+}
+
+void TaskMonitor::logReport() {
+  if (!records || samples < 2) return;
+
+  Serial.printf("[TaskMon] %lu samples, internal heap free=%u largest=%u\n", (unsigned long)samples,
+                heap_caps_get_free_size(MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT),
+                heap_caps_get_largest_free_block(MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT));
+
+  // Core load is whatever its idle task did not get.
+  for (BaseType_t core = 0; core < portNUM_PROCESSORS; core++) {
+    TaskHandle_t idle = xTaskGetIdleTaskHandleForCore(core);
+    for (uint8_t i = 0; i < recordCount; i++) {
+      if (records[i].handle != idle || records[i].loadCount == 0) continue;
+      LoadSummary idleLoad = summarize(records[i]);
+      char p50[8], peak[8];
+      formatLoad(p50, sizeof(p50), 200 - idleLoad.p50);
+      formatLoad(peak, sizeof(peak), 200 - idleLoad.min);
+      Serial.printf("[TaskMon] core%d load p50=%s%% peak=%s%%\n", (int)core, p50, peak);
+    }
+  }
+
+  Serial.printf("[TaskMon] %-16s core prio  stack   free    rec  cpu%% p50/p95/max  where\n", "task");
+  for (uint8_t i = 0; i < recordCount; i++) {
+    const Record &record = records[i];
+    if (!record.seen) continue;
+    LoadSummary load = summarize(record);
+
+    char core[4] = "-", stack[8] = "-", rec[8] = "-", p50[8], p95[8], max[8];
+    if (record.core >= 0) snprintf(core, sizeof(core), "%d", record.core);
+    if (record.stackBytes) snprintf(stack, sizeof(stack), "%lu", (unsigned long)record.stackBytes);
+    uint32_t recommended = recommendedStack(record);
+    if (recommended) snprintf(rec, sizeof(rec), "%lu", (unsigned long)recommended);
+    formatLoad(p50, sizeof(p50), load.p50);
+    formatLoad(p95, sizeof(p95), load.p95);
+    formatLoad(max, sizeof(max), load.max);
+
+    Serial.printf("[TaskMon] %-16s %4s %4u %6s %6lu %6s  %5s/%5s/%5s  %s\n", record.name, core, record.priority,
+                  stack, (unsigned long)(record.minFreeBytes == UINT32_MAX ? 0 : record.minFreeBytes), rec,
+                  p50, p95, max, record.psramStack ? "psram" : "internal");
+  }
+
+  // Recommendations for the tasks we create (and so can resize).
+  for (uint8_t i = 0; i < recordCount; i++) {
+    const Record &record = records[i];
+    if (!record.seen || record.stackBytes == 0) continue;
+    LoadSummary load = summarize(record);
+    uint32_t stack = recommendedStack(record);
+    uint8_t priority = recommendedPriority(record, load);
+    bool moveInternal = record.psramStack && load.p95 >= TASK_MONITOR_HOT_LOAD * 2 && stack && stack <= TASK_MONITOR_INTERNAL_MAX_STACK;
+
+    char p95[8];
+    formatLoad(p95, sizeof(p95), load.p95);
+    Serial.printf("[TaskMon] > %-16s stack %lu -> %lu, prio %u -> %u%s (p95 %s%%)\n", record.name,
+                  (unsigned long)record.stackBytes, (unsigned long)stack, record.priority, priority,
+                  moveInternal ? ", move stack to internal RAM" : "", p95);
+  }
+}
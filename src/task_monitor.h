@@ -0,0 +1,76 @@
+#pragma once
+
+#ifndef TASK_MONITOR_H
+#define TASK_MONITOR_H
+
+#include <Arduino.h>
+
+// Samples every FreeRTOS task's stack high-water mark, run-time counter,
+// priority and core affinity, and keeps a rolling history of CPU load per
+// task.  The report turns that into a recommended stack size and priority
+// for each task we create, and flags PSRAM stacks that are hot enough to be
+// worth moving into internal RAM.
+//
+// Load is measured against the ESP timer run-time counter that
+// CONFIG_FREERTOS_RUN_TIME_STATS_USING_ESP_TIMER provides, as a percentage of
+// one core.  The counter is 32-bit microseconds, so samples must be less than
+// ~71 minutes apart.
+#define TASK_MONITOR_MAX_TASKS          32
+#define TASK_MONITOR_HISTORY            64      // load samples kept per task
+#define TASK_MONITOR_STACK_MARGIN       1024    // recommended = peak used * 5/4 + margin
+#define TASK_MONITOR_HOT_LOAD           5       // % (p95) before a PSRAM stack is worth moving
+#define TASK_MONITOR_HEAVY_LOAD         50      // % (p95) before a task should yield to its peers
+#define TASK_MONITOR_INTERNAL_MAX_STACK 8192    // largest stack we would put in internal RAM
+
+class TaskMonitor {
+  public:
+    // Allocates the sample buffers (PSRAM).
+    bool begin();
+
+    // Registers one of our tasks with the stack size it was created with and
+    // the free-stack level that should raise a warning.
+    void watch(TaskHandle_t task, uint32_t stackBytes, uint32_t lowWaterBytes);
+
+    // Takes one sample of every task.  Warns straight away when a watched
+    // task's stack reaches a new low under its threshold.
+    void sample();
+
+    // Per-core load, the per-task table and the recommendations.
+    void logReport();
+
+  private:
+    struct Record {
+      TaskHandle_t handle;                // nullptr: free slot
+      char name[configMAX_TASK_NAME_LEN];
+      uint32_t stackBytes;                // 0: not watched, size unknown
+      uint32_t lowWaterBytes;
+      uint32_t minFreeBytes;
+      uint32_t lastRunTime;
+      uint8_t priority;
+      int8_t core;                        // -1: either core
+      bool psramStack;
+      bool seen;                          // present in the latest sample
+      bool primed;                        // lastRunTime is valid
+      uint8_t loadCount;
+      uint8_t loadHead;
+      uint8_t load[TASK_MONITOR_HISTORY]; // half-percent of one core
+    };
+
+    struct LoadSummary {
+      uint8_t min, p50, p95, max;         // half-percent
+    };
+
+    Record *recordFor(TaskHandle_t task, const char *name);
+    LoadSummary summarize(const Record &record);
+    uint32_t recommendedStack(const Record &record);
+    uint8_t recommendedPriority(const Record &record, const LoadSummary &load);
+
+    Record *records = nullptr;
+    TaskStatus_t *status = nullptr;
+    uint8_t recordCount = 0;
+    int64_t lastSampleUs = 0;
+    uint32_t samples = 0;
+    portMUX_TYPE lock = portMUX_INITIALIZER_UNLOCKED;
+};
+
+#endif /* task_monitor.h */
@@ -2,6 +2,7 @@
 #include "src/vars.h"
 #include "time.h"
 #include "time_client.h"
+#include "civil_time.h"
 #include <Arduino.h>
 #include <WiFi.h>
 #include <WiFiMulti.h>
@@ -9,38 +10,216 @@
 #include <ArduinoJson.h>
 #include "psram_alloc.h"
 #include "secrets.h"
+#include "RTC_PCF85063.h"
+#include <esp_sntp.h>
+#include <sys/time.h>
 #include <stdlib.h>
+#include <math.h>
+
+extern TimeZone timeZone;
 
 TimeClient::TimeClient() {
 }
 
 void TimeClient::begin() {
+  time_t now = time(nullptr);
+  if (!discipline.syncDue(now)) {
+    ntpSkipped++;
+    Serial.printf("NTP not due for %lds, clock good to %ld ms\n",
+                  (long)(discipline.lastSample() + discipline.nextSyncDelay() - now),
+                  lround(discipline.uncertainty(now) * 1000));
+    return;
+  }
+  if (rtcBusy.test_and_set()) return;
   syncWithNTP();
+  // A held-back answer gets its second opinion from the other server while
+  // WiFi is still up.
+  if (discipline.awaitingConfirmation()) syncWithNTP(true);
+  rtcBusy.clear();
 }
 
-void TimeClient::syncWithNTP() {
-  struct tm timeinfo;
+static volatile bool ntpAnswered = false;
+
+static void onNtpAnswer(struct timeval *tv) {
+  ntpAnswered = true;
+}
 
+// One SNTP answer, then the RTC is measured against it.  SNTP is stopped
+// afterwards so lwIP does not step the clock on its own schedule; the next
+// sync is the discipline's call.
+bool TimeClient::syncWithNTP(bool otherServerFirst) {
   Serial.println(F("Setting up time"));
+  ntpAnswered = false;
+  sntp_set_time_sync_notification_cb(onNtpAnswer);
   // Use numeric NTP server addresses to avoid SNTP DNS callbacks racing with
   // concurrent HTTPS DNS resolution during startup.
-  configTime(0, 0, "129.6.15.28", "216.239.35.0");
+  if (otherServerFirst) configTime(0, 0, "216.239.35.0", "129.6.15.28");
+  else configTime(0, 0, "129.6.15.28", "216.239.35.0");
 
   // configTime(0, 0, ...) resets the TZ environment variable to UTC.
   // Re-apply the saved timezone immediately so getLocalTime() returns
-  // local time, not UTC.  Without this, every WiFi sync (every 120 min)
-  // reverts the clock to UTC until the next lookupTimezone() call (every 6 h).
+  // local time, not UTC.  Without this, every NTP sync reverts the clock
+  // to UTC until the next lookupTimezone() call (every 6 h).
   if (timezone[0] != '\0') {
     setenv("TZ", timezone, 1);
     tzset();
+    timeZone.set(timezone);
     Serial.printf("  Re-applied saved timezone: %s\n", timezone);
   }
 
-  if (!getLocalTime(&timeinfo)) {
+  unsigned long started = millis();
+  while (!ntpAnswered && millis() - started < TIME_NTP_TIMEOUT_MS) {
+    vTaskDelay(pdMS_TO_TICKS(20));
+  }
+  esp_sntp_stop();
+  if (!ntpAnswered) {
+    ntpFailed++;
     Serial.println(F("  Failed to obtain time"));
-    return;
+    return false;
   }
+  ntpSyncs++;
   Serial.println(F("  Got the time from NTP"));
+
+  double offset;
+  time_t now;
+  if (!measureRtc(offset, now)) {
+    Serial.println(F("  RTC not answering"));
+    return true;
+  }
+  discipline.clockSet(now);
+  if (!PCF85063_Time_Valid()) {
+    // Never set, or it lost power: nothing to learn from it.
+    rewriteRtc(now, offset);
+    return true;
+  }
+
+  TimeDiscipline::Verdict verdict = discipline.addSample(now, offset);
+  if (verdict == TimeDiscipline::REJECTED) {
+    // The system clock took the bad answer; put it back on the RTC.
+    ntpRejected++;
+    Serial.printf("  NTP answer %+ld ms from the RTC's prediction, not used\n",
+                  lround((discipline.predictedOffset(now) - offset) * 1000));
+    stepClock(offset - discipline.predictedOffset(now));
+    return false;
+  }
+  if (verdict == TimeDiscipline::STEPPED) Serial.println(F("  RTC moved, drift fit restarted"));
+
+  int8_t target = discipline.targetSteps();
+  if (target != discipline.steps()) {
+    PCF85063_Set_Offset(target);
+    discipline.setSteps(now, target);
+  }
+  if (fabs(offset) > TIME_RTC_REWRITE_S) rewriteRtc(now, offset);
+
+  Serial.printf("  RTC %+ld ms, drift %+.1f ppm (+/- %.1f), offset register %d, next NTP in %lus\n",
+                lround(offset * 1000), discipline.driftPpm(), discipline.sigmaPpm(), discipline.steps(),
+                (unsigned long)discipline.nextSyncDelay());
+  return true;
+}
+
+// RTC minus system time at the RTC's last second boundary.
+bool TimeClient::measureRtc(double &offset, time_t &at, uint32_t waitMs) {
+  time_t rtc;
+  struct timeval edge;
+  if (!PCF85063_Read_Edge(&rtc, &edge, waitMs)) return false;
+  offset = (double)rtc - ((double)edge.tv_sec + edge.tv_usec * 1e-6);
+  at = edge.tv_sec;
+  return true;
+}
+
+// Loads the RTC with a whole second while it is stopped and restarts it so
+// that its next second starts when the system clock's does.
+void TimeClient::rewriteRtc(time_t now, double before) {
+  struct timeval tv;
+  gettimeofday(&tv, NULL);
+  time_t second = tv.tv_usec < 400000 ? tv.tv_sec : tv.tv_sec + 1;
+  int64_t releaseUs = (int64_t)second * 1000000 + (1000000 - RTC_STOP_RELEASE_US);
+
+  PCF85063_Hold(second);
+  do {
+    vTaskDelay(1);
+    gettimeofday(&tv, NULL);
+  } while ((int64_t)tv.tv_sec * 1000000 + tv.tv_usec < releaseUs);
+  PCF85063_Release();
+
+  double after;
+  if (!measureRtc(after, now)) return;
+  discipline.rewritten(now, before, after);
+  rtcWrites++;
+  Serial.printf("  RTC rewritten, now %+ld ms\n", lround(after * 1000));
+}
+
+// Small corrections slew so the seconds never jump; large ones step.
+void TimeClient::stepClock(double seconds) {
+  if (fabs(seconds) < TIME_SLEW_MAX_S) {
+    int64_t us = llround(seconds * 1e6);
+    struct timeval delta = { (time_t)(us / 1000000), (suseconds_t)(us % 1000000) };
+    adjtime(&delta, NULL);
+  } else {
+    struct timeval tv;
+    gettimeofday(&tv, NULL);
+    int64_t us = (int64_t)tv.tv_sec * 1000000 + tv.tv_usec + llround(seconds * 1e6);
+    tv.tv_sec = us / 1000000;
+    tv.tv_usec = us % 1000000;
+    settimeofday(&tv, NULL);
+  }
+}
+
+void TimeClient::restoreFromRtc() {
+  discipline.begin(PCF85063_Read_Offset(), RTC_OFFSET_PPM);
+  time_t rtc;
+  if (time(nullptr) > 1700000000 || !PCF85063_Time_Valid() || !PCF85063_Read_Epoch(&rtc)) return;
+  // Somewhere in this second; steerFromRtc() finds the edge later.
+  struct timeval tv = { rtc, 500000 };
+  settimeofday(&tv, NULL);
+  Serial.println(F("Clock set from the RTC"));
+}
+
+// Between steers the drift the discipline expects is slewed out, which needs
+// no I2C.  A steer sleeps until shortly before the RTC's next second is
+// expected and polls from there.
+void TimeClient::steerFromRtc() {
+  if (rtcBusy.test_and_set()) return;
+  struct timeval tv;
+  gettimeofday(&tv, NULL);
+  if (!discipline.steerDue(tv.tv_sec)) {
+    stepClock(discipline.compensate(tv.tv_sec));
+    rtcBusy.clear();
+    return;
+  }
+  if (!PCF85063_Time_Valid()) {
+    rtcBusy.clear();
+    return;
+  }
+
+  uint32_t waitMs = lround(discipline.untilEdge(tv.tv_sec + tv.tv_usec * 1e-6) * 1000);
+  unsigned long started = millis();
+  double offset;
+  time_t now;
+  if (measureRtc(offset, now, waitMs)) {
+    // offset is RTC minus system, the prediction RTC minus true time.
+    double error = discipline.predictedOffset(now) - offset;
+    stepClock(-error);
+    discipline.steered(now, error);
+    steers++;
+    lastSteerMs = lround(error * 1000);
+  }
+  unsigned long spent = millis() - started;
+  edgePollMs += spent > waitMs ? spent - waitMs : 0;
+  rtcBusy.clear();
+}
+
+void TimeClient::logStats() {
+  time_t now = time(nullptr);
+  long nextNtp = discipline.hasFix() ? (long)(discipline.lastSample() + discipline.nextSyncDelay() - now) : 0;
+  Serial.printf("[Time] ntp=%lu skipped=%lu failed=%lu rejected=%lu, drift %+.1f ppm (+/- %.1f) register %d, "
+                "rtc writes=%lu, steers=%lu last %+ld ms (system %+.0f ppm, edge polls %lu ms), error <= %ld ms, "
+                "next ntp in %lds\n",
+                (unsigned long)ntpSyncs, (unsigned long)ntpSkipped, (unsigned long)ntpFailed,
+                (unsigned long)ntpRejected, discipline.driftPpm(), discipline.sigmaPpm(), discipline.steps(),
+                (unsigned long)rtcWrites, (unsigned long)steers, (long)lastSteerMs, discipline.systemPpm(),
+                (unsigned long)edgePollMs,
+                discipline.hasFix() ? lround(discipline.uncertainty(now) * 1000) : -1L, nextNtp);
 }
 
 bool TimeClient::lookupTimezone(const char *latitude, const char *longitude) {
@@ -110,25 +289,19 @@ bool TimeClient::lookupTimezone(const char *latitude, const char *longitude) {
                 }*/
                 if(doc["abbreviation"]) {
                   strncpy(timezoneName, doc["zoneName"], sizeof(timezoneName));
-                  const char *abbr = doc["abbreviation"];
-                  const char *nextAbbr = doc["nextAbbreviation"];
-                  int gmtOffset = doc["gmtOffset"];
                   const char *dstFlag = doc["dst"];
-                  bool isDst = (dstFlag && dstFlag[0] == '1');
-
-                  // POSIX TZ format: <std><offset><dst>
-                  // Offset is for STANDARD time, positive = west of Greenwich.
-                  // When DST is active the API returns the DST abbreviation/offset,
-                  // so we must swap and derive the standard offset (subtract 1 hour).
-                  const char *stdAbbr = isDst ? nextAbbr : abbr;
-                  const char *dstAbbr = isDst ? abbr : nextAbbr;
-                  int stdGmtOffset = isDst ? (gmtOffset - 3600) : gmtOffset;
-                  int posixOffsetHours = -(stdGmtOffset / 3600);
-
-                  snprintf(timezone, sizeof(timezone), "%s%d%s", stdAbbr, posixOffsetHours, dstAbbr);   // CST6CDT
+                  // zoneStart/zoneEnd are the transitions around now; the
+                  // DST rules come from them.  Null for zones without DST.
+                  int len = posixZoneString(timezone, sizeof(timezone), doc["abbreviation"], doc["gmtOffset"],
+                                            dstFlag && dstFlag[0] == '1', doc["nextAbbreviation"],
+                                            (time_t)(doc["zoneStart"] | (int64_t)0), (time_t)(doc["zoneEnd"] | (int64_t)0));
+                  if (len >= (int)sizeof(timezone)) Serial.printf("    Timezone string cut short: %s\n", timezone);
                   setenv("TZ", timezone, 1);  //  Now adjust the TZ.  Clock settings are adjusted to show the new local time
                   Serial.printf("    Setting timezone to %s and timezone name to %s\n", timezone, timezoneName);
                   tzset();
+                  if (!timeZone.set(timezone)) {
+                    Serial.printf("    Timezone %s not understood, calendar times stay on the previous zone\n", timezone);
+                  }
                 } else {
                   // invalid timezone do nothing
                   Serial.println(F("Unable to load timezone"));
@@ -155,6 +328,17 @@ bool TimeClient::lookupTimezone(const char *latitude, const char *longitude) {
   return lookupSuccess;
 }
 
+void TimeClient::restoreTimezone(const char *posix, const char *name) {
+  strlcpy(timezone, posix, sizeof(timezone));
+  strlcpy(timezoneName, name, sizeof(timezoneName));
+  setenv("TZ", timezone, 1);
+  tzset();
+  if (!timeZone.set(timezone)) {
+    Serial.printf("    Timezone %s not understood, calendar times stay on the previous zone\n", timezone);
+  }
+  Serial.printf("    Restored timezone %s (%s)\n", timezone, timezoneName);
+}
+
 void TimeClient::refresh() {
   struct tm timeinfo;
   getLocalTime(&timeinfo);
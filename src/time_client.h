@@ -4,12 +4,29 @@
 #define TIME_CLIENT_H
 
 #include <HTTPClient.h>
+#include <atomic>
+#include "time_discipline.h"
+
+// The PCF85063 keeps the time between NTP syncs; the system clock runs from
+// the internal RC oscillator and is steered back to the RTC, less the offset
+// TimeDiscipline predicts for it, every so often.
+#define TIME_RTC_REWRITE_S      0.1              // rewrite an RTC further off than this
+#define TIME_SLEW_MAX_S         0.5              // smaller steers slew, larger ones step
+#define TIME_NTP_TIMEOUT_MS     5000
 
 class TimeClient {
   public:
     TimeClient();
+    // Syncs with NTP when the time discipline says the clock needs it.
     void begin();
+    // Boot: sets an unset system clock from the RTC and picks up its offset
+    // register.
+    void restoreFromRtc();
+    // Steers the system clock to the RTC less its predicted offset.
+    void steerFromRtc();
     bool lookupTimezone(const char *latitude, const char *longitude);
+    // Applies a timezone remembered for this network instead of looking it up.
+    void restoreTimezone(const char *posix, const char *name);
     const char *getTimezone() { return timezone; }
     const char *getTimezoneName() { return timezoneName; }
     void refresh();
@@ -19,9 +36,13 @@ class TimeClient {
     const char *getDayOfWeek() { return date_day_of_week; }
     const char *getDayOfMonth() { return date_day_of_month; }
     const char *getYear() { return date_year; }
+    void logStats();
  
   private:
-    void syncWithNTP();
+    bool syncWithNTP(bool otherServerFirst = false);
+    bool measureRtc(double &offset, time_t &at, uint32_t waitMs = 0);
+    void rewriteRtc(time_t now, double before);
+    void stepClock(double seconds);
     char *readResponseToPsram(HTTPClient &http, size_t maxSize = 4096); 
 
     char time_min[3] = { 0 };
@@ -30,9 +51,19 @@ class TimeClient {
     char date_day_of_week[4] = { 0 };
     char date_day_of_month[7] = { 0 };
     char date_year[5] = { 0 };
-    char timezone[10] = { 0 };
+    char timezone[48] = { 0 };             // POSIX TZ with its DST rules
     char timezoneName[30] = { 0 };
 
+    TimeDiscipline discipline;
+    std::atomic_flag rtcBusy = ATOMIC_FLAG_INIT;   // an NTP sync or a steer owns both clocks
+    uint32_t ntpSyncs = 0;
+    uint32_t ntpSkipped = 0;                       // connects that did not need NTP
+    uint32_t ntpFailed = 0;
+    uint32_t ntpRejected = 0;
+    uint32_t rtcWrites = 0;
+    uint32_t steers = 0;
+    int32_t lastSteerMs = 0;
+    uint32_t edgePollMs = 0;                       // spent polling for the RTC's edge when steering
 
   const char *isrgRootCACert = R"string_literal(
 -----BEGIN CERTIFICATE-----
@@ -0,0 +1,200 @@
+#include "time_discipline.h"
+#include <math.h>
+
+void TimeDiscipline::begin(int8_t steps, double ppmPerStep) {
+  ppmStep = ppmPerStep;
+  programmed = steps;
+  rawPpm = -steps * ppmStep;
+  sigma = steps ? TIME_DRIFT_KEPT_PPM : TIME_DRIFT_PRIOR_PPM;
+}
+
+// Back to "the register cancels the drift, to the crystal's tolerance".
+void TimeDiscipline::resetFit() {
+  pointCount = 0;
+  rawPpm = -programmed * ppmStep;
+  sigma = TIME_DRIFT_PRIOR_PPM;
+}
+
+// How far a sample may land from a prediction made `elapsed` seconds earlier,
+// allowing `sigmas` of the drift's uncertainty.
+double TimeDiscipline::gate(double elapsed, double sigmas) const {
+  return 3 * TIME_NTP_JITTER_S + sigmas * sigma * 1e-6 * elapsed;
+}
+
+// Accounts for the register's correction up to `now`.
+void TimeDiscipline::advance(time_t now) {
+  if (adjustedTo && now > adjustedTo) adjust -= programmed * ppmStep * 1e-6 * (double)(now - adjustedTo);
+  adjustedTo = now;
+}
+
+TimeDiscipline::Verdict TimeDiscipline::addSample(time_t now, double offset) {
+  advance(now);
+  Verdict verdict = ACCEPTED;
+  if (!based) {
+    verdict = FIRST;
+  } else {
+    double deviation = fabs(offset - predictedOffset(now));
+    double elapsed = (double)(now - base);
+    if (deviation > fmin(gate(elapsed, 1), TIME_MAX_ERROR_S / 2)) {
+      double fromSuspect = suspectOffset + residualPpm() * 1e-6 * (double)(now - suspectTime);
+      if (!suspect || fabs(offset - fromSuspect) > gate((double)(now - suspectTime), 3)) {
+        suspect = true;
+        suspectTime = now;
+        suspectOffset = offset;
+        return REJECTED;
+      }
+      // Two samples agree.  Far enough out, the RTC was moved or the fit was
+      // wrong; either way the old phases no longer apply.
+      if (deviation > gate(elapsed, 3)) {
+        resetFit();
+        verdict = STEPPED;
+      }
+    }
+  }
+
+  suspect = false;
+  based = true;
+  base = now;
+  baseOffset = offset;
+  if (pointCount && now - points[0].t > TIME_DRIFT_WINDOW_S) {
+    uint8_t keep = 0;
+    for (uint8_t i = 0; i < pointCount; i++) {
+      if (now - points[i].t <= TIME_DRIFT_WINDOW_S) points[keep++] = points[i];
+    }
+    pointCount = keep;
+  }
+  if (pointCount == TIME_DRIFT_POINTS) {
+    memmove(&points[0], &points[1], (TIME_DRIFT_POINTS - 1) * sizeof(Point));
+    pointCount--;
+  }
+  points[pointCount++] = { now, offset + adjust };
+  fit();
+  return verdict;
+}
+
+void TimeDiscipline::rewritten(time_t now, double before, double after) {
+  advance(now);
+  adjust += before - after;
+  based = true;
+  base = now;
+  baseOffset = after;
+}
+
+void TimeDiscipline::setSteps(time_t now, int8_t steps) {
+  advance(now);
+  programmed = steps;
+}
+
+// Least squares through the phases.  A sample is good to the NTP jitter even
+// when the points happen to line up better than that.  Two points would let
+// one bad sample that slipped through the early, wide gate set the slope on
+// its own; from three its residual shows in the error.
+void TimeDiscipline::fit() {
+  if (pointCount < 3 || points[pointCount - 1].t - points[0].t < TIME_DRIFT_MIN_SPAN_S) return;
+  double tMean = 0, pMean = 0;
+  for (uint8_t i = 0; i < pointCount; i++) {
+    tMean += (double)(points[i].t - points[0].t);
+    pMean += points[i].phase;
+  }
+  tMean /= pointCount;
+  pMean /= pointCount;
+
+  double stt = 0, stp = 0;
+  for (uint8_t i = 0; i < pointCount; i++) {
+    double dt = (double)(points[i].t - points[0].t) - tMean;
+    stt += dt * dt;
+    stp += dt * (points[i].phase - pMean);
+  }
+  double slope = stp / stt;
+
+  double squares = 0;
+  for (uint8_t i = 0; i < pointCount; i++) {
+    double dt = (double)(points[i].t - points[0].t) - tMean;
+    double residual = points[i].phase - (pMean + slope * dt);
+    squares += residual * residual;
+  }
+  double variance = fmax(TIME_NTP_JITTER_S * TIME_NTP_JITTER_S, squares / (pointCount - 2));
+  double error = sqrt(variance / stt) * 1e6;
+  rawPpm = slope * 1e6;
+  sigma = sqrt(error * error + TIME_DRIFT_FLOOR_PPM * TIME_DRIFT_FLOOR_PPM);
+}
+
+int8_t TimeDiscipline::targetSteps() const {
+  if (sigma > ppmStep / 2) return programmed;
+  double ideal = -rawPpm / ppmStep;
+  if (fabs(ideal - programmed) < 0.75) return programmed;
+  return (int8_t)constrain(lround(ideal), -64L, 63L);    // a 7-bit register
+}
+
+double TimeDiscipline::predictedOffset(time_t now) const {
+  if (!based) return 0;
+  return baseOffset + residualPpm() * 1e-6 * (double)(now - base);
+}
+
+double TimeDiscipline::uncertainty(time_t now) const {
+  if (!based) return INFINITY;
+  return TIME_NTP_JITTER_S + 2 * sigma * 1e-6 * (double)(now - base) +
+         fabs(systemError(now)) + systemSpread(now);
+}
+
+uint32_t TimeDiscipline::nextSyncDelay() const {
+  double seconds = (TIME_MAX_ERROR_S - TIME_NTP_JITTER_S - TIME_STEER_ERROR_S) / (2 * sigma * 1e-6);
+  return (uint32_t)constrain(seconds, (double)TIME_SYNC_MIN_S, (double)TIME_SYNC_MAX_S);
+}
+
+void TimeDiscipline::steered(time_t now, double error) {
+  if (lastSteer && now > lastSteer) {
+    rates[rateHead] = (float)((error + compensated) / (double)(now - lastSteer) * 1e6);
+    rateHead = (rateHead + 1) % TIME_STEER_HISTORY;
+    if (rateCount < TIME_STEER_HISTORY) rateCount++;
+  }
+  lastSteer = now;
+  compensated = 0;
+}
+
+void TimeDiscipline::clockSet(time_t now) {
+  lastSteer = now;
+  compensated = 0;
+}
+
+// The mean of the recent rates; they swing between the RC oscillator's asleep
+// and the crystal's awake with how much of each interval the screen was on.
+double TimeDiscipline::systemPpm() const {
+  double sum = 0;
+  for (uint8_t i = 0; i < rateCount; i++) sum += rates[i];
+  return rateCount ? sum / rateCount : 0;
+}
+
+double TimeDiscipline::systemError(time_t now) const {
+  return lastSteer ? systemPpm() * 1e-6 * (double)(now - lastSteer) - compensated : 0;
+}
+
+double TimeDiscipline::systemSpread(time_t now) const {
+  double spread = TIME_SYSTEM_PRIOR_PPM;
+  if (rateCount >= 2) {
+    double mean = systemPpm();
+    spread = TIME_SYSTEM_FLOOR_PPM;
+    for (uint8_t i = 0; i < rateCount; i++) spread = fmax(spread, fabs(rates[i] - mean));
+  }
+  return lastSteer ? spread * 1e-6 * (double)(now - lastSteer) : 0;
+}
+
+bool TimeDiscipline::steerDue(time_t now) const {
+  if (!lastSteer) return true;
+  return fabs(systemError(now)) + systemSpread(now) >= TIME_STEER_ERROR_S || now - lastSteer >= TIME_STEER_MAX_S;
+}
+
+double TimeDiscipline::compensate(time_t now) {
+  double error = systemError(now);
+  compensated += error;
+  return -error;
+}
+
+double TimeDiscipline::untilEdge(double clock) const {
+  time_t now = (time_t)clock;
+  double margin = systemSpread(now) + TIME_EDGE_MARGIN_S;
+  if (!based || !lastSteer || margin >= 0.5) return 0;
+  double rtc = clock + predictedOffset(now) - systemError(now);
+  double wait = ceil(rtc) - rtc - margin;
+  return wait < 0 ? wait + 1 : wait;
+}
@@ -0,0 +1,144 @@
+#pragma once
+
+#ifndef TIME_DISCIPLINE_H
+#define TIME_DISCIPLINE_H
+
+#include <Arduino.h>
+#include <time.h>
+
+// How far the PCF85063 is from true time, and when NTP next needs asking.
+//
+// Each NTP sync measures the RTC's offset (RTC minus NTP, seconds).  The
+// offsets are turned into the crystal's raw phase by adding back what the
+// offset register took out and what rewriting the RTC moved, and a line
+// through the last few raw phases gives the crystal's drift in ppm and how
+// sure that is.  The register is then set to cancel the drift, and between
+// syncs the system clock is steered to the RTC less the offset the model
+// predicts, so what is left is the uncertainty of the fit.  NTP is due when
+// that could have grown past TIME_MAX_ERROR_S.
+//
+// A sample further from the prediction than the fit's one-sigma band, or
+// than half of TIME_MAX_ERROR_S while the band is wider than that, is held
+// back: NTP over WiFi now and then answers from the wrong server or with a
+// stale packet, and a second opinion is due straight away.  A second sample
+// that agrees with the held one is taken; past three sigma that means the
+// RTC really moved, and the fit starts over.
+//
+// The system clock is steered to the RTC, and between steers it drifts at
+// its own rate: the internal RC oscillator's while asleep, a few hundred ppm.
+// Each steer measures that rate.  In between, the clock is slewed by the mean
+// of the recent rates every minute, which costs no I2C, and the next steer
+// is due when the spread of those rates could have carried it
+// TIME_STEER_ERROR_S away; the RTC's edge is then only polled for around
+// where the model puts it.  TIME_MAX_ERROR_S is shared out: the NTP sample's
+// jitter, the steering allowance, and what is left for the fit's 2-sigma
+// drift (its floor included) to grow into before NTP is asked again.
+#define TIME_MAX_ERROR_S        0.5              // displayed seconds should be right
+#define TIME_NTP_JITTER_S       0.05             // one SNTP sample over WiFi
+#define TIME_DRIFT_PRIOR_PPM    20.0             // crystal tolerance, before any fit
+#define TIME_DRIFT_KEPT_PPM     3.0              // an offset register found set at boot
+#define TIME_DRIFT_FLOOR_PPM    1.0              // temperature wander no fit removes
+#define TIME_DRIFT_MIN_SPAN_S   (30 * 60)        // shorter baselines do not fit a drift
+#define TIME_DRIFT_WINDOW_S     (7 * 24 * 60 * 60)
+#define TIME_DRIFT_POINTS       8
+#define TIME_SYNC_MIN_S         (60 * 60)
+#define TIME_SYNC_MAX_S         (3 * 24 * 60 * 60)
+#define TIME_STEER_ERROR_S      0.15             // system clock drift allowed between steers
+#define TIME_SYSTEM_PRIOR_PPM   500.0            // the RC oscillator before a steer has measured it
+#define TIME_SYSTEM_FLOOR_PPM   20.0             // rates never read as steadier than this
+#define TIME_STEER_MAX_S        (6 * 60 * 60)
+#define TIME_STEER_HISTORY      8
+#define TIME_EDGE_MARGIN_S      0.02             // polling starts this far ahead of the predicted edge
+
+class TimeDiscipline {
+  public:
+    enum Verdict : uint8_t { FIRST, ACCEPTED, REJECTED, STEPPED };
+
+    // `steps`: the offset register as found at boot.  It is assumed to be a
+    // correction made earlier, so the prior drift cancels it.
+    void begin(int8_t steps, double ppmPerStep);
+
+    // `offset`: RTC minus NTP time, seconds, measured at `now`.
+    Verdict addSample(time_t now, double offset);
+    // The RTC was rewritten at `now`: it was `before` ahead and is `after`.
+    void rewritten(time_t now, double before, double after);
+    // The offset register was changed at `now`.
+    void setSteps(time_t now, int8_t steps);
+
+    // Register value that cancels the fitted drift; the current one until
+    // the fit is good to half a step.
+    int8_t targetSteps() const;
+    int8_t steps() const { return programmed; }
+
+    bool hasFix() const { return based; }
+    // RTC minus true time expected at `now`, and how far off that may be.
+    double predictedOffset(time_t now) const;
+    double uncertainty(time_t now) const;
+    bool syncDue(time_t now) const { return !based || suspect || now >= base + (time_t)nextSyncDelay(); }
+    // The last sample was held back and wants a second opinion.
+    bool awaitingConfirmation() const { return suspect; }
+    // Seconds after the last accepted sample that NTP is due.
+    uint32_t nextSyncDelay() const;
+    time_t lastSample() const { return base; }
+
+    // The system clock was `error` seconds ahead of the predicted true time
+    // at `now`, and has been steered back.
+    void steered(time_t now, double error);
+    // The system clock was set to true time some other way (NTP).
+    void clockSet(time_t now);
+    bool steerDue(time_t now) const;
+    // Seconds to slew the system clock by at `now` for the drift expected
+    // since the last steer; counted as done.
+    double compensate(time_t now);
+    // Seconds from system time `clock` until it is worth polling for the
+    // RTC's next second; 0 when the edge could be anywhere.
+    double untilEdge(double clock) const;
+    // System clock minus true time expected at `now`, net of compensate(),
+    // and how far from that it may be.
+    double systemError(time_t now) const;
+    double systemSpread(time_t now) const;
+
+    double driftPpm() const { return rawPpm; }        // the crystal, without correction
+    double residualPpm() const { return rawPpm + programmed * ppmStep; }
+    double sigmaPpm() const { return sigma; }
+    double systemPpm() const;
+
+  private:
+    struct Point {
+      time_t t;
+      double phase;
+    };
+
+    void advance(time_t now);
+    void fit();
+    void resetFit();
+    double gate(double elapsed, double sigmas) const;
+
+    Point points[TIME_DRIFT_POINTS] = {};
+    uint8_t pointCount = 0;
+
+    double ppmStep = 1.0;
+    int8_t programmed = 0;
+    double rawPpm = 0;
+    double sigma = TIME_DRIFT_PRIOR_PPM;
+
+    // phase = offset + adjust; adjust grows by what the register removes.
+    double adjust = 0;
+    time_t adjustedTo = 0;
+
+    bool based = false;                // base/baseOffset hold a measurement
+    time_t base = 0;
+    double baseOffset = 0;
+
+    bool suspect = false;              // a rejected sample waiting for a second opinion
+    time_t suspectTime = 0;
+    double suspectOffset = 0;
+
+    float rates[TIME_STEER_HISTORY] = {};   // system clock rate over each recent steer, ppm
+    uint8_t rateCount = 0;
+    uint8_t rateHead = 0;
+    time_t lastSteer = 0;
+    double compensated = 0;            // slewed since lastSteer
+};
+
+#endif /* time_discipline.h */
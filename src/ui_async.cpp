@@ -0,0 +1,69 @@
+#include "ui_async.h"
+#include "src/eez-flow.h"
+
+static void runPushScreen(ScreenOperation *op) {
+  eez_flow_push_screen(op->screenId, op->animType, op->time, op->delay);
+}
+
+static void runPopScreen(ScreenOperation *op) {
+  eez_flow_pop_screen(op->animType, op->time, op->delay);
+}
+
+bool UiAsync::begin() {
+  if (!pool.begin()) {
+    Serial.println(">> FATAL: Failed to allocate UI async pool!");
+    return false;
+  }
+  // Holds at most one entry per pool slot, so a send can never fail.
+  queue = xQueueCreateStatic(UI_ASYNC_POOL_SIZE, sizeof(Pending *), (uint8_t *)queueStorage, &queueStruct);
+  return queue != nullptr;
+}
+
+bool UiAsync::post(ScreenOperationFunc fn, const ScreenOperation &op) {
+  Pending *pending = queue ? pool.acquire() : nullptr;
+  if (!pending) {
+    Serial.println(">> ERROR: UI async pool exhausted, screen operation dropped");
+    return false;
+  }
+  pending->fn = fn;
+  pending->op = op;
+  xQueueSend(queue, &pending, 0);
+  return true;
+}
+
+bool UiAsync::pushScreen(uint8_t screenId, lv_scr_load_anim_t animType, uint16_t time, uint16_t delay) {
+  ScreenOperation op = {};
+  op.screenId = screenId;
+  op.animType = animType;
+  op.time = time;
+  op.delay = delay;
+  op.isPush = true;
+  return post(runPushScreen, op);
+}
+
+bool UiAsync::popScreen(lv_scr_load_anim_t animType, uint16_t time, uint16_t delay) {
+  ScreenOperation op = {};
+  op.animType = animType;
+  op.time = time;
+  op.delay = delay;
+  return post(runPopScreen, op);
+}
+
+void UiAsync::run() {
+  if (!queue) return;
+  // Only what was posted so far: an operation that posts another one
+  // leaves it for the next pass, as lv_async_call() did.
+  UBaseType_t count = uxQueueMessagesWaiting(queue);
+  Pending *pending;
+  while (count-- && xQueueReceive(queue, &pending, 0) == pdTRUE) {
+    pending->fn(&pending->op);
+    pool.release(pending);
+    ran++;
+  }
+}
+
+void UiAsync::logStats() {
+  Serial.printf("[UiAsync] ran=%lu\n", (unsigned long)ran);
+  pool.logStats("screen-ops");
+  ran = 0;
+}
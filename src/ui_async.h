@@ -0,0 +1,58 @@
+#pragma once
+
+#ifndef UI_ASYNC_H
+#define UI_ASYNC_H
+
+#include <Arduino.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+#include "lvgl.h"
+#include "object_pool.h"
+
+#define UI_ASYNC_POOL_SIZE  16
+
+// Deferred screen push/pop, run on the UI task right before the next
+// Lvgl_Loop().  Replaces lv_async_call() with an lv_mem_alloc'd operation,
+// which cost two LVGL heap allocations (operation + timer) per navigation and
+// fragmented the LVGL PSRAM heap under notification bursts.  Operations come
+// from a fixed pool and run in the order they were posted.
+struct ScreenOperation {
+  uint8_t screenId;
+  lv_scr_load_anim_t animType;
+  uint16_t time;
+  uint16_t delay;
+  bool isPush;  // true = push, false = pop
+  bool isQuickNotificationOp;
+  uint32_t quickNotificationGeneration;
+};
+
+typedef void (*ScreenOperationFunc)(ScreenOperation *op);
+
+class UiAsync {
+  public:
+    bool begin();
+
+    // False (and nothing runs) when the pool is exhausted.
+    bool post(ScreenOperationFunc fn, const ScreenOperation &op);
+    bool pushScreen(uint8_t screenId, lv_scr_load_anim_t animType, uint16_t time, uint16_t delay);
+    bool popScreen(lv_scr_load_anim_t animType, uint16_t time, uint16_t delay);
+
+    // UI task only.
+    void run();
+
+    void logStats();
+
+  private:
+    struct Pending {
+      ScreenOperationFunc fn;
+      ScreenOperation op;
+    };
+
+    ObjectPool<Pending, UI_ASYNC_POOL_SIZE> pool;
+    QueueHandle_t queue = nullptr;           // Pending *, in post order
+    StaticQueue_t queueStruct;
+    Pending *queueStorage[UI_ASYNC_POOL_SIZE];
+    uint32_t ran = 0;
+};
+
+#endif /* ui_async.h */
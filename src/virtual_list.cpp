@@ -0,0 +1,123 @@
+#include "virtual_list.h"
+
+bool VirtualList::attach(lv_obj_t *parent, lv_coord_t height, lv_coord_t gap,
+                         lv_style_t *rowStyle, CreateFn create, BindFn bind, void *ctx) {
+  if (!parent || height <= 0) return false;
+  if (container == parent) return true;
+
+  container = parent;
+  rowHeight = height;
+  pitch = height + gap;
+  bindFn = bind;
+  bindCtx = ctx;
+  items = 0;
+
+  lv_obj_clean(container);
+  lv_obj_set_style_layout(container, 0, LV_PART_MAIN);
+
+  // Only its extent matters: it is what LVGL measures for the scroll range.
+  spacer = lv_obj_create(container);
+  lv_obj_remove_style_all(spacer);
+  lv_obj_clear_flag(spacer, LV_OBJ_FLAG_CLICKABLE);
+  lv_obj_add_flag(spacer, LV_OBJ_FLAG_EVENT_BUBBLE);
+  lv_obj_set_pos(spacer, 0, 0);
+  lv_obj_set_size(spacer, 1, 0);
+
+  lv_obj_update_layout(container);
+  lv_coord_t viewport = lv_obj_get_content_height(container);
+  rowCount = (viewport + pitch - 1) / pitch + 2;
+  if (rowCount > VIRTUAL_LIST_MAX_ROWS) rowCount = VIRTUAL_LIST_MAX_ROWS;
+
+  for (uint8_t i = 0; i < rowCount; i++) {
+    lv_obj_t *row = lv_obj_create(container);
+    lv_obj_remove_style_all(row);
+    if (rowStyle) lv_obj_add_style(row, rowStyle, LV_PART_MAIN);
+    lv_obj_set_height(row, rowHeight);
+    lv_obj_add_flag(row, LV_OBJ_FLAG_HIDDEN);
+    if (create) create(row, ctx);
+    rows[i] = row;
+    bound[i] = -1;
+  }
+
+  lv_obj_add_event_cb(container, scrollCb, LV_EVENT_SCROLL, this);
+  lv_obj_add_event_cb(container, deleteCb, LV_EVENT_DELETE, this);
+  return true;
+}
+
+void VirtualList::setCount(uint32_t count) {
+  if (!container) return;
+  items = count;
+  lv_obj_set_height(spacer, count ? offsetOf(count - 1) + rowHeight : 0);
+  lv_obj_update_layout(container);
+  // The scroll event would bind rows that are about to be rebound anyway.
+  rebinding = true;
+  lv_obj_scroll_to_y(container, 0, LV_ANIM_OFF);
+  rebinding = false;
+  update(true);
+}
+
+void VirtualList::refresh() {
+  if (container) update(true);
+}
+
+void VirtualList::scrollToView(uint32_t index, lv_anim_enable_t anim) {
+  if (!container || index >= items) return;
+  lv_coord_t viewport = lv_obj_get_content_height(container);
+  lv_coord_t scroll = lv_obj_get_scroll_y(container);
+  lv_coord_t top = offsetOf(index);
+  lv_coord_t bottom = top + rowHeight;
+
+  if (top < scroll) lv_obj_scroll_to_y(container, top, anim);
+  else if (bottom > scroll + viewport) lv_obj_scroll_to_y(container, bottom - viewport, anim);
+}
+
+lv_coord_t VirtualList::offsetOf(uint32_t index) const {
+  int64_t y = (int64_t)index * pitch;
+  return y < LV_COORD_MAX - rowHeight ? (lv_coord_t)y : LV_COORD_MAX - rowHeight;
+}
+
+uint32_t VirtualList::takeBinds() {
+  uint32_t taken = binds;
+  binds = 0;
+  return taken;
+}
+
+// Item k always lives in row k % rowCount, so a scroll by one row rebinds
+// one row and leaves the rest alone.
+void VirtualList::update(bool force) {
+  lv_coord_t scroll = lv_obj_get_scroll_y(container);
+  uint32_t first = scroll > 0 ? scroll / pitch : 0;
+
+  for (uint32_t index = first; index < first + rowCount; index++) {
+    uint8_t slot = index % rowCount;
+    lv_obj_t *row = rows[slot];
+    if (index >= items) {
+      if (bound[slot] != -1) {
+        lv_obj_add_flag(row, LV_OBJ_FLAG_HIDDEN);
+        bound[slot] = -1;
+      }
+      continue;
+    }
+    if (!force && bound[slot] == (int32_t)index) continue;
+
+    lv_obj_set_y(row, offsetOf(index));
+    if (bindFn) bindFn(row, index, bindCtx);
+    if (bound[slot] == -1) lv_obj_clear_flag(row, LV_OBJ_FLAG_HIDDEN);
+    bound[slot] = index;
+    binds++;
+  }
+}
+
+void VirtualList::scrollCb(lv_event_t *e) {
+  VirtualList *list = (VirtualList *)lv_event_get_user_data(e);
+  if (list->container && !list->rebinding) list->update(false);
+}
+
+// The rows go with the container; forget them so attach() starts over.
+void VirtualList::deleteCb(lv_event_t *e) {
+  VirtualList *list = (VirtualList *)lv_event_get_user_data(e);
+  list->container = nullptr;
+  list->spacer = nullptr;
+  list->rowCount = 0;
+  list->items = 0;
+}
@@ -0,0 +1,68 @@
+#pragma once
+
+#ifndef VIRTUAL_LIST_H
+#define VIRTUAL_LIST_H
+
+#include <Arduino.h>
+#include <lvgl.h>
+
+// Scrolling list of fixed-height rows that only ever creates enough row
+// objects to cover the viewport (plus one above and below).  Rows sit at
+// absolute positions; a transparent spacer child gives the container its
+// full scroll height, and on every scroll the rows that moved out of view are
+// rebound to the items moving in.  Binding is the caller's: create() builds a
+// row's children once, bind() fills them for an item.
+//
+// The container's flex layout is switched off while attached.  The list
+// follows the container's LV_EVENT_DELETE, so a screen that is freed and
+// rebuilt just needs attach() again.
+//
+// Row offsets and the spacer height run to count * pitch, past the 8191 px
+// LV_COORD_MAX of 16-bit coordinates after about 160 calendar rows, so
+// lv_conf.h sets LV_USE_LARGE_COORD.  Offsets are still clamped to
+// LV_COORD_MAX rather than left to wrap.
+#define VIRTUAL_LIST_MAX_ROWS   16
+
+class VirtualList {
+  public:
+    typedef void (*CreateFn)(lv_obj_t *row, void *ctx);
+    typedef void (*BindFn)(lv_obj_t *row, uint32_t index, void *ctx);
+
+    // Builds the row pool in `container`.  `rowStyle` is added to every row.
+    bool attach(lv_obj_t *container, lv_coord_t rowHeight, lv_coord_t gap,
+                lv_style_t *rowStyle, CreateFn create, BindFn bind, void *ctx);
+    bool attachedTo(lv_obj_t *obj) const { return obj && container == obj; }
+
+    // New item count: scrolls to the top and rebinds the visible rows.
+    void setCount(uint32_t count);
+    // Rebinds the visible rows in place (items changed, count did not).
+    void refresh();
+    // Scrolls the least distance that brings item `index` fully into view.
+    void scrollToView(uint32_t index, lv_anim_enable_t anim);
+
+    uint32_t count() const { return items; }
+    uint8_t poolSize() const { return rowCount; }
+    // Row binds since the last call, for the stats line.
+    uint32_t takeBinds();
+
+  private:
+    static void scrollCb(lv_event_t *e);
+    static void deleteCb(lv_event_t *e);
+    void update(bool force);
+    lv_coord_t offsetOf(uint32_t index) const;
+
+    lv_obj_t *container = nullptr;
+    lv_obj_t *spacer = nullptr;
+    lv_obj_t *rows[VIRTUAL_LIST_MAX_ROWS] = {};
+    int32_t bound[VIRTUAL_LIST_MAX_ROWS] = {};    // item shown by each row, -1: none
+    uint8_t rowCount = 0;
+    lv_coord_t pitch = 0;                         // row height + gap
+    lv_coord_t rowHeight = 0;
+    uint32_t items = 0;
+    BindFn bindFn = nullptr;
+    void *bindCtx = nullptr;
+    uint32_t binds = 0;
+    bool rebinding = false;
+};
+
+#endif /* virtual_list.h */
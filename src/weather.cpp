@@ -19,11 +19,15 @@
 #include "geolocation.h"
 #include "time_client.h"
 #include "psram_alloc.h"
+#include "civil_time.h"
+#include "BAT_Driver.h"
+#include <esp_timer.h>
 
 extern Weather weather;
 extern WeatherLocations weatherLocations;
 extern GeoLocation ipLocation;
 extern TimeClient timeClient;
+extern TimeZone timeZone;
 
 // External spinner control functions from main .ino file
 extern void hideStartupSpinner();
@@ -77,7 +81,7 @@ void set_var_weather_city(const char *value) {
 // Fetches data and stores in pendingData struct, does NOT touch LVGL
 // Thread-safe: Returns immediately if another call is already in progress
 // ============================================================================
-void Weather::loadWeather() {
+void Weather::loadWeather(bool sessionRecorded) {
   // Try to acquire the lock - if already locked, return immediately
   if (loadInProgress.test_and_set(std::memory_order_acquire)) {
     // Another thread is already loading weather, skip this call
@@ -92,22 +96,20 @@ void Weather::loadWeather() {
     }
   } clearer{ loadInProgress };
 
-  static unsigned long lastWeatherUpdate = 0;
-  static long now = 0;
+  unsigned long now = millis();
 
-  now = millis();
-
-  // reload the weather every 10 minutes or anytime weatherNeedsReload is true
-  if (weatherNeedsReload || now - lastWeatherUpdate > 10 * 60 * 1000) {
+  // reload the weather when the refresh policy says so or anytime weatherNeedsReload is true
+  if (refreshDue(now)) {
     try {
       WeatherLocation weatherLocation = weatherLocations.getSelection();
+      uint8_t locationIndex = weatherLocations.getSelectedIndex();
 
       // Validate geolocation before proceeding - empty coordinates would cause API errors
       const char *lat;
       const char *lon;
 
       // we don't store the lat and long for the ip location because it changes
-      if(weatherLocations.getSelectedIndex() == 0) {
+      if(locationIndex == 0) {
         lat = ipLocation.getLatitude();
         lon = ipLocation.getLongitude();
       } else {
@@ -118,7 +120,20 @@ void Weather::loadWeather() {
       if (!lat || !lon || lat[0] == '\0' || lon[0] == '\0') {
         Serial.println(F(">> ERROR: Invalid weather location - cannot load weather"));
         Serial.printf(">> lat='%s' lon='%s'\n", lat ? lat : "(null)", lon ? lon : "(null)");
-        // Don't update lastWeatherUpdate so we retry on next cycle
+        // Don't reschedule so we retry on next cycle
+        return;
+      }
+
+      // A forecast for this place fetched within the minimum interval (just
+      // before a reboot, say) is still current.
+      time_t wallNow = time(nullptr);
+      int64_t age = cache.age(wallNow);
+      if (cache.matches(locationIndex, lat, lon) && age < WEATHER_REFRESH_MIN_S) {
+        publish(cache.record, wallNow);
+        weatherNeedsReload = false;
+        cacheSkips++;
+        scheduleRefresh(now, wallNow, age);
+        Serial.printf(">> Cached forecast is %lds old - skipping fetch\n", (long)age);
         return;
       }
 
@@ -130,105 +145,170 @@ void Weather::loadWeather() {
       // (~16KB) are allocated by mbedTLS via C malloc() and land on internal heap.
       // This is the unavoidable floor of internal heap usage during a weather fetch.
 
-      // Track whether at least one load succeeded
-      bool loadedSomething = false;
-
-      Serial.println(F("Loading current and hourly weather..."));
-      if (loadCurrentAndHourly(client, lat, lon)) {
-        loadedSomething = true;
-      } else {
-        Serial.println(F(">> WARNING: Current/hourly weather load failed"));
-      }
-      
-      Serial.println(F("Done loading hourly. Loading daily weather..."));
-      if (loadDaily(client, lat, lon)) {
-        loadedSomething = true;
-      } else {
-        Serial.println(F(">> WARNING: Daily weather load failed"));
-      }
-      
-      Serial.println(F("... end loading daily weather"));
+      Serial.println(F("Loading weather forecast..."));
+      bool loaded = loadForecast(client, lat, lon);
       delete client;
-      
-      // CRITICAL FIX: Only update timestamp if at least one call succeeded
-      // This allows immediate retry on failure instead of waiting 10 minutes
-      if (loadedSomething) {
-        lastWeatherUpdate = now;
+
+      // CRITICAL FIX: Only reschedule if the call succeeded
+      // This allows immediate retry on failure instead of waiting for the next slot
+      if (loaded) {
+        cache.record.locationIndex = locationIndex;
+        strlcpy(cache.record.latitude, lat, sizeof(cache.record.latitude));
+        strlcpy(cache.record.longitude, lon, sizeof(cache.record.longitude));
+        if (!cache.save()) Serial.println(F(">> WARNING: Could not write the weather cache"));
+        wallNow = time(nullptr);
+        publish(cache.record, wallNow);
+        if (!sessionRecorded) refreshPolicy.recordFetch(wallNow);
+
         weatherNeedsReload = false;
-        newDataReady.store(true);
-        Serial.println(F(">> Weather data loaded successfully - next update in 10 minutes"));
+        scheduleRefresh(now, wallNow, 0);
+        Serial.printf(">> Weather data loaded successfully - next update in %lu min (%s)\n",
+                      (unsigned long)(refreshDelayMs / 60000),
+                      WeatherRefreshPolicy::reasonName(refreshPolicy.lastReason()));
       } else {
-        // Don't update lastWeatherUpdate - will retry on next check (30 seconds)
-        Serial.println(F(">> ERROR: All weather loads failed - will retry in 30 seconds"));
+        // Don't reschedule - will retry with the next connection
+        Serial.println(F(">> ERROR: Weather load failed - will retry with the next connection"));
         // Don't clear weatherNeedsReload either so retry happens
       }
     } catch (...) {
       Serial.println(">> EXCEPTION in loadWeather - will retry in 30 seconds");
-      // Don't update lastWeatherUpdate on exception - allow retry
+      // Don't reschedule on exception - allow retry
     }
   }
 }
 
+// ============================================================================
+// begin() - Called from setup() after the config is read
+// Shows the last forecast from the SD card until WiFi brings a new one.  A
+// clock that is not set yet cannot date the record, so it is not shown.
+// ============================================================================
+void Weather::begin() {
+  if (!cache.load()) return;
+  time_t now = time(nullptr);
+  int64_t age = cache.age(now);
+  uint8_t locationIndex = weatherLocations.getSelectedIndex();
+  WeatherLocation selection = weatherLocations.getSelection();
+  const char *lat = locationIndex == 0 ? nullptr : selection.getLatitude();
+  const char *lon = locationIndex == 0 ? nullptr : selection.getLongitude();
+
+  if (!cache.matches(locationIndex, lat, lon) || age > WEATHER_CACHE_MAX_AGE_S) {
+    Serial.println(F("Weather: cached forecast is for another place or too old"));
+    return;
+  }
+  publish(cache.record, now);
+  Serial.printf("Weather: showing cached forecast from %ld min ago\n", (long)(age / 60));
+}
+
+// ============================================================================
+// readForward() - Called from Background_Tasks
+// The hourly strip, today's row, the date and the current temperature are all
+// read from the cached forecast as of the time it is published.  Between
+// fetches, which can be hours apart at night, it is published again at each
+// local hour so none of them freeze.  Skipped while a fetch is in progress;
+// that publishes anyway.
+// ============================================================================
+void Weather::readForward() {
+  if (publishedHour < 0) return;
+  time_t now = time(nullptr);
+  if (localHour(now) == publishedHour) return;
+  if (loadInProgress.test_and_set(std::memory_order_acquire)) return;
+  publish(cache.record, now);
+  loadInProgress.clear(std::memory_order_release);
+}
+
+bool Weather::refreshDue(unsigned long now) {
+  return weatherNeedsReload || now - lastRefreshMs >= refreshDelayMs;
+}
+
+bool Weather::sessionAllowed() {
+  return refreshPolicy.budgetDelay(time(nullptr), BAT_Is_Charging(), BAT_Get_Charge_Percent()) == 0;
+}
+
+void Weather::recordSession() {
+  refreshPolicy.recordFetch(time(nullptr));
+}
+
+// `age`: how long ago, in seconds, the forecast in the cache was fetched.
+void Weather::scheduleRefresh(unsigned long now, time_t wallNow, int64_t age) {
+  struct tm local;
+  timeZone.toLocal(wallNow, local);
+  int64_t delay = refreshPolicy.nextDelay(&cache.record, wallNow, local.tm_hour, BAT_Is_Charging(),
+                                          BAT_Get_Charge_Percent());
+  delay = max(delay - age, (int64_t)WEATHER_REFRESH_MIN_S - age);
+  lastRefreshMs = now;
+  refreshDelayMs = delay * 1000;
+}
+
+void Weather::logStats() {
+  long dueIn = weatherNeedsReload ? 0 : (long)(refreshDelayMs - min(millis() - lastRefreshMs, (unsigned long)refreshDelayMs)) / 1000;
+  Serial.printf("[Weather] loads=%lu requests=%lu, per load %lu bytes %lums, cached skips=%lu, forecast age %lds, "
+                "next in %lds (%s)\n",
+                (unsigned long)loads, (unsigned long)fetches, (unsigned long)(loads ? fetchBytes / loads : 0),
+                (unsigned long)(loads ? fetchMs / loads : 0), (unsigned long)cacheSkips,
+                cache.valid ? (long)cache.age(time(nullptr)) : -1L, dueIn,
+                WeatherRefreshPolicy::reasonName(refreshPolicy.lastReason()));
+  Serial.printf("[Weather] applies=%lu vars/apply avg %lu last %u of %u, apply avg %luus max %luus, "
+                "intern hits=%lu misses=%lu\n",
+                (unsigned long)applies, (unsigned long)(applies ? ui.varsPushed / applies : 0), lastPushed,
+                WEATHER_UI_VARIABLES, (unsigned long)(applies ? applyUs / applies : 0), (unsigned long)maxApplyUs,
+                (unsigned long)ui.internHits, (unsigned long)ui.internMisses);
+}
+
+// The flow variables as eez values.  The pool's values live in PSRAM,
+// allocated on the first apply.
+class EezWeatherTarget : public WeatherUiTarget {
+  public:
+    void intern(uint8_t slot, const char *text) override {
+      if (!values) values = new eez::Value[WEATHER_INTERN_SLOTS]();
+      values[slot] = eez::StringValue(text);
+    }
+    void setInterned(uint32_t variable, uint8_t slot) override {
+      eez::flow::setGlobalVariable(variable, values[slot]);
+    }
+    void setString(uint32_t variable, const char *text) override {
+      eez::flow::setGlobalVariable(variable, eez::StringValue(text));
+    }
+    void setInt(uint32_t variable, int value) override {
+      eez::flow::setGlobalVariable(variable, eez::IntegerValue(value));
+    }
+
+  private:
+    eez::Value *values = nullptr;
+};
+
+static EezWeatherTarget uiTarget;
+
 // ============================================================================
 // applyToUI() - Called from Core 1 (main loop)
-// Applies pendingData to LVGL - safe because we're on the LVGL thread
+// Applies pendingData to LVGL - safe because we're on the LVGL thread.
+// WeatherUi pushes only the fields that differ from the last apply.
 // Hides startup spinner on first weather load completion
 // ============================================================================
 void Weather::applyToUI() {
-  if (!newDataReady.load()) {
-    return;  // No new data to apply
+  uint32_t version = pendingVersion.load(std::memory_order_acquire);
+  if (version == shownVersion || (version & 1)) {
+    return;  // No new data to apply, or Core 0 is mid-write
+  }
+  memcpy(&snapshot, &pendingData, sizeof(snapshot));
+  std::atomic_thread_fence(std::memory_order_acquire);
+  if (pendingVersion.load(std::memory_order_relaxed) != version) {
+    return;  // Torn copy - the next call gets the new version
   }
 
-  Serial.println(F(">> Applying weather data to UI..."));
-
-  // Current conditions
-  eez::flow::setGlobalVariable(FLOW_GLOBAL_VARIABLE_WEATHER_CURRENT_CONDITIONS,
-                               eez::StringValue(pendingData.currentConditions));
-  eez::flow::setGlobalVariable(FLOW_GLOBAL_VARIABLE_WEATHER_DATE,
-                               eez::StringValue(pendingData.weatherDate));
-  eez::flow::setGlobalVariable(FLOW_GLOBAL_VARIABLE_WEATHER_TEMPERATURE,
-                               eez::IntegerValue(pendingData.temperature));
-  eez::flow::setGlobalVariable(FLOW_GLOBAL_VARIABLE_WEATHER_WIND_SPEED,
-                               eez::StringValue(pendingData.windSpeed));
-  eez::flow::setGlobalVariable(FLOW_GLOBAL_VARIABLE_WEATHER_HUMIDITY_PERCENTAGE,
-                               eez::StringValue(pendingData.humidityPct));
-  eez::flow::setGlobalVariable(FLOW_GLOBAL_VARIABLE_WEATHER_MIN_MAX,
-                               eez::StringValue(pendingData.minMaxStr));
+  int64_t started = esp_timer_get_time();
+  lastPushed = ui.apply(snapshot, uiTarget);
 
   // Copy icons to class members (for getLargeIcon/getSmallIcon)
-  strncpy(weatherIconLarge, pendingData.iconLarge, sizeof(weatherIconLarge) - 1);
+  strncpy(weatherIconLarge, snapshot.iconLarge, sizeof(weatherIconLarge) - 1);
   weatherIconLarge[sizeof(weatherIconLarge) - 1] = '\0';
-  strncpy(weatherIconSmall, pendingData.iconSmall, sizeof(weatherIconSmall) - 1);
+  strncpy(weatherIconSmall, snapshot.iconSmall, sizeof(weatherIconSmall) - 1);
   weatherIconSmall[sizeof(weatherIconSmall) - 1] = '\0';
 
-  // Hourly forecast
-  for (int i = 0; i < 8; i++) {
-    eez::flow::setGlobalVariable(FLOW_GLOBAL_VARIABLE_HOUR_ICON_0 + i,
-                                 eez::StringValue(pendingData.hourly[i].icon));
-    eez::flow::setGlobalVariable(FLOW_GLOBAL_VARIABLE_HOUR_TEMP_0 + i,
-                                 eez::StringValue(pendingData.hourly[i].temp));
-
-    if (i > 0) {  // Skip first entry (NOW)
-      eez::flow::setGlobalVariable(FLOW_GLOBAL_VARIABLE_HOUR_LABEL_1 + (i - 1),
-                                   eez::IntegerValue(pendingData.hourly[i].hour));
-      eez::flow::setGlobalVariable(FLOW_GLOBAL_VARIABLE_HOUR_AMPM_1 + (i - 1),
-                                   eez::StringValue(pendingData.hourly[i].ampm));
-    }
-  }
-
-  // Daily forecast
-  for (int i = 0; i < 10; i++) {
-    eez::flow::setGlobalVariable(FLOW_GLOBAL_VARIABLE_DAY_FORECAST_0 + i,
-                                 eez::StringValue(pendingData.daily[i].dayName));
-    eez::flow::setGlobalVariable(FLOW_GLOBAL_VARIABLE_HIGH_TEMP_FORECAST_0 + i,
-                                 eez::StringValue(pendingData.daily[i].high));
-    eez::flow::setGlobalVariable(FLOW_GLOBAL_VARIABLE_LOW_TEMP_FORECAST_0 + i,
-                                 eez::StringValue(pendingData.daily[i].low));
-    eez::flow::setGlobalVariable(FLOW_GLOBAL_VARIABLE_ICON_FORECAST_0 + i,
-                                 eez::StringValue(pendingData.daily[i].icon));
-  }
-
-  newDataReady.store(false);
+  shownVersion = version;
+  uint32_t elapsed = (uint32_t)(esp_timer_get_time() - started);
+  applies++;
+  applyUs += elapsed;
+  if (elapsed > maxApplyUs) maxApplyUs = elapsed;
 
   // Hide startup spinner on first weather load completion
   if (!isFirstWeatherLoaded()) {
@@ -246,110 +326,75 @@ void Weather::applyToUI() {
     // Serial.flush();
   }
 
-  Serial.println(F(">> Weather UI updated"));
+  Serial.printf(">> Weather UI updated (%u variables, %luus)\n", lastPushed, (unsigned long)elapsed);
 }
 
 // ============================================================================
-// loadDaily() - Fetches daily forecast, stores in pendingData
-// Returns true on success, false on failure
+// loadForecast() - Fetches current, hourly and daily data in one request and
+// decodes it into cache.record.  Hours count from the current one, so the
+// record reads forward for a day; daily wind is the max for the day.
+//
+// Built with -DWEATHER_TWO_REQUESTS it makes the two requests this one
+// replaced instead (3 days of hourly data, then 10 days of daily data, no
+// daily wind), so the [Weather] fetch counters measure both.
 // ============================================================================
-bool Weather::loadDaily(NetworkClientSecure *client, const char *lat, const char *lon) {
-  HTTPClient https;
+bool Weather::loadForecast(NetworkClientSecure *client, const char *lat, const char *lon) {
+  char url[400] = { 0 };
+  JsonDocument doc(SpiRamAllocator::instance());
+#ifdef WEATHER_TWO_REQUESTS
+  snprintf(url, sizeof(url), "https://api.open-meteo.com/v1/forecast?latitude=%s&longitude=%s&daily=temperature_2m_max,temperature_2m_min,weather_code&hourly=temperature_2m,weather_code&current=temperature_2m,precipitation,weather_code&timezone=%s&forecast_days=3&wind_speed_unit=mph&temperature_unit=fahrenheit",
+           lat, lon, timeClient.getTimezoneName());
+  char *jsonBuffer = fetchJson(client, url, doc);
+  if (!jsonBuffer) return false;
 
-  Serial.print(F("[HTTPS] begin...\n"));
-  char url[350] = { 0 };
-  const int numResults = 10;
   snprintf(url, sizeof(url), "https://api.open-meteo.com/v1/forecast?latitude=%s&longitude=%s&daily=temperature_2m_max,temperature_2m_min,weather_code&timezone=%s&forecast_days=%d&wind_speed_unit=mph&temperature_unit=fahrenheit",
-           lat, lon, timeClient.getTimezoneName(), numResults);
-  Serial.println(url);
-
-  if (https.begin(*client, url)) {
-    Serial.print(F("[HTTPS] GET...\n"));
-    int httpCode = https.GET();
-
-    if (httpCode > 0) {
-      Serial.printf(F("[HTTPS] GET... code: %d\n"), httpCode);
-
-      if (httpCode == HTTP_CODE_OK || httpCode == HTTP_CODE_MOVED_PERMANENTLY) {
-        Serial.println(F("About to deserialize document"));
-
-        // Read response into PSRAM buffer (avoids heap fragmentation)
-        char *jsonBuffer = readResponseToPsram(https);
-        if (!jsonBuffer) {
-          Serial.println(F("Failed to read response"));
-          https.end();
-          return false;
-        }
-
-        JsonDocument doc(SpiRamAllocator::instance());
-        DeserializationError error = deserializeJson(doc, jsonBuffer);
-        // NOTE: Do NOT free jsonBuffer here! ArduinoJson uses zero-copy mode
-        // and doc may contain pointers into jsonBuffer
-        Serial.println(F("Done deserializing document"));
-
-        if (error) {
-          Serial.print(F("deserializeJson() failed: "));
-          Serial.println(error.f_str());
-          heap_caps_free(jsonBuffer);
-          https.end();
-          return false;
-        }
-
-        for (int i = 0; i < numResults; i++) {
-          const float highTemp = doc["daily"]["temperature_2m_max"][i];
-          const float lowTemp = doc["daily"]["temperature_2m_min"][i];
-          const char *timeTemp = (const char *)doc["daily"]["time"][i];
-          const int weatherCode = doc["daily"]["weather_code"][i];
-
-          // Calculate day of week
-          int y, m, d;
-          sscanf(timeTemp, "%d-%d-%d", &y, &m, &d);
-          int weekday = (d += m < 3 ? y-- : y - 2, 23 * m / 9 + d + 4 + y / 4 - y / 100 + y / 400) % 7;
-
-          const char *dayNames[] = { "Sun", "Mon", "Tue", "Wed", "Thu", "Fri", "Sat" };
-          strncpy(pendingData.daily[i].dayName, dayNames[weekday], sizeof(pendingData.daily[i].dayName) - 1);
-          pendingData.daily[i].dayName[sizeof(pendingData.daily[i].dayName) - 1] = '\0';
-
-          snprintf(pendingData.daily[i].high, sizeof(pendingData.daily[i].high), "%d°", (int)highTemp);
-          snprintf(pendingData.daily[i].low, sizeof(pendingData.daily[i].low), "%d°", (int)lowTemp);
-          snprintf(pendingData.daily[i].icon, sizeof(pendingData.daily[i].icon), "%02d-small",
-                   convertOpenMeteoToOpenWeatherCode(weatherCode));
-
-          // Also update class members for backward compatibility
-          snprintf(dailyForecast[i].high, sizeof(dailyForecast[i].high), "%d°", (int)highTemp);
-          snprintf(dailyForecast[i].low, sizeof(dailyForecast[i].low), "%d°", (int)lowTemp);
-          snprintf(dailyForecast[i].icon, sizeof(dailyForecast[i].icon), "%02d-small",
-                   convertOpenMeteoToOpenWeatherCode(weatherCode));
-        }
-
-        doc.clear();
-        heap_caps_free(jsonBuffer);  // NOW safe to free
-        https.end();
-        return true;  // Success!
-      }
-    } else {
-      Serial.printf(F("[HTTPS] GET... failed, error: %s\n"), https.errorToString(httpCode).c_str());
-    }
-
-    https.end();
-  } else {
-    Serial.printf(F("[HTTPS] Unable to connect\n"));
+           lat, lon, timeClient.getTimezoneName(), 10);
+  JsonDocument daily(SpiRamAllocator::instance());
+  char *dailyBuffer = fetchJson(client, url, daily);
+  if (!dailyBuffer) {
+    doc.clear();
+    heap_caps_free(jsonBuffer);
+    return false;
+  }
+  doc["daily"] = daily["daily"];
+#else
+  snprintf(url, sizeof(url), "https://api.open-meteo.com/v1/forecast?latitude=%s&longitude=%s"
+           "&current=temperature_2m,precipitation,weather_code&hourly=temperature_2m,weather_code&forecast_hours=%d"
+           "&daily=temperature_2m_max,temperature_2m_min,weather_code,wind_speed_10m_max&forecast_days=%d"
+           "&timezone=%s&wind_speed_unit=mph&temperature_unit=fahrenheit",
+           lat, lon, WEATHER_CACHE_HOURS, WEATHER_CACHE_DAYS, timeClient.getTimezoneName());
+  char *jsonBuffer = fetchJson(client, url, doc);
+  if (!jsonBuffer) return false;
+#endif
+
+  weather_forecast_t forecast = {};
+  bool decoded = decodeForecast(doc, forecast);
+  doc.clear();
+  heap_caps_free(jsonBuffer);  // NOW safe to free
+#ifdef WEATHER_TWO_REQUESTS
+  daily.clear();
+  heap_caps_free(dailyBuffer);
+#endif
+  if (!decoded) {
+    Serial.println(F("Forecast response is missing data"));
+    return false;
   }
-  return false;  // Failed
+  cache.record = forecast;
+  loads++;
+  return true;  // Success!
 }
 
 // ============================================================================
-// loadCurrentAndHourly() - Fetches current + hourly, stores in pendingData
+// fetchJson() - One GET, deserialized into doc.  Returns the PSRAM buffer doc
+// points into (free it after doc), or nullptr on failure.  Counts the fetch.
 // ============================================================================
-bool Weather::loadCurrentAndHourly(NetworkClientSecure *client, const char *lat, const char *lon) {
+char *Weather::fetchJson(NetworkClientSecure *client, const char *url, JsonDocument &doc) {
   HTTPClient https;
 
   Serial.print(F("[HTTPS] begin...\n"));
-  char url[350] = { 0 };
-  snprintf(url, sizeof(url), "https://api.open-meteo.com/v1/forecast?latitude=%s&longitude=%s&daily=temperature_2m_max,temperature_2m_min,weather_code&hourly=temperature_2m,weather_code&current=temperature_2m,precipitation,weather_code&timezone=%s&forecast_days=3&wind_speed_unit=mph&temperature_unit=fahrenheit",
-           lat, lon, timeClient.getTimezoneName());
   Serial.println(url);
 
+  unsigned long started = millis();
   if (https.begin(*client, url)) {
     Serial.print(F("[HTTPS] GET...\n"));
     int httpCode = https.GET();
@@ -365,100 +410,26 @@ bool Weather::loadCurrentAndHourly(NetworkClientSecure *client, const char *lat,
         if (!jsonBuffer) {
           Serial.println(F("Failed to read response"));
           https.end();
-          return false;
+          return nullptr;
         }
+        fetches++;
+        fetchBytes += strlen(jsonBuffer);
+        fetchMs += millis() - started;
 
-        JsonDocument doc(SpiRamAllocator::instance());
         DeserializationError error = deserializeJson(doc, jsonBuffer);
         // NOTE: Do NOT free jsonBuffer here! ArduinoJson uses zero-copy mode
         // and doc may contain pointers into jsonBuffer
         Serial.println(F("Done deserializing document"));
+        https.end();
 
         if (error) {
           Serial.print(F("deserializeJson() failed: "));
           Serial.println(error.f_str());
+          doc.clear();
           heap_caps_free(jsonBuffer);
-          https.end();
-          return false;
+          return nullptr;
         }
-
-        // Current conditions - store in pendingData
-        int weatherCode = doc["current"]["weather_code"];
-        const char *currentConditions = getCurrentCondsFromCode(weatherCode);
-        strncpy(pendingData.currentConditions, currentConditions, sizeof(pendingData.currentConditions) - 1);
-        pendingData.currentConditions[sizeof(pendingData.currentConditions) - 1] = '\0';
-
-        struct tm timeinfo;
-        getLocalTime(&timeinfo);
-
-        strftime(pendingData.weatherDate, sizeof(pendingData.weatherDate), "%m. %d. %A", &timeinfo);
-
-        pendingData.temperature = (int)doc["current"]["temperature_2m"];
-
-        snprintf(pendingData.windSpeed, sizeof(pendingData.windSpeed), "%d m/h",
-                 (int)doc["daily"]["wind_speed_10m_max"][0]);
-
-        snprintf(pendingData.humidityPct, sizeof(pendingData.humidityPct), "%d%%",
-                 (int)doc["current"]["precipitation"]);
-
-        snprintf(pendingData.minMaxStr, sizeof(pendingData.minMaxStr), "Max: %d° Min: %d°",
-                 (int)doc["daily"]["temperature_2m_max"][0],
-                 (int)doc["daily"]["temperature_2m_min"][0]);
-
-        // Icons
-        snprintf(pendingData.iconLarge, sizeof(pendingData.iconLarge), "%02d%c@2x",
-                 convertOpenMeteoToOpenWeatherCode(weatherCode),
-                 timeinfo.tm_hour >= 6 && timeinfo.tm_hour <= 19 ? 'd' : 'n');
-        snprintf(pendingData.iconSmall, sizeof(pendingData.iconSmall), "%02d-small",
-                 convertOpenMeteoToOpenWeatherCode(weatherCode));
-
-        // Hourly forecast
-        const int numHours = 8;
-        for (int i = 0; i < numHours; i++) {
-          const int index = timeinfo.tm_hour + (i * 3);
-
-          if (i != 0) {
-            const char *timeTemp = (const char *)doc["hourly"]["time"][index];
-
-            int year, month, day, hour;
-            sscanf(timeTemp, "%d-%d-%dT%d:00", &year, &month, &day, &hour);
-
-            if (hour == 0) {
-              hour = 12;
-              strncpy(pendingData.hourly[i].ampm, "AM", sizeof(pendingData.hourly[i].ampm) - 1);
-              pendingData.hourly[i].ampm[sizeof(pendingData.hourly[i].ampm) - 1] = '\0';
-            } else if (hour <= 11) {
-              strncpy(pendingData.hourly[i].ampm, "AM", sizeof(pendingData.hourly[i].ampm) - 1);
-              pendingData.hourly[i].ampm[sizeof(pendingData.hourly[i].ampm) - 1] = '\0';
-            } else if (hour == 12) {
-              strncpy(pendingData.hourly[i].ampm, "PM", sizeof(pendingData.hourly[i].ampm) - 1);
-              pendingData.hourly[i].ampm[sizeof(pendingData.hourly[i].ampm) - 1] = '\0';
-            } else {
-              hour = hour - 12;
-              strncpy(pendingData.hourly[i].ampm, "PM", sizeof(pendingData.hourly[i].ampm) - 1);
-              pendingData.hourly[i].ampm[sizeof(pendingData.hourly[i].ampm) - 1] = '\0';
-            }
-
-            pendingData.hourly[i].hour = hour;
-          }
-
-          const int hourlyWeatherCode = doc["hourly"]["weather_code"][index];
-          snprintf(pendingData.hourly[i].icon, sizeof(pendingData.hourly[i].icon), "%02d-small",
-                   convertOpenMeteoToOpenWeatherCode(hourlyWeatherCode));
-
-          const float temp = doc["hourly"]["temperature_2m"][index];
-          snprintf(pendingData.hourly[i].temp, sizeof(pendingData.hourly[i].temp), "%d°", (int)temp);
-
-          // Also update class members for backward compatibility
-          snprintf(hourlyForecast[i].icon, sizeof(hourlyForecast[i].icon), "%02d-small",
-                   convertOpenMeteoToOpenWeatherCode(hourlyWeatherCode));
-          snprintf(hourlyForecast[i].temp, sizeof(hourlyForecast[i].temp), "%d°", (int)temp);
-        }
-
-        doc.clear();
-        heap_caps_free(jsonBuffer);  // NOW safe to free
-        https.end();
-        return true;  // Success!
+        return jsonBuffer;
       }
     } else {
       Serial.printf(F("[HTTPS] GET... failed, error: %s\n"), https.errorToString(httpCode).c_str());
@@ -468,60 +439,68 @@ bool Weather::loadCurrentAndHourly(NetworkClientSecure *client, const char *lat,
   } else {
     Serial.printf(F("[HTTPS] Unable to connect\n"));
   }
-  return false;  // Failed
+  return nullptr;  // Failed
 }
 
-int Weather::convertOpenMeteoToOpenWeatherCode(int code) {
-  if (code == 0) {
-    return 1;
-  } else if (code >= 40 && code <= 49) {
-    return 45;
-  } else if (code >= 50 && code <= 59) {
-    return 50;
-  } else if (code >= 60 && code <= 69) {
-    return 10;
-  } else if (code >= 70 && code <= 79) {
-    return 13;
-  } else if (code >= 80 && code <= 89) {
-    return 9;
-  } else if (code >= 90 && code <= 99) {
-    return 11;
-  }
-  return code;
+static int16_t tenths(JsonVariant value) {
+  return (int16_t)lroundf(value.as<float>() * 10);
 }
 
-const char *Weather::getCurrentCondsFromCode(int code) {
-  switch (code) {
-    case 0: return "Clear Sky";
-    case 1: return "Mainly Clear";
-    case 2: return "Partly Cloudy";
-    case 3: return "Cloudy";
-    case 45: return "Foggy";
-    case 48: return "Rime Fog";
-    case 51: return "Light Drizzle";
-    case 53: return "Drizzle";
-    case 55: return "Heavy Drizzle";
-    case 56:
-    case 57: return "Freezing Drizzle";
-    case 61: return "Light Rain";
-    case 63: return "Rain";
-    case 65: return "Heavy Rain";
-    case 66:
-    case 67: return "Freezing Rain";
-    case 71: return "Light Snow";
-    case 73: return "Snow";
-    case 75: return "Heavy Snow";
-    case 77: return "Dusting";
-    case 80: return "Light Showers";
-    case 81: return "Showers";
-    case 82: return "Heavy Showers";
-    case 85: return "Light Snow";
-    case 86: return "Snow Showers";
-    case 95: return "Thunderstorm";
-    case 96: return "Light Hail";
-    case 99: return "Thunder/Hail";
-    default: return "Unknown";
+// Times come back in the watch's zone (the timezone parameter), as
+// "2026-03-08T14:00" and "2026-03-08".
+bool Weather::decodeForecast(JsonDocument &doc, weather_forecast_t &forecast) {
+  JsonObject current = doc["current"];
+  JsonArray hourTimes = doc["hourly"]["time"];
+  JsonArray hourTemps = doc["hourly"]["temperature_2m"];
+  JsonArray hourCodes = doc["hourly"]["weather_code"];
+  JsonArray dayTimes = doc["daily"]["time"];
+  JsonArray dayHighs = doc["daily"]["temperature_2m_max"];
+  JsonArray dayLows = doc["daily"]["temperature_2m_min"];
+  JsonArray dayCodes = doc["daily"]["weather_code"];
+  JsonArray dayWinds = doc["daily"]["wind_speed_10m_max"];
+  if (current.isNull() || hourTimes.size() == 0 || dayTimes.size() == 0) return false;
+
+  CivilTime civil = {};
+  int year, month, day, hour, minute;
+  if (sscanf(hourTimes[0] | "", "%d-%d-%dT%d:%d", &year, &month, &day, &hour, &minute) != 5) return false;
+  civil = { (int16_t)year, (uint8_t)month, (uint8_t)day, (uint8_t)hour, (uint8_t)minute, 0 };
+  forecast.hourStart = timeZone.fromLocal(civil);
+  if (sscanf(dayTimes[0] | "", "%d-%d-%d", &year, &month, &day) != 3) return false;
+  forecast.dayStart = civilToDays(year, month, day);
+
+  forecast.fetchedAt = time(nullptr);
+  forecast.temperature = tenths(current["temperature_2m"]);
+  forecast.precipitation = tenths(current["precipitation"]);
+  forecast.code = current["weather_code"] | 0;
+
+  // A short answer repeats its last entry rather than leaving holes.
+  for (size_t i = 0; i < WEATHER_CACHE_HOURS; i++) {
+    size_t from = i < hourTimes.size() ? i : hourTimes.size() - 1;
+    forecast.hours[i] = { tenths(hourTemps[from]), (uint8_t)(hourCodes[from] | 0) };
+  }
+  for (size_t i = 0; i < WEATHER_CACHE_DAYS; i++) {
+    size_t from = i < dayTimes.size() ? i : dayTimes.size() - 1;
+    forecast.days[i] = { tenths(dayHighs[from]), tenths(dayLows[from]), tenths(dayWinds[from]),
+                         (uint8_t)(dayCodes[from] | 0) };
   }
+  return true;
+}
+
+void Weather::publish(const weather_forecast_t &forecast, time_t now) {
+  uint32_t version = pendingVersion.load(std::memory_order_relaxed);
+  pendingVersion.store(version + 1, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+  formatWeather(forecast, now, pendingData);
+  pendingVersion.store(version + 2, std::memory_order_release);
+  publishedHour = localHour(now);
+}
+
+// Hours since the start of the local year: changes at every local hour,
+// midnight included, and with the zone.
+int Weather::localHour(time_t now) {
+  struct tm local;
+  timeZone.toLocal(now, local);
+  return local.tm_yday * 24 + local.tm_hour;
 }
 
 bool Weather::isFirstWeatherLoaded() {
@@ -10,80 +10,80 @@
 #include <atomic>
 #include <ArduinoJson.h>
 #include <HTTPClient.h>
-
-// Struct to hold parsed weather data for thread-safe transfer to UI
-struct WeatherData {
-  // Current conditions
-  char currentConditions[32];
-  char weatherDate[20];
-  int temperature;
-  char windSpeed[10];
-  char humidityPct[5];
-  char minMaxStr[20];
-  char iconLarge[14];
-  char iconSmall[14];
-  
-  // Hourly forecast (8 entries)
-  struct {
-    char icon[10];
-    char temp[5];
-    int hour;
-    char ampm[3];
-  } hourly[8];
-  
-  // Daily forecast (10 entries)
-  struct {
-    char high[5];
-    char low[5];
-    char icon[10];
-    char dayName[4];
-  } daily[10];
-};
+#include "weather_cache.h"
+#include "weather_refresh.h"
+#include "weather_ui.h"
 
 class Weather {
 public:
   Weather() {};
-  void loadWeather();        // Call from Core 0 - fetches data only
+  void begin();              // Shows the SD copy of the last forecast; call after the config is read
+  // Call from Core 0 - fetches data only.  `sessionRecorded`: the connection
+  // was made for the weather alone and recordSession() already counted it.
+  void loadWeather(bool sessionRecorded = false);
   void applyToUI();          // Call from Core 1 main loop - updates LVGL
-  bool hasNewData() { return newDataReady.load(); }
+  void logStats();
+  // Call from Background_Tasks - shows the cached forecast as of the new local
+  // hour once the clock reaches it; no radio.
+  void readForward();
+  // True when loadWeather() would fetch; Background_Tasks connects for it.
+  bool refreshDue(unsigned long now);
+  // Whether the battery budget has room for a connection made for the
+  // weather alone, and counting one against it.
+  bool sessionAllowed();
+  void recordSession();
+  bool hasNewData() { return pendingVersion.load() != shownVersion; }
   const char *getLargeIcon() { return weatherIconLarge; }
   const char *getSmallIcon() { return weatherIconSmall; }
   bool isFirstWeatherLoaded();
 
 private:
-  bool loadCurrentAndHourly(NetworkClientSecure *, const char *lat, const char *lon);
-  bool loadDaily(NetworkClientSecure *, const char *lat, const char *lon);
+  // One request for current, hourly and daily data, decoded into cache.record.
+  bool loadForecast(NetworkClientSecure *, const char *lat, const char *lon);
+  char *fetchJson(NetworkClientSecure *, const char *url, JsonDocument &doc);
+  bool decodeForecast(JsonDocument &doc, weather_forecast_t &forecast);
+  // formatWeather() into pendingData inside a pendingVersion bump; Core 0.
+  void publish(const weather_forecast_t &forecast, time_t now);
+  static int localHour(time_t now);
+  int publishedHour = -1;            // localHour() of the last publish, -1 before any
 
   char weatherIconLarge[14] = { 0 };
   char weatherIconSmall[14] = { 0 };
     
-  // Thread-safe data transfer from Core 0 to Core 1
+  // Thread-safe data transfer from Core 0 to Core 1.  pendingVersion is odd
+  // while Core 0 writes pendingData; Core 1 copies it into snapshot and keeps
+  // the copy only if the version was even and unchanged across it.
   WeatherData pendingData;
-  std::atomic<bool> newDataReady{false};
+  std::atomic<uint32_t> pendingVersion{0};
+
+  // Core 1 only.  applyToUI() hands snapshot to ui, which pushes the fields
+  // that differ from the last apply.
+  WeatherData snapshot;
+  WeatherUi ui;
+  uint32_t shownVersion = 0;
+
+  uint32_t applies = 0;
+  uint16_t lastPushed = 0;
+  uint32_t applyUs = 0;              // all applies
+  uint32_t maxApplyUs = 0;
   
   // Prevent concurrent execution of loadWeather
   std::atomic_flag loadInProgress = ATOMIC_FLAG_INIT;
-  
-  typedef struct {
-    char hour[6] = { 0 };
-    char temp[5] = { 0 };
-    char icon[10] = { 0 };
-  } hourly_forecast_t;
-
-  hourly_forecast_t hourlyForecast[8];
 
-  typedef struct {
-    char high[5] = { 0 };
-    char low[5] = { 0 };
-    char icon[10] = { 0 };
-  } daily_forecast_t;    
+  WeatherCache cache;                // last forecast, Core 0 after begin()
+  WeatherRefreshPolicy refreshPolicy;
+  unsigned long lastRefreshMs = 0;   // millis() the delay below runs from
+  uint32_t refreshDelayMs = 0;
+  void scheduleRefresh(unsigned long now, time_t wallNow, int64_t age);
 
-  daily_forecast_t dailyForecast[10];
+  uint32_t loads = 0;                // forecasts fetched and decoded
+  uint32_t fetches = 0;              // requests, two per load with WEATHER_TWO_REQUESTS
+  uint32_t fetchBytes = 0;           // response bodies, all fetches
+  uint32_t fetchMs = 0;              // connect to last byte, all fetches
+  uint32_t cacheSkips = 0;           // refreshes answered by a fresh cached forecast
 
   bool first_weather_loaded = false;
 
-  int convertOpenMeteoToOpenWeatherCode(int code);
-  const char *getCurrentCondsFromCode(int code);    
   void markFirstWeatherLoaded();
   char *readResponseToPsram(HTTPClient &http, size_t maxSize = 16384); 
   
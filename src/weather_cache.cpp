@@ -0,0 +1,59 @@
+#include "weather_cache.h"
+#include "SD_Card.h"
+#include <esp_rom_crc.h>
+#include <stddef.h>
+
+uint32_t WeatherCache::checksum(const weather_forecast_t &forecast) {
+  const size_t from = offsetof(weather_forecast_t, crc) + sizeof(forecast.crc);
+  return esp_rom_crc32_le(0, (const uint8_t *)&forecast + from, sizeof(forecast) - from);
+}
+
+bool WeatherCache::load() {
+  valid = false;
+  File file = SD_MMC.open(WEATHER_CACHE_PATH);
+  if (!file) return false;
+  weather_forecast_t loaded;
+  bool ok = file.size() == sizeof(loaded) &&
+            file.read((uint8_t *)&loaded, sizeof(loaded)) == sizeof(loaded);
+  file.close();
+
+  ok = ok && loaded.magic == WEATHER_CACHE_MAGIC && loaded.version == WEATHER_CACHE_VERSION &&
+       loaded.size == sizeof(loaded) && loaded.crc == checksum(loaded);
+  if (!ok) {
+    Serial.println("Weather: cached forecast unreadable, ignoring it");
+    return false;
+  }
+  loaded.latitude[sizeof(loaded.latitude) - 1] = '\0';
+  loaded.longitude[sizeof(loaded.longitude) - 1] = '\0';
+  record = loaded;
+  valid = true;
+  return true;
+}
+
+bool WeatherCache::save() {
+  record.magic = WEATHER_CACHE_MAGIC;
+  record.version = WEATHER_CACHE_VERSION;
+  record.size = sizeof(record);
+  record.crc = checksum(record);
+  valid = true;
+
+  File file = SD_MMC.open(WEATHER_CACHE_PATH, FILE_WRITE);
+  if (!file) return false;
+  bool ok = file.write((const uint8_t *)&record, sizeof(record)) == sizeof(record);
+  file.close();
+  if (!ok) SD_MMC.remove(WEATHER_CACHE_PATH);
+  return ok;
+}
+
+// The IP location is not known until WiFi is up; until then the last one is
+// assumed.
+bool WeatherCache::matches(uint8_t locationIndex, const char *latitude, const char *longitude) {
+  if (!valid || record.locationIndex != locationIndex) return false;
+  if (!latitude || !longitude || !latitude[0] || !longitude[0]) return locationIndex == 0;
+  return strcmp(record.latitude, latitude) == 0 && strcmp(record.longitude, longitude) == 0;
+}
+
+int64_t WeatherCache::age(time_t now) {
+  if (!valid || now < record.fetchedAt) return INT64_MAX;
+  return now - record.fetchedAt;
+}
@@ -0,0 +1,75 @@
+#pragma once
+
+#ifndef WEATHER_CACHE_H
+#define WEATHER_CACHE_H
+
+#include <Arduino.h>
+#include <time.h>
+
+// The last Open-Meteo forecast as one fixed-layout record, decoded once from
+// the JSON and mirrored to the SD card so the weather screens have data at
+// boot before WiFi is up.  Hours and days are kept with their start so the
+// record can be read forward: a forecast fetched yesterday evening still
+// fills the hourly strip and ten days from today.
+//
+// The record is versioned and CRC'd; anything that fails either is ignored
+// and the next fetch overwrites it.  Temperatures and speeds are tenths of a
+// unit (°F, mph, mm) as the API reports them.
+#define WEATHER_CACHE_PATH      "/weather_cache.bin"
+#define WEATHER_CACHE_MAGIC     0x58435746      // "FWCX"
+#define WEATHER_CACHE_VERSION   1
+#define WEATHER_CACHE_HOURS     48              // from the hour of the fetch
+#define WEATHER_CACHE_DAYS      11              // from the day of the fetch
+#define WEATHER_CACHE_MAX_AGE_S (24 * 60 * 60)  // older records are not shown
+
+typedef struct __attribute__((packed)) {
+  int16_t temp;
+  uint8_t code;                          // WMO weather code
+} weather_hour_t;
+
+typedef struct __attribute__((packed)) {
+  int16_t high;
+  int16_t low;
+  int16_t windMax;
+  uint8_t code;
+} weather_day_t;
+
+typedef struct __attribute__((packed)) {
+  uint32_t magic;
+  uint16_t version;
+  uint16_t size;                         // sizeof(weather_forecast_t)
+  uint32_t crc;                          // CRC-32 of everything after this field
+
+  int64_t fetchedAt;
+  uint8_t locationIndex;                 // WeatherLocations selection, 0 = IP based
+  char latitude[10];
+  char longitude[10];
+
+  int16_t temperature;
+  int16_t precipitation;
+  uint8_t code;
+
+  int64_t hourStart;                     // UTC start of hours[0]
+  weather_hour_t hours[WEATHER_CACHE_HOURS];
+  int32_t dayStart;                      // days since 1970-01-01 of days[0]
+  weather_day_t days[WEATHER_CACHE_DAYS];
+} weather_forecast_t;
+
+class WeatherCache {
+  public:
+    bool load();
+    bool save();
+
+    // True when `record` holds a forecast for the given place.
+    bool matches(uint8_t locationIndex, const char *latitude, const char *longitude);
+    // Seconds since the record was fetched; large when there is none.
+    int64_t age(time_t now);
+
+    weather_forecast_t record = {};
+    bool valid = false;
+
+  private:
+    static uint32_t checksum(const weather_forecast_t &forecast);
+};
+
+#endif /* weather_cache.h */
@@ -0,0 +1,78 @@
+#include "weather_refresh.h"
+
+uint8_t WeatherRefreshPolicy::budgetFor(bool charging, int battery) {
+  if (charging) return WEATHER_BUDGET_WINDOW_S / WEATHER_REFRESH_MIN_S;
+  if (battery >= 50) return 24;
+  if (battery >= 20) return 12;
+  return 4;
+}
+
+const char *WeatherRefreshPolicy::reasonName(Reason reason) {
+  switch (reason) {
+    case NO_FORECAST: return "no forecast";
+    case PRECIP: return "precipitation change";
+    case UNSETTLED: return "unsettled";
+    case STABLE: return "stable";
+    case NIGHT: return "night";
+    case BUDGET: return "battery budget";
+  }
+  return "?";
+}
+
+void WeatherRefreshPolicy::recordFetch(time_t now) {
+  fetchTimes[fetchHead] = now;
+  fetchHead = (fetchHead + 1) % WEATHER_FETCH_HISTORY;
+}
+
+uint32_t WeatherRefreshPolicy::budgetDelay(time_t now, bool charging, int battery) const {
+  if (charging) return 0;
+  uint8_t budget = budgetFor(charging, battery);
+  time_t last = fetchTimes[(fetchHead + WEATHER_FETCH_HISTORY - 1) % WEATHER_FETCH_HISTORY];
+  time_t oldest = fetchTimes[(fetchHead + WEATHER_FETCH_HISTORY - budget) % WEATHER_FETCH_HISTORY];
+  time_t earliest = now;
+  if (last) earliest = max(earliest, last + (time_t)(WEATHER_BUDGET_WINDOW_S / budget));
+  if (oldest) earliest = max(earliest, oldest + (time_t)WEATHER_BUDGET_WINDOW_S);
+  return (uint32_t)(earliest - now);
+}
+
+uint32_t WeatherRefreshPolicy::nextDelay(const weather_forecast_t *forecast, time_t now, int localHour,
+                                         bool charging, int battery) {
+  int64_t elapsed = forecast ? now - forecast->hourStart : 0;
+  int current = elapsed > 0 ? elapsed / 3600 : 0;
+  int64_t delay = WEATHER_REFRESH_MIN_S;
+  reason = NO_FORECAST;
+
+  if (forecast && current < WEATHER_CACHE_HOURS) {
+    bool wet = precipitating(forecast->hours[current].code);
+    bool unsettled = wet;
+    time_t change = 0;
+    for (int h = current + 1; h < WEATHER_CACHE_HOURS && !change; h++) {
+      bool hourWet = precipitating(forecast->hours[h].code);
+      if (h <= current + WEATHER_UNSETTLED_HOURS) unsettled |= hourWet;
+      if (hourWet != wet) change = forecast->hourStart + (time_t)h * 3600;
+    }
+
+    bool night = localHour >= WEATHER_NIGHT_FROM_HOUR || localHour < WEATHER_NIGHT_TO_HOUR;
+    if (unsettled) {
+      reason = UNSETTLED;
+      delay = WEATHER_REFRESH_UNSETTLED_S;
+    } else {
+      reason = night ? NIGHT : STABLE;
+      delay = night ? WEATHER_REFRESH_NIGHT_S : WEATHER_REFRESH_STABLE_S;
+    }
+    int64_t ahead = change ? (int64_t)(change - now) - WEATHER_PRECIP_LEAD_S : delay;
+    if (ahead < delay) {
+      reason = PRECIP;
+      delay = max(ahead, (int64_t)WEATHER_REFRESH_MIN_S);
+    }
+  }
+
+  // Evenly spaced within the budget, and never more than the budget in a
+  // window (reloads for a new location bypass the policy but still count).
+  int64_t held = budgetDelay(now, charging, battery);
+  if (held > delay) {
+    delay = held;
+    reason = BUDGET;
+  }
+  return (uint32_t)delay;
+}
@@ -0,0 +1,68 @@
+#pragma once
+
+#ifndef WEATHER_REFRESH_H
+#define WEATHER_REFRESH_H
+
+#include <Arduino.h>
+#include <time.h>
+#include "weather_cache.h"
+
+// Decides when the next weather fetch is worth its radio time.
+//
+// Weather::readForward() shows the cached forecast as of each local hour, so
+// between fetches the screen follows the clock; what goes stale is the
+// forecast itself, revised with every model run.  Temperature
+// revisions come at a steady rate nothing in the forecast predicts, and for
+// those evenly spaced fetches are the best a fixed number can do.  Rain is
+// different: its revisions cluster in unsettled spells, and a start or end
+// shown at the wrong hour is what reads as a wrong forecast.  So the fetches
+// are spaced evenly by day, closer while rain is anywhere in the next few
+// hours, one is placed just ahead of each predicted start or end of rain,
+// and the night, when nobody looks, is where the time comes from.  Over a
+// synthetic year (test/test_weather_refresh) this spends the fetches of the
+// 120 min sync interval with a quarter fewer minutes of wrong rain, and less
+// temperature error on screen.
+//
+// Every delay is then held to a daily budget set by the battery: no closer
+// than the budget's even spacing, and never more than the budget in any 24
+// hours.  Radio sessions made only for the weather count against it whether
+// or not the fetch succeeds.  Charging lifts the budget but not the minimum
+// interval.
+#define WEATHER_REFRESH_MIN_S       (15 * 60)
+#define WEATHER_REFRESH_UNSETTLED_S (90 * 60)        // rain within WEATHER_UNSETTLED_HOURS
+#define WEATHER_REFRESH_STABLE_S    (135 * 60)
+#define WEATHER_REFRESH_NIGHT_S     (4 * 60 * 60)
+#define WEATHER_UNSETTLED_HOURS     6
+#define WEATHER_PRECIP_LEAD_S       (20 * 60)        // fetch this far ahead of rain starting or stopping
+#define WEATHER_NIGHT_FROM_HOUR     22
+#define WEATHER_NIGHT_TO_HOUR       6
+#define WEATHER_BUDGET_WINDOW_S     (24 * 60 * 60)
+#define WEATHER_FETCH_HISTORY       32               // >= the largest budget below
+
+class WeatherRefreshPolicy {
+  public:
+    enum Reason : uint8_t { NO_FORECAST, PRECIP, UNSETTLED, STABLE, NIGHT, BUDGET };
+
+    // Seconds from `now` until the next fetch.  `localHour` is the watch's
+    // local hour, `battery` a percentage.
+    uint32_t nextDelay(const weather_forecast_t *forecast, time_t now, int localHour,
+                       bool charging, int battery);
+    // Seconds from `now` until the budget allows another fetch; 0: now.
+    uint32_t budgetDelay(time_t now, bool charging, int battery) const;
+    // A fetch, or a radio session made for one.
+    void recordFetch(time_t now);
+
+    // Fetches allowed per WEATHER_BUDGET_WINDOW_S at this battery level.
+    static uint8_t budgetFor(bool charging, int battery);
+    static const char *reasonName(Reason reason);
+    Reason lastReason() const { return reason; }
+
+  private:
+    static bool precipitating(uint8_t code) { return code >= 51; }
+
+    time_t fetchTimes[WEATHER_FETCH_HISTORY] = {};   // ring, 0: empty
+    uint8_t fetchHead = 0;
+    Reason reason = NO_FORECAST;
+};
+
+#endif /* weather_refresh.h */
@@ -0,0 +1,209 @@
+#include "weather_ui.h"
+#include "src/vars.h"
+#include "civil_time.h"
+
+extern TimeZone timeZone;
+
+static int convertOpenMeteoToOpenWeatherCode(int code) {
+  if (code == 0) {
+    return 1;
+  } else if (code >= 40 && code <= 49) {
+    return 45;
+  } else if (code >= 50 && code <= 59) {
+    return 50;
+  } else if (code >= 60 && code <= 69) {
+    return 10;
+  } else if (code >= 70 && code <= 79) {
+    return 13;
+  } else if (code >= 80 && code <= 89) {
+    return 9;
+  } else if (code >= 90 && code <= 99) {
+    return 11;
+  }
+  return code;
+}
+
+static const char *getCurrentCondsFromCode(int code) {
+  switch (code) {
+    case 0: return "Clear Sky";
+    case 1: return "Mainly Clear";
+    case 2: return "Partly Cloudy";
+    case 3: return "Cloudy";
+    case 45: return "Foggy";
+    case 48: return "Rime Fog";
+    case 51: return "Light Drizzle";
+    case 53: return "Drizzle";
+    case 55: return "Heavy Drizzle";
+    case 56:
+    case 57: return "Freezing Drizzle";
+    case 61: return "Light Rain";
+    case 63: return "Rain";
+    case 65: return "Heavy Rain";
+    case 66:
+    case 67: return "Freezing Rain";
+    case 71: return "Light Snow";
+    case 73: return "Snow";
+    case 75: return "Heavy Snow";
+    case 77: return "Dusting";
+    case 80: return "Light Showers";
+    case 81: return "Showers";
+    case 82: return "Heavy Showers";
+    case 85: return "Light Snow";
+    case 86: return "Snow Showers";
+    case 95: return "Thunderstorm";
+    case 96: return "Light Hail";
+    case 99: return "Thunder/Hail";
+    default: return "Unknown";
+  }
+}
+
+void formatWeather(const weather_forecast_t &forecast, time_t now, WeatherData &out) {
+  struct tm timeinfo;
+  timeZone.toLocal(now, timeinfo);
+
+  // Current conditions are those of the hour of the fetch; past it, the
+  // hourly forecast for now is the better reading.
+  int firstHour = now > forecast.hourStart ? (now - forecast.hourStart) / 3600 : 0;
+  firstHour = min(firstHour, WEATHER_CACHE_HOURS - 1);
+  bool pastFetchHour = forecast.fetchedAt < forecast.hourStart + (int64_t)firstHour * 3600;
+  int weatherCode = pastFetchHour ? forecast.hours[firstHour].code : forecast.code;
+  const char *currentConditions = getCurrentCondsFromCode(weatherCode);
+  strncpy(out.currentConditions, currentConditions, sizeof(out.currentConditions) - 1);
+  out.currentConditions[sizeof(out.currentConditions) - 1] = '\0';
+
+  strftime(out.weatherDate, sizeof(out.weatherDate), "%m. %d. %A", &timeinfo);
+
+  int today = civilToDays(timeinfo.tm_year + 1900, timeinfo.tm_mon + 1, timeinfo.tm_mday) - forecast.dayStart;
+  today = constrain(today, 0, WEATHER_CACHE_DAYS - 1);
+  const weather_day_t &todayForecast = forecast.days[today];
+
+  out.temperature = (pastFetchHour ? forecast.hours[firstHour].temp : forecast.temperature) / 10;
+  snprintf(out.windSpeed, sizeof(out.windSpeed), "%d m/h", todayForecast.windMax / 10);
+  snprintf(out.humidityPct, sizeof(out.humidityPct), "%d%%", forecast.precipitation / 10);
+  snprintf(out.minMaxStr, sizeof(out.minMaxStr), "Max: %d° Min: %d°",
+           todayForecast.high / 10, todayForecast.low / 10);
+
+  // Icons
+  snprintf(out.iconLarge, sizeof(out.iconLarge), "%02d%c@2x",
+           convertOpenMeteoToOpenWeatherCode(weatherCode),
+           timeinfo.tm_hour >= 6 && timeinfo.tm_hour <= 19 ? 'd' : 'n');
+  snprintf(out.iconSmall, sizeof(out.iconSmall), "%02d-small",
+           convertOpenMeteoToOpenWeatherCode(weatherCode));
+
+  // Hourly forecast, every third hour from now
+  for (int i = 0; i < 8; i++) {
+    int index = min(firstHour + i * 3, WEATHER_CACHE_HOURS - 1);
+    const weather_hour_t &entry = forecast.hours[index];
+
+    if (i != 0) {
+      struct tm hourTime;
+      timeZone.toLocal(forecast.hourStart + (time_t)index * 3600, hourTime);
+      int hour = hourTime.tm_hour;
+      strncpy(out.hourly[i].ampm, hour < 12 ? "AM" : "PM", sizeof(out.hourly[i].ampm) - 1);
+      out.hourly[i].ampm[sizeof(out.hourly[i].ampm) - 1] = '\0';
+      out.hourly[i].hour = hour % 12 == 0 ? 12 : hour % 12;
+    }
+
+    snprintf(out.hourly[i].icon, sizeof(out.hourly[i].icon), "%02d-small",
+             convertOpenMeteoToOpenWeatherCode(entry.code));
+    snprintf(out.hourly[i].temp, sizeof(out.hourly[i].temp), "%d°", entry.temp / 10);
+  }
+
+  // Daily forecast
+  const char *dayNames[] = { "Sun", "Mon", "Tue", "Wed", "Thu", "Fri", "Sat" };
+  for (int i = 0; i < 10; i++) {
+    int index = min(today + i, WEATHER_CACHE_DAYS - 1);
+    const weather_day_t &entry = forecast.days[index];
+
+    strncpy(out.daily[i].dayName, dayNames[civilWeekday(forecast.dayStart + today + i)],
+            sizeof(out.daily[i].dayName) - 1);
+    out.daily[i].dayName[sizeof(out.daily[i].dayName) - 1] = '\0';
+
+    snprintf(out.daily[i].high, sizeof(out.daily[i].high), "%d°", entry.high / 10);
+    snprintf(out.daily[i].low, sizeof(out.daily[i].low), "%d°", entry.low / 10);
+    snprintf(out.daily[i].icon, sizeof(out.daily[i].icon), "%02d-small",
+             convertOpenMeteoToOpenWeatherCode(entry.code));
+  }
+}
+
+uint16_t WeatherUi::apply(const WeatherData &data, WeatherUiTarget &target) {
+  uint32_t pushedBefore = varsPushed;
+
+  // Current conditions
+  pushString(target, FLOW_GLOBAL_VARIABLE_WEATHER_CURRENT_CONDITIONS, data.currentConditions,
+             shown.currentConditions, sizeof(shown.currentConditions));
+  pushString(target, FLOW_GLOBAL_VARIABLE_WEATHER_DATE, data.weatherDate, shown.weatherDate, sizeof(shown.weatherDate));
+  pushInt(target, FLOW_GLOBAL_VARIABLE_WEATHER_TEMPERATURE, data.temperature, shown.temperature);
+  pushString(target, FLOW_GLOBAL_VARIABLE_WEATHER_WIND_SPEED, data.windSpeed, shown.windSpeed, sizeof(shown.windSpeed));
+  pushString(target, FLOW_GLOBAL_VARIABLE_WEATHER_HUMIDITY_PERCENTAGE, data.humidityPct,
+             shown.humidityPct, sizeof(shown.humidityPct));
+  pushString(target, FLOW_GLOBAL_VARIABLE_WEATHER_MIN_MAX, data.minMaxStr, shown.minMaxStr, sizeof(shown.minMaxStr));
+
+  // Hourly forecast
+  for (int i = 0; i < 8; i++) {
+    pushString(target, FLOW_GLOBAL_VARIABLE_HOUR_ICON_0 + i, data.hourly[i].icon,
+               shown.hourly[i].icon, sizeof(shown.hourly[i].icon));
+    pushString(target, FLOW_GLOBAL_VARIABLE_HOUR_TEMP_0 + i, data.hourly[i].temp,
+               shown.hourly[i].temp, sizeof(shown.hourly[i].temp));
+
+    if (i > 0) {  // Skip first entry (NOW)
+      pushInt(target, FLOW_GLOBAL_VARIABLE_HOUR_LABEL_1 + (i - 1), data.hourly[i].hour, shown.hourly[i].hour);
+      pushString(target, FLOW_GLOBAL_VARIABLE_HOUR_AMPM_1 + (i - 1), data.hourly[i].ampm,
+                 shown.hourly[i].ampm, sizeof(shown.hourly[i].ampm));
+    }
+  }
+
+  // Daily forecast
+  for (int i = 0; i < 10; i++) {
+    pushString(target, FLOW_GLOBAL_VARIABLE_DAY_FORECAST_0 + i, data.daily[i].dayName,
+               shown.daily[i].dayName, sizeof(shown.daily[i].dayName));
+    pushString(target, FLOW_GLOBAL_VARIABLE_HIGH_TEMP_FORECAST_0 + i, data.daily[i].high,
+               shown.daily[i].high, sizeof(shown.daily[i].high));
+    pushString(target, FLOW_GLOBAL_VARIABLE_LOW_TEMP_FORECAST_0 + i, data.daily[i].low,
+               shown.daily[i].low, sizeof(shown.daily[i].low));
+    pushString(target, FLOW_GLOBAL_VARIABLE_ICON_FORECAST_0 + i, data.daily[i].icon,
+               shown.daily[i].icon, sizeof(shown.daily[i].icon));
+  }
+
+  shownValid = true;
+  return (uint16_t)(varsPushed - pushedBefore);
+}
+
+// A text already in the pool is pushed as the slot's value; otherwise the
+// least recently used slot takes it.
+void WeatherUi::pushString(WeatherUiTarget &target, uint32_t variable, const char *value, char *current, size_t size) {
+  if (shownValid && strcmp(value, current) == 0) return;
+  strlcpy(current, value, size);
+  varsPushed++;
+
+  if (strlen(value) >= WEATHER_INTERN_LEN) {
+    target.setString(variable, value);
+    return;
+  }
+  InternSlot *slot = &pool[0];
+  for (int i = 0; i < WEATHER_INTERN_SLOTS; i++) {
+    InternSlot &candidate = pool[i];
+    if (candidate.used && strcmp(candidate.text, value) == 0) {
+      slot = &candidate;
+      break;
+    }
+    if (candidate.used < slot->used) slot = &candidate;
+  }
+  uint8_t index = (uint8_t)(slot - pool);
+  if (slot->used && strcmp(slot->text, value) == 0) {
+    internHits++;
+  } else {
+    internMisses++;
+    strlcpy(slot->text, value, sizeof(slot->text));
+    target.intern(index, value);
+  }
+  slot->used = ++internClock;
+  target.setInterned(variable, index);
+}
+
+void WeatherUi::pushInt(WeatherUiTarget &target, uint32_t variable, int value, int &current) {
+  if (shownValid && value == current) return;
+  current = value;
+  varsPushed++;
+  target.setInt(variable, value);
+}
@@ -0,0 +1,96 @@
+#pragma once
+
+#ifndef WEATHER_UI_H
+#define WEATHER_UI_H
+
+#include <Arduino.h>
+#include <time.h>
+#include "weather_cache.h"
+
+// What the weather screens show, and pushing it to their flow variables.
+//
+// formatWeather() turns a forecast into the strings of WeatherData as of a
+// given time (Core 0).  WeatherUi::apply() then pushes only the fields that
+// differ from the last apply (Core 1), so a refresh that moves one
+// temperature costs one flow variable, not all 76.  Short strings
+// (temperatures, icon and day names, AM/PM) recur across fields and
+// refreshes; they come from an LRU pool of shared values, so a repeated text
+// reuses a reference instead of allocating.
+//
+// The flow values themselves stay behind WeatherUiTarget: weather.cpp binds
+// it to eez::Value, test/test_weather_ui to a refcounting stand-in.
+#define WEATHER_INTERN_SLOTS  48   // distinct short strings kept as shared flow values
+#define WEATHER_INTERN_LEN    12   // longer strings are not interned
+#define WEATHER_UI_VARIABLES  (6 + 8 * 2 + 7 * 2 + 10 * 4)  // flow variables WeatherUi owns
+
+// Struct to hold parsed weather data for thread-safe transfer to UI
+struct WeatherData {
+  // Current conditions
+  char currentConditions[32];
+  char weatherDate[20];
+  int temperature;
+  char windSpeed[10];
+  char humidityPct[5];
+  char minMaxStr[20];
+  char iconLarge[14];
+  char iconSmall[14];
+
+  // Hourly forecast (8 entries)
+  struct {
+    char icon[10];
+    char temp[5];
+    int hour;
+    char ampm[3];
+  } hourly[8];
+
+  // Daily forecast (10 entries)
+  struct {
+    char high[5];
+    char low[5];
+    char icon[10];
+    char dayName[4];
+  } daily[10];
+};
+
+// Fills `out` from a forecast, read forward to `now`: the hourly strip starts
+// at the current local hour and the days at today.
+void formatWeather(const weather_forecast_t &forecast, time_t now, WeatherData &out);
+
+// The flow variables, by FLOW_GLOBAL_VARIABLE_* id, and the pool's values.
+class WeatherUiTarget {
+  public:
+    virtual ~WeatherUiTarget() {}
+    // Pool slot `slot` (0 to WEATHER_INTERN_SLOTS - 1) now holds `text`,
+    // replacing whatever it held.
+    virtual void intern(uint8_t slot, const char *text) = 0;
+    virtual void setInterned(uint32_t variable, uint8_t slot) = 0;
+    virtual void setString(uint32_t variable, const char *text) = 0;
+    virtual void setInt(uint32_t variable, int value) = 0;
+};
+
+class WeatherUi {
+  public:
+    // Pushes the fields of `data` that differ from the last apply, all of
+    // them the first time; returns how many.
+    uint16_t apply(const WeatherData &data, WeatherUiTarget &target);
+
+    uint32_t varsPushed = 0;           // all applies
+    uint32_t internHits = 0;
+    uint32_t internMisses = 0;
+
+  private:
+    struct InternSlot {
+      char text[WEATHER_INTERN_LEN];
+      uint32_t used;                   // internClock of the last push, 0 while empty
+    };
+
+    void pushString(WeatherUiTarget &target, uint32_t variable, const char *value, char *current, size_t size);
+    void pushInt(WeatherUiTarget &target, uint32_t variable, int value, int &current);
+
+    WeatherData shown;                 // what the flow variables hold
+    bool shownValid = false;
+    InternSlot pool[WEATHER_INTERN_SLOTS] = {};
+    uint32_t internClock = 0;
+};
+
+#endif /* weather_ui.h */
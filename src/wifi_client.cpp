@@ -11,12 +11,19 @@
 #include <vector>
 #include "WiFi.h"
 #include "esp_wifi.h"
+#include "esp_netif.h"
+#include "esp_netif_net_stack.h"
+#include "lwip/etharp.h"
+#include "lwip/tcpip.h"
 #include "wifi_client.h"
 #include "serializable_configs.h"
 #include "geolocation.h"
 #include "time_client.h"
 #include "weather.h"
 #include "calendar_fetcher.h"
+#include "location_cache.h"
+#include "boot_profiler.h"
+#include "ui_async.h"
 
 extern WiFi_Client wifiClient;
 extern SerializableConfigs serializableConfigs;
@@ -24,6 +31,9 @@ extern GeoLocation ipLocation;
 extern TimeClient timeClient;
 extern Weather weather;
 extern CalendarFetcher calendarFetcher;
+extern LocationCache locationCache;
+extern BootProfiler bootProfiler;
+extern UiAsync uiAsync;
 
 bool wifiScanInProgress = false;
 unsigned long wifiScanStartTime = 0;
@@ -36,8 +46,37 @@ bool wifiAsyncReconnectNeeded = false;
 
 static const unsigned long WIFI_IDLE_TIMEOUT_MS = 30000;  // Disconnect after 30 s idle
 
-// External flag from main .ino file
+// External flags from main .ino file
 extern volatile bool locationDataReady;
+extern volatile bool weatherOnlySync;
+
+// The gateway's MAC from the ARP table; NTP has been through it by the time
+// this is asked.  Left zero when it is not there.
+static void gatewayMac(uint8_t mac[6]) {
+  esp_netif_t *netif = esp_netif_get_handle_from_ifkey("WIFI_STA_DEF");
+  esp_netif_ip_info_t ip;
+  if (!netif || esp_netif_get_ip_info(netif, &ip) != ESP_OK || ip.gw.addr == 0) return;
+  struct netif *lwipNetif = (struct netif *)esp_netif_get_netif_impl(netif);
+  if (!lwipNetif) return;
+
+  ip4_addr_t gateway;
+  gateway.addr = ip.gw.addr;
+  struct eth_addr *eth = nullptr;
+  const ip4_addr_t *entry = nullptr;
+  LOCK_TCPIP_CORE();
+  if (etharp_find_addr(lwipNetif, &gateway, &eth, &entry) >= 0 && eth) memcpy(mac, eth->addr, 6);
+  UNLOCK_TCPIP_CORE();
+}
+
+static network_fingerprint_t currentNetwork() {
+  network_fingerprint_t network = {};
+  wifi_ap_record_t ap;
+  if (esp_wifi_sta_get_ap_info(&ap) != ESP_OK) return network;
+  network.ssidHash = LocationCache::hashSsid((const char *)ap.ssid);
+  memcpy(network.bssid, ap.bssid, sizeof(network.bssid));
+  gatewayMac(network.gateway);
+  return network;
+}
 
 // Callback function to reload location and weather after WiFi connection
 void onWifiConnected() {
@@ -45,21 +84,55 @@ void onWifiConnected() {
   static unsigned long lastLocationRefreshMs = 0;
   unsigned long now = millis();
 
-  // FIRST: Sync time with NTP (fast, gets accurate time immediately)
+  static bool firstConnect = true;
+  if (firstConnect) {
+    firstConnect = false;
+    bootProfiler.event("wifi connected");
+  }
+
+  // Connected only because the weather fell due between full syncs.
+  if (weatherOnlySync) {
+    weatherOnlySync = false;
+    Serial.println("Weather-only sync");
+    weather.loadWeather(true);
+    wifiClient.keepAlive();
+    return;
+  }
+
+  // FIRST: NTP, when the RTC's drift model says the clock needs it
   timeClient.begin();
-  Serial.println("Time synced with NTP");
 
-  // SECOND: Reload location/timezone infrequently. This is one of the more expensive
-  // network sequences and generally does not need to run every sync window.
-  bool doLocationRefresh = (lastLocationRefreshMs == 0) ||
+  // SECOND: Location/timezone.  A network seen before answers from the
+  // location cache without any service call.  Otherwise the services are asked
+  // when the network changed, and every 6 h on the same one: this is one of the
+  // more expensive network sequences.
+  static network_fingerprint_t lastNetwork = {};
+  network_fingerprint_t network = currentNetwork();
+  bool networkChanged = memcmp(&network, &lastNetwork, sizeof(network)) != 0;
+  lastNetwork = network;
+
+  const location_entry_t *known = locationCache.find(network, time(nullptr));
+  bool doLocationRefresh = networkChanged || (lastLocationRefreshMs == 0) ||
                            ((now - lastLocationRefreshMs) >= 6UL * 60UL * 60UL * 1000UL);
-  if (doLocationRefresh) {
+  if (known) {
+    Serial.printf("Location for this network is cached: %s, %s\n", known->city, known->state);
+    ipLocation.restore(known->city, known->state, known->latitude, known->longitude);
+    timeClient.restoreTimezone(known->timezone, known->timezoneName);
+    locationCache.rememberZone(known->timezone, known->timezoneName);
+    locationDataReady = true;
+    lastLocationRefreshMs = now;
+  } else if (doLocationRefresh) {
     if (ipLocation.loadUsingIp()) {
       Serial.println("Location reloaded successfully");
       locationDataReady = true;  // Set flag after successful location load
 
       // THIRD: Update timezone based on new location
-      timeClient.lookupTimezone(ipLocation.getLatitude(), ipLocation.getLongitude());
+      if (timeClient.lookupTimezone(ipLocation.getLatitude(), ipLocation.getLongitude())) {
+        locationCache.rememberZone(timeClient.getTimezone(), timeClient.getTimezoneName());
+        locationCache.store(network, time(nullptr), ipLocation.getCity(), ipLocation.getState(),
+                            ipLocation.getLatitude(), ipLocation.getLongitude(),
+                            timeClient.getTimezone(), timeClient.getTimezoneName());
+      }
       lastLocationRefreshMs = now;
     } else {
       Serial.println("Failed to reload location");
@@ -84,23 +157,6 @@ void onWifiConnected() {
   wifiClient.keepAlive();
 }
 
-// Async callbacks that run on LVGL thread
-static void asyncPushScreen(void *param) {
-  ScreenOperation *op = (ScreenOperation *)param;
-  if (op) {
-    eez_flow_push_screen(op->screenId, op->animType, op->time, op->delay);
-    lv_mem_free(op);
-  }
-}
-
-static void asyncPopScreen(void *param) {
-  ScreenOperation *op = (ScreenOperation *)param;
-  if (op) {
-    eez_flow_pop_screen(op->animType, op->time, op->delay);
-    lv_mem_free(op);
-  }
-}
-
 void action_wifi_network_clicked(lv_event_t *e) {
   lv_obj_t *row_container = lv_event_get_target(e);
   lv_obj_t *ssid_container = lv_obj_get_child(row_container, 0);
@@ -128,15 +184,8 @@ void action_wifi_network_clicked(lv_event_t *e) {
 
   Serial.printf("wifi network clicked %s - %s - %s\n", ssid, isOpen ? "open" : "secure", isSaved ? "saved" : "not saved");
 
-  // Safe to call from event handler - defers until next LVGL tick
-  ScreenOperation *op = (ScreenOperation *)lv_mem_alloc(sizeof(ScreenOperation));
-  if (op) {
-    op->screenId = SCREEN_ID_WIFI_CREDENTIALS;
-    op->animType = LV_SCR_LOAD_ANIM_MOVE_LEFT;
-    op->time = 200;
-    op->delay = 0;
-    lv_async_call(asyncPushScreen, op);
-  }
+  // Safe to call from event handler - defers until the next UI pass
+  uiAsync.pushScreen(SCREEN_ID_WIFI_CREDENTIALS, LV_SCR_LOAD_ANIM_MOVE_LEFT, 200, 0);
 }
 
 static void insert_wifi_row(const int rssi, const bool isOpen, const char *ssid) {
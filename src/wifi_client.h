@@ -23,14 +23,6 @@ typedef struct {
   } nets[20];
 } WifiUiScanResult;
 
-struct ScreenOperation {
-  uint8_t screenId;
-  lv_scr_load_anim_t animType;
-  uint16_t time;
-  uint16_t delay;
-  bool isPush;  // true = push, false = pop
-};
-
 class WiFi_Client : public SerializableConfig {
 public:
   WiFi_Client() {}
@@ -0,0 +1,112 @@
+"""
+Host tool — resolve the call sites in [HeapTrack] serial output to
+function/file:line and total the live bytes per function.
+
+Build and flash the `waveshare_s3_146_heaptrack` environment, capture the
+serial monitor to a file, then run this against the same firmware.elf so the
+addresses line up.  Every `site=0x........` line is echoed with its location
+appended, followed by a per-function summary of the last dump seen.
+
+Usage:
+    pio device monitor | tee monitor.log
+    python symbolize_heap.py monitor.log
+    python symbolize_heap.py --elf path/to/firmware.elf < monitor.log
+"""
+import argparse
+import os
+import re
+import shutil
+import subprocess
+import sys
+
+PROJECT_DIR = os.path.dirname(os.path.abspath(__file__))
+DEFAULT_ELF = os.path.join(PROJECT_DIR, ".pio", "build", "waveshare_s3_146_heaptrack", "firmware.elf")
+ADDR2LINE = "xtensa-esp32s3-elf-addr2line"
+
+SITE_RE = re.compile(r"\[HeapTrack\] site=(0x[0-9a-fA-F]{8})\s+live=(\d+)")
+DUMP_RE = re.compile(r"\[HeapTrack\] --- top \d+ sites by live bytes")
+# diff() prints its grown sites with the same site= format; those are deltas
+# since the snapshot and must not be added to the live totals.
+DIFF_RE = re.compile(r"\[HeapTrack\] --- \d+ sites grew since snapshot")
+
+
+def find_addr2line(explicit):
+    if explicit:
+        return explicit
+    found = shutil.which(ADDR2LINE)
+    if found:
+        return found
+    # PlatformIO keeps the toolchain out of PATH.
+    packages = os.path.join(os.path.expanduser("~"), ".platformio", "packages")
+    for toolchain in ("toolchain-xtensa-esp-elf", "toolchain-xtensa-esp32s3"):
+        candidate = os.path.join(packages, toolchain, "bin", ADDR2LINE)
+        if os.path.exists(candidate):
+            return candidate
+    sys.exit(f"{ADDR2LINE} not found; pass --addr2line")
+
+
+def symbolize(addr2line, elf, addresses):
+    """Returns {address: 'function at file:line'} in one addr2line call."""
+    if not addresses:
+        return {}
+    out = subprocess.run([addr2line, "-pfiaC", "-e", elf] + addresses,
+                         capture_output=True, text=True, check=True).stdout
+    result = {}
+    current = None
+    for line in out.splitlines():
+        # -a prints the address on its own line, then the (inlined) frames.
+        if re.match(r"^0x[0-9a-fA-F]+:", line):
+            current, frame = line.split(":", 1)
+            current = "0x%08x" % int(current, 16)
+            result[current] = frame.strip()
+        elif current and line.strip().startswith("(inlined by)"):
+            result[current] += " " + line.strip()
+    return result
+
+
+def function_of(location):
+    return location.split(" at ", 1)[0] if location else "??"
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n\n")[0].strip(),
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("log", nargs="?", help="serial log (default: stdin)")
+    parser.add_argument("--elf", default=DEFAULT_ELF)
+    parser.add_argument("--addr2line")
+    args = parser.parse_args()
+
+    if not os.path.exists(args.elf):
+        sys.exit(f"{args.elf} not found; build the waveshare_s3_146_heaptrack env or pass --elf")
+
+    with open(args.log, errors="replace") if args.log else sys.stdin as f:
+        lines = f.read().splitlines()
+
+    addresses = sorted({"0x%08x" % int(m.group(1), 16) for m in map(SITE_RE.search, lines) if m})
+    locations = symbolize(find_addr2line(args.addr2line), args.elf, addresses)
+
+    by_function = {}
+    in_dump = False
+    for line in lines:
+        if DUMP_RE.search(line):
+            by_function = {}                  # summarise the most recent dump only
+            in_dump = True
+        elif DIFF_RE.search(line):
+            in_dump = False
+        m = SITE_RE.search(line)
+        if not m:
+            print(line)
+            continue
+        location = locations.get("0x%08x" % int(m.group(1), 16), "??")
+        print(f"{line}  <- {location}")
+        if in_dump:
+            by_function[function_of(location)] = by_function.get(function_of(location), 0) + int(m.group(2))
+
+    if by_function:
+        print("\nLive bytes by function (last dump):")
+        for name, size in sorted(by_function.items(), key=lambda item: -item[1]):
+            print(f"  {size:>10}  {name}")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,179 @@
+#pragma once
+
+// Just enough of the Arduino core for the hardware-free modules under
+// `pio test -e native`.  millis() is a simulated clock the tests drive.
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdarg.h>
+#include <string.h>
+#include <limits.h>
+#include <math.h>
+#include <time.h>
+#include <string>
+#include <vector>
+#include <mutex>
+#include <thread>
+#include <condition_variable>
+#include "esp_heap_caps.h"
+
+#define IRAM_ATTR
+#define F(x) (x)
+
+// Flash tables and the core's log macros, for the vendored audio decoders.
+#define PROGMEM
+#define pgm_read_byte(addr) (*(const uint8_t *)(addr))
+#define pgm_read_word(addr) (*(const uint16_t *)(addr))
+#define pgm_read_dword(addr) (*(const uint32_t *)(addr))
+#define log_e(...) ((void)0)
+#define log_w(...) ((void)0)
+#define log_i(...) ((void)0)
+#define log_d(...) ((void)0)
+#define log_v(...) ((void)0)
+static inline bool psramFound() { return true; }
+static inline void *ps_malloc(size_t size) { return malloc(size); }
+static inline void *ps_calloc(size_t n, size_t size) { return calloc(n, size); }
+
+extern unsigned long hostMillis;
+static inline unsigned long millis() { return hostMillis; }
+static inline unsigned long micros() { return hostMillis * 1000UL; }
+static inline void delay(unsigned long ms) { hostMillis += ms; }
+
+class HardwareSerial {
+  public:
+    int printf(const char *format, ...) __attribute__((format(printf, 2, 3))) {
+      if (quiet) return 0;
+      va_list args;
+      va_start(args, format);
+      int n = vprintf(format, args);
+      va_end(args);
+      return n;
+    }
+    void print(const char *text) { if (!quiet) fputs(text, stdout); }
+    void println(const char *text = "") { if (!quiet) puts(text); }
+    void flush() { fflush(stdout); }
+    operator bool() const { return true; }
+
+    bool quiet = true;                   // tests opt in to the module logs
+};
+extern HardwareSerial Serial;
+
+// FreeRTOS critical sections; no host test enters one from two threads.
+typedef int portMUX_TYPE;
+#define portMUX_INITIALIZER_UNLOCKED 0
+#define taskENTER_CRITICAL(mux) ((void)(mux))
+#define taskEXIT_CRITICAL(mux) ((void)(mux))
+
+// FreeRTOS mutexes and notified tasks.  A task runs on its own host thread,
+// but only inside hostRunTasks(): notifications queue up until a test calls
+// it, so background work happens at a point the test chooses.
+typedef int BaseType_t;
+typedef uint32_t TickType_t;
+#define pdFALSE 0
+#define pdTRUE 1
+#define pdPASS 1
+#define portMAX_DELAY 0xffffffffu
+
+typedef std::mutex *SemaphoreHandle_t;
+static inline SemaphoreHandle_t xSemaphoreCreateMutex() { return new std::mutex; }
+static inline BaseType_t xSemaphoreTake(SemaphoreHandle_t mutex, TickType_t timeout) {
+  if (timeout != portMAX_DELAY) return mutex->try_lock() ? pdTRUE : pdFALSE;
+  mutex->lock();
+  return pdTRUE;
+}
+static inline BaseType_t xSemaphoreGive(SemaphoreHandle_t mutex) {
+  mutex->unlock();
+  return pdTRUE;
+}
+
+struct HostTask {
+  std::mutex lock;
+  std::condition_variable changed;
+  uint32_t queued = 0;                   // given, not yet handed over
+  uint32_t delivered = 0;                // handed over by hostRunTasks()
+  bool waiting = false;                  // blocked in ulTaskNotifyTake()
+};
+typedef HostTask *TaskHandle_t;
+typedef void (*TaskFunction_t)(void *);
+
+inline std::vector<HostTask *> &hostTasks() {
+  static std::vector<HostTask *> tasks;
+  return tasks;
+}
+inline HostTask *&hostCurrentTask() {
+  static thread_local HostTask *task = nullptr;
+  return task;
+}
+
+inline BaseType_t xTaskCreatePinnedToCoreWithCaps(TaskFunction_t fn, const char *, uint32_t, void *parameter,
+                                                  int, TaskHandle_t *handle, int, uint32_t) {
+  HostTask *task = new HostTask;
+  hostTasks().push_back(task);
+  if (handle) *handle = task;
+  std::thread([=] {
+    hostCurrentTask() = task;
+    fn(parameter);
+  }).detach();
+  return pdPASS;
+}
+inline void xTaskNotifyGive(TaskHandle_t task) {
+  std::lock_guard<std::mutex> hold(task->lock);
+  task->queued++;
+}
+inline uint32_t ulTaskNotifyTake(BaseType_t clearOnExit, TickType_t) {
+  HostTask *task = hostCurrentTask();
+  std::unique_lock<std::mutex> hold(task->lock);
+  task->waiting = true;
+  task->changed.notify_all();
+  task->changed.wait(hold, [task] { return task->delivered != 0; });
+  task->waiting = false;
+  uint32_t count = task->delivered;
+  task->delivered = clearOnExit ? 0 : count - 1;
+  return count;
+}
+// Lets every task handle what it has been given, until none has more.
+inline void hostRunTasks() {
+  for (bool ran = true; ran;) {
+    ran = false;
+    for (HostTask *task : hostTasks()) {
+      std::unique_lock<std::mutex> hold(task->lock);
+      if (task->queued) {
+        task->delivered += task->queued;
+        task->queued = 0;
+        task->changed.notify_all();
+        ran = true;
+      }
+      task->changed.wait(hold, [task] { return task->waiting && task->delivered == 0; });
+    }
+  }
+}
+
+// The slice of Arduino String the config-facing interfaces take.
+class String {
+  public:
+    String(const char *text = "") : value(text) {}
+    const char *c_str() const { return value.c_str(); }
+    size_t length() const { return value.size(); }
+    bool operator==(const String &other) const { return value == other.value; }
+
+  private:
+    std::string value;
+};
+
+template <class T> static inline T min(T a, T b) { return a < b ? a : b; }
+template <class T> static inline T max(T a, T b) { return a > b ? a : b; }
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+
+#if !defined(__GLIBC__) || !__GLIBC_PREREQ(2, 38)
+static inline size_t strlcpy(char *dst, const char *src, size_t size) {
+  size_t len = strlen(src);
+  if (size) {
+    size_t n = len < size - 1 ? len : size - 1;
+    memcpy(dst, src, n);
+    dst[n] = '\0';
+  }
+  return len;
+}
+#endif
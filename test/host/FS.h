@@ -0,0 +1,156 @@
+#pragma once
+
+// An in-memory filesystem standing in for the SD card.  Directories are the
+// ones made with mkdir() plus every path some file lives under; they list in
+// name order.
+
+#include <Arduino.h>
+#include <map>
+#include <memory>
+#include <set>
+#include <string>
+#include <vector>
+
+#define FILE_READ   "r"
+#define FILE_WRITE  "w"
+#define FILE_APPEND "a"
+
+namespace fs {
+
+typedef std::map<std::string, std::vector<uint8_t>> FileTable;
+
+class FS;
+
+class File {
+  public:
+    File() {}
+    File(FS *owner, const std::string &path, size_t pos, bool directory = false)
+        : owner(owner), path_(path), pos(pos), directory(directory) {}
+
+    operator bool() const;
+    size_t size() const { return *this && !directory ? data().size() : 0; }
+    size_t position() const { return pos; }
+    int available() { return (int)(size() - pos); }
+    bool seek(uint32_t to) {
+      if (!*this || to > size()) return false;
+      pos = to;
+      return true;
+    }
+    size_t read(uint8_t *buf, size_t len);
+    int read() {
+      uint8_t c;
+      return read(&c, 1) == 1 ? c : -1;
+    }
+    size_t write(const uint8_t *buf, size_t len);
+    size_t write(uint8_t c) { return write(&c, 1); }
+    void flush() {}
+    void close() { owner = nullptr; }
+    const char *path() const { return path_.c_str(); }
+    const char *name() const {
+      size_t slash = path_.rfind('/');
+      return path_.c_str() + (slash == std::string::npos ? 0 : slash + 1);
+    }
+    bool isDirectory() { return directory; }
+    time_t getLastWrite() { return 0; }
+    File openNextFile(const char *mode = FILE_READ);
+    void rewindDirectory() { next = 0; }
+
+  private:
+    const std::vector<uint8_t> &data() const;
+
+    FS *owner = nullptr;
+    std::string path_;
+    size_t pos = 0;
+    bool directory = false;
+    std::shared_ptr<std::vector<std::pair<std::string, bool>>> children;   // listed on first openNextFile()
+    size_t next = 0;
+};
+
+class FS {
+  public:
+    File open(const char *path, const char *mode = FILE_READ, bool create = false) {
+      opens++;
+      if (mode[0] == 'r' && !create && isDirectory(path)) return File(this, path, 0, true);
+      if (mode[0] == 'w') files[path].clear();
+      else if (mode[0] == 'a' || create) files[path];
+      if (!files.count(path)) return File();
+      return File(this, path, mode[0] == 'a' ? files[path].size() : 0);
+    }
+    bool exists(const char *path) { return files.count(path) != 0 || isDirectory(path); }
+    bool remove(const char *path) { return files.erase(path) != 0; }
+    bool rename(const char *from, const char *to) {
+      if (!files.count(from)) return false;
+      files[to] = files[from];
+      files.erase(from);
+      return true;
+    }
+    bool mkdir(const char *path) {
+      directories.insert(path);
+      return true;
+    }
+    bool rmdir(const char *path) { return directories.erase(path) != 0; }
+
+    bool isDirectory(const std::string &path) const {
+      if (path == "/" || directories.count(path)) return true;
+      std::string prefix = path + "/";
+      auto it = files.lower_bound(prefix);
+      return it != files.end() && it->first.compare(0, prefix.size(), prefix) == 0;
+    }
+
+    // Names directly under `path`, and whether each is a directory.
+    std::vector<std::pair<std::string, bool>> list(const std::string &path) const {
+      std::string prefix = path == "/" ? path : path + "/";
+      std::map<std::string, bool> names;
+      auto collect = [&](const std::string &entry, bool isDir) {
+        if (entry.compare(0, prefix.size(), prefix) != 0 || entry.size() == prefix.size()) return;
+        size_t slash = entry.find('/', prefix.size());
+        names[entry.substr(prefix.size(), slash - prefix.size())] |= isDir || slash != std::string::npos;
+      };
+      for (auto it = files.lower_bound(prefix); it != files.end() && it->first.compare(0, prefix.size(), prefix) == 0; ++it) {
+        collect(it->first, false);
+      }
+      for (const std::string &dir : directories) collect(dir, true);
+      return std::vector<std::pair<std::string, bool>>(names.begin(), names.end());
+    }
+
+    FileTable files;                     // tests may inspect or corrupt these
+    std::set<std::string> directories;
+    uint32_t opens = 0;                  // open() and openNextFile() calls
+    uint64_t bytesRead = 0;
+};
+
+inline File::operator bool() const { return owner && (directory || owner->files.count(path_)); }
+
+inline const std::vector<uint8_t> &File::data() const { return owner->files.at(path_); }
+
+inline size_t File::read(uint8_t *buf, size_t len) {
+  if (!*this || pos >= size()) return 0;
+  size_t n = min(len, size() - pos);
+  memcpy(buf, &data()[pos], n);
+  pos += n;
+  owner->bytesRead += n;
+  return n;
+}
+
+inline size_t File::write(const uint8_t *buf, size_t len) {
+  if (!*this || directory) return 0;
+  std::vector<uint8_t> &bytes = owner->files[path_];
+  if (bytes.size() < pos + len) bytes.resize(pos + len);
+  memcpy(&bytes[pos], buf, len);
+  pos += len;
+  return len;
+}
+
+inline File File::openNextFile(const char *) {
+  if (!*this || !directory) return File();
+  if (!children) children = std::make_shared<std::vector<std::pair<std::string, bool>>>(owner->list(path_));
+  if (next >= children->size()) return File();
+  const std::pair<std::string, bool> &child = (*children)[next++];
+  owner->opens++;
+  return File(owner, (path_ == "/" ? path_ : path_ + "/") + child.first, 0, child.second);
+}
+
+}  // namespace fs
+
+using fs::File;
+using fs::FS;
@@ -0,0 +1,16 @@
+#pragma once
+#include "FS.h"
+
+enum { CARD_NONE, CARD_MMC, CARD_SD, CARD_SDHC };
+
+class SDMMCFS : public fs::FS {
+  public:
+    bool setPins(int, int, int, int, int, int) { return true; }
+    bool begin(const char *, bool, bool = false, int = 0, uint8_t = 5) { return true; }
+    void end() {}
+    uint8_t cardType() { return CARD_SDHC; }
+    uint64_t cardSize() { return 0; }
+    uint64_t totalBytes() { return 0; }
+    uint64_t usedBytes() { return 0; }
+};
+extern SDMMCFS SD_MMC;
@@ -0,0 +1,9 @@
+#pragma once
+#include <stdint.h>
+#include <chrono>
+
+// Host nanoseconds stand in for the CPU cycle counter.
+static inline uint32_t esp_cpu_get_cycle_count() {
+  using namespace std::chrono;
+  return (uint32_t)duration_cast<nanoseconds>(steady_clock::now().time_since_epoch()).count();
+}
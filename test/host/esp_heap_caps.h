@@ -0,0 +1,15 @@
+#pragma once
+#include <stdlib.h>
+#include <stdint.h>
+
+#define MALLOC_CAP_DEFAULT   (1 << 12)
+#define MALLOC_CAP_8BIT      (1 << 2)
+#define MALLOC_CAP_DMA       (1 << 3)
+#define MALLOC_CAP_SPIRAM    (1 << 10)
+#define MALLOC_CAP_INTERNAL  (1 << 11)
+
+static inline void *heap_caps_malloc(size_t size, uint32_t) { return malloc(size); }
+static inline void *heap_caps_calloc(size_t n, size_t size, uint32_t) { return calloc(n, size); }
+static inline void *heap_caps_realloc(void *ptr, size_t size, uint32_t) { return realloc(ptr, size); }
+static inline void *heap_caps_malloc_prefer(size_t size, size_t, ...) { return malloc(size); }
+static inline void heap_caps_free(void *ptr) { free(ptr); }
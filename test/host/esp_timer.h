@@ -0,0 +1,9 @@
+#pragma once
+#include <stdint.h>
+#include <chrono>
+
+// Wall time, for the benchmarks.
+static inline int64_t esp_timer_get_time() {
+  using namespace std::chrono;
+  return duration_cast<microseconds>(steady_clock::now().time_since_epoch()).count();
+}
@@ -0,0 +1,15 @@
+#pragma once
+
+// Definitions behind the host headers.  Include from exactly one file of
+// each test suite.
+
+#include <Arduino.h>
+#include <SD_MMC.h>
+#include "civil_time.h"
+
+unsigned long hostMillis = 0;
+HardwareSerial Serial;
+SDMMCFS SD_MMC;
+TimeZone timeZone;                       // main.cpp's, for the modules that read it
+
+bool BAT_Is_Charging(void) { return false; }
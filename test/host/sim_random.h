@@ -0,0 +1,23 @@
+#pragma once
+
+// Seeded random numbers for the simulated suites: xorshift64, so a run is the
+// same on every host.  Set `seed` (nonzero) before a simulation.
+
+#include <math.h>
+#include <stdint.h>
+
+static uint64_t seed;
+
+// Uniform in [0, 1).
+static inline double uniform() {
+  seed ^= seed << 13;
+  seed ^= seed >> 7;
+  seed ^= seed << 17;
+  return (seed >> 11) * (1.0 / 9007199254740992.0);
+}
+
+// Standard normal, Box-Muller.
+static inline double gaussian() {
+  double u = uniform() + 1e-12, v = uniform();
+  return sqrt(-2 * log(u)) * cos(2 * M_PI * v);
+}
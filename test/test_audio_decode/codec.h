@@ -0,0 +1,28 @@
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+
+// One vendored decoder behind the calls Audio::sendBytes() makes.  Each is
+// built in its own file: the three define the same helper names.
+struct Codec {
+  const char *name;
+  const char *fixture;                       // under fixtures/
+  uint32_t maxBlockSize;                     // InBuff's, as Audio sets it per codec
+  uint8_t compression;                       // processLocalFile() passes per decode
+  bool (*allocate)();
+  void (*release)();
+  // Reads the header Audio parses before the first frame; returns where the
+  // audio data starts.
+  size_t (*start)(const uint8_t *file, size_t size);
+  int (*findSync)(uint8_t *buf, int len);
+  int (*decode)(uint8_t *buf, int *bytesLeft, int16_t *out);
+  int (*outputSamples)();                    // all channels, last decode
+  int (*sampleRate)();
+  int (*channels)();
+  int ignoredError;                          // sendBytes() carries on past this one
+};
+
+extern const Codec mp3Codec;
+extern const Codec aacCodec;
+extern const Codec flacCodec;
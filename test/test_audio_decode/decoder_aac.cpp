@@ -0,0 +1,17 @@
+// The Helix AAC decoder as Audio drives it, on an ADTS stream.
+
+#include "codec.h"
+#include "../../lib/ESP32-audioI2S/src/aac_decoder/aac_decoder.cpp"
+
+const Codec aacCodec = {
+  "aac", "rooster.aac", 1600, 3,
+  AACDecoder_AllocateBuffers,
+  AACDecoder_FreeBuffers,
+  [](const uint8_t *, size_t) { return (size_t)0; },
+  AACFindSyncWord,
+  [](uint8_t *buf, int *left, int16_t *out) { return AACDecode(buf, left, out); },
+  AACGetOutputSamps,
+  AACGetSampRate,
+  AACGetChannels,
+  0,
+};
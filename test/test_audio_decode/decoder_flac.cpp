@@ -0,0 +1,49 @@
+// The FLAC decoder as Audio drives it.
+
+#include "codec.h"
+#include "../../lib/ESP32-audioI2S/src/flac_decoder/flac_decoder.cpp"
+
+static struct {
+  uint8_t channels, bits;
+  uint32_t sampleRate, totalSamples, dataSize;
+} streamInfo;
+
+// Audio::read_FLAC_Header() walks the metadata blocks and keeps STREAMINFO;
+// findNextSync() hands it to the decoder before every search.
+static size_t flacStart(const uint8_t *file, size_t size) {
+  if (size < 8 || memcmp(file, "fLaC", 4) != 0) return 0;
+  size_t pos = 4;
+  bool last = false;
+  while (!last && pos + 4 <= size) {
+    const uint8_t *block = file + pos;
+    last = block[0] & 0x80;
+    uint32_t length = block[1] << 16 | block[2] << 8 | block[3];
+    if ((block[0] & 0x7f) == 0 && pos + 4 + 18 <= size) {
+      const uint8_t *info = block + 4;
+      streamInfo.sampleRate = info[10] << 12 | info[11] << 4 | info[12] >> 4;
+      streamInfo.channels = ((info[12] >> 1) & 0x07) + 1;
+      streamInfo.bits = ((info[12] & 0x01) << 4 | info[13] >> 4) + 1;
+      streamInfo.totalSamples = (uint32_t)(info[14] << 24 | info[15] << 16 | info[16] << 8 | info[17]);
+    }
+    pos += 4 + length;
+  }
+  streamInfo.dataSize = size - pos;
+  return pos;
+}
+
+const Codec flacCodec = {
+  "flac", "rooster.flac", 4096 * 4, 2,
+  FLACDecoder_AllocateBuffers,
+  FLACDecoder_FreeBuffers,
+  flacStart,
+  [](uint8_t *buf, int len) {
+    FLACSetRawBlockParams(streamInfo.channels, streamInfo.sampleRate, streamInfo.bits, streamInfo.totalSamples,
+                          streamInfo.dataSize);
+    return FLACFindSyncWord(buf, len);
+  },
+  [](uint8_t *buf, int *left, int16_t *out) { return (int)FLACDecode(buf, left, out); },
+  [] { return (int)FLACGetOutputSamps(); },
+  [] { return (int)FLACGetSampRate(); },
+  [] { return (int)FLACGetChannels(); },
+  0,
+};
@@ -0,0 +1,23 @@
+// The Helix MP3 decoder as Audio drives it.
+
+#include "codec.h"
+#include "../../lib/ESP32-audioI2S/src/mp3_decoder/mp3_decoder.cpp"
+
+// Audio::read_ID3_Header() skips an ID3v2 tag ahead of the first frame.
+static size_t mp3Start(const uint8_t *file, size_t size) {
+  if (size < 10 || memcmp(file, "ID3", 3) != 0) return 0;
+  return 10 + ((file[6] & 0x7f) << 21 | (file[7] & 0x7f) << 14 | (file[8] & 0x7f) << 7 | (file[9] & 0x7f));
+}
+
+const Codec mp3Codec = {
+  "mp3", "rooster.mp3", 1600, 3,
+  MP3Decoder_AllocateBuffers,
+  MP3Decoder_FreeBuffers,
+  mp3Start,
+  [](uint8_t *buf, int len) { return MP3FindSyncWord(buf, len); },
+  [](uint8_t *buf, int *left, int16_t *out) { return MP3Decode(buf, left, out, 0); },
+  MP3GetOutputSamps,
+  MP3GetSampRate,
+  MP3GetChannels,
+  ERR_MP3_MAINDATA_UNDERFLOW,
+};
@@ -0,0 +1,226 @@
+// The vendored MP3, AAC and FLAC decoders on the host, driven the way the
+// audio pump drives Audio::loop() for a file on the card: each pass reads up
+// to one chunk into InBuff, and every `compression` passes one frame is
+// decoded (processLocalFile() / playAudioData() / sendBytes()).  Checks that
+// each fixture decodes whole at its format, and reports decode time per
+// frame with the buffering before the pump task (a 300000-byte InBuff, 16 KiB
+// reads) and after it (32 and 4 DMA descriptors of 2 KiB).  FLAC hands each
+// frame out in pieces of up to 2048 samples; each piece counts as a frame.
+//
+// The fixtures are 4.1 s of sd-card/System/alarms/rooster-crowing-in-the-
+// morning-2462-2.wav, 44.1 kHz stereo, encoded with FFmpeg: libmp3lame at
+// 128 kb/s, the native AAC-LC encoder at 128 kb/s into ADTS, and FLAC at the
+// default level.  Host times only track regressions and the ratio between
+// the two buffer set-ups; the device figure is the [Audio] decode=ms/s line of
+// a STATS_LOG build.
+
+#include <unity.h>
+#include "host_shim.h"
+#include "esp_timer.h"
+#include "codec.h"
+#include <string>
+#include <vector>
+
+#define SOURCE_FRAMES   181440                // the WAV the fixtures were made from
+#define DESC_BYTES      (512 * 2 * 2)         // dma_frame_num stereo 16-bit
+#define RESERVE_BYTES   (4096 * 4)            // AudioBuffer's m_resBuffSizePSRAM
+#define ROUNDS          20
+
+void setUp() {}
+void tearDown() {}
+
+// AudioBuffer as InBuff uses it: a ring followed by a reserve that a frame
+// wrapping past the end is completed into, so the decoder reads it whole.
+class InBuff {
+  public:
+    InBuff(size_t allocated, uint32_t maxBlockSize)
+        : mem(allocated), size(allocated - RESERVE_BYTES), maxBlockSize(maxBlockSize) {
+      rd = wr = mem.data();
+      end = mem.data() + size;
+    }
+    size_t writeSpace() const {
+      if (start) return size - 1;
+      if (rd >= wr) return rd - wr - 1;
+      return rd == mem.data() ? end - wr - 1 : end - wr;
+    }
+    size_t freeSpace() const {
+      if (start) return size - 1;
+      return (rd >= wr ? rd - wr : (end - wr) + (rd - mem.data())) - 1;
+    }
+    size_t filled() const { return wr >= rd ? wr - rd : (end - rd) + (wr - mem.data()); }
+    uint8_t *writePtr() { return wr; }
+    void written(size_t n) {
+      wr += n;
+      if (wr == end) wr = mem.data();
+      if (n) start = false;
+    }
+    uint8_t *readPtr() {
+      size_t tail = end - rd;
+      if (tail < maxBlockSize) memcpy(end, mem.data(), maxBlockSize - tail);
+      return rd;
+    }
+    void read(size_t n) {
+      rd += n;
+      if (rd >= end) rd = mem.data() + (rd - end);
+    }
+
+  private:
+    std::vector<uint8_t> mem;
+    size_t size;
+    uint32_t maxBlockSize;
+    uint8_t *rd, *wr, *end;
+    bool start = true;
+};
+
+struct Outcome {
+  uint32_t frames;                           // decode calls that produced samples
+  uint32_t samples;                          // per channel
+  int sampleRate, channels;
+  uint32_t errors;
+  uint32_t passes;
+  uint32_t bytesBeforeFirstFrame;
+  int64_t decodeUs;                          // inside the decoder
+  int64_t maxPassUs;
+};
+
+static std::vector<uint8_t> loadFixture(const char *name) {
+  std::string path = __FILE__;
+  path = path.substr(0, path.rfind('/') + 1) + "fixtures/" + name;
+  std::vector<uint8_t> bytes;
+  FILE *f = fopen(path.c_str(), "rb");
+  if (!f) return bytes;
+  int c;
+  while ((c = fgetc(f)) != EOF) bytes.push_back((uint8_t)c);
+  fclose(f);
+  return bytes;
+}
+
+// One song from the card through InBuff and the decoder.
+static Outcome play(const Codec &codec, size_t inBuffBytes, uint32_t readChunk) {
+  static int16_t outBuff[2048 * 2];          // Audio's m_outBuff
+  File file = SD_MMC.open("/song", FILE_READ);
+  uint8_t header[64 * 1024];
+  size_t headerBytes = file.read(header, sizeof(header));
+  size_t dataStart = codec.start(header, headerBytes);
+  file.seek(dataStart);
+
+  Outcome o = {};
+  InBuff in(inBuffBytes, codec.maxBlockSize);
+  TEST_ASSERT_TRUE(codec.allocate());
+  size_t remaining = file.size() - dataStart;
+  bool streaming = false, playing = false, complete = false;
+  uint8_t cnt = 0;
+  uint32_t bytesRead = 0;
+
+  // One sendBytes(); returns the bytes to drop from InBuff, or -1 to skip on.
+  auto send = [&](uint8_t *data, int len) -> int {
+    if (!playing) {
+      int next = codec.findSync(data, len);
+      if (next == 0) playing = true;
+      return next;
+    }
+    int left = len;
+    int64_t t = esp_timer_get_time();
+    int ret = codec.decode(data, &left, outBuff);
+    o.decodeUs += esp_timer_get_time() - t;
+    int decoded = len - left;
+    if (decoded == 0 && ret == 0) {
+      playing = false;
+      return 1;
+    }
+    if (ret < 0) {
+      if (ret != codec.ignoredError) {
+        o.errors++;
+        playing = false;
+      }
+      return decoded ? decoded : 2;
+    }
+    int samples = codec.outputSamples();     // FLAC's clears itself
+    if (samples) {
+      if (!o.frames) {
+        o.sampleRate = codec.sampleRate();
+        o.channels = codec.channels();
+        o.bytesBeforeFirstFrame = bytesRead;
+      }
+      o.frames++;
+      o.samples += samples / codec.channels();
+    }
+    return decoded;
+  };
+
+  for (;;) {
+    int64_t passStart = esp_timer_get_time();
+    o.passes++;
+    size_t n = min((size_t)readChunk, min(in.writeSpace(), remaining));
+    n = file.read(in.writePtr(), n);
+    in.written(n);
+    remaining -= n;
+    bytesRead += n;
+    if (!streaming) {
+      // Fill the buffer before playing.
+      if (in.freeSpace() > codec.maxBlockSize && remaining > codec.maxBlockSize) continue;
+      streaming = true;
+    }
+    if (complete && in.filled() < codec.maxBlockSize) {
+      // One sendBytes() per pass until it makes no progress.
+      while (in.filled()) {
+        int used = send(in.readPtr(), (int)in.filled());
+        if (used != 0 && used <= 2) break;
+        in.read(used);
+      }
+      break;
+    }
+    if (remaining == 0) complete = true;
+    if (++cnt == codec.compression) {
+      cnt = 0;
+      int used = send(in.readPtr(), codec.maxBlockSize);
+      in.read(used < 0 ? min((size_t)200, in.filled()) : (size_t)used);
+    }
+    o.maxPassUs = max(o.maxPassUs, esp_timer_get_time() - passStart);
+  }
+  codec.release();
+  file.close();
+  return o;
+}
+
+static void test_codec(const Codec &codec) {
+  std::vector<uint8_t> fixture = loadFixture(codec.fixture);
+  TEST_ASSERT_TRUE_MESSAGE(!fixture.empty(), codec.fixture);
+  SD_MMC.files["/song"] = fixture;
+
+  Outcome before = {}, after = {};
+  int64_t beforeUs = INT64_MAX, afterUs = INT64_MAX;
+  for (int round = 0; round < ROUNDS; round++) {
+    before = play(codec, 300000, 16 * 1024);
+    after = play(codec, 32 * DESC_BYTES, 4 * DESC_BYTES);
+    beforeUs = min(beforeUs, before.decodeUs);
+    afterUs = min(afterUs, after.decodeUs);
+  }
+
+  // Every frame of the source, give or take the encoder's priming and
+  // padding, at its rate and channel count.
+  TEST_ASSERT_EQUAL_INT(44100, after.sampleRate);
+  TEST_ASSERT_EQUAL_INT(2, after.channels);
+  TEST_ASSERT_EQUAL_UINT32(0, after.errors);
+  TEST_ASSERT_INT_WITHIN(4096, SOURCE_FRAMES, (int)after.samples);
+  TEST_ASSERT_EQUAL_UINT32(before.samples, after.samples);
+
+  double seconds = after.samples / 44100.0;
+  printf("audio_decode: %-4s %4lu frames, decode %5.1f us/frame before, %5.1f after (%.2f ms per audio s); "
+         "first frame after %6lu bytes before, %5lu after; longest pass %lu us before, %lu after\n",
+         codec.name, (unsigned long)after.frames, (double)beforeUs / before.frames, (double)afterUs / after.frames,
+         afterUs / 1000.0 / seconds, (unsigned long)before.bytesBeforeFirstFrame,
+         (unsigned long)after.bytesBeforeFirstFrame, (unsigned long)before.maxPassUs, (unsigned long)after.maxPassUs);
+}
+
+static void test_mp3() { test_codec(mp3Codec); }
+static void test_aac() { test_codec(aacCodec); }
+static void test_flac() { test_codec(flacCodec); }
+
+int main(int argc, char **argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_mp3);
+  RUN_TEST(test_aac);
+  RUN_TEST(test_flac);
+  return UNITY_END();
+}
@@ -0,0 +1,363 @@
+// AudioMixer rendered on the host: levels, ducking, voice stealing,
+// resampling and clipping, the I2S format around a paused stream, plus a
+// render-cost benchmark and the trigger-to-first-sample latency of a resident
+// tone against one streamed from the card.  Set MIXER_WAV to a
+// path to also write the alarm-over-media mix as a 16-bit stereo WAV.
+
+#include <unity.h>
+#include "host_shim.h"
+#include "audio_mixer.h"
+#include "esp_timer.h"
+#include <string>
+
+#define RATE 44100
+
+static AudioMixer *mixer;
+
+void setUp() { mixer = new AudioMixer(); }
+void tearDown() { delete mixer; }
+
+static int16_t constant[RATE];      // one second of a DC level per test
+static int16_t other[RATE];
+
+static void fill(int16_t *pcm, uint32_t frames, int16_t value) {
+  for (uint32_t i = 0; i < frames; i++) pcm[i] = value;
+}
+
+// Mixes `frames` frames over a constant stream sample; returns the last one.
+static void run(uint32_t frames, int16_t stream, int16_t out[2], uint32_t rate = RATE) {
+  for (uint32_t i = 0; i < frames; i++) {
+    out[0] = out[1] = stream;
+    mixer->mixFrame(out, rate);
+  }
+}
+
+static void test_voice_plays_at_unity_then_ends() {
+  fill(constant, 1000, 1000);
+  TEST_ASSERT_TRUE(mixer->play(constant, 1000, 1, RATE, AUDIO_PRIORITY_UI));
+  int16_t out[2];
+  run(500, 0, out);
+  TEST_ASSERT_EQUAL_INT(1000, out[0]);
+  TEST_ASSERT_EQUAL_INT(1000, out[1]);
+  run(AUDIO_MIXER_BLOCK_FRAMES * 10, 0, out);
+  TEST_ASSERT_FALSE(mixer->isPlaying(constant));
+  TEST_ASSERT_EQUAL_INT(0, out[0]);
+}
+
+static void test_alarm_ducks_stream_and_lower_voices() {
+  fill(constant, RATE, 8000);                 // UI click
+  fill(other, RATE, 4000);                    // alarm
+  mixer->play(constant, RATE, 1, RATE, AUDIO_PRIORITY_UI);
+  mixer->play(other, RATE, 1, RATE, AUDIO_PRIORITY_ALARM);
+  int16_t out[2];
+  run(AUDIO_MIXER_BLOCK_FRAMES * 12, 16000, out);   // well past the ~23 ms ramp
+  // stream and UI at -12 dB, alarm at unity.
+  TEST_ASSERT_INT_WITHIN(3, 16000 / 4 + 8000 / 4 + 4000, out[0]);
+
+  mixer->stop(other);
+  run(AUDIO_MIXER_BLOCK_FRAMES * 12, 16000, out);
+  TEST_ASSERT_INT_WITHIN(3, 16000 + 8000, out[0]);
+}
+
+static void test_stop_leaves_other_voices() {
+  fill(constant, RATE, 1000);
+  fill(other, RATE, 2000);
+  mixer->play(constant, RATE, 1, RATE, AUDIO_PRIORITY_TIMER);
+  mixer->play(other, RATE, 1, RATE, AUDIO_PRIORITY_ALARM);
+  mixer->stop(constant);
+  TEST_ASSERT_FALSE(mixer->isPlaying(constant));
+  TEST_ASSERT_TRUE(mixer->isPlaying(other));
+  int16_t out[2];
+  run(AUDIO_MIXER_BLOCK_FRAMES * 2, 0, out);
+  TEST_ASSERT_INT_WITHIN(2, 2000, out[0]);
+}
+
+static void test_full_mixer_steals_oldest_lowest() {
+  static int16_t voices[AUDIO_MIXER_VOICES + 1][16];
+  for (int i = 0; i < AUDIO_MIXER_VOICES; i++) {
+    TEST_ASSERT_TRUE(mixer->play(voices[i], 16, 1, RATE, i == 0 ? AUDIO_PRIORITY_TIMER : AUDIO_PRIORITY_UI));
+  }
+  // Oldest UI voice (1) goes, the older timer voice stays.
+  TEST_ASSERT_TRUE(mixer->play(voices[AUDIO_MIXER_VOICES], 16, 1, RATE, AUDIO_PRIORITY_UI));
+  TEST_ASSERT_TRUE(mixer->isPlaying(voices[0]));
+  TEST_ASSERT_FALSE(mixer->isPlaying(voices[1]));
+  TEST_ASSERT_TRUE(mixer->isPlaying(voices[2]));
+
+  // Nothing outranks an alarm, so a full mixer of alarms turns a UI sound away.
+  for (int i = 0; i < AUDIO_MIXER_VOICES; i++) mixer->play(voices[i], 16, 1, RATE, AUDIO_PRIORITY_ALARM);
+  TEST_ASSERT_FALSE(mixer->play(voices[AUDIO_MIXER_VOICES], 16, 1, RATE, AUDIO_PRIORITY_UI));
+}
+
+static void test_resamples_with_interpolation() {
+  // A 22.05 kHz ramp played at 44.1 kHz: every other output frame falls
+  // halfway between two source frames.
+  for (int i = 0; i < 64; i++) constant[i] = (int16_t)(i * 100);
+  mixer->play(constant, 64, 1, RATE / 2, AUDIO_PRIORITY_UI);
+  int16_t out[2] = { 0, 0 };
+  int16_t got[8];
+  for (int i = 0; i < 8; i++) {
+    out[0] = out[1] = 0;
+    mixer->mixFrame(out, RATE);
+    got[i] = out[0];
+  }
+  for (int i = 0; i < 8; i++) TEST_ASSERT_INT_WITHIN(1, i * 50, got[i]);
+}
+
+static void test_stereo_voice_and_clipping() {
+  int16_t stereo[2 * 256];
+  for (int i = 0; i < 256; i++) {
+    stereo[2 * i] = 30000;
+    stereo[2 * i + 1] = -30000;
+  }
+  mixer->play(stereo, 256, 2, RATE, AUDIO_PRIORITY_UI);
+  int16_t out[2];
+  run(16, 20000, out);
+  TEST_ASSERT_EQUAL_INT(INT16_MAX, out[0]);
+  TEST_ASSERT_INT_WITHIN(2, -10000, out[1]);
+}
+
+// The slice of the Audio library the pump drives.  Like the real decoders,
+// loop() programs the stream's format once, on its first frame.
+struct FakeStream {
+  bool running = false;
+  bool paramsSet = false;
+  uint32_t sampleRate = 16000;
+  uint8_t bits = 16;
+  uint32_t framesWritten = 0;
+
+  bool isRunning() { return running; }
+  void pauseResume() { running = !running; }
+  uint32_t getSampleRate() { return sampleRate; }
+  uint8_t getBitsPerSample() { return bits; }
+  bool setSampleRate(uint32_t hz) { sampleRate = hz; return true; }
+  bool setBitsPerSample(int b) { bits = (uint8_t)b; return true; }
+  void loop() {
+    if (!paramsSet) {
+      sampleRate = 48000;
+      bits = 8;
+      paramsSet = true;
+    }
+    int16_t frame[2] = { 0, 0 };
+    for (int i = 0; i < 64; i++) mixer->mixFrame(frame, sampleRate);
+  }
+  size_t writePCM(const int16_t *samples, size_t frames, uint8_t channels, uint32_t rate) {
+    if (sampleRate != rate) setSampleRate(rate);
+    setBitsPerSample(16);
+    int16_t frame[2];
+    for (size_t i = 0; i < frames; i++) {
+      frame[0] = frame[1] = samples[i * channels];
+      mixer->mixFrame(frame, sampleRate);
+    }
+    framesWritten += frames;
+    return frames;
+  }
+};
+
+// A 22.05 kHz tone over paused 48 kHz 8-bit media: the tone gets its own
+// rate on I2S, and the media plays on at its own once resumed.
+static void test_tone_over_paused_stream_keeps_its_format() {
+  static const int16_t silence[512] = {};
+  FakeStream stream;
+  stream.running = true;
+  mixer->pump(stream, silence, 512);
+  TEST_ASSERT_EQUAL_UINT32(48000, stream.sampleRate);
+
+  stream.pauseResume();
+  fill(constant, 2048, 1000);
+  mixer->play(constant, 2048, 1, RATE / 2, AUDIO_PRIORITY_TIMER);
+  while (mixer->isPlaying(constant)) mixer->pump(stream, silence, 512);
+  TEST_ASSERT_EQUAL_UINT32(RATE / 2, stream.sampleRate);
+  TEST_ASSERT_EQUAL_UINT8(16, stream.bits);
+  TEST_ASSERT_TRUE(stream.framesWritten > 0);
+
+  stream.pauseResume();
+  mixer->pump(stream, silence, 512);
+  TEST_ASSERT_EQUAL_UINT32(48000, stream.sampleRate);
+  TEST_ASSERT_EQUAL_UINT8(8, stream.bits);
+
+  // A second pause starts over from the resumed format.
+  stream.pauseResume();
+  mixer->play(constant, 2048, 1, RATE, AUDIO_PRIORITY_UI);
+  mixer->pump(stream, silence, 512);
+  TEST_ASSERT_EQUAL_UINT32(RATE, stream.sampleRate);
+  stream.pauseResume();
+  mixer->pump(stream, silence, 512);
+  TEST_ASSERT_EQUAL_UINT32(48000, stream.sampleRate);
+}
+
+static void writeLE(FILE *f, uint32_t v, int bytes) {
+  for (int i = 0; i < bytes; i++) fputc((v >> (8 * i)) & 0xff, f);
+}
+
+// Two seconds of a 440 Hz "media" tone with a 1 kHz timer beep from 0.5 s
+// and a 880 Hz alarm from 1 s, stereo 16-bit at 44.1 kHz.
+static void test_render_alarm_over_media() {
+  static int16_t beep[RATE / 4], alarm[RATE];
+  for (int i = 0; i < RATE / 4; i++) beep[i] = (int16_t)(6000 * sin(2 * M_PI * 1000 * i / RATE));
+  for (int i = 0; i < RATE; i++) alarm[i] = (int16_t)(12000 * sin(2 * M_PI * 880 * i / RATE));
+
+  static int16_t pcm[2 * RATE * 2];
+  int32_t peak = 0;
+  for (int i = 0; i < 2 * RATE; i++) {
+    if (i == RATE / 2) mixer->play(beep, RATE / 4, 1, RATE, AUDIO_PRIORITY_TIMER);
+    if (i == RATE) mixer->play(alarm, RATE, 1, RATE, AUDIO_PRIORITY_ALARM);
+    int16_t s = (int16_t)(16000 * sin(2 * M_PI * 440 * i / RATE));
+    int16_t frame[2] = { s, s };
+    mixer->mixFrame(frame, RATE);
+    pcm[2 * i] = frame[0];
+    pcm[2 * i + 1] = frame[1];
+    if (i >= RATE + RATE / 10 && abs(frame[0]) > peak) peak = abs(frame[0]);
+  }
+  // Once ducked, media (16000 / 4) plus the alarm stays well clear of clipping.
+  TEST_ASSERT_LESS_OR_EQUAL(16000 / 4 + 12000 + 4, peak);
+
+  const char *path = getenv("MIXER_WAV");
+  if (!path) return;
+  FILE *f = fopen(path, "wb");
+  TEST_ASSERT_NOT_NULL(f);
+  uint32_t dataBytes = sizeof(pcm);
+  fwrite("RIFF", 1, 4, f); writeLE(f, 36 + dataBytes, 4); fwrite("WAVE", 1, 4, f);
+  fwrite("fmt ", 1, 4, f); writeLE(f, 16, 4); writeLE(f, 1, 2); writeLE(f, 2, 2);
+  writeLE(f, RATE, 4); writeLE(f, RATE * 4, 4); writeLE(f, 4, 2); writeLE(f, 16, 2);
+  fwrite("data", 1, 4, f); writeLE(f, dataBytes, 4);
+  for (size_t i = 0; i < sizeof(pcm) / sizeof(pcm[0]); i++) writeLE(f, (uint16_t)pcm[i], 2);
+  fclose(f);
+  printf("mixer: wrote %s\n", path);
+}
+
+// Host time per output frame with every voice busy and resampling.  The
+// device figure is the [Mixer] cycles/frame line of a STATS_LOG build; the
+// host number only tracks regressions in the render loop.
+static void test_benchmark_render() {
+  static int16_t pcm[AUDIO_MIXER_VOICES][RATE];
+  for (int v = 0; v < AUDIO_MIXER_VOICES; v++) {
+    for (int i = 0; i < RATE; i++) pcm[v][i] = (int16_t)(8000 * sin(2 * M_PI * (300 + 100 * v) * i / RATE));
+  }
+  const uint32_t frames = RATE * 10;
+  int64_t start = esp_timer_get_time();
+  for (uint32_t i = 0; i < frames; i++) {
+    if (i % RATE == 0) {
+      for (int v = 0; v < AUDIO_MIXER_VOICES; v++) mixer->play(pcm[v], RATE, 1, v & 1 ? 22050 : RATE, AUDIO_PRIORITY_UI);
+    }
+    int16_t frame[2] = { 1000, 1000 };
+    mixer->mixFrame(frame, RATE);
+  }
+  double nsPerFrame = (esp_timer_get_time() - start) * 1000.0 / frames;
+  printf("mixer: %d voices, %.1f ns per output frame on the host (%.3f%% of a host core at 44.1 kHz)\n",
+         AUDIO_MIXER_VOICES, nsPerFrame, nsPerFrame * RATE / 1e7);
+  TEST_ASSERT_TRUE(nsPerFrame > 0);
+}
+
+#define DESC_FRAMES     512                            // dma_frame_num
+#define DESC_BYTES      (DESC_FRAMES * 2 * 2)
+#define INBUFF_BYTES    (32 * DESC_BYTES - 4096 * 4)   // AUDIO_INBUFF_DESCS less the reserve
+#define READ_BYTES      (4 * DESC_BYTES)               // AUDIO_READ_DESCS
+#define WAV_FRAME_BYTES 1024                           // Audio's m_frameSizeWav
+#define ALARM_TONE      "alarm-clock-beep-988-2.wav"   // the default alarm
+
+// A WAV tone as Audio::processLocalFile() plays it after connecttoFS(): the
+// first pass only starts the connection, the header is parsed once more than
+// a frame is buffered, and nothing reaches I2S until InBuff is full.
+struct StreamedTone : FakeStream {
+  File file;
+  size_t filled = 0;
+  bool firstCall = true;
+  bool header = false;
+  bool streaming = false;
+
+  bool isRunning() { return true; }
+  void loop() {
+    static uint8_t chunk[READ_BYTES];
+    if (firstCall) {
+      firstCall = false;
+      return;
+    }
+    filled += file.read(chunk, min((size_t)READ_BYTES, (size_t)INBUFF_BYTES - 1 - filled));
+    if (!streaming) {
+      if (!header) {
+        if (filled > WAV_FRAME_BYTES) {
+          filled -= 44;                                // RIFF, fmt and data headers
+          header = true;
+        }
+        return;
+      }
+      if (INBUFF_BYTES - 1 - filled > WAV_FRAME_BYTES && file.available() > WAV_FRAME_BYTES) return;
+      streaming = true;
+    }
+    filled -= WAV_FRAME_BYTES;
+    framesWritten += WAV_FRAME_BYTES / 4;
+  }
+};
+
+// Trigger to first sample in audio pump passes.  A pass that writes nothing
+// waits for the DMA to retire a descriptor (11.6 ms at 44.1 kHz) before the
+// next, so passes before the first sample are what an SD-streamed trigger
+// costs beyond its card reads; a resident tone is mixed into the first pass.
+// The device figures are the [Audio] first sample (bank) line of a STATS_LOG
+// build and the (sd) line of the _stats_streamed build.
+static void test_trigger_to_first_sample() {
+  static const int16_t silence[DESC_FRAMES] = {};
+  std::string path = __FILE__;
+  path = path.substr(0, path.rfind("/test/") + 1) + "sd-card/System/alarms/" ALARM_TONE;
+  FILE *f = fopen(path.c_str(), "rb");
+  TEST_ASSERT_NOT_NULL_MESSAGE(f, path.c_str());
+  std::vector<uint8_t> &wav = SD_MMC.files["/" ALARM_TONE];
+  wav.clear();
+  int c;
+  while ((c = fgetc(f)) != EOF) wav.push_back((uint8_t)c);
+  fclose(f);
+
+  // Before the bank: the tone streams from the card.
+  StreamedTone streamed;
+  uint64_t bytes = SD_MMC.bytesRead;
+  streamed.file = SD_MMC.open("/" ALARM_TONE);
+  uint32_t streamedPasses = 0;
+  while (streamed.framesWritten == 0) {
+    mixer->pump(streamed, silence, DESC_FRAMES);
+    streamedPasses++;
+  }
+  bytes = SD_MMC.bytesRead - bytes;
+
+  // Resident: the loader decoded it to mono PCM ahead of time.
+  static int16_t pcm[RATE];
+  for (int i = 0; i < RATE; i++) pcm[i] = (int16_t)(8000 * sin(2 * M_PI * 988 * i / RATE));
+  FakeStream idle;
+  int64_t residentUs = INT64_MAX;
+  uint32_t residentPasses = 0;
+  for (int round = 0; round < 20; round++) {
+    mixer->stop(nullptr);
+    idle.framesWritten = 0;
+    residentPasses = 0;
+    int64_t start = esp_timer_get_time();
+    mixer->play(pcm, RATE, 1, RATE, AUDIO_PRIORITY_ALARM);
+    while (idle.framesWritten == 0) {
+      mixer->pump(idle, silence, DESC_FRAMES);
+      residentPasses++;
+    }
+    residentUs = min(residentUs, esp_timer_get_time() - start);
+  }
+
+  TEST_ASSERT_EQUAL_UINT32(1, residentPasses);
+  TEST_ASSERT_GREATER_OR_EQUAL(INBUFF_BYTES / READ_BYTES, streamedPasses - 1);
+  TEST_ASSERT_GREATER_OR_EQUAL(INBUFF_BYTES - WAV_FRAME_BYTES, bytes);
+  double descMs = DESC_FRAMES * 1000.0 / RATE;
+  printf("mixer: trigger to first sample, streamed %lu passes (%.1f ms of DMA waits, %llu bytes read first), "
+         "resident %lu pass (%lld us on the host, no card reads)\n",
+         (unsigned long)streamedPasses, (streamedPasses - 1) * descMs, (unsigned long long)bytes,
+         (unsigned long)residentPasses, (long long)residentUs);
+}
+
+int main(int argc, char **argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_voice_plays_at_unity_then_ends);
+  RUN_TEST(test_alarm_ducks_stream_and_lower_voices);
+  RUN_TEST(test_stop_leaves_other_voices);
+  RUN_TEST(test_full_mixer_steals_oldest_lowest);
+  RUN_TEST(test_resamples_with_interpolation);
+  RUN_TEST(test_stereo_voice_and_clipping);
+  RUN_TEST(test_tone_over_paused_stream_keeps_its_format);
+  RUN_TEST(test_render_alarm_over_media);
+  RUN_TEST(test_benchmark_render);
+  RUN_TEST(test_trigger_to_first_sample);
+  return UNITY_END();
+}
@@ -0,0 +1,163 @@
+// CalendarStore's one-pass hash merge against the per-day pairwise title
+// check it replaced, on synthetic calendars: 16 busy days, 1-8 feeds, up to
+// 5000 events.  Feeds after the first carry 20% renamed copies of feed 0's
+// events under the same UID and 20% copies re-shared under a new UID.
+
+#include <unity.h>
+#include "host_shim.h"
+#include "calendar_store.h"
+#include "civil_time.h"
+#include "esp_timer.h"
+#include <algorithm>
+
+#define DAYS  16
+
+static uint32_t seed;
+static uint32_t nextRandom() {
+  seed = seed * 1664525u + 1013904223u;
+  return seed >> 8;
+}
+
+void setUp() {
+  TEST_ASSERT_TRUE(timeZone.set("CET-1CEST,M3.5.0,M10.5.0/3"));
+  seed = 12345;
+}
+void tearDown() {}
+
+struct Calendars {
+  std::vector<std::vector<CalendarEvent>> feeds;
+  uint32_t renamed = 0;                    // same UID, new title: only the new merge drops these
+  uint32_t reshared = 0;                   // new UID, same title and hour: both drop these
+};
+
+static CalendarEvent makeEvent(const char *title, time_t start, uint32_t uid) {
+  CalendarEvent event = {};
+  strlcpy(event.title, title, sizeof(event.title));
+  event.startTimestamp = start;
+  event.endTimestamp = start + 30 * 60;
+  event.uidHash = uid;
+  event.instance = start;
+  return event;
+}
+
+static Calendars generate(time_t firstDay, uint32_t total, uint8_t feeds) {
+  Calendars cals;
+  cals.feeds.resize(feeds);
+  uint32_t perFeed = total / feeds;
+  char title[sizeof(CalendarEvent::title)];
+  for (uint32_t i = 0; i < perFeed; i++) {
+    time_t start = firstDay + (time_t)(nextRandom() % DAYS) * 86400 + (8 + nextRandom() % 12) * 3600 +
+                   (nextRandom() % 4) * 900;
+    snprintf(title, sizeof(title), "Meeting %u", i);
+    cals.feeds[0].push_back(makeEvent(title, start, 0x10000 + i));
+  }
+  for (uint8_t f = 1; f < feeds; f++) {
+    for (uint32_t i = 0; i < perFeed; i++) {
+      uint32_t kind = nextRandom() % 10;
+      const CalendarEvent &original = cals.feeds[0][i];        // each original copied once per feed
+      if (kind < 2) {
+        snprintf(title, sizeof(title), "%.100s (feed %u)", original.title, f);
+        cals.feeds[f].push_back(makeEvent(title, original.startTimestamp, original.uidHash));
+        cals.renamed++;
+      } else if (kind < 4) {
+        cals.feeds[f].push_back(makeEvent(original.title, original.startTimestamp, 0x900000 + f * 65536 + i));
+        cals.reshared++;
+      } else {
+        time_t start = firstDay + (time_t)(nextRandom() % DAYS) * 86400 + (8 + nextRandom() % 12) * 3600;
+        snprintf(title, sizeof(title), "Feed %u event %u", f, i);
+        cals.feeds[f].push_back(makeEvent(title, start, 0x20000 + f * 65536 + i));
+      }
+    }
+  }
+  return cals;
+}
+
+// The old query: the day's events in start order, each kept unless one
+// already kept has the same title in the same local hour.
+static size_t pairwiseDay(const std::vector<CalendarEvent> &sorted, time_t dayStart, time_t dayEnd,
+                          std::vector<CalendarEvent> &out) {
+  out.clear();
+  auto it = std::lower_bound(sorted.begin(), sorted.end(), dayStart, [](const CalendarEvent &e, time_t t) {
+    return e.startTimestamp < t;
+  });
+  for (; it != sorted.end() && it->startTimestamp < dayEnd; ++it) {
+    const CalendarEvent &event = *it;
+    time_t hour = timeZone.utcToLocal(event.startTimestamp) / 3600;
+    bool isDuplicate = false;
+    for (const CalendarEvent &existing : out) {
+      if (strcmp(existing.title, event.title) == 0 && timeZone.utcToLocal(existing.startTimestamp) / 3600 == hour) {
+        isDuplicate = true;
+        break;
+      }
+    }
+    if (!isDuplicate) out.push_back(event);
+  }
+  return out.size();
+}
+
+struct Result {
+  size_t oldShown, newShown;
+  double oldMs, newMs, mergeMs;
+};
+
+static Result compare(uint32_t total, uint8_t feedCount) {
+  time_t firstDay = timeZone.startOfDay(1792368000);          // 2026-10-19, over the DST change
+  Calendars cals = generate(firstDay, total, feedCount);
+
+  std::vector<CalendarEvent> sorted;
+  for (const auto &feed : cals.feeds) sorted.insert(sorted.end(), feed.begin(), feed.end());
+  std::stable_sort(sorted.begin(), sorted.end(), [](const CalendarEvent &a, const CalendarEvent &b) {
+    return a.startTimestamp < b.startTimestamp;
+  });
+
+  Result result = {};
+  std::vector<CalendarEvent> out;
+  int64_t t0 = esp_timer_get_time();
+  for (int d = 0; d < DAYS; d++) {
+    time_t dayStart = timeZone.startOfDay(firstDay, d);
+    result.oldShown += pairwiseDay(sorted, dayStart, timeZone.startOfDay(dayStart, 1), out);
+  }
+  result.oldMs = (esp_timer_get_time() - t0) / 1000.0;
+
+  CalendarStore store;
+  for (uint8_t f = 0; f < feedCount; f++) {
+    store.replaceFeed(f, f + 1, firstDay, timeZone.startOfDay(firstDay, DAYS), cals.feeds[f], firstDay);
+  }
+  result.mergeMs = store.mergeMicros() / 1000.0;
+  t0 = esp_timer_get_time();
+  for (int d = 0; d < DAYS; d++) {
+    time_t dayStart = timeZone.startOfDay(firstDay, d);
+    store.query(dayStart, timeZone.startOfDay(dayStart, 1), out);
+    result.newShown += out.size();
+  }
+  result.newMs = result.mergeMs + (esp_timer_get_time() - t0) / 1000.0;
+
+  // Re-shared copies go either way; renamed ones only with the UID key.
+  TEST_ASSERT_EQUAL_UINT32(sorted.size() - cals.reshared, result.oldShown);
+  TEST_ASSERT_EQUAL_UINT32(result.oldShown - cals.renamed, result.newShown);
+  TEST_ASSERT_EQUAL_UINT32(cals.renamed + cals.reshared, store.duplicates());
+  return result;
+}
+
+static void test_merge_matches_pairwise_rule() {
+  compare(200, 1);
+  compare(200, 3);
+}
+
+static void test_benchmark_merge() {
+  static const struct { uint32_t total; uint8_t feeds; } cases[] = {
+    { 500, 1 }, { 2000, 4 }, { 5000, 1 }, { 5000, 8 },
+  };
+  for (const auto &c : cases) {
+    Result r = compare(c.total, c.feeds);
+    printf("calendar_merge: %u events, %u feeds: pairwise %.2f ms (%u shown), merge %.2f ms + queries = %.2f ms (%u shown)\n",
+           (unsigned)c.total, c.feeds, r.oldMs, (unsigned)r.oldShown, r.mergeMs, r.newMs, (unsigned)r.newShown);
+  }
+}
+
+int main(int argc, char **argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_merge_matches_pairwise_rule);
+  RUN_TEST(test_benchmark_merge);
+  return UNITY_END();
+}
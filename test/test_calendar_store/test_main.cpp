@@ -0,0 +1,330 @@
+// CalendarStore: the day index, cross-feed duplicate removal, feed
+// replacement and coverage, the SD copy, day stepping across DST, and a
+// scripted week of day views against the fetch per view it replaced.
+
+#include <unity.h>
+#include "host_shim.h"
+#include "calendar_store.h"
+#include "civil_time.h"
+
+static const int64_t HOUR = 3600;
+
+void setUp() {
+  Serial.quiet = true;
+  TEST_ASSERT_TRUE(timeZone.set("CET-1CEST,M3.5.0,M10.5.0/3"));
+  SD_MMC.remove(CALENDAR_STORE_PATH);
+}
+void tearDown() {}
+
+static time_t local(int year, int month, int day, int hour = 0, int minute = 0) {
+  CivilTime civil = { (int16_t)year, (uint8_t)month, (uint8_t)day, (uint8_t)hour, (uint8_t)minute, 0 };
+  return timeZone.fromLocal(civil);
+}
+
+static CalendarEvent event(const char *title, time_t start, time_t end, uint32_t uid = 0, time_t instance = 0) {
+  CalendarEvent e = {};
+  strlcpy(e.title, title, sizeof(e.title));
+  e.startTimestamp = start;
+  e.endTimestamp = end;
+  e.uidHash = uid;
+  e.instance = instance ? instance : start;
+  return e;
+}
+
+static std::vector<CalendarEvent> day(CalendarStore &store, time_t dayStart) {
+  std::vector<CalendarEvent> out;
+  store.query(dayStart, timeZone.startOfDay(dayStart, 1), out);
+  return out;
+}
+
+static void test_query_uses_longest_duration() {
+  CalendarStore store;
+  time_t d = local(2026, 10, 19);
+  std::vector<CalendarEvent> feed = {
+    event("Trip", d - 3 * 24 * HOUR, d + 2 * 24 * HOUR),     // started three days ago
+    event("Standup", d + 9 * HOUR, d + 9 * HOUR + 900),
+    event("Yesterday", d - 2 * HOUR, d),                       // ends at midnight
+    event("Reminder", d, d),                                   // zero length at midnight
+    event("Tomorrow", d + 24 * HOUR, d + 25 * HOUR),
+  };
+  store.replaceFeed(0, 1, d, d + 2 * 24 * HOUR, feed, d);
+
+  std::vector<CalendarEvent> shown = day(store, d);
+  TEST_ASSERT_EQUAL(3, (int)shown.size());
+  TEST_ASSERT_EQUAL_STRING("Trip", shown[0].title);
+  TEST_ASSERT_EQUAL_STRING("Reminder", shown[1].title);
+  TEST_ASSERT_EQUAL_STRING("Standup", shown[2].title);
+}
+
+static void test_duplicates_across_feeds() {
+  CalendarStore store;
+  time_t d = local(2026, 10, 19);
+  time_t nine = d + 9 * HOUR;
+  // Feed 0: the user's own calendar.
+  store.replaceFeed(0, 1, d, d + 24 * HOUR, { event("Team  sync", nine, nine + HOUR, 0xaaaa) }, d);
+  // Feed 1: the same occurrence by UID, a copy under a new UID, and its own event.
+  store.replaceFeed(1, 2, d, d + 24 * HOUR, {
+    event("Team sync", nine, nine + HOUR, 0xaaaa),
+    event("team SYNC", nine + 1800, nine + HOUR, 0xbbbb),           // same local hour
+    event("Team sync", nine + 2 * HOUR, nine + 3 * HOUR, 0xcccc),   // a later hour: distinct
+  }, d);
+
+  std::vector<CalendarEvent> shown = day(store, d);
+  TEST_ASSERT_EQUAL(2, (int)shown.size());
+  TEST_ASSERT_EQUAL_STRING("Team  sync", shown[0].title);           // the lower feed wins
+  TEST_ASSERT_EQUAL_UINT32(0xcccc, shown[1].uidHash);
+  TEST_ASSERT_EQUAL(2, (int)store.duplicates());
+
+  // Feed 0 drops the event: feed 1's copy takes its place.
+  store.replaceFeed(0, 1, d, d + 24 * HOUR, {}, d);
+  shown = day(store, d);
+  TEST_ASSERT_EQUAL(2, (int)shown.size());
+  TEST_ASSERT_EQUAL_STRING("Team sync", shown[0].title);
+}
+
+static void test_feeds_replace_and_cover() {
+  CalendarStore store;
+  time_t d = local(2026, 10, 19);
+  time_t start, end;
+  CalendarStore::windowFor(d, start, end);
+  store.replaceFeed(0, 1, start, end, { event("A", d + HOUR, d + 2 * HOUR) }, d);
+  store.replaceFeed(1, 2, start, end, { event("B", d + 3 * HOUR, d + 4 * HOUR) }, d);
+  TEST_ASSERT_TRUE(store.covers(d, timeZone.startOfDay(d, 1)));
+  TEST_ASSERT_FALSE(store.covers(end, timeZone.startOfDay(end, 1)));
+  TEST_ASSERT_TRUE(store.fresh(d));
+  TEST_ASSERT_FALSE(store.fresh(d + CALENDAR_STORE_MAX_AGE_S));
+
+  // Feed 1 refetched with new events; feed 0 keeps its own.
+  store.replaceFeed(1, 2, start, end, { event("C", d + 5 * HOUR, d + 6 * HOUR) }, d);
+  std::vector<CalendarEvent> shown = day(store, d);
+  TEST_ASSERT_EQUAL(2, (int)shown.size());
+  TEST_ASSERT_EQUAL_STRING("A", shown[0].title);
+  TEST_ASSERT_EQUAL_STRING("C", shown[1].title);
+
+  store.setFeedCount(1);
+  TEST_ASSERT_EQUAL(1, (int)store.size());
+  TEST_ASSERT_EQUAL(1, store.feeds());
+}
+
+static void test_sd_copy_round_trip() {
+  time_t d = local(2026, 10, 19);
+  {
+    CalendarStore store;
+    store.replaceFeed(0, CalendarStore::hashUrl("https://a/cal.ics"), d, d + 24 * HOUR,
+                      { event("A", d + HOUR, d + 2 * HOUR, 7) }, d);
+    store.replaceFeed(1, CalendarStore::hashUrl("https://b/cal.ics"), d, d + 24 * HOUR,
+                      { event("B", d + 3 * HOUR, d + 4 * HOUR, 8) }, d);
+    TEST_ASSERT_TRUE(store.save());
+  }
+
+  CalendarStore same;
+  TEST_ASSERT_TRUE(same.load({ "https://a/cal.ics", "https://b/cal.ics" }));
+  TEST_ASSERT_EQUAL(2, (int)same.size());
+  TEST_ASSERT_TRUE(same.covers(d, d + 24 * HOUR));
+
+  // The second URL changed: its events go and the day is no longer covered.
+  CalendarStore changed;
+  TEST_ASSERT_TRUE(changed.load({ "https://a/cal.ics", "https://c/cal.ics" }));
+  std::vector<CalendarEvent> shown = day(changed, d);
+  TEST_ASSERT_EQUAL(1, (int)shown.size());
+  TEST_ASSERT_EQUAL_STRING("A", shown[0].title);
+  TEST_ASSERT_FALSE(changed.covers(d, d + 24 * HOUR));
+
+  // A file of the wrong length is refused.
+  SD_MMC.open(CALENDAR_STORE_PATH, FILE_APPEND).write((const uint8_t *)"x", 1);
+  CalendarStore corrupt;
+  TEST_ASSERT_FALSE(corrupt.load({ "https://a/cal.ics" }));
+}
+
+// CalendarFetcher::nextDay()/prevDay() step with startOfDay(); a fixed
+// 86400 s lands on 01:00 or 23:00 after a DST change.
+static void test_day_steps_across_dst() {
+  time_t spring = local(2026, 3, 29);
+  time_t next = timeZone.startOfDay(spring, 1);
+  TEST_ASSERT_EQUAL_INT64(23 * HOUR, (int64_t)(next - spring));
+  TEST_ASSERT_EQUAL_INT64(local(2026, 3, 30), next);
+  TEST_ASSERT_EQUAL_INT64(spring, timeZone.startOfDay(next, -1));
+
+  time_t autumn = local(2026, 10, 25);
+  next = timeZone.startOfDay(autumn, 1);
+  TEST_ASSERT_EQUAL_INT64(25 * HOUR, (int64_t)(next - autumn));
+  TEST_ASSERT_EQUAL_INT64(autumn, timeZone.startOfDay(next, -1));
+
+  CivilTime civil;
+  timeZone.toLocal(spring + 86400, civil);
+  TEST_ASSERT_EQUAL(1, civil.hour);
+  timeZone.toLocal(autumn + 86400, civil);
+  TEST_ASSERT_EQUAL(23, civil.hour);
+
+  // An event late on the short day belongs to it, not to the next one.
+  CalendarStore store;
+  store.replaceFeed(0, 1, spring, next,
+                    { event("Late", local(2026, 3, 29, 23, 30), local(2026, 3, 29, 23, 45)) }, spring);
+  TEST_ASSERT_EQUAL(1, (int)day(store, spring).size());
+  TEST_ASSERT_EQUAL(0, (int)day(store, timeZone.startOfDay(spring, 1)).size());
+
+  time_t start, end;
+  CalendarStore::windowFor(spring, start, end);
+  timeZone.toLocal(end, civil);
+  TEST_ASSERT_EQUAL(0, civil.hour);
+  TEST_ASSERT_EQUAL(13, civil.day);
+  TEST_ASSERT_EQUAL(4, civil.month);
+}
+
+// A scripted week of day views, answered the way CalendarFetcher::requestDay()
+// answers them (from the store when the day is covered and fresh, else a
+// fetch) against the fetch on every view it replaced.  Both see the periodic
+// sync's calendar fetch every two hours.  The radio is on from a fetch's
+// connect until WiFi's idle timeout after it; a fetch while it is still on
+// skips the connect, and a view while a fetch runs starts none.
+#define WEEK_FEEDS        2
+#define SYNC_S            (120 * 60)       // main.cpp WIFI_SYNC_INTERVAL_MS
+#define RADIO_TAIL_S      30               // wifi_client.cpp WIFI_IDLE_TIMEOUT_MS
+#define CONNECT_S         3                // assumed: association, DHCP
+#define FEED_FETCH_S      2                // assumed: TLS request and parse, per feed
+#define VIEW_GAP_S        10               // between taps within a session
+
+class Radio {
+  public:
+    // Returns false when a fetch is already running.
+    bool fetch(time_t now) {
+      if (now < busyUntil) return false;
+      bool on = !spans.empty() && now < spans.back().second;
+      busyUntil = now + (on ? 0 : CONNECT_S) + WEEK_FEEDS * FEED_FETCH_S;
+      if (on) spans.back().second = busyUntil + RADIO_TAIL_S;
+      else spans.push_back({ now, busyUntil + RADIO_TAIL_S });
+      fetches++;
+      return true;
+    }
+    int64_t onSeconds() const {
+      int64_t total = 0;
+      for (const auto &span : spans) total += span.second - span.first;
+      return total;
+    }
+
+    uint32_t fetches = 0;
+
+  private:
+    std::vector<std::pair<time_t, time_t>> spans;
+    time_t busyUntil = 0;
+};
+
+// What the feeds serve at `now`: a meeting a day per feed, and from
+// Wednesday 21:20 a Thursday review added to the first.
+struct WeekSource {
+  time_t added, addedDay;
+  std::vector<CalendarEvent> feed(int f, time_t start, time_t end, time_t now) const {
+    std::vector<CalendarEvent> events;
+    for (time_t d = start; d < end; d = timeZone.startOfDay(d, 1)) {
+      char title[32];
+      snprintf(title, sizeof(title), "Feed %d, %lld", f, (long long)d);
+      time_t at = d + (9 + 2 * f) * HOUR;
+      events.push_back(event(title, at, at + HOUR, CalendarStore::hashUrl(title)));
+      if (f == 0 && d == addedDay && now >= added) events.push_back(event("Review", d + 15 * HOUR, d + 16 * HOUR, 99));
+    }
+    return events;
+  }
+};
+
+// CalendarFetcher::fetchCalendarWithRetry(): the window follows today unless
+// the viewed day lies outside it.
+static void fetchInto(CalendarStore &store, const WeekSource &source, time_t viewed, time_t now) {
+  time_t start, end;
+  CalendarStore::windowFor(now, start, end);
+  if (viewed < start || viewed >= end) CalendarStore::windowFor(viewed, start, end);
+  for (int f = 0; f < WEEK_FEEDS; f++) store.replaceFeed(f, f + 1, start, end, source.feed(f, start, end, now), now);
+}
+
+static void test_week_of_day_views() {
+  const time_t monday = local(2026, 10, 19);                   // the week DST ends
+  WeekSource source = { local(2026, 10, 21, 21, 20), local(2026, 10, 22) };
+
+  // Each session opens on today, then taps: +1/-1 a day, 0 back to today,
+  // or a jump of `days` through the date picker.
+  struct Session {
+    int hour, minute;
+    std::vector<int> taps;
+  };
+  const std::vector<Session> weekday = {
+    { 7, 40, { +1, 0 } },
+    { 12, 30, {} },
+    { 18, 0, { +1 } },
+    { 21, 30, { +1, +1, +1 } },
+  };
+  const std::vector<Session> saturday = {
+    { 10, 0, { 20, 0 } },                                      // a date three weeks out
+    { 16, 15, { +1 } },
+  };
+  const std::vector<Session> sunday = {
+    { 9, 0, {} },
+    { 19, 0, { +1, +1, +1, +1, +1, +1, +1, 0 } },
+  };
+
+  CalendarStore store;
+  Radio stored, perView;
+  uint32_t views = 0, hits = 0, outdated = 0;
+  time_t nextSync = monday + 15 * 60;
+  fetchInto(store, source, monday, monday);                    // the boot fetch
+  stored.fetch(monday);
+  perView.fetch(monday);
+
+  for (int weekdayIndex = 0; weekdayIndex < 7; weekdayIndex++) {
+    time_t today = timeZone.startOfDay(monday, weekdayIndex);
+    const std::vector<Session> &sessions = weekdayIndex == 5 ? saturday : weekdayIndex == 6 ? sunday : weekday;
+    for (const Session &session : sessions) {
+      time_t now = today + session.hour * HOUR + session.minute * 60;
+      for (; nextSync <= now; nextSync += SYNC_S) {
+        if (stored.fetch(nextSync)) fetchInto(store, source, today, nextSync);
+        perView.fetch(nextSync);
+      }
+
+      time_t viewed = today;
+      for (size_t tap = 0; tap <= session.taps.size(); tap++, now += VIEW_GAP_S) {
+        if (tap > 0) {
+          int step = session.taps[tap - 1];
+          viewed = step == 0 ? today : timeZone.startOfDay(viewed, step);
+        }
+        views++;
+        perView.fetch(now);
+
+        // What fetching would show against what the store shows.
+        CalendarStore fetched;
+        fetchInto(fetched, source, viewed, now);
+        uint32_t truth = CalendarStore::digest(day(fetched, viewed));
+
+        time_t dayEnd = timeZone.startOfDay(viewed, 1);
+        bool covered = store.covers(viewed, dayEnd);
+        if (covered && store.fresh(now)) {
+          hits++;
+        } else if (stored.fetch(now)) {
+          fetchInto(store, source, viewed, now);
+        }
+        TEST_ASSERT_TRUE(store.covers(viewed, dayEnd));
+        if (CalendarStore::digest(day(store, viewed)) != truth) {
+          // Only the added review, and only until the next sync fetches it.
+          TEST_ASSERT_TRUE(now >= source.added && now < source.added + SYNC_S);
+          outdated++;
+        }
+      }
+    }
+  }
+
+  TEST_ASSERT_LESS_THAN_UINT32(perView.fetches, stored.fetches);
+  TEST_ASSERT_LESS_THAN(perView.onSeconds(), stored.onSeconds());
+  printf("calendar_store: %lu views in a week, %lu from memory; fetches %lu -> %lu, radio %llds -> %llds "
+         "(%llds avoided); %lu views showed a copy older than the feed\n",
+         (unsigned long)views, (unsigned long)hits, (unsigned long)perView.fetches, (unsigned long)stored.fetches,
+         (long long)perView.onSeconds(), (long long)stored.onSeconds(),
+         (long long)(perView.onSeconds() - stored.onSeconds()), (unsigned long)outdated);
+}
+
+int main(int argc, char **argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_query_uses_longest_duration);
+  RUN_TEST(test_duplicates_across_feeds);
+  RUN_TEST(test_feeds_replace_and_cover);
+  RUN_TEST(test_sd_copy_round_trip);
+  RUN_TEST(test_day_steps_across_dst);
+  RUN_TEST(test_week_of_day_views);
+  return UNITY_END();
+}
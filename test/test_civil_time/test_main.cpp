@@ -0,0 +1,310 @@
+// Civil date arithmetic, TimeZone against glibc's own TZ handling for the
+// same POSIX strings (28 zones, 1971 to 2060), conversion cost against
+// localtime_r() and mktime(), and the strings posixZoneString() builds from
+// timezonedb answers: each must put both of the answer's transitions, and
+// the next year's, where the IANA database has them.
+
+#include <unity.h>
+#include "host_shim.h"
+#include "civil_time.h"
+#include "esp_timer.h"
+#include <stdlib.h>
+
+void setUp() {}
+void tearDown() {}
+
+static void test_days_round_trip() {
+  CivilTime civil;
+  for (int32_t days = -800000; days < 3000000; days += 997) {
+    civilFromDays(days, civil);
+    TEST_ASSERT_EQUAL_INT32(days, civilToDays(civil.year, civil.month, civil.day));
+  }
+  civilFromDays(0, civil);
+  TEST_ASSERT_EQUAL(1970, civil.year);
+  TEST_ASSERT_EQUAL(4, civilWeekday(0));                       // a Thursday
+  TEST_ASSERT_EQUAL(29, civilDaysInMonth(2000, 2));
+  TEST_ASSERT_EQUAL(28, civilDaysInMonth(2100, 2));
+  TEST_ASSERT_EQUAL(366, civilDaysInYear(2024));
+  TEST_ASSERT_EQUAL_INT32(civilToDays(2026, 3, 1), civilToDays(2026, 2, 29));   // days run over
+}
+
+// The zones the engine was checked against: fixed offsets whole, half and
+// three-quarter hour, the US, EU, Australian and New Zealand rules, Lord
+// Howe's half-hour DST, Chatham's 02:45 switch, transition times past 24 h
+// (Chile, Israel) and negative (Greenland), Ireland's negative DST, J and n
+// rules, and a DST zone with no rule part.
+static const char *const zones[] = {
+  "UTC0",
+  "JST-9",
+  "IST-5:30",
+  "<+0545>-5:45",
+  "<-03>3",
+  "HST10",
+  "EST5EDT,M3.2.0,M11.1.0",
+  "CST6CDT,M3.2.0,M11.1.0",
+  "MST7MDT,M3.2.0,M11.1.0",
+  "PST8PDT,M3.2.0,M11.1.0",
+  "AKST9AKDT,M3.2.0,M11.1.0",
+  "NST3:30NDT,M3.2.0,M11.1.0",
+  "CST5CDT,M3.2.0/0,M11.1.0/1",
+  "GMT0BST,M3.5.0/1,M10.5.0",
+  "WET0WEST,M3.5.0/1,M10.5.0",
+  "CET-1CEST,M3.5.0,M10.5.0/3",
+  "EET-2EEST,M3.5.0/3,M10.5.0/4",
+  "IST-1GMT0,M10.5.0,M3.5.0/1",
+  "IST-2IDT,M3.4.4/26,M10.5.0",
+  "AEST-10AEDT,M10.1.0,M4.1.0/3",
+  "ACST-9:30ACDT,M10.1.0,M4.1.0/3",
+  "NZST-12NZDT,M9.5.0,M4.1.0/3",
+  "<+1030>-10:30<+11>-11,M10.1.0,M4.1.0",
+  "<+1245>-12:45<+1345>,M9.5.0/2:45,M4.1.0/3:45",
+  "<-04>4<-03>,M9.1.6/24,M4.1.6/24",
+  "<-02>2<-01>,M3.5.0/-1,M10.5.0/0",
+  "XST-2XDT,J60/2,J300/3",
+  "YST3YDT,59,299",
+};
+
+static void useGlibc(const char *posix) {
+  if (posix) setenv("TZ", posix, 1);
+  else unsetenv("TZ");
+  tzset();
+}
+
+// Every 20 minutes for two years, TimeZone and glibc (TZ set to the same
+// string) must agree on the offset and the DST flag.
+static void agreesWithGlibc(const char *posix) {
+  TimeZone zone;
+  TEST_ASSERT_TRUE_MESSAGE(zone.set(posix), posix);
+  useGlibc(posix);
+  const time_t from = 1767225600;                              // 2026-01-01
+  for (time_t t = from; t < from + 2 * 366 * 86400; t += 1200) {
+    struct tm expected;
+    localtime_r(&t, &expected);
+    bool dst;
+    int32_t offset = zone.offsetAt(t, &dst);
+    if (offset != expected.tm_gmtoff || dst != (expected.tm_isdst > 0)) {
+      char message[96];
+      snprintf(message, sizeof(message), "%s at %lld", posix, (long long)t);
+      TEST_ASSERT_EQUAL_INT32_MESSAGE(expected.tm_gmtoff, offset, message);
+      TEST_ASSERT_EQUAL_MESSAGE(expected.tm_isdst > 0, dst, message);
+    }
+  }
+}
+
+static void test_zone_matches_glibc() {
+  agreesWithGlibc("EST5EDT");                                  // no rules: the US defaults
+  for (const char *posix : zones) agreesWithGlibc(posix);
+  useGlibc(nullptr);
+}
+
+// A wall time that happens twice, which mktime() may place either way.
+static bool ambiguous(TimeZone &zone, time_t utc) {
+  const time_t local = zone.utcToLocal(utc);
+  for (time_t shift : { -3600, -1800, 1800, 3600 }) {
+    if (zone.utcToLocal(utc + shift) == local) return true;
+  }
+  return false;
+}
+
+// 1971 to 2060 at a step that walks through every time of day: the local
+// fields, and where the wall time and the day's midnight are unambiguous,
+// mktime()'s answer for them.
+static void test_zone_table_sweep() {
+  const time_t from = 31536000, to = 2840140800;               // 1971-01-01, 2060-01-01
+  const time_t step = 4 * 3600 + 20 * 60 + 17;
+  uint32_t checks = 0;
+  for (const char *posix : zones) {
+    TimeZone zone;
+    TEST_ASSERT_TRUE(zone.set(posix));
+    useGlibc(posix);
+    for (time_t t = from; t < to; t += step) {
+      char message[96];
+      snprintf(message, sizeof(message), "%s at %lld", posix, (long long)t);
+      struct tm expected, local;
+      localtime_r(&t, &expected);
+      zone.toLocal(t, local);
+      TEST_ASSERT_EQUAL_INT_MESSAGE(expected.tm_year, local.tm_year, message);
+      TEST_ASSERT_EQUAL_INT_MESSAGE(expected.tm_yday, local.tm_yday, message);
+      TEST_ASSERT_EQUAL_INT_MESSAGE(expected.tm_hour, local.tm_hour, message);
+      TEST_ASSERT_EQUAL_INT_MESSAGE(expected.tm_min, local.tm_min, message);
+      TEST_ASSERT_EQUAL_INT_MESSAGE(expected.tm_wday, local.tm_wday, message);
+      TEST_ASSERT_EQUAL_INT_MESSAGE(expected.tm_isdst, local.tm_isdst, message);
+
+      CivilTime civil = { (int16_t)(expected.tm_year + 1900), (uint8_t)(expected.tm_mon + 1),
+                          (uint8_t)expected.tm_mday, (uint8_t)expected.tm_hour, (uint8_t)expected.tm_min,
+                          (uint8_t)expected.tm_sec };
+      struct tm wall = expected;
+      wall.tm_isdst = -1;
+      if (!ambiguous(zone, t)) {
+        TEST_ASSERT_EQUAL_INT64_MESSAGE(mktime(&wall), zone.fromLocal(civil), message);
+        checks++;
+      }
+
+      struct tm midnight = expected;
+      midnight.tm_hour = midnight.tm_min = midnight.tm_sec = 0;
+      midnight.tm_isdst = -1;
+      time_t dayStart = mktime(&midnight);
+      if (!ambiguous(zone, dayStart)) {
+        TEST_ASSERT_EQUAL_INT64_MESSAGE(dayStart, zone.startOfDay(t), message);
+        checks++;
+      }
+      checks += 6;
+    }
+  }
+  useGlibc(nullptr);
+  printf("civil_time: %u zones, %lu checks from 1971 to 2060\n", (unsigned)(sizeof(zones) / sizeof(zones[0])),
+         (unsigned long)checks);
+}
+
+// Conversions per call, both ways, against glibc on the same zone.  newlib
+// adds its TZ lock and environment check on top of glibc's cost.
+static void test_conversion_speed() {
+  const char *posix = "CET-1CEST,M3.5.0,M10.5.0/3";
+  const int calls = 1000000;
+  const time_t from = 1767225600, step = 997;
+  TimeZone zone;
+  TEST_ASSERT_TRUE(zone.set(posix));
+  useGlibc(posix);
+
+  volatile int sink = 0;
+  struct tm local;
+  int64_t start = esp_timer_get_time();
+  for (int i = 0; i < calls; i++) {
+    time_t t = from + i * step;
+    zone.toLocal(t, local);
+    sink += local.tm_hour;
+  }
+  int64_t zoneToLocal = esp_timer_get_time() - start;
+  start = esp_timer_get_time();
+  for (int i = 0; i < calls; i++) {
+    time_t t = from + i * step;
+    localtime_r(&t, &local);
+    sink += local.tm_hour;
+  }
+  int64_t glibcToLocal = esp_timer_get_time() - start;
+
+  CivilTime civil = { 2026, 1, 1, 0, 0, 0 };
+  start = esp_timer_get_time();
+  for (int i = 0; i < calls; i++) {
+    civil.day = 1 + i % 28;
+    civil.hour = i % 24;
+    sink += (int)zone.fromLocal(civil);
+  }
+  int64_t zoneFromLocal = esp_timer_get_time() - start;
+  start = esp_timer_get_time();
+  for (int i = 0; i < calls; i++) {
+    struct tm wall = {};
+    wall.tm_year = 126;
+    wall.tm_mday = 1 + i % 28;
+    wall.tm_hour = i % 24;
+    wall.tm_isdst = -1;
+    sink += (int)mktime(&wall);
+  }
+  int64_t glibcFromLocal = esp_timer_get_time() - start;
+  useGlibc(nullptr);
+  (void)sink;
+
+  printf("civil_time: utc->local %.0f ns (localtime_r %.0f ns), local->utc %.0f ns (mktime %.0f ns)\n",
+         zoneToLocal * 1000.0 / calls, glibcToLocal * 1000.0 / calls, zoneFromLocal * 1000.0 / calls,
+         glibcFromLocal * 1000.0 / calls);
+}
+
+static void test_local_conversions() {
+  TimeZone zone;
+  TEST_ASSERT_TRUE(zone.set("CET-1CEST,M3.5.0,M10.5.0/3"));
+  TEST_ASSERT_FALSE(zone.set("not a zone"));                   // keeps CET
+
+  // 02:30 on the spring-forward day does not exist: read as 03:30 CEST.
+  CivilTime gap = { 2026, 3, 29, 2, 30, 0 };
+  CivilTime back;
+  zone.toLocal(zone.fromLocal(gap), back);
+  TEST_ASSERT_EQUAL(3, back.hour);
+  TEST_ASSERT_EQUAL(30, back.minute);
+
+  // 02:30 on the fall-back day happens twice: the DST one.
+  CivilTime twice = { 2026, 10, 25, 2, 30, 0 };
+  bool dst;
+  zone.offsetAt(zone.fromLocal(twice), &dst);
+  TEST_ASSERT_TRUE(dst);
+
+  time_t noon = zone.fromLocal({ 2026, 10, 25, 12, 0, 0 });
+  TEST_ASSERT_EQUAL_INT64(zone.fromLocal({ 2026, 10, 25, 0, 0, 0 }), zone.startOfDay(noon));
+  TEST_ASSERT_EQUAL_INT64(25 * 3600, zone.startOfDay(noon, 1) - zone.startOfDay(noon));
+}
+
+struct Answer {
+  const char *zoneName;
+  const char *abbreviation;
+  int32_t gmtOffset;
+  bool dst;
+  const char *nextAbbreviation;
+  time_t zoneStart, zoneEnd;
+  const char *expected;
+  time_t later[2];                                             // the next year's transitions, 0: not checked
+};
+
+// timezonedb answers for 2026-10-19 and the following transitions, from
+// the IANA database.
+static const Answer answers[] = {
+  { "America/Chicago", "CDT", -18000, true, "CST", 1772956800, 1793516400,
+    "CST6CDT,M3.2.0,M11.1.0", { 1805011200, 1825570800 } },
+  { "Australia/Sydney", "AEDT", 39600, true, "AEST", 1791043200, 1806768000,
+    "AEST-10AEDT,M10.1.0,M4.1.0/3", { 1822492800, 0 } },
+  { "Europe/London", "BST", 3600, true, "GMT", 1774746000, 1792890000,
+    "GMT0BST,M3.5.0/1,M10.5.0", { 1806195600, 1824944400 } },
+  { "America/Santiago", "-03", -10800, true, "-04", 1788667200, 1806807600,
+    "<-04>4<-03>,M9.1.0/0,M4.1.0/0", { 1820116800, 0 } },
+  { "America/Nuuk", "-01", -3600, true, "-02", 1774746000, 1792890000,
+    "<-02>2<-01>,M3.5.6/23,M10.5.0/0", { 1806195600, 1824944400 } },
+  { "Asia/Kathmandu", "+0545", 20700, false, "", 0, 0, "<+0545>-5:45", { 0, 0 } },
+  { "Asia/Tokyo", "JST", 32400, false, nullptr, 0, 0, "JST-9", { 0, 0 } },
+};
+
+static void expectTransition(TimeZone &zone, time_t at, const char *name) {
+  bool before, after;
+  int32_t offsetBefore = zone.offsetAt(at - 1, &before);
+  int32_t offsetAfter = zone.offsetAt(at, &after);
+  TEST_ASSERT_TRUE_MESSAGE(before != after, name);
+  TEST_ASSERT_EQUAL_INT32_MESSAGE(3600, abs(offsetAfter - offsetBefore), name);
+}
+
+static void test_posix_string_from_timezonedb() {
+  for (const Answer &a : answers) {
+    char posix[48];
+    int len = posixZoneString(posix, sizeof(posix), a.abbreviation, a.gmtOffset, a.dst, a.nextAbbreviation,
+                              a.zoneStart, a.zoneEnd);
+    TEST_ASSERT_EQUAL_STRING_MESSAGE(a.expected, posix, a.zoneName);
+    TEST_ASSERT_EQUAL_INT(strlen(posix), len);
+
+    TimeZone zone;
+    TEST_ASSERT_TRUE_MESSAGE(zone.set(posix), a.zoneName);
+    TEST_ASSERT_EQUAL_INT32_MESSAGE(a.gmtOffset, zone.offsetAt(a.zoneStart ? a.zoneStart : 1792368000), a.zoneName);
+    if (!a.zoneStart) continue;
+    expectTransition(zone, a.zoneStart, a.zoneName);
+    expectTransition(zone, a.zoneEnd, a.zoneName);
+    for (time_t later : a.later) {
+      if (later) expectTransition(zone, later, a.zoneName);
+    }
+  }
+}
+
+// Before zoneStart/zoneEnd were used, a southern zone got the US rules.
+static void test_rules_missing_fall_back_to_defaults() {
+  char posix[48];
+  posixZoneString(posix, sizeof(posix), "AEDT", 39600, true, "AEST", 0, 0);
+  TEST_ASSERT_EQUAL_STRING("AEST-10AEDT", posix);
+  TEST_ASSERT_TRUE(posixZoneString(posix, 8, "AEDT", 39600, true, "AEST", 1791043200, 1806768000) >= 8);
+  TEST_ASSERT_EQUAL_STRING("AEST-10", posix);                  // cut short, still terminated
+}
+
+int main(int argc, char **argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_days_round_trip);
+  RUN_TEST(test_zone_matches_glibc);
+  RUN_TEST(test_zone_table_sweep);
+  RUN_TEST(test_local_conversions);
+  RUN_TEST(test_posix_string_from_timezonedb);
+  RUN_TEST(test_rules_missing_fall_back_to_defaults);
+  RUN_TEST(test_conversion_speed);
+  return UNITY_END();
+}
@@ -0,0 +1,223 @@
+// LocationCache: matching a connection to a remembered network as access
+// points, gateways and places change under the same SSID, expiry and
+// eviction, the last zone, the SD copy, and two weeks of simulated
+// connections counting the service lookups the cache leaves.
+
+#include <unity.h>
+#include "host_shim.h"
+#include "location_cache.h"
+
+static const time_t START = 1735718400;      // 2025-01-01 08:00 UTC
+static const time_t DAY = 24 * 60 * 60;
+
+void setUp() {
+  Serial.quiet = true;
+  SD_MMC.remove(LOCATION_CACHE_PATH);
+}
+void tearDown() {}
+
+// `ap` and `router` pick the BSSID and gateway MAC; router 0 is an unknown
+// gateway, `hotspot` a locally administered BSSID.
+static network_fingerprint_t network(const char *ssid, uint8_t ap, uint8_t router, bool hotspot = false) {
+  network_fingerprint_t n = {};
+  n.ssidHash = LocationCache::hashSsid(ssid);
+  const uint8_t bssid[6] = { (uint8_t)(hotspot ? 0x02 : 0x00), 0x1A, 0x2B, 0x3C, 0x4D, ap };
+  memcpy(n.bssid, bssid, 6);
+  if (router) {
+    const uint8_t gateway[6] = { 0x00, 0x5E, 0x6F, 0x70, 0x81, router };
+    memcpy(n.gateway, gateway, 6);
+  }
+  return n;
+}
+
+static void store(LocationCache &cache, const network_fingerprint_t &n, time_t now, const char *city,
+                  const char *zone = "CET-1CEST,M3.5.0,M10.5.0/3") {
+  cache.store(n, now, city, "ST", "48.1", "11.6", zone, "Europe/Berlin");
+}
+
+static void test_same_access_point_and_roaming() {
+  LocationCache cache;
+  store(cache, network("Home", 1, 10), START, "Munich");
+
+  const location_entry_t *entry = cache.find(network("Home", 1, 10), START + 60);
+  TEST_ASSERT_NOT_NULL(entry);
+  TEST_ASSERT_EQUAL_STRING("Munich", entry->city);
+  TEST_ASSERT_EQUAL_STRING("CET-1CEST,M3.5.0,M10.5.0/3", entry->timezone);
+
+  // A mesh node upstairs: new access point, same router.  It is learned, so
+  // it matches later even when the gateway could not be read.
+  TEST_ASSERT_NOT_NULL(cache.find(network("Home", 2, 10), START + 120));
+  TEST_ASSERT_NOT_NULL(cache.find(network("Home", 2, 0), START + 180));
+  TEST_ASSERT_EQUAL_UINT8(2, cache.find(network("Home", 1, 0), START + 240)->bssidCount);
+
+  // An access point never seen with an unknown gateway, or another SSID on
+  // the same hardware, is not this network.
+  TEST_ASSERT_NULL(cache.find(network("Home", 3, 0), START + 300));
+  TEST_ASSERT_NULL(cache.find(network("Home-Guest", 1, 10), START + 300));
+}
+
+static void test_chain_ssid_elsewhere_does_not_match() {
+  LocationCache cache;
+  store(cache, network("CoffeeCo", 1, 20), START, "Munich");
+  TEST_ASSERT_NULL(cache.find(network("CoffeeCo", 7, 21), START + 3600));
+
+  store(cache, network("CoffeeCo", 7, 21), START + 3600, "Vienna");
+  TEST_ASSERT_EQUAL_STRING("Munich", cache.find(network("CoffeeCo", 1, 20), START + 7200)->city);
+  TEST_ASSERT_EQUAL_STRING("Vienna", cache.find(network("CoffeeCo", 7, 21), START + 7200)->city);
+}
+
+static void test_hotspots_are_never_cached() {
+  LocationCache cache;
+  network_fingerprint_t phone = network("Pixel", 9, 30, true);
+  TEST_ASSERT_FALSE(LocationCache::cacheable(phone));
+  store(cache, phone, START, "Munich");
+  TEST_ASSERT_NULL(cache.find(phone, START + 60));
+
+  TEST_ASSERT_FALSE(LocationCache::cacheable(network("", 1, 10)));
+  network_fingerprint_t noBssid = network("Home", 0, 10);
+  memset(noBssid.bssid, 0, 6);
+  TEST_ASSERT_FALSE(LocationCache::cacheable(noBssid));
+
+  // The zone it resolved to is still what boot shows.
+  cache.rememberZone("EST5EDT,M3.2.0,M11.1.0", "America/New_York");
+  TEST_ASSERT_EQUAL_STRING("EST5EDT,M3.2.0,M11.1.0", cache.lastZone());
+  TEST_ASSERT_EQUAL_STRING("America/New_York", cache.lastZoneName());
+}
+
+static void test_expiry_and_clock_steps() {
+  LocationCache cache;
+  store(cache, network("Home", 1, 10), START, "Munich");
+  TEST_ASSERT_NOT_NULL(cache.find(network("Home", 1, 10), START + LOCATION_CACHE_MAX_AGE_S));
+  TEST_ASSERT_NULL(cache.find(network("Home", 1, 10), START + LOCATION_CACHE_MAX_AGE_S + 1));
+  // A clock that has not been set yet reads 1970.
+  TEST_ASSERT_NULL(cache.find(network("Home", 1, 10), 60));
+
+  // Storing again renews it in place.
+  store(cache, network("Home", 1, 10), START + 8 * DAY, "Munich");
+  TEST_ASSERT_NOT_NULL(cache.find(network("Home", 1, 10), START + 9 * DAY));
+}
+
+static void test_full_table_replaces_oldest() {
+  LocationCache cache;
+  char ssid[16];
+  for (int i = 0; i <= LOCATION_CACHE_ENTRIES; i++) {
+    snprintf(ssid, sizeof(ssid), "Net%d", i);
+    store(cache, network(ssid, i + 1, i + 1), START + i * 60, ssid);
+  }
+  TEST_ASSERT_NULL(cache.find(network("Net0", 1, 1), START + DAY));
+  for (int i = 1; i <= LOCATION_CACHE_ENTRIES; i++) {
+    snprintf(ssid, sizeof(ssid), "Net%d", i);
+    TEST_ASSERT_NOT_NULL_MESSAGE(cache.find(network(ssid, i + 1, i + 1), START + DAY), ssid);
+  }
+}
+
+static void test_access_point_set_drops_oldest() {
+  LocationCache cache;
+  store(cache, network("Office", 1, 40), START, "Munich");
+  for (int ap = 2; ap <= LOCATION_CACHE_BSSIDS + 1; ap++) {
+    TEST_ASSERT_NOT_NULL(cache.find(network("Office", ap, 40), START + ap * 60));
+  }
+  // The first access point was pushed out; without the gateway it is unknown.
+  TEST_ASSERT_NULL(cache.find(network("Office", 1, 0), START + 3600));
+  TEST_ASSERT_NOT_NULL(cache.find(network("Office", LOCATION_CACHE_BSSIDS + 1, 0), START + 3600));
+}
+
+static void test_sd_round_trip_and_damage() {
+  LocationCache cache;
+  store(cache, network("Home", 1, 10), START, "Munich");
+  cache.find(network("Home", 2, 10), START + 60);
+  cache.rememberZone("CET-1CEST,M3.5.0,M10.5.0/3", "Europe/Berlin");
+
+  LocationCache rebooted;
+  TEST_ASSERT_TRUE(rebooted.load());
+  TEST_ASSERT_EQUAL_STRING("Europe/Berlin", rebooted.lastZoneName());
+  TEST_ASSERT_NOT_NULL(rebooted.find(network("Home", 2, 0), START + 120));
+
+  std::vector<uint8_t> &bytes = SD_MMC.files[LOCATION_CACHE_PATH];
+  bytes[bytes.size() - 1] ^= 0x01;
+  TEST_ASSERT_FALSE(LocationCache().load());
+  bytes[bytes.size() - 1] ^= 0x01;
+  TEST_ASSERT_TRUE(LocationCache().load());
+
+  // A record from an older layout is ignored rather than misread.
+  location_cache_t *record = (location_cache_t *)bytes.data();
+  record->version = LOCATION_CACHE_VERSION - 1;
+  TEST_ASSERT_FALSE(LocationCache().load());
+  bytes.pop_back();
+  TEST_ASSERT_FALSE(LocationCache().load());
+}
+
+// Two weeks of connections as wifi_client makes them: a lookup from the
+// services when find() comes back empty, then store().  Home is a two-node
+// mesh, the office three access points behind one router, lunch a chain's
+// SSID at a different branch each weekday, the commute a phone hotspot.
+static void test_two_weeks_of_connections() {
+  struct Place {
+    const char *ssid;
+    const char *city;
+    bool hotspot;
+    uint32_t lookups, connects;
+  } places[] = {
+    { "Home", "Munich", false },
+    { "Office", "Garching", false },
+    { "CoffeeCo", "Branch", false },
+    { "Pixel", "Tethered", true },
+  };
+  LocationCache cache;
+  char city[16];
+  uint32_t seed = 7;
+
+  for (int day = 0; day < 14; day++) {
+    bool weekday = day % 7 < 5;
+    for (int visit = 0; visit < 8; visit++) {
+      int p = !weekday ? 0 : visit < 2 ? 0 : visit == 2 ? 3 : visit == 5 ? 2 : visit == 6 ? 3 : visit == 7 ? 0 : 1;
+      Place &place = places[p];
+      time_t now = START + day * DAY + visit * 90 * 60;
+      seed = seed * 1664525u + 1013904223u;
+      uint8_t ap, router;
+      switch (p) {
+        case 0: ap = 1 + (seed >> 16) % 2; router = 10; break;
+        case 1: ap = 20 + (seed >> 16) % 3; router = 20; break;
+        case 2: ap = 30 + day; router = 30 + day; break;
+        default: ap = 40; router = 40; break;
+      }
+      // The gateway's MAC is not always in the ARP table yet.
+      if ((seed >> 24) % 4 == 0) router = 0;
+
+      network_fingerprint_t n = network(place.ssid, ap, router, place.hotspot);
+      snprintf(city, sizeof(city), "%s%d", place.city, p == 2 ? day : 0);
+      place.connects++;
+      const location_entry_t *entry = cache.find(n, now);
+      if (entry) {
+        TEST_ASSERT_EQUAL_STRING(city, entry->city);
+      } else {
+        place.lookups++;
+        store(cache, n, now, city);
+      }
+    }
+  }
+
+  for (const Place &place : places) {
+    printf("location_cache: %-8s %2lu connects, %2lu lookups\n", place.ssid, (unsigned long)place.connects,
+           (unsigned long)place.lookups);
+  }
+  // Home and the office once a week, plus access points met first without a
+  // gateway; every branch and every hotspot connection once.
+  TEST_ASSERT_TRUE(places[0].lookups <= 4);
+  TEST_ASSERT_TRUE(places[1].lookups <= 5);
+  TEST_ASSERT_EQUAL_UINT32(places[2].connects, places[2].lookups);
+  TEST_ASSERT_EQUAL_UINT32(places[3].connects, places[3].lookups);
+}
+
+int main(int argc, char **argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_same_access_point_and_roaming);
+  RUN_TEST(test_chain_ssid_elsewhere_does_not_match);
+  RUN_TEST(test_hotspots_are_never_cached);
+  RUN_TEST(test_expiry_and_clock_steps);
+  RUN_TEST(test_full_table_replaces_oldest);
+  RUN_TEST(test_access_point_set_drops_oldest);
+  RUN_TEST(test_sd_round_trip_and_damage);
+  RUN_TEST(test_two_weeks_of_connections);
+  return UNITY_END();
+}
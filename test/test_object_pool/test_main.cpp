@@ -0,0 +1,162 @@
+// ObjectPool: slot accounting, exhaustion, a multi-thread stress run standing
+// in for producers on both cores, and a burst benchmark against malloc/free.
+
+#include <unity.h>
+#include "host_shim.h"
+#include "object_pool.h"
+#include "esp_timer.h"
+#include <thread>
+#include <vector>
+
+struct Op {
+  uint32_t owner;
+  uint32_t seq;
+  char payload[120];             // about a ScreenOperation / quick notification
+};
+
+#define POOL_SIZE     16
+
+void setUp() {}
+void tearDown() {}
+
+static void test_hands_out_each_slot_once() {
+  ObjectPool<Op, POOL_SIZE> pool;
+  TEST_ASSERT_NULL(pool.acquire());                       // before begin()
+  TEST_ASSERT_TRUE(pool.begin());
+
+  Op *taken[POOL_SIZE];
+  for (int i = 0; i < POOL_SIZE; i++) {
+    taken[i] = pool.acquire();
+    TEST_ASSERT_NOT_NULL(taken[i]);
+    TEST_ASSERT_TRUE(pool.owns(taken[i]));
+    for (int j = 0; j < i; j++) TEST_ASSERT_TRUE(taken[i] != taken[j]);
+  }
+  TEST_ASSERT_EQUAL_UINT(POOL_SIZE, pool.used());
+  TEST_ASSERT_NULL(pool.acquire());
+  TEST_ASSERT_NULL(pool.acquire());
+
+  pool.release(taken[5]);
+  TEST_ASSERT_EQUAL_UINT(1, pool.available());
+  TEST_ASSERT_TRUE(pool.acquire() == taken[5]);           // the freed slot comes back
+
+  Op outside;
+  pool.release(&outside);                                 // not ours: ignored
+  pool.release(nullptr);
+  TEST_ASSERT_EQUAL_UINT(POOL_SIZE, pool.used());
+  TEST_ASSERT_FALSE(pool.owns(&outside));
+}
+
+static void test_stats_window() {
+  ObjectPool<Op, 4> pool;
+  pool.begin();
+  Op *a = pool.acquire();
+  Op *b = pool.acquire();
+  pool.acquire();
+  pool.acquire();
+  pool.acquire();                                         // exhausted
+  pool.release(a);
+  pool.release(b);
+  TEST_ASSERT_EQUAL_UINT(4, pool.peakUsed());
+  TEST_ASSERT_EQUAL_UINT32(4, pool.acquisitions());
+  TEST_ASSERT_EQUAL_UINT32(1, pool.exhaustions());
+  Serial.quiet = false;
+  pool.logStats("test");                                  // used=2/4 peak=4 acquired=4 exhausted=1
+  Serial.quiet = true;
+  TEST_ASSERT_EQUAL_UINT(2, pool.used());
+
+  // The next window starts from what is still held.
+  TEST_ASSERT_EQUAL_UINT(2, pool.peakUsed());
+  TEST_ASSERT_EQUAL_UINT32(0, pool.acquisitions());
+  TEST_ASSERT_EQUAL_UINT32(0, pool.exhaustions());
+  a = pool.acquire();
+  pool.release(a);
+  TEST_ASSERT_EQUAL_UINT(3, pool.peakUsed());
+  TEST_ASSERT_EQUAL_UINT32(1, pool.acquisitions());
+  TEST_ASSERT_EQUAL_UINT32(0, pool.exhaustions());
+}
+
+// Producers on several threads take up to HOLD objects each, stamp them,
+// check nobody else stamped them meanwhile and give them back.  The pool is
+// smaller than THREADS * HOLD, so exhaustion and retries are exercised too;
+// a thread that finds it empty hands back what it holds before retrying,
+// or every thread could end up holding part of a round and waiting.
+#define STRESS_THREADS  4
+#define STRESS_HOLD     3
+#define STRESS_ROUNDS   200000
+
+static void test_concurrent_acquire_release() {
+  static ObjectPool<Op, 8> pool;
+  pool.begin();
+  std::atomic<uint32_t> clashes{0};
+  std::atomic<uint32_t> retries{0};
+
+  std::vector<std::thread> threads;
+  for (uint32_t t = 1; t <= STRESS_THREADS; t++) {
+    threads.emplace_back([&, t]() {
+      Op *held[STRESS_HOLD];
+      for (uint32_t round = 0; round < STRESS_ROUNDS; round++) {
+        for (int h = 0; h < STRESS_HOLD; h++) {
+          if (!(held[h] = pool.acquire())) {
+            while (h > 0) pool.release(held[--h]);
+            retries++;
+            std::this_thread::yield();
+            h = -1;
+            continue;
+          }
+          held[h]->owner = t;
+          held[h]->seq = round;
+        }
+        for (int h = STRESS_HOLD - 1; h >= 0; h--) {
+          if (held[h]->owner != t || held[h]->seq != round) clashes++;
+          pool.release(held[h]);
+        }
+      }
+    });
+  }
+  for (auto &thread : threads) thread.join();
+
+  TEST_ASSERT_EQUAL_UINT(0, clashes.load());
+  TEST_ASSERT_EQUAL_UINT(0, pool.used());
+  printf("object_pool: %u threads x %u rounds, %lu empty-pool retries\n",
+         STRESS_THREADS, STRESS_ROUNDS, (unsigned long)retries.load());
+}
+
+// A notification burst: take a handful of objects, then free them, as the
+// UI core does per frame.  Pool against the heap it replaced.
+#define BENCH_BURST   8
+#define BENCH_ROUNDS  2000000
+
+static void test_benchmark_against_malloc() {
+  static ObjectPool<Op, POOL_SIZE> pool;
+  pool.begin();
+  Op *held[BENCH_BURST];
+
+  int64_t start = esp_timer_get_time();
+  for (uint32_t round = 0; round < BENCH_ROUNDS; round++) {
+    for (int i = 0; i < BENCH_BURST; i++) held[i] = pool.acquire();
+    for (int i = 0; i < BENCH_BURST; i++) pool.release(held[i]);
+  }
+  double poolNs = (esp_timer_get_time() - start) * 1000.0 / (BENCH_ROUNDS * BENCH_BURST);
+
+  start = esp_timer_get_time();
+  for (uint32_t round = 0; round < BENCH_ROUNDS; round++) {
+    for (int i = 0; i < BENCH_BURST; i++) {
+      held[i] = (Op *)malloc(sizeof(Op));
+      held[i]->seq = round;     // keep the allocation observable
+    }
+    for (int i = 0; i < BENCH_BURST; i++) free(held[i]);
+  }
+  double heapNs = (esp_timer_get_time() - start) * 1000.0 / (BENCH_ROUNDS * BENCH_BURST);
+
+  TEST_ASSERT_EQUAL_UINT(0, pool.used());
+  printf("object_pool: acquire+release %.1f ns, malloc+free %.1f ns (host)\n", poolNs, heapNs);
+}
+
+int main(int argc, char **argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_hands_out_each_slot_once);
+  RUN_TEST(test_stats_window);
+  RUN_TEST(test_concurrent_acquire_release);
+  RUN_TEST(test_benchmark_against_malloc);
+  return UNITY_END();
+}
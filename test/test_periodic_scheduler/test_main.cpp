@@ -0,0 +1,170 @@
+// Driver_Loop under the scheduler against the fixed 100 ms / 1 s loop it
+// replaced: wakeups per hour and sleep residency, awake and asleep.
+//
+// PWR_Loop polls every 100 ms / 1 s in both, which sets the floor on
+// wakeups; what the scheduler has to show is that nothing else wakes the
+// CPU, and that it does not poll faster than the loop did.
+
+#include <unity.h>
+#include "host_shim.h"
+#include "periodic_scheduler.h"
+
+// Bus time each job costs, ms.
+#define PWR_COST_MS    1
+#define IMU_COST_MS    2
+#define SLOW_COST_MS   3
+#define TASKS_COST_MS  1
+
+static const unsigned long HOUR_MS = 3600UL * 1000UL;
+
+static uint32_t pwrRuns, imuRuns, slowRuns;
+static unsigned long lastImu, maxImuGap;
+
+static void pwrJob() { pwrRuns++; hostMillis += PWR_COST_MS; }
+static void imuJob() {
+  if (imuRuns && hostMillis - lastImu > maxImuGap) maxImuGap = hostMillis - lastImu;
+  lastImu = hostMillis;
+  imuRuns++;
+  hostMillis += IMU_COST_MS;
+}
+static void slowJob() { slowRuns++; hostMillis += SLOW_COST_MS; }
+static void tasksJob() { hostMillis += TASKS_COST_MS; }
+
+struct Report {
+  uint32_t wakeups;
+  unsigned long sleptMs;
+};
+
+// main.cpp's job table and loop, for an hour in one display state.
+static Report runScheduler(bool awake) {
+  PeriodicScheduler scheduler;
+  hostMillis = 1;
+  pwrRuns = imuRuns = slowRuns = 0;
+  maxImuGap = 0;
+  scheduler.addJob("pwr", pwrJob, { 100, 0 }, { 1000, 0 });
+  scheduler.addJob("imu", imuJob, { 100, 10 }, { 1000, 250 });
+  scheduler.addJob("slow", slowJob, { 500, 50 }, { 2000, 500 });
+  scheduler.addJob("tasks", tasksJob, { 5000, 50 }, { 30000, 500 });
+  scheduler.setAwake(awake, hostMillis);
+
+  Report report = {};
+  unsigned long end = hostMillis + HOUR_MS;
+  while (hostMillis < end) {
+    uint32_t waitMs = scheduler.runDue(hostMillis);
+    report.wakeups++;
+    if (waitMs == 0) waitMs = 1;  // taskYIELD: the tick
+    hostMillis += waitMs;
+    report.sleptMs += waitMs;
+    scheduler.recordSleep(waitMs);
+  }
+  TEST_ASSERT_EQUAL_UINT32(report.wakeups, scheduler.wakeupCount());
+  return report;
+}
+
+// The loop before the scheduler: PWR_Loop every pass, the IMU and the slow
+// job on their intervals, then a fixed sleep.
+static Report runFixedLoop(bool awake) {
+  hostMillis = 1;
+  pwrRuns = imuRuns = slowRuns = 0;
+  maxImuGap = 0;
+  unsigned long lastImuRead = 0, lastSlowRead = 0, lastStackCheck = 0;
+  Report report = {};
+  unsigned long end = hostMillis + HOUR_MS;
+  while (hostMillis < end) {
+    report.wakeups++;
+    pwrJob();
+    if (hostMillis - lastImuRead >= (awake ? 50UL : 75UL)) {
+      lastImuRead = hostMillis;
+      imuJob();
+    }
+    if (hostMillis - lastSlowRead >= (awake ? 500UL : 2000UL)) {
+      lastSlowRead = hostMillis;
+      slowJob();
+    }
+    if (hostMillis - lastStackCheck > 30000) {
+      lastStackCheck = hostMillis;
+      tasksJob();
+    }
+    unsigned long sleepMs = awake ? 100 : 1000;
+    hostMillis += sleepMs;
+    report.sleptMs += sleepMs;
+  }
+  return report;
+}
+
+static void printReport(const char *name, const Report &report) {
+  printf("  %-22s wakeups/h=%-6lu sleep residency=%.2f%% imu runs=%lu max gap=%lums slow runs=%lu\n", name,
+         (unsigned long)report.wakeups, report.sleptMs * 100.0 / HOUR_MS, (unsigned long)imuRuns, maxImuGap,
+         (unsigned long)slowRuns);
+}
+
+void setUp() {}
+void tearDown() {}
+
+static void test_awake_keeps_the_fixed_loop_cadence() {
+  Report fixed = runFixedLoop(true);
+  uint32_t fixedImu = imuRuns;
+  printReport("fixed loop, awake", fixed);
+  Report sched = runScheduler(true);
+  printReport("scheduler, awake", sched);
+
+  // Same IMU rate as before (the fixed loop could not run it faster than
+  // its 100 ms pass), within a run's cost of drift per period.
+  TEST_ASSERT_UINT32_WITHIN(fixedImu / 20, fixedImu, imuRuns);
+  TEST_ASSERT_LESS_OR_EQUAL(110 + IMU_COST_MS + PWR_COST_MS + SLOW_COST_MS + TASKS_COST_MS, maxImuGap);
+  // Every wakeup is a PWR_Loop poll, and the polls are no more frequent.
+  TEST_ASSERT_EQUAL_UINT32(sched.wakeups, pwrRuns);
+  TEST_ASSERT_LESS_OR_EQUAL(fixed.wakeups, sched.wakeups);
+}
+
+static void test_asleep_wakes_no_more_than_once_a_second() {
+  Report fixed = runFixedLoop(false);
+  printReport("fixed loop, asleep", fixed);
+  Report sched = runScheduler(false);
+  printReport("scheduler, asleep", sched);
+
+  TEST_ASSERT_EQUAL_UINT32(sched.wakeups, pwrRuns);
+  TEST_ASSERT_LESS_OR_EQUAL(fixed.wakeups, sched.wakeups);
+  TEST_ASSERT_UINT32_WITHIN(HOUR_MS / 1000, fixed.sleptMs, sched.sleptMs);
+  TEST_ASSERT_LESS_OR_EQUAL(1000 + 250 + IMU_COST_MS + PWR_COST_MS + SLOW_COST_MS + TASKS_COST_MS, maxImuGap);
+}
+
+static void test_waking_pulls_deadlines_in() {
+  PeriodicScheduler scheduler;
+  hostMillis = 1;
+  imuRuns = 0;
+  scheduler.addJob("imu", imuJob, { 100, 10 }, { 1000, 250 });
+  scheduler.setAwake(false, hostMillis);
+  scheduler.runDue(hostMillis);
+  TEST_ASSERT_EQUAL_UINT32(1, imuRuns);
+
+  hostMillis += 50;
+  scheduler.setAwake(true, hostMillis);
+  TEST_ASSERT_LESS_OR_EQUAL(100 + 10, scheduler.runDue(hostMillis));
+}
+
+// Driver_Loop re-runs runDue() without sleeping after a profile change; only
+// passes that follow a sleep count as wakeups.
+static void test_profile_change_is_not_a_wakeup() {
+  PeriodicScheduler scheduler;
+  hostMillis = 1;
+  scheduler.addJob("pwr", pwrJob, { 100, 0 }, { 1000, 0 });
+  scheduler.runDue(hostMillis);
+  scheduler.setAwake(false, hostMillis);
+  scheduler.runDue(hostMillis);
+  TEST_ASSERT_EQUAL_UINT32(0, scheduler.wakeupCount());
+
+  hostMillis += 1000;
+  scheduler.recordSleep(1000);
+  scheduler.runDue(hostMillis);
+  TEST_ASSERT_EQUAL_UINT32(1, scheduler.wakeupCount());
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_awake_keeps_the_fixed_loop_cadence);
+  RUN_TEST(test_asleep_wakes_no_more_than_once_a_second);
+  RUN_TEST(test_waking_pulls_deadlines_in);
+  RUN_TEST(test_profile_change_is_not_a_wakeup);
+  return UNITY_END();
+}
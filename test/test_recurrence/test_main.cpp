@@ -0,0 +1,264 @@
+// RRULE expansion against the RFC 5545 3.8.5.3 examples, the leap-day rules
+// that outlive a few hundred empty periods, and the cost of expanding a
+// one-week window with and without the jump to the window start.  Over a
+// window: UNTIL as a date and as a date-time, EXDATE, and an instance moved
+// by a RECURRENCE-ID VEVENT elsewhere in the feed.
+
+#include <unity.h>
+#include "host_shim.h"
+#include "recurrence.h"
+#include "esp_timer.h"
+#include <string.h>
+
+void setUp() {}
+void tearDown() {}
+
+// Space-separated YYYYMMDD of the first `limit` instances.
+static const char *expand(const char *rrule, const char *dtstart, int limit, uint32_t *periods = nullptr) {
+  static char out[512];
+  static RecurrenceRule rule;
+  out[0] = '\0';
+  TEST_ASSERT_TRUE_MESSAGE(rule.parse(rrule), rrule);
+  CivilTime start;
+  TEST_ASSERT_TRUE(parseICalCivil(dtstart, start, nullptr, nullptr));
+
+  RecurrenceIterator it;
+  it.begin(rule, start);
+  CivilTime when;
+  for (int i = 0; i < limit && it.next(when); i++) {
+    size_t len = strlen(out);
+    snprintf(out + len, sizeof(out) - len, "%s%04d%02d%02d", len ? " " : "", when.year, when.month, when.day);
+  }
+  if (periods) *periods = it.periodsVisited();
+  return out;
+}
+
+static void test_rfc_daily_and_weekly() {
+  TEST_ASSERT_EQUAL_STRING("19970902 19970903 19970904 19970905 19970906 19970907 19970908 19970909 19970910 19970911",
+                           expand("FREQ=DAILY;COUNT=10", "19970902T090000", 20));
+  TEST_ASSERT_EQUAL_STRING("19970902 19970904 19970916 19970918 19970930 19971002 19971014 19971016",
+                           expand("FREQ=WEEKLY;INTERVAL=2;WKST=SU;BYDAY=TU,TH;COUNT=8", "19970902T090000", 20));
+}
+
+static void test_rfc_monthly() {
+  TEST_ASSERT_EQUAL_STRING("19970905 19971003 19971107 19971205 19980102 19980206 19980306 19980403 19980501 19980605",
+                           expand("FREQ=MONTHLY;COUNT=10;BYDAY=1FR", "19970905T090000", 20));
+  TEST_ASSERT_EQUAL_STRING("19970928 19971029 19971128 19971229 19980129 19980226",
+                           expand("FREQ=MONTHLY;BYMONTHDAY=-3;COUNT=6", "19970928T090000", 20));
+  // DTSTART (a Monday) is not the last weekday but still comes first.
+  TEST_ASSERT_EQUAL_STRING("19970929 19970930 19971031 19971128 19971231 19980130",
+                           expand("FREQ=MONTHLY;BYDAY=MO,TU,WE,TH,FR;BYSETPOS=-1;COUNT=6", "19970929T090000", 20));
+  // Friday the 13th; DTSTART is always the first instance.
+  TEST_ASSERT_EQUAL_STRING("19970902 19980213 19980313 19981113 19990813",
+                           expand("FREQ=MONTHLY;BYDAY=FR;BYMONTHDAY=13;COUNT=5", "19970902T090000", 20));
+}
+
+static void test_rfc_yearly() {
+  TEST_ASSERT_EQUAL_STRING("19970519 19980518 19990517",
+                           expand("FREQ=YEARLY;BYDAY=20MO;COUNT=3", "19970519T090000", 20));
+  TEST_ASSERT_EQUAL_STRING("19970313 19970320 19970327 19980305",
+                           expand("FREQ=YEARLY;BYMONTH=3;BYDAY=TH", "19970313T090000", 4));
+}
+
+// 1000 empty DAILY periods used to end these before the next Feb 29.
+static void test_leap_day_outlives_empty_periods() {
+  TEST_ASSERT_EQUAL_STRING("20250101 20280229 20320229",
+                           expand("FREQ=DAILY;BYMONTH=2;BYMONTHDAY=29", "20250101", 3));
+  // 2100 is not a leap year: eight years between instances.
+  TEST_ASSERT_EQUAL_STRING("20970301 21040229 21080229",
+                           expand("FREQ=DAILY;BYMONTH=2;BYMONTHDAY=29", "20970301", 3));
+  TEST_ASSERT_EQUAL_STRING("20240229 20440229 20640229 20840229 21040229",
+                           expand("FREQ=YEARLY;INTERVAL=5;BYMONTH=2;BYMONTHDAY=29", "20240229", 5));
+  TEST_ASSERT_EQUAL_STRING("20240229 20280229 20320229",
+                           expand("FREQ=MONTHLY;BYMONTHDAY=29;BYMONTH=2", "20240229", 3));
+}
+
+static void test_impossible_rule_gives_up() {
+  uint32_t periods;
+  TEST_ASSERT_EQUAL_STRING("20250101", expand("FREQ=DAILY;BYMONTH=2;BYMONTHDAY=30", "20250101", 5, &periods));
+  TEST_ASSERT_LESS_THAN_UINT32((RECURRENCE_MAX_EMPTY_YEARS + 1) * 366 + 1, periods);
+  TEST_ASSERT_EQUAL_STRING("20250101", expand("FREQ=YEARLY;BYMONTH=4;BYMONTHDAY=31", "20250101", 5, &periods));
+  TEST_ASSERT_LESS_THAN_UINT32(RECURRENCE_MAX_EMPTY_YEARS + 3, periods);
+}
+
+// 1997 New York, as the RFC examples' TZID=America/New_York reads then.
+#define NEW_YORK_1997 "EST5EDT,M4.1.0,M10.5.0"
+
+// Space-separated local YYYYMMDDTHHMM of the instances in [from, to).
+static const char *window(const RecurrenceExpansion &expansion, const char *from, const char *to,
+                          const RecurrenceOverrides *overrides = nullptr, size_t *count = nullptr) {
+  static char out[2048];
+  out[0] = '\0';
+  std::vector<time_t> starts;
+  expansion.expand(parseICalTime(from), parseICalTime(to), overrides, starts);
+  for (time_t t : starts) {
+    CivilTime when;
+    timeZone.toLocal(t, when);
+    size_t len = strlen(out);
+    snprintf(out + len, sizeof(out) - len, "%s%04d%02d%02dT%02d%02d", len ? " " : "", when.year, when.month,
+             when.day, when.hour, when.minute);
+  }
+  if (count) *count = starts.size();
+  return out;
+}
+
+static RecurrenceExpansion expansionOf(const char *rrule, const char *dtstart, time_t duration = 3600,
+                                       uint32_t uidHash = 0) {
+  RecurrenceRule rule;
+  TEST_ASSERT_TRUE_MESSAGE(rule.parse(rrule), rrule);
+  RecurrenceExpansion expansion;
+  TEST_ASSERT_TRUE_MESSAGE(expansion.begin(rule, dtstart, duration, uidHash), dtstart);
+  return expansion;
+}
+
+// UNTIL is inclusive.  A date-time in UTC bounds a local DTSTART once
+// converted; a date covers its whole day.
+static void test_until_date_and_date_time() {
+  TEST_ASSERT_TRUE(timeZone.set(NEW_YORK_1997));
+
+  // "Daily until December 24, 1997": Sep 2 through Dec 23, 113 instances.
+  size_t count;
+  const char *daily = window(expansionOf("FREQ=DAILY;UNTIL=19971224T000000Z", "19970902T090000"),
+                             "19970901", "19980101", nullptr, &count);
+  TEST_ASSERT_EQUAL_UINT32(113, count);
+  TEST_ASSERT_EQUAL_INT(0, strncmp(daily, "19970902T0900 19970903T0900", 27));
+  TEST_ASSERT_EQUAL_STRING("19971223T0900", daily + strlen(daily) - 13);
+
+  // "Every other week on Monday, Wednesday, and Friday until December 24,
+  // 1997", 9:00 local across the October change.
+  TEST_ASSERT_EQUAL_STRING(
+      "19970901T0900 19970903T0900 19970905T0900 19970915T0900 19970917T0900 19970919T0900 19970929T0900 "
+      "19971001T0900 19971003T0900 19971013T0900 19971015T0900 19971017T0900 19971027T0900 19971029T0900 "
+      "19971031T0900 19971110T0900 19971112T0900 19971114T0900 19971124T0900 19971126T0900 19971128T0900 "
+      "19971208T0900 19971210T0900 19971212T0900 19971222T0900",
+      window(expansionOf("FREQ=WEEKLY;INTERVAL=2;UNTIL=19971224T000000Z;WKST=SU;BYDAY=MO,WE,FR", "19970901T090000"),
+             "19970901", "19980101"));
+
+  // Landing exactly on UNTIL keeps the instance; a second later does not.
+  TEST_ASSERT_EQUAL_STRING("19970902T0500 19970903T0500 19970904T0500",
+                           window(expansionOf("FREQ=DAILY;UNTIL=19970904T090000Z", "19970902T090000Z"),
+                                  "19970901", "19971001"));
+  TEST_ASSERT_EQUAL_STRING("19970902T0500 19970903T0500",
+                           window(expansionOf("FREQ=DAILY;UNTIL=19970904T085959Z", "19970902T090000Z"),
+                                  "19970901", "19971001"));
+
+  // All-day, UNTIL a date: its own day included.
+  TEST_ASSERT_EQUAL_STRING("19970902T0000 19970903T0000 19970904T0000 19970905T0000",
+                           window(expansionOf("FREQ=DAILY;UNTIL=19970905", "19970902", 86400), "19970901", "19971001"));
+  timeZone.set("UTC0");
+}
+
+// RFC 5545 3.8.5.1's list, and a second EXDATE line adding to it.
+static void test_exdate() {
+  RecurrenceExpansion expansion = expansionOf("FREQ=DAILY;COUNT=6", "19960401T010000Z");
+  expansion.exclude("19960402T010000Z,19960403T010000Z,19960404T010000Z");
+  TEST_ASSERT_EQUAL_STRING("19960401T0100 19960405T0100 19960406T0100", window(expansion, "19960401", "19960501"));
+  expansion.exclude("19960406T010000Z");
+  TEST_ASSERT_EQUAL_STRING("19960401T0100 19960405T0100", window(expansion, "19960401", "19960501"));
+  // Not an instance: nothing to take out.
+  expansion.exclude("19960405T020000Z");
+  TEST_ASSERT_EQUAL_STRING("19960401T0100 19960405T0100", window(expansion, "19960401", "19960501"));
+}
+
+// The RFC 5545 3.8.4.4 case: one instance of a weekly meeting moved by its
+// own VEVENT.  The series drops the instance it replaces, whichever way the
+// feed folds the UID, and leaves other series alone.
+static void test_moved_instance() {
+  const char *feed =
+      "BEGIN:VCALENDAR\r\n"
+      "BEGIN:VEVENT\r\n"
+      "UID:19970901T130000Z-123401@exam\r\n ple.com\r\n"
+      "DTSTART:19970902T090000Z\r\n"
+      "RRULE:FREQ=WEEKLY;COUNT=4\r\n"
+      "SUMMARY:Weekly meeting\r\n"
+      "END:VEVENT\r\n"
+      "BEGIN:VEVENT\r\n"
+      "UID:19970901T130000Z-123401@example.com\r\n"
+      "RECURRENCE-ID:19970909T090000Z\r\n"
+      "DTSTART:19970910T140000Z\r\n"
+      "SUMMARY:Weekly meeting (moved)\r\n"
+      "END:VEVENT\r\n"
+      "END:VCALENDAR\r\n";
+  RecurrenceOverrides overrides;
+  overrides.collect(feed);
+  TEST_ASSERT_EQUAL_UINT32(1, overrides.size());
+
+  uint32_t uid = hashICalUid("19970901T130000Z-123401@example.com\r\n");
+  TEST_ASSERT_EQUAL_UINT32(uid, hashICalUid(strstr(feed, "UID:") + 4));
+  RecurrenceExpansion series = expansionOf("FREQ=WEEKLY;COUNT=4", "19970902T090000Z", 3600, uid);
+  TEST_ASSERT_EQUAL_STRING("19970902T0900 19970916T0900 19970923T0900",
+                           window(series, "19970901", "19971001", &overrides));
+  TEST_ASSERT_EQUAL_STRING("19970902T0900 19970909T0900 19970916T0900 19970923T0900",
+                           window(series, "19970901", "19971001"));
+
+  RecurrenceExpansion other = expansionOf("FREQ=WEEKLY;COUNT=4", "19970902T090000Z", 3600, uid + 1);
+  TEST_ASSERT_EQUAL_STRING("19970902T0900 19970909T0900 19970916T0900 19970923T0900",
+                           window(other, "19970901", "19971001", &overrides));
+}
+
+static void test_window_jump_skips_history() {
+  RecurrenceRule rule;
+  TEST_ASSERT_TRUE(rule.parse("FREQ=WEEKLY;BYDAY=MO,WE"));
+  CivilTime start = { 2000, 1, 3, 9, 0, 0 };
+  CivilTime from = { 2026, 10, 19, 0, 0, 0 };
+
+  RecurrenceIterator it;
+  it.begin(rule, start, &from);
+  CivilTime when;
+  TEST_ASSERT_TRUE(it.next(when));
+  TEST_ASSERT_EQUAL(2026, when.year);
+  TEST_ASSERT_EQUAL(10, when.month);
+  TEST_ASSERT_EQUAL(19, when.day);
+  TEST_ASSERT_EQUAL(9, when.hour);
+  TEST_ASSERT_TRUE(it.next(when));
+  TEST_ASSERT_EQUAL(21, when.day);
+  TEST_ASSERT_EQUAL_UINT32(1, it.periodsVisited());
+}
+
+// One week of a 26-year-old weekly event, as the day view expands it.
+static void test_benchmark_window() {
+  RecurrenceRule rule;
+  TEST_ASSERT_TRUE(rule.parse("FREQ=WEEKLY;BYDAY=MO,WE,FR"));
+  CivilTime start = { 2000, 1, 3, 9, 0, 0 };
+  CivilTime from = { 2026, 10, 19, 0, 0, 0 };
+  CivilTime until = { 2026, 10, 26, 0, 0, 0 };
+  const int32_t untilDays = civilToDays(until.year, until.month, until.day);
+  const int rounds = 2000;
+
+  uint32_t found[2] = {}, periods[2] = {};
+  double nsPerWindow[2];
+  for (int jump = 0; jump < 2; jump++) {
+    int64_t t0 = esp_timer_get_time();
+    for (int r = 0; r < rounds; r++) {
+      RecurrenceIterator it;
+      it.begin(rule, start, jump ? &from : nullptr);
+      CivilTime when;
+      while (it.next(when)) {
+        int32_t days = civilToDays(when.year, when.month, when.day);
+        if (days >= untilDays) break;
+        if (days >= civilToDays(from.year, from.month, from.day)) found[jump]++;
+      }
+      periods[jump] = it.periodsVisited();
+    }
+    nsPerWindow[jump] = (esp_timer_get_time() - t0) * 1000.0 / rounds;
+  }
+  TEST_ASSERT_EQUAL_UINT32(3 * rounds, found[0]);
+  TEST_ASSERT_EQUAL_UINT32(found[0], found[1]);
+  printf("recurrence: one week of a 26-year weekly rule: walk from DTSTART %u periods %.0f ns, jump %u periods %.0f ns\n",
+         (unsigned)periods[0], nsPerWindow[0], (unsigned)periods[1], nsPerWindow[1]);
+}
+
+int main(int argc, char **argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_rfc_daily_and_weekly);
+  RUN_TEST(test_rfc_monthly);
+  RUN_TEST(test_rfc_yearly);
+  RUN_TEST(test_leap_day_outlives_empty_periods);
+  RUN_TEST(test_impossible_rule_gives_up);
+  RUN_TEST(test_until_date_and_date_time);
+  RUN_TEST(test_exdate);
+  RUN_TEST(test_moved_instance);
+  RUN_TEST(test_window_jump_skips_history);
+  RUN_TEST(test_benchmark_window);
+  return UNITY_END();
+}
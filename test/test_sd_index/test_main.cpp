@@ -0,0 +1,234 @@
+// SdIndex over the in-memory card: lookups and listings, the manifest the
+// first walk writes and the next mount rechecks, a damaged manifest, and a
+// directory of several thousand entries loaded cold (walked) against a
+// manifest hit.
+//
+// Card cost is counted in opens: FatFs opens and stats every entry a walk
+// steps over, while a manifest is one open and one sequential read.  Host
+// times only track regressions; the device figures are the [SdIndex] line's
+// manifest and walk times.
+
+#include <unity.h>
+#include "host_shim.h"
+#include "esp_timer.h"
+#include "sd_index.h"
+
+#define MUSIC           "/Music"
+#define MANIFEST        MUSIC "/" SD_INDEX_MANIFEST
+#define LARGE_ENTRIES   4000
+#define SAMPLED_LOOKUPS 200
+#define ROUNDS          10
+
+void setUp() {
+  SD_MMC.files.clear();
+  SD_MMC.directories.clear();
+}
+void tearDown() {}
+
+static void addFile(const char *name, size_t size) {
+  SD_MMC.files[std::string(MUSIC "/") + name].assign(size, 0);
+}
+
+static void addTracks(int count) {
+  char name[32];
+  for (int i = 0; i < count; i++) {
+    snprintf(name, sizeof(name), "track-%05d.mp3", i);
+    addFile(name, 1000 + i);
+  }
+}
+
+static void test_lookups_and_listing() {
+  addFile("b.mp3", 100);
+  addFile("a.wav", 200);
+  addFile("c.mp3", 300);
+  SD_MMC.mkdir(MUSIC "/Albums");
+  SD_MMC.files[MUSIC "/Albums/x.mp3"].assign(1, 0);
+
+  SdIndex index;
+  index.begin();
+  TEST_ASSERT_TRUE(index.contains(MUSIC, "c.mp3"));
+  TEST_ASSERT_TRUE(index.contains(MUSIC, "Albums"));
+  TEST_ASSERT_FALSE(index.contains(MUSIC, "d.mp3"));
+  TEST_ASSERT_FALSE(index.contains(MUSIC, "x.mp3"));        // one level only
+  TEST_ASSERT_FALSE(index.contains(MUSIC, SD_INDEX_MANIFEST));
+  TEST_ASSERT_TRUE(SD_MMC.exists(MANIFEST));
+
+  // Files only, in card order, cut at the caller's limit.
+  char names[4][100];
+  TEST_ASSERT_EQUAL_UINT16(2, index.list(MUSIC, ".mp3", names, 4));
+  TEST_ASSERT_EQUAL_STRING("b.mp3", names[0]);
+  TEST_ASSERT_EQUAL_STRING("c.mp3", names[1]);
+  TEST_ASSERT_EQUAL_UINT16(3, index.list(MUSIC, nullptr, names, 4));
+  TEST_ASSERT_EQUAL_STRING("a.wav", names[0]);
+  TEST_ASSERT_EQUAL_UINT16(1, index.list(MUSIC, nullptr, names, 1));
+
+  uint32_t bytes = 0;
+  TEST_ASSERT_EQUAL_UINT16(3, index.forEach(MUSIC, nullptr, [](const char *, uint32_t size, void *ctx) {
+    *(uint32_t *)ctx += size;
+  }, &bytes));
+  TEST_ASSERT_EQUAL_UINT32(600, bytes);
+
+  TEST_ASSERT_FALSE(index.load("/Missing"));
+  hostRunTasks();
+}
+
+// The next boot answers from the manifest at once; the recheck walk leaves
+// an unchanged directory alone and picks up files copied on from a computer.
+static void test_manifest_rechecked_each_mount() {
+  addTracks(20);
+  {
+    SdIndex index;
+    index.begin();
+    TEST_ASSERT_TRUE(index.load(MUSIC));
+    hostRunTasks();
+  }
+  std::vector<uint8_t> manifest = SD_MMC.files[MANIFEST];
+
+  {
+    SdIndex index;
+    index.begin();
+    uint32_t opens = SD_MMC.opens;
+    TEST_ASSERT_TRUE(index.contains(MUSIC, "track-00007.mp3"));
+    TEST_ASSERT_EQUAL_UINT32(1, SD_MMC.opens - opens);
+    hostRunTasks();
+    TEST_ASSERT_TRUE(manifest == SD_MMC.files[MANIFEST]);
+  }
+
+  {
+    SdIndex index;
+    index.begin();
+    TEST_ASSERT_TRUE(index.load(MUSIC));
+    addFile("new.mp3", 4000);
+    TEST_ASSERT_FALSE(index.contains(MUSIC, "new.mp3"));   // the manifest answers until the walk
+    hostRunTasks();
+    TEST_ASSERT_TRUE(index.contains(MUSIC, "new.mp3"));
+    TEST_ASSERT_TRUE(manifest != SD_MMC.files[MANIFEST]);
+  }
+
+  // invalidate() re-walks on the watch's own writes.
+  {
+    SdIndex index;
+    index.begin();
+    TEST_ASSERT_TRUE(index.load(MUSIC));
+    hostRunTasks();
+    SD_MMC.remove(MUSIC "/track-00003.mp3");
+    index.invalidate(MUSIC);
+    hostRunTasks();
+    TEST_ASSERT_FALSE(index.contains(MUSIC, "track-00003.mp3"));
+  }
+}
+
+static void test_damaged_manifest_is_rebuilt() {
+  addTracks(20);
+  {
+    SdIndex index;
+    index.begin();
+    TEST_ASSERT_TRUE(index.load(MUSIC));
+  }
+  std::vector<uint8_t> good = SD_MMC.files[MANIFEST];
+
+  SD_MMC.files[MANIFEST].resize(good.size() - 3);            // cut short
+  {
+    SdIndex index;
+    index.begin();
+    TEST_ASSERT_TRUE(index.contains(MUSIC, "track-00019.mp3"));
+    hostRunTasks();
+  }
+  TEST_ASSERT_TRUE(good == SD_MMC.files[MANIFEST]);
+
+  SD_MMC.files[MANIFEST][sizeof(sd_index_header_t) + offsetof(sd_index_entry_t, nameOffset) + 3] = 0x7f;
+  {
+    SdIndex index;
+    index.begin();
+    TEST_ASSERT_TRUE(index.contains(MUSIC, "track-00019.mp3"));
+    hostRunTasks();
+  }
+  TEST_ASSERT_TRUE(good == SD_MMC.files[MANIFEST]);
+}
+
+// File_Search() before the index: walk the directory until the name turns up.
+static uint32_t legacyOpens(const char *directory, const char *fileName) {
+  uint32_t opens = SD_MMC.opens;
+  File path = SD_MMC.open(directory);
+  for (File file = path.openNextFile(); file; file = path.openNextFile()) {
+    if (strcmp(file.name(), fileName) == 0) break;
+  }
+  path.close();
+  return SD_MMC.opens - opens;
+}
+
+static void test_cold_scan_against_manifest_hit() {
+  addTracks(LARGE_ENTRIES);
+
+  int64_t coldUs = INT64_MAX, hitUs = INT64_MAX;
+  uint32_t coldOpens = 0, hitOpens = 0;
+  uint64_t coldBytes = 0, hitBytes = 0;
+  for (int round = 0; round < ROUNDS; round++) {
+    SD_MMC.remove(MANIFEST);
+    {
+      SdIndex index;
+      index.begin();
+      uint32_t opens = SD_MMC.opens;
+      uint64_t bytes = SD_MMC.bytesRead;
+      int64_t start = esp_timer_get_time();
+      TEST_ASSERT_TRUE(index.load(MUSIC));
+      coldUs = min(coldUs, esp_timer_get_time() - start);
+      coldOpens = SD_MMC.opens - opens;
+      coldBytes = SD_MMC.bytesRead - bytes;
+      hostRunTasks();
+    }
+    {
+      SdIndex index;
+      index.begin();
+      uint32_t opens = SD_MMC.opens;
+      uint64_t bytes = SD_MMC.bytesRead;
+      int64_t start = esp_timer_get_time();
+      TEST_ASSERT_TRUE(index.load(MUSIC));
+      hitUs = min(hitUs, esp_timer_get_time() - start);
+      hitOpens = SD_MMC.opens - opens;
+      hitBytes = SD_MMC.bytesRead - bytes;
+      hostRunTasks();                    // the mount's recheck, which changes nothing
+    }
+  }
+
+  // Cold, the manifest is looked for, then the directory and every entry are
+  // opened and a manifest written; a hit opens the manifest alone.
+  TEST_ASSERT_EQUAL_UINT32(LARGE_ENTRIES + 3, coldOpens);
+  TEST_ASSERT_EQUAL_UINT32(1, hitOpens);
+  TEST_ASSERT_EQUAL_UINT64(SD_MMC.files[MANIFEST].size(), hitBytes);
+
+  // Lookups once indexed touch the card not at all; before, each one walked.
+  SdIndex index;
+  index.begin();
+  TEST_ASSERT_TRUE(index.load(MUSIC));
+  hostRunTasks();
+  char name[32];
+  uint64_t before = 0;
+  uint32_t opens = SD_MMC.opens;
+  int64_t start = esp_timer_get_time();
+  for (int i = 0; i < SAMPLED_LOOKUPS; i++) {
+    snprintf(name, sizeof(name), "track-%05d.mp3", i * (LARGE_ENTRIES / SAMPLED_LOOKUPS));
+    TEST_ASSERT_TRUE(index.contains(MUSIC, name));
+  }
+  int64_t lookupUs = esp_timer_get_time() - start;
+  TEST_ASSERT_EQUAL_UINT32(opens, SD_MMC.opens);
+  for (int i = 0; i < SAMPLED_LOOKUPS; i++) {
+    snprintf(name, sizeof(name), "track-%05d.mp3", i * (LARGE_ENTRIES / SAMPLED_LOOKUPS));
+    before += legacyOpens(MUSIC, name);
+  }
+
+  printf("sd_index: %d entries, cold scan %lld us (%lu opens, %llu bytes read), manifest hit %lld us "
+         "(%lu open, %llu bytes); lookup %.2f us and 0 opens, was %llu opens\n",
+         LARGE_ENTRIES, (long long)coldUs, (unsigned long)coldOpens, (unsigned long long)coldBytes,
+         (long long)hitUs, (unsigned long)hitOpens, (unsigned long long)hitBytes,
+         (double)lookupUs / SAMPLED_LOOKUPS, (unsigned long long)(before / SAMPLED_LOOKUPS));
+}
+
+int main(int argc, char **argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_lookups_and_listing);
+  RUN_TEST(test_manifest_rechecked_each_mount);
+  RUN_TEST(test_damaged_manifest_is_rebuilt);
+  RUN_TEST(test_cold_scan_against_manifest_hit);
+  return UNITY_END();
+}
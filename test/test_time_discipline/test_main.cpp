@@ -0,0 +1,250 @@
+// TimeDiscipline: the drift fit and its outlier gate on their own, then a
+// month of a simulated watch kept as TimeClient keeps it.  The RTC's crystal
+// runs 9 ppm fast and wanders 1.5 ppm a day on and off the wrist; the system
+// clock runs from the RC oscillator (-280 ppm, drifting with temperature)
+// asleep and the main crystal awake; NTP answers within 15 ms, 2% of the
+// time from a wrong server, and is only reachable on the 120 min WiFi sync.
+// The displayed time must stay within TIME_MAX_ERROR_S throughout.
+
+#include <unity.h>
+#include "host_shim.h"
+#include "time_discipline.h"
+#include "sim_random.h"
+#include <math.h>
+
+#define RTC_STEP_PPM  4.069                  // RTC_OFFSET_PPM
+#define START         1735689600
+#define DAY           (24 * 60 * 60)
+#define CRYSTAL_PPM   9.0                    // the RTC off the wrist
+#define WORN_PPM      1.5                    // added on it, 07:00 to 23:00
+#define SYNC_MIN      120                    // the WiFi sync NTP rides on
+
+void setUp() {
+  seed = 0x2545F4914F6CDD1Dull;
+}
+void tearDown() {}
+
+static void test_fit_and_register() {
+  TimeDiscipline discipline;
+  discipline.begin(0, RTC_STEP_PPM);
+  TEST_ASSERT_TRUE(discipline.syncDue(START));
+  // 12 ppm fast, sampled every two hours with 10 ms of jitter.
+  for (int i = 0; i < 6; i++) {
+    time_t now = START + i * 7200;
+    TEST_ASSERT_NOT_EQUAL(TimeDiscipline::REJECTED, discipline.addSample(now, 12e-6 * i * 7200 + 0.01 * gaussian()));
+  }
+  TEST_ASSERT_FLOAT_WITHIN(1.0, 12.0, discipline.driftPpm());
+  TEST_ASSERT_EQUAL_INT(-3, discipline.targetSteps());
+  // The sync spacing leaves the steering allowance out of the budget.
+  double spent = TIME_NTP_JITTER_S + TIME_STEER_ERROR_S + 2 * discipline.sigmaPpm() * 1e-6 * discipline.nextSyncDelay();
+  TEST_ASSERT_TRUE(spent <= TIME_MAX_ERROR_S + 1e-6 || discipline.nextSyncDelay() == TIME_SYNC_MIN_S);
+}
+
+static void test_outlier_held_then_step_confirmed() {
+  TimeDiscipline discipline;
+  discipline.begin(0, RTC_STEP_PPM);
+  for (int i = 0; i < 5; i++) discipline.addSample(START + i * 7200, 0.002 * gaussian());
+  time_t now = START + 5 * 7200;
+  TEST_ASSERT_EQUAL(TimeDiscipline::REJECTED, discipline.addSample(now, 0.8));
+  TEST_ASSERT_TRUE(discipline.syncDue(now + 1));
+  TEST_ASSERT_EQUAL(TimeDiscipline::ACCEPTED, discipline.addSample(now + 120, 0.003));
+  // Two answers that agree on a moved RTC restart the fit.
+  TEST_ASSERT_EQUAL(TimeDiscipline::REJECTED, discipline.addSample(now + 7200, 1.5));
+  TEST_ASSERT_EQUAL(TimeDiscipline::STEPPED, discipline.addSample(now + 7320, 1.5));
+}
+
+// Steers follow the system clock's measured rate, and the edge is looked
+// for where that rate puts it.
+static void test_steering_follows_measured_rate() {
+  TimeDiscipline discipline;
+  discipline.begin(0, RTC_STEP_PPM);
+  discipline.addSample(START, 0.25);
+  TEST_ASSERT_TRUE(discipline.steerDue(START));
+  TEST_ASSERT_FLOAT_WITHIN(1e-6, 0, discipline.untilEdge(START + 0.1));
+  discipline.steered(START, 0);
+
+  // Before any rate is known the prior allows 300 s.
+  TEST_ASSERT_FALSE(discipline.steerDue(START + 200));
+  TEST_ASSERT_TRUE(discipline.steerDue(START + 300));
+  for (int i = 1; i <= 4; i++) discipline.steered(START + i * 400, -100e-6 * 400);
+  TEST_ASSERT_FLOAT_WITHIN(0.1, -100, discipline.systemPpm());
+  // 100 ppm plus the 20 ppm floor: 0.15 s in 1250 s.
+  TEST_ASSERT_FALSE(discipline.steerDue(START + 1600 + 1200));
+  TEST_ASSERT_TRUE(discipline.steerDue(START + 1600 + 1250));
+
+  // 1000 s on, the clock is expected 0.1 s slow: the RTC (0.25 s ahead of
+  // true) reads 0.35 s past the system, so its next second starts 0.65 s
+  // later, and polling 20 ms of spread plus 20 ms of margin before that.
+  double clock = START + 1600 + 1000;
+  TEST_ASSERT_FLOAT_WITHIN(0.002, 0.65 - 0.04, discipline.untilEdge(clock));
+
+  // Slewing the expected drift out leaves only the 20 ppm spread to steer
+  // for: 0.15 s in 7500 s.
+  TEST_ASSERT_FLOAT_WITHIN(1e-6, 0.1, discipline.compensate(START + 2600));
+  TEST_ASSERT_FLOAT_WITHIN(1e-6, 0, discipline.systemError(START + 2600));
+  for (time_t t = START + 2700; t <= START + 8600; t += 100) discipline.compensate(t);
+  TEST_ASSERT_FALSE(discipline.steerDue(START + 8600));
+  for (time_t t = START + 8700; t <= START + 9100; t += 100) discipline.compensate(t);
+  TEST_ASSERT_TRUE(discipline.steerDue(START + 9100));
+  // 0.05 s behind what was slewed out: the rate was 106.7 ppm.
+  discipline.steered(START + 9100, -0.05);
+  TEST_ASSERT_FLOAT_WITHIN(0.01, (4 * -100 - 106.67) / 5, discipline.systemPpm());
+}
+
+struct Watch {
+  double rtc = 0.3;                          // RTC minus true, seconds
+  double system = 0.3;                       // system minus true
+  int8_t steps = 0;
+  double asleepPpm = -280;
+  double crystalWalk = 0;
+};
+
+struct Outcome {
+  double maxError, meanError;
+  double steersPerDay, pollSecondsPerDay;
+  double ntpPerDay;
+  long rejected;
+  double minDriftPpm, maxDriftPpm;           // the fit, past its first day
+  double walkPpm;                            // the crystal's largest excursion from its cycle
+};
+
+// RTC minus system at the RTC's edge, as PCF85063_Read_Edge() times it, and
+// how long it polled after sleeping `wait`.
+static double readEdge(const Watch &w, double clock, double wait, double &polled) {
+  double rtc = clock + w.rtc - w.system + wait;
+  double toEdge = ceil(rtc) - rtc;
+  polled = toEdge < 0.001 ? toEdge + 1 : toEdge;
+  return w.rtc - w.system + 0.0005 * gaussian();
+}
+
+// A month of the watch.  `fixedSteer`: steer on the old 10 min timer with a
+// full poll instead of when due.
+static Outcome simulate(bool fixedSteer) {
+  TimeDiscipline discipline;
+  discipline.begin(0, RTC_STEP_PPM);
+  Watch w;
+  Outcome o = {};
+  o.minDriftPpm = INFINITY;
+  o.maxDriftPpm = -INFINITY;
+  long steers = 0, ntp = 0, minutes = 0;
+  double polled = 0, errorSum = 0;
+  long lastSteer = -10;
+
+  for (long minute = 0; minute < 30L * 24 * 60; minute++) {
+    double t = START + minute * 60.0;
+    int hour = (minute / 60) % 24;
+    bool worn = hour >= 7 && hour < 23;
+    bool awake = worn && uniform() < 0.1;
+
+    // One minute of drift.
+    w.crystalWalk += 0.02 * gaussian();
+    double crystal = CRYSTAL_PPM + (worn ? WORN_PPM : 0) + 0.5 * sin(2 * M_PI * minute / (24 * 60.0)) + w.crystalWalk * 0.05;
+    o.walkPpm = fmax(o.walkPpm, fabs(w.crystalWalk * 0.05));
+    w.asleepPpm = constrain(w.asleepPpm + 0.5 * gaussian(), -350.0, -210.0);
+    w.rtc += (crystal + w.steps * RTC_STEP_PPM) * 60e-6;
+    w.system += (awake ? 5 : w.asleepPpm) * 60e-6;
+    double clock = t + w.system;
+    time_t now = (time_t)clock;
+
+    // TimeClient::begin() on the 120 min sync, asking again straight away
+    // when the answer was held back.
+    for (int ask = 0; minute % SYNC_MIN == 0 && discipline.syncDue(now) && ask < 2; ask++) {
+      if (ask && !discipline.awaitingConfirmation()) break;
+      ntp++;
+      bool wrong = uniform() < 0.02;
+      w.system = wrong ? 0.4 + 0.6 * uniform() : 0.015 * gaussian();
+      double edgePolled;
+      double offset = readEdge(w, t + w.system, 0, edgePolled);
+      polled += edgePolled;
+      TimeDiscipline::Verdict verdict = discipline.addSample(now, offset);
+      if (verdict == TimeDiscipline::REJECTED) {
+        o.rejected++;
+        w.system += offset - discipline.predictedOffset(now);
+      } else {
+        if (minute >= 24 * 60) {
+          o.minDriftPpm = fmin(o.minDriftPpm, discipline.driftPpm());
+          o.maxDriftPpm = fmax(o.maxDriftPpm, discipline.driftPpm());
+        }
+        int8_t target = discipline.targetSteps();
+        if (target != discipline.steps()) {
+          w.steps = target;
+          discipline.setSteps(now, target);
+        }
+        if (fabs(offset) > 0.1) {
+          w.rtc = w.system + 0.001 * gaussian();
+          double after = readEdge(w, t + w.system, 0, edgePolled);
+          polled += edgePolled;
+          discipline.rewritten(now, offset, after);
+        }
+      }
+      discipline.clockSet(now);
+    }
+
+    // What the screen shows before this minute's steer, once the first NTP
+    // answer is in.
+    if (discipline.hasFix()) {
+      double error = fabs(w.system);
+      o.maxError = fmax(o.maxError, error);
+      errorSum += error;
+      minutes++;
+    }
+
+    // TimeClient::steerFromRtc() from Background_Tasks.
+    bool due = fixedSteer ? minute - lastSteer >= 10 : discipline.steerDue(now);
+    if (!due && !fixedSteer) w.system += discipline.compensate(now);
+    if (due) {
+      lastSteer = minute;
+      double edgePolled;
+      clock += uniform();                    // the loop is not locked to the RTC's second
+      double wait = fixedSteer ? 0 : discipline.untilEdge(clock);
+      double offset = readEdge(w, clock, wait, edgePolled);
+      polled += edgePolled;
+      double error = discipline.predictedOffset(now) - offset;
+      w.system -= error;
+      discipline.steered(now, error);
+      steers++;
+    }
+
+  }
+  o.meanError = errorSum / minutes;
+  o.steersPerDay = steers / 30.0;
+  o.pollSecondsPerDay = polled / 30.0;
+  o.ntpPerDay = ntp / 30.0;
+  return o;
+}
+
+static void report(const char *name, const Outcome &o) {
+  printf("time_discipline: %-22s max error %4.0f ms, mean %3.0f ms, %5.1f steers/day, RTC polled %5.1f s/day, "
+         "%.1f NTP/day, %ld rejected, drift %.2f to %.2f ppm (walk %.2f)\n",
+         name, o.maxError * 1000, o.meanError * 1000, o.steersPerDay, o.pollSecondsPerDay, o.ntpPerDay, o.rejected,
+         o.minDriftPpm, o.maxDriftPpm, o.walkPpm);
+}
+
+static void test_month_within_budget() {
+  Outcome timer = simulate(true);
+  seed = 0x2545F4914F6CDD1Dull;
+  Outcome gated = simulate(false);
+  report("10 min steer, full poll", timer);
+  report("steer when due", gated);
+
+  TEST_ASSERT_TRUE(gated.maxError <= TIME_MAX_ERROR_S);
+  TEST_ASSERT_TRUE(gated.pollSecondsPerDay < timer.pollSecondsPerDay / 2);
+
+  // NTP only when the fit needs it: under a tenth of asking on every sync.
+  TEST_ASSERT_LESS_THAN(24 * 60 / SYNC_MIN / 10.0, gated.ntpPerDay);
+
+  // The fit follows the crystal's daily mean, worn 16 hours of 24, to within
+  // how far its random walk took it.
+  double meanPpm = CRYSTAL_PPM + WORN_PPM * 16 / 24;
+  TEST_ASSERT_FLOAT_WITHIN(gated.walkPpm, meanPpm, gated.minDriftPpm);
+  TEST_ASSERT_FLOAT_WITHIN(gated.walkPpm, meanPpm, gated.maxDriftPpm);
+}
+
+int main(int argc, char **argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_fit_and_register);
+  RUN_TEST(test_outlier_held_then_step_confirmed);
+  RUN_TEST(test_steering_follows_measured_rate);
+  RUN_TEST(test_month_within_budget);
+  return UNITY_END();
+}
@@ -0,0 +1,220 @@
+// WeatherRefreshPolicy against fixed refresh timers over a synthetic year.
+//
+// The year is synthetic because what the policy is judged on is how far the
+// forecast on the watch has drifted from the one a fetch would bring, and no
+// archive keeps every hourly revision of a forecast for a year.  Revisions are
+// built the way forecasts are known to evolve (each model run moves the
+// forecast for every hour ahead by an innovation correlated across the hours
+// it touches, and the forecast at lead 0 is the truth), over a climate with a
+// seasonal and a diurnal temperature cycle and settled and unsettled spells:
+// unsettled spells carry most of the rain and forecasts that are revised
+// twice as hard.  Errors are measured against the freshest forecast, minute by
+// minute, over the whole day and over the minutes the screen is on.
+//
+// At the fetch count of the 120 min sync interval the policy must show less
+// wrong rain, over the day and on screen, and less temperature error on
+// screen.  Its temperature error over the whole day may be a little worse:
+// with revisions the forecast cannot anticipate, evenly spaced fetches are
+// the best a fixed count can do for that, and the policy's are spaced out
+// overnight on purpose.
+
+#include <unity.h>
+#include "host_shim.h"
+#include "weather_refresh.h"
+#include "sim_random.h"
+#include <math.h>
+#include <vector>
+
+#define SIM_DAYS      365
+#define SIM_START     1735689600             // 2025-01-01 00:00 UTC, local time = UTC
+#define LEADS         WEATHER_CACHE_HOURS    // hours a model run reaches ahead
+#define BATTERY       60
+
+// A year of forecasts.  Run t (one per hour) adds revision[t][L] to the
+// forecast for hour t + L; the forecast issued at t for hour h is the
+// climate plus every revision made at or before t, and the truth is the
+// forecast issued at h.
+struct Year {
+  int hours;
+  std::vector<bool> unsettled;
+  std::vector<float> climate;                // temperature, tenths °F
+  std::vector<float> wetClimate;             // precipitation latent, wet above 0
+  std::vector<float> tempRevision, wetRevision;
+  std::vector<int> runAt;                    // the newest run a fetch at each minute gets
+
+  Year() : hours((SIM_DAYS + 3) * 24) {
+    unsettled.resize(hours);
+    climate.resize(hours);
+    wetClimate.resize(hours);
+    tempRevision.resize((size_t)(hours + LEADS) * LEADS);
+    wetRevision.resize((size_t)(hours + LEADS) * LEADS);
+    runAt.resize(hours * 60);
+
+    bool spell = false;
+    for (int h = 0; h < hours; h++) {
+      // Spells of about three days, unsettled a third of the time.
+      if (uniform() < 1.0 / (spell ? 48 : 96)) spell = !spell;
+      unsettled[h] = spell;
+      double day = h / 24.0;
+      climate[h] = 550 - 250 * cos(2 * M_PI * (day - 15) / 365) + 90 * cos(2 * M_PI * ((h % 24) - 15) / 24.0);
+      wetClimate[h] = spell ? -0.4 : -2.2;
+    }
+    // Runs are published 30-90 min after their hour, in order.
+    int run = -1, next = 30 + (int)(uniform() * 60);
+    for (int minute = 0; minute < hours * 60; minute++) {
+      while (minute >= next) next = (++run + 1) * 60 + 30 + (int)(uniform() * 60);
+      runAt[minute] = run;
+    }
+    for (int t = 0; t < hours + LEADS; t++) {
+      double temp = 0, wet = 0;
+      for (int lead = LEADS - 1; lead >= 0; lead--) {
+        int h = t - LEADS + lead;            // runs start LEADS hours before the year
+        double scale = h >= 0 && h < hours && unsettled[h] ? 2.0 : 1.0;
+        temp = 0.9 * temp + gaussian() * 2.6 * scale;
+        wet = 0.9 * wet + gaussian() * 0.07 * scale;
+        tempRevision[(size_t)t * LEADS + lead] = temp;
+        wetRevision[(size_t)t * LEADS + lead] = wet;
+      }
+    }
+  }
+
+  // Hour h as forecast by the run at hour `issued` (<= h).
+  void forecast(int issued, int h, float &temp, bool &wet) const {
+    double t = climate[h], w = wetClimate[h];
+    for (int run = h - LEADS + 1; run <= issued; run++) {
+      size_t i = (size_t)(run + LEADS) * LEADS + (h - run);
+      t += tempRevision[i];
+      w += wetRevision[i];
+    }
+    temp = t;
+    wet = w > 0;
+  }
+};
+
+static Year *year;
+
+struct Outcome {
+  double fetchesPerDay;
+  double tempError;                          // mean |°F| over every minute
+  long precipMiss;                           // minutes showing rain wrongly or missing it
+  double seenTempError;                      // the same over the minutes the screen is on
+  long seenPrecipMiss;
+};
+
+// Screen on for glances through the day, never overnight.
+static bool displayAwake(long minute) {
+  int hour = (minute / 60) % 24;
+  if (hour < 7 || hour >= 23) return false;
+  uint32_t h = (uint32_t)minute * 2654435761u;
+  return (h >> 24) < 26;                     // about 10% of daytime minutes
+}
+
+// Fixed timer when `interval` > 0, the policy otherwise.
+static Outcome simulate(long interval) {
+  WeatherRefreshPolicy policy;
+  weather_forecast_t shown = {};
+  float freshTemp = 0;
+  bool freshWet = false;
+  long minutes = (long)SIM_DAYS * 24 * 60;
+  long nextFetch = 0, fetches = 0, awake = 0;
+  double tempError = 0, seenTempError = 0;
+  long precipMiss = 0, seenPrecipMiss = 0;
+  int freshRun = -1, freshHour = -1;
+
+  for (long minute = 60; minute < minutes; minute++) {
+    int hour = minute / 60;
+    time_t now = SIM_START + minute * 60;
+    bool screen = displayAwake(minute);
+    if (minute >= nextFetch) {
+      shown.hourStart = SIM_START + (time_t)hour * 3600;
+      shown.fetchedAt = now;
+      for (int i = 0; i < WEATHER_CACHE_HOURS; i++) {
+        float temp;
+        bool wet;
+        year->forecast(year->runAt[minute], hour + i, temp, wet);
+        shown.hours[i].temp = (int16_t)lrintf(temp);
+        shown.hours[i].code = wet ? 61 : 2;
+      }
+      fetches++;
+      if (interval) {
+        nextFetch = minute + interval;
+      } else {
+        policy.recordFetch(now);
+        uint32_t delay = policy.nextDelay(&shown, now, hour % 24, false, BATTERY);
+        nextFetch = minute + max(1L, (long)(delay + 59) / 60);
+      }
+    }
+    if (hour != freshHour || year->runAt[minute] != freshRun) {
+      freshHour = hour;
+      freshRun = year->runAt[minute];
+      year->forecast(freshRun, hour, freshTemp, freshWet);
+    }
+    // The screen as Weather::readForward() keeps it: the cached forecast's
+    // entry for the current hour.
+    int index = (now - shown.hourStart) / 3600;
+    float temp = index < WEATHER_CACHE_HOURS ? shown.hours[index].temp : year->climate[hour];
+    bool wet = index < WEATHER_CACHE_HOURS && shown.hours[index].code >= 51;
+    double error = fabs(temp - freshTemp) / 10;
+    bool miss = wet != freshWet;
+    tempError += error;
+    precipMiss += miss;
+    if (screen) {
+      awake++;
+      seenTempError += error;
+      seenPrecipMiss += miss;
+    }
+  }
+  return { fetches / (double)SIM_DAYS, tempError / minutes, precipMiss, seenTempError / awake, seenPrecipMiss };
+}
+
+static void report(const char *name, const Outcome &o) {
+  printf("weather_refresh: %-14s %5.1f fetches/day, temp error %.3f F (seen %.3f), precip miss %ld min (seen %ld)\n",
+         name, o.fetchesPerDay, o.tempError, o.seenTempError, o.precipMiss, o.seenPrecipMiss);
+}
+
+void setUp() {}
+void tearDown() {}
+
+static void test_policy_beats_fixed_timer() {
+  Outcome adaptive = simulate(0);
+  long equalInterval = lrint(24 * 60 / adaptive.fetchesPerDay);
+  Outcome equal = simulate(equalInterval);
+  Outcome hourly = simulate(60);
+  char name[24];
+  report("policy", adaptive);
+  snprintf(name, sizeof(name), "fixed %ld min", equalInterval);
+  report(name, equal);
+  report("fixed 60 min", hourly);
+
+  TEST_ASSERT_TRUE(adaptive.fetchesPerDay <= 24 * 60 / 120.0 + 0.1);
+  TEST_ASSERT_TRUE(adaptive.precipMiss < equal.precipMiss * 0.8);
+  TEST_ASSERT_TRUE(adaptive.seenPrecipMiss < equal.seenPrecipMiss * 0.8);
+  TEST_ASSERT_TRUE(adaptive.seenTempError < equal.seenTempError);
+  TEST_ASSERT_TRUE(adaptive.tempError < equal.tempError * 1.1);
+}
+
+// Sessions made for the weather count whether or not anything was fetched;
+// a reload burst holds the next fetch until the window has room.
+static void test_sessions_count_against_budget() {
+  WeatherRefreshPolicy policy;
+  time_t start = SIM_START;
+  TEST_ASSERT_EQUAL_UINT32(0, policy.budgetDelay(start, false, 30));
+  policy.recordFetch(start);
+  TEST_ASSERT_EQUAL_UINT32(2 * 3600 - 600, policy.budgetDelay(start + 600, false, 30));
+  TEST_ASSERT_EQUAL_UINT32(2 * 3600 - 600, policy.nextDelay(nullptr, start + 600, 12, false, 30));
+  TEST_ASSERT_EQUAL(WeatherRefreshPolicy::BUDGET, policy.lastReason());
+  TEST_ASSERT_EQUAL_UINT32(0, policy.budgetDelay(start + 600, true, 30));
+
+  for (int i = 1; i < 12; i++) policy.recordFetch(start + i * 60);
+  TEST_ASSERT_EQUAL_UINT32(24 * 3600 - 3600, policy.budgetDelay(start + 3600, false, 30));
+  TEST_ASSERT_EQUAL_UINT32(11 * 60, policy.budgetDelay(start + 3600, false, 80));
+}
+
+int main(int argc, char **argv) {
+  seed = 0x9E3779B97F4A7C15ull;
+  year = new Year;
+  UNITY_BEGIN();
+  RUN_TEST(test_policy_beats_fixed_timer);
+  RUN_TEST(test_sessions_count_against_budget);
+  return UNITY_END();
+}
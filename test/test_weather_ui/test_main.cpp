@@ -0,0 +1,243 @@
+// WeatherUi against a refcounting stand-in for eez::Value: which flow
+// variables each apply pushes, how many strings it allocates, and that the
+// variables always end up as a full push of the same data would leave them.
+//
+// The changing applies come from four days of a synthetic forecast as the
+// watch sees it: readForward() formats the cached forecast at every local
+// hour, and a fetch every two hours brings a forecast revised by a few tenths
+// of a degree per hour ahead and by a degree or two per day.  Each of those
+// is one formatWeather() and one apply.
+
+#include <unity.h>
+#include "host_shim.h"
+#include "weather_ui.h"
+#include "sim_random.h"
+#include "src/vars.h"
+#include <map>
+#include <math.h>
+#include <string>
+
+#define SIM_START     1748736000             // 2025-06-01 00:00 UTC
+#define SIM_APPLIES   200
+#define FETCH_EVERY_S (2 * 60 * 60)
+#define WEATHER_UI_STRINGS (WEATHER_UI_VARIABLES - 1 - 7)   // all but the temperature and hour labels
+
+// eez::Value as WeatherUi's target uses it: strings are shared, counted
+// blocks, integers are held inline.
+struct Text {
+  std::string text;
+  int refs;
+};
+static long allocations = 0, liveTexts = 0;
+
+class Value {
+  public:
+    Value() {}
+    Value(const Value &other) : text(other.text), integer(other.integer) {
+      if (text) text->refs++;
+    }
+    Value &operator=(const Value &other) {
+      if (other.text) other.text->refs++;
+      release();
+      text = other.text;
+      integer = other.integer;
+      return *this;
+    }
+    ~Value() { release(); }
+
+    static Value string(const char *s) {
+      Value v;
+      v.text = new Text{ s, 1 };
+      allocations++;
+      liveTexts++;
+      return v;
+    }
+    static Value number(int n) {
+      Value v;
+      v.integer = n;
+      return v;
+    }
+    bool operator==(const Value &other) const {
+      if (!text || !other.text) return !text && !other.text && integer == other.integer;
+      return text->text == other.text->text;
+    }
+
+  private:
+    void release() {
+      if (text && --text->refs == 0) {
+        delete text;
+        liveTexts--;
+      }
+      text = nullptr;
+    }
+    Text *text = nullptr;
+    int integer = 0;
+};
+
+class MockTarget : public WeatherUiTarget {
+  public:
+    void intern(uint8_t slot, const char *text) override { pool[slot] = Value::string(text); }
+    void setInterned(uint32_t variable, uint8_t slot) override { variables[variable] = pool[slot]; }
+    void setString(uint32_t variable, const char *text) override { variables[variable] = Value::string(text); }
+    void setInt(uint32_t variable, int value) override { variables[variable] = Value::number(value); }
+
+    std::map<uint32_t, Value> variables;
+    Value pool[WEATHER_INTERN_SLOTS];
+};
+
+// The variables a fresh WeatherUi leaves after pushing all of `data`.
+static bool matchesFullPush(const MockTarget &target, const WeatherData &data) {
+  WeatherUi ui;
+  MockTarget full;
+  ui.apply(data, full);
+  return target.variables == full.variables;
+}
+
+// Summer days around 75 °F with a 20 °F swing, showers now and then; each
+// fetch revises the hours ahead by a random walk in tenths of a degree.
+static float truth(time_t t) {
+  double hour = (t - SIM_START) / 3600.0;
+  return 750 + 100 * cos(2 * M_PI * (fmod(hour - 4, 24.0) - 15) / 24);   // local time is UTC-4
+}
+
+static int16_t revision[WEATHER_CACHE_HOURS];
+
+static void fetch(weather_forecast_t &forecast, time_t now) {
+  forecast.fetchedAt = now;
+  forecast.hourStart = now - now % 3600;
+  forecast.dayStart = (int32_t)(timeZone.utcToLocal(now) / 86400);
+  for (int i = 0; i < WEATHER_CACHE_HOURS; i++) {
+    revision[i] = (int16_t)(0.9 * (i + 2 < WEATHER_CACHE_HOURS ? revision[i + 2] : 0) + gaussian() * 4 * (i + 1) / 8);
+    time_t at = forecast.hourStart + (time_t)i * 3600;
+    forecast.hours[i].temp = (int16_t)lrintf(truth(at) + revision[i]);
+    forecast.hours[i].code = at / 3600 % 31 < 4 ? 61 : at / 3600 / 6 % 3 + 1;
+  }
+  forecast.temperature = forecast.hours[0].temp;
+  forecast.code = forecast.hours[0].code;
+  forecast.precipitation = forecast.code == 61 ? 12 : 0;
+  for (int d = 0; d < WEATHER_CACHE_DAYS; d++) {
+    forecast.days[d].high = (int16_t)(850 + gaussian() * 15);
+    forecast.days[d].low = (int16_t)(650 + gaussian() * 15);
+    forecast.days[d].windMax = (int16_t)(120 + gaussian() * 20);
+    forecast.days[d].code = (forecast.dayStart + d) % 4 == 0 ? 61 : 2;
+  }
+}
+
+void setUp() {
+  seed = 0x9e3779b97f4a7c15ull;
+  memset(revision, 0, sizeof(revision));
+  timeZone.set("EST5EDT,M3.2.0,M11.1.0");
+}
+void tearDown() {}
+
+static void test_first_apply_pushes_all_then_none() {
+  weather_forecast_t forecast = {};
+  fetch(forecast, SIM_START + 600);
+  WeatherData data;
+  formatWeather(forecast, SIM_START + 600, data);
+
+  WeatherUi ui;
+  MockTarget target;
+  long before = allocations;
+  TEST_ASSERT_EQUAL_UINT16(WEATHER_UI_VARIABLES, ui.apply(data, target));
+  TEST_ASSERT_EQUAL_UINT32(WEATHER_UI_VARIABLES, target.variables.size());
+  long firstAllocations = allocations - before;
+  TEST_ASSERT_LESS_THAN(WEATHER_UI_STRINGS, firstAllocations);   // repeated short texts share a value
+
+  before = allocations;
+  TEST_ASSERT_EQUAL_UINT16(0, ui.apply(data, target));
+  TEST_ASSERT_EQUAL(0, allocations - before);
+  TEST_ASSERT_TRUE(matchesFullPush(target, data));
+  printf("weather_ui: first apply %d variables, %ld of %d strings allocated; unchanged apply 0 and 0\n",
+         WEATHER_UI_VARIABLES, firstAllocations, WEATHER_UI_STRINGS);
+}
+
+static void test_read_forward_and_fetches() {
+  long live = liveTexts;
+  weather_forecast_t forecast = {};
+  WeatherData data;
+  WeatherUi ui;
+  MockTarget target;
+  time_t now = SIM_START + 600;
+  fetch(forecast, now);
+  formatWeather(forecast, now, data);
+  ui.apply(data, target);
+
+  long pushed = 0, maxPushed = 0, allocated = 0;
+  time_t nextFetch = now + FETCH_EVERY_S;
+  for (int apply = 0; apply < SIM_APPLIES; apply++) {
+    // The next local hour or the next fetch, whichever comes first.
+    time_t nextHour = now - now % 3600 + 3600;
+    now = min(nextHour, nextFetch);
+    if (now == nextFetch) {
+      fetch(forecast, now);
+      nextFetch += FETCH_EVERY_S;
+    }
+    formatWeather(forecast, now, data);
+    long before = allocations;
+    long n = ui.apply(data, target);
+    allocated += allocations - before;
+    pushed += n;
+    maxPushed = max(maxPushed, n);
+    TEST_ASSERT_TRUE_MESSAGE(matchesFullPush(target, data), "variables differ from a full push");
+    // The pool and the variables hold every string there is.
+    TEST_ASSERT_LESS_OR_EQUAL(WEATHER_INTERN_SLOTS + WEATHER_UI_VARIABLES, liveTexts - live);
+  }
+
+  double perApply = (double)pushed / SIM_APPLIES;
+  double allocationsPerApply = (double)allocated / SIM_APPLIES;
+  TEST_ASSERT_LESS_THAN(WEATHER_UI_VARIABLES / 3.0, perApply);
+  TEST_ASSERT_LESS_OR_EQUAL(WEATHER_UI_VARIABLES, maxPushed);
+  TEST_ASSERT_LESS_THAN(2.0, allocationsPerApply);
+  TEST_ASSERT_EQUAL_UINT32(ui.varsPushed - WEATHER_UI_VARIABLES, pushed);
+  printf("weather_ui: %d changing applies, %.1f variables per apply (max %ld), %.2f strings allocated per apply, "
+         "intern hits=%lu misses=%lu; a full push is %d variables and %d strings\n",
+         SIM_APPLIES, perApply, maxPushed, allocationsPerApply, (unsigned long)ui.internHits,
+         (unsigned long)ui.internMisses, WEATHER_UI_VARIABLES, WEATHER_UI_STRINGS);
+}
+
+// More distinct short texts than slots: evicting a slot drops the pool's
+// reference, not the value a variable still shows.
+static void test_eviction_keeps_shown_values() {
+  long live = liveTexts;
+  weather_forecast_t forecast = {};
+  fetch(forecast, SIM_START + 600);
+  WeatherData data;
+  formatWeather(forecast, SIM_START + 600, data);
+  WeatherUi ui;
+  MockTarget target;
+  for (int round = 0; round < 20; round++) {
+    for (int i = 0; i < 10; i++) {
+      snprintf(data.daily[i].high, sizeof(data.daily[i].high), "%d°", (round * 20 + i) % 90 + 10);
+      snprintf(data.daily[i].low, sizeof(data.daily[i].low), "%d°", (round * 20 + i + 10) % 90 + 10);
+    }
+    ui.apply(data, target);
+    TEST_ASSERT_TRUE(matchesFullPush(target, data));
+  }
+  TEST_ASSERT_GREATER_THAN(WEATHER_INTERN_SLOTS, ui.internMisses);
+  TEST_ASSERT_LESS_OR_EQUAL(WEATHER_INTERN_SLOTS + WEATHER_UI_VARIABLES, liveTexts - live);
+}
+
+static void test_nothing_leaks() {
+  long live = liveTexts;
+  {
+    weather_forecast_t forecast = {};
+    fetch(forecast, SIM_START);
+    WeatherData data;
+    formatWeather(forecast, SIM_START, data);
+    WeatherUi ui;
+    MockTarget target;
+    ui.apply(data, target);
+    TEST_ASSERT_GREATER_THAN(live, liveTexts);
+  }
+  TEST_ASSERT_EQUAL(live, liveTexts);
+}
+
+int main(int argc, char **argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_first_apply_pushes_all_then_none);
+  RUN_TEST(test_read_forward_and_fetches);
+  RUN_TEST(test_eviction_keeps_shown_values);
+  RUN_TEST(test_nothing_leaks);
+  return UNITY_END();
+}